@@ -1582,7 +1582,18 @@ void MacroAssembler::check_klass_subtype_slow_path(Register sub_klass,
   br(Assembler::NE, *L_failure);
 
   // Success.  Cache the super we found and proceed in triumph.
+  // Skip the store when the cache already holds it, every thread checking
+  // against this sub_klass shares the cache line.
+  assert_different_registers(sub_klass, super_klass, rscratch2);
+  Label L_cached;
+  ldr(rscratch2, super_cache_addr);
+  cmp(rscratch2, super_klass);
+  br(Assembler::EQ, L_cached);
   str(super_klass, super_cache_addr);
+  if (set_cond_codes) {
+    cmp(super_klass, super_klass); // Z again on success
+  }
+  bind(L_cached);
 
   if (L_success != &L_fallthrough) {
     b(*L_success);
@@ -7338,6 +7338,69 @@ class StubGenerator: public StubCodeGenerator {
     return start;
   }
 
+  // Constant-time conditional assignment for
+  // sun.security.util.math.intpoly.IntegerPolynomial:
+  //
+  //   a[i] = set ? b[i] : a[i]   for i in [0, length)
+  //
+  // The only branches depend on the number of limbs, which is a
+  // property of the field and not secret. Every limb of both arrays
+  // is always loaded, and every limb of a is always stored.
+  address generate_intpoly_assign() {
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "intpoly_assign");
+    address start = __ pc();
+    __ enter();
+
+    // Arguments
+    const Register set    = c_rarg0;
+    const Register aLimbs = c_rarg1;
+    const Register bLimbs = c_rarg2;
+    const Register length = c_rarg3;
+
+    const Register mask = r4;
+    const Register a0 = r5, a1 = r6, b0 = r7, b1 = r10;
+
+    Label L_pairs, L_tail, L_done;
+
+    // mask = set ? -1 : 0
+    __ sxtw(mask, set);
+    __ neg(mask, mask);
+
+    __ subsw(length, length, 2);
+    __ br(Assembler::LT, L_tail);
+
+    __ bind(L_pairs);
+    __ ldp(a0, a1, Address(aLimbs));
+    __ ldp(b0, b1, __ post(bLimbs, 2 * wordSize));
+    // a ^= mask & (a ^ b)
+    __ eor(b0, b0, a0);
+    __ eor(b1, b1, a1);
+    __ andr(b0, b0, mask);
+    __ andr(b1, b1, mask);
+    __ eor(a0, a0, b0);
+    __ eor(a1, a1, b1);
+    __ stp(a0, a1, __ post(aLimbs, 2 * wordSize));
+    __ subsw(length, length, 2);
+    __ br(Assembler::GE, L_pairs);
+
+    // length is now -1 if one limb is left, -2 otherwise.
+    __ bind(L_tail);
+    __ tbz(length, 0, L_done);
+    __ ldr(a0, Address(aLimbs));
+    __ ldr(b0, Address(bLimbs));
+    __ eor(b0, b0, a0);
+    __ andr(b0, b0, mask);
+    __ eor(a0, a0, b0);
+    __ str(a0, Address(aLimbs));
+
+    __ bind(L_done);
+    __ leave();
+    __ ret(lr);
+
+    return start;
+  }
+
   // exception handler for upcall stubs
   address generate_upcall_stub_exception_handler() {
     StubCodeMark mark(this, "StubRoutines", "upcall stub exception handler");
@@ -8256,6 +8319,10 @@ class StubGenerator: public StubCodeGenerator {
       StubRoutines::_poly1305_processBlocks = generate_poly1305_processBlocks();
     }
 
+    if (UseIntPolyIntrinsics) {
+      StubRoutines::_intpoly_assign = generate_intpoly_assign();
+    }
+
 #if defined (LINUX) && !defined (__ARM_FEATURE_ATOMICS)
 
     generate_atomic_entry_points();
@@ -574,6 +574,11 @@ void VM_Version::initialize() {
   if (FLAG_IS_DEFAULT(UsePoly1305Intrinsics)) {
     FLAG_SET_DEFAULT(UsePoly1305Intrinsics, true);
   }
+
+  // Only intpoly_assign has a stub, the P-256 Montgomery multiply stays in Java
+  if (FLAG_IS_DEFAULT(UseIntPolyIntrinsics)) {
+    FLAG_SET_DEFAULT(UseIntPolyIntrinsics, true);
+  }
 #endif
 
   _spin_wait = get_spin_wait_desc();
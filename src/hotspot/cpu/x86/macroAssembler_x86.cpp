@@ -4740,7 +4740,16 @@ void MacroAssembler::check_klass_subtype_slow_path(Register sub_klass,
   else  jcc(Assembler::notEqual, *L_failure);
 
   // Success.  Cache the super we found and proceed in triumph.
+  // Skip the store when the cache already holds it, every thread checking
+  // against this sub_klass shares the cache line.
+  Label L_cached;
+  cmpptr(super_klass, super_cache_addr);
+  jccb(Assembler::equal, L_cached);
   movptr(super_cache_addr, super_klass);
+  if (set_cond_codes) {
+    cmpptr(super_klass, super_klass); // Z again on success
+  }
+  bind(L_cached);
 
   if (L_success != &L_fallthrough) {
     jmp(*L_success);
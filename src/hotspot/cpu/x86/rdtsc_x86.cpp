@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -24,10 +24,13 @@
 
 #include "precompiled.hpp"
 #include "rdtsc_x86.hpp"
+#include "logging/log.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/globals_extension.hpp"
 #include "runtime/javaThread.hpp"
 #include "runtime/os.inline.hpp"
 #include "runtime/orderAccess.hpp"
+#include "runtime/task.hpp"
 #include "vm_version_x86.hpp"
 
 static jlong _epoch = 0;
@@ -208,3 +211,214 @@ bool Rdtsc::initialize() {
   }
   return rdtsc_elapsed_counter_enabled;
 }
+
+#if defined(LINUX) && defined(_LP64)
+
+// The conversion is a line through (nanos_tsc_base, nanos_base) with slope
+// nanos_mult. It is re-fitted against the OS clock every
+// NANOS_CHECK_INTERVAL_MILLISECS, and readers use a sequence lock to see a
+// consistent set of parameters: an odd nanos_seq means an update is in
+// progress.
+static volatile bool nanos_enabled = false;
+static volatile jlong nanos_seq = 0;
+static volatile jlong nanos_base = 0;      // nanos() at nanos_tsc_base
+static volatile jlong nanos_tsc_base = 0;  // tsc of the last update
+static volatile jlong nanos_mult = 0;      // nanoseconds per tick, 32.32 fixed point
+static volatile bool nanos_use_os_clock = false;  // set when the kernel gives up the tsc
+static volatile jlong nanos_os_offset = 0;        // nanos() - OS clock, once on the OS clock
+
+static jlong nanos_calibration_start = 0;  // OS clock at the start of calibration
+static jlong nanos_calibration_tsc = 0;    // tsc at the start of calibration
+
+static const jlong NANOS_CALIBRATION_MILLISECS = 20;
+static const int   NANOS_CHECK_INTERVAL_MILLISECS = 1000;
+// The slope may differ from the measured frequency by at most 1/NANOS_MAX_SLEW
+// while an offset from the OS clock is being corrected.
+static const jlong NANOS_MAX_SLEW = 2000;
+
+// The kernel only keeps the tsc as its clocksource if it passed the boot
+// time synchronization checks between cpus and the clocksource watchdog
+// has not found it unstable since.
+static bool kernel_uses_tsc_clocksource() {
+  FILE* f = os::fopen("/sys/devices/system/clocksource/clocksource0/current_clocksource", "r");
+  if (f == nullptr) {
+    return false;
+  }
+  char buf[32];
+  bool result = fgets(buf, sizeof(buf), f) != nullptr && strcmp(buf, "tsc\n") == 0;
+  fclose(f);
+  return result;
+}
+
+// The clock javaTimeNanos() uses when the tsc is not used.
+static jlong os_clock_nanos() {
+  struct timespec tp;
+  int status = clock_gettime(CLOCK_MONOTONIC, &tp);
+  assert(status == 0, "clock_gettime error: %s", os::strerror(errno));
+  return jlong(tp.tv_sec) * NANOSECS_PER_SEC + jlong(tp.tv_nsec);
+}
+
+// A plain rdtsc can execute before earlier loads have completed, so a time
+// stamp could be taken before the event it is meant to follow. rdtscp waits
+// for all earlier instructions, and lfence does the same for a plain rdtsc.
+static inline jlong ordered_rdtsc() {
+  uint32_t lo, hi;
+  if (VM_Version::supports_rdtscp()) {
+    uint32_t aux;
+    __asm__ __volatile__ ("rdtscp" : "=a" (lo), "=d" (hi), "=c" (aux) : : "memory");
+  } else {
+    __asm__ __volatile__ ("lfence; rdtsc" : "=a" (lo), "=d" (hi) : : "memory");
+  }
+  return (jlong)(((uint64_t)hi << 32) | lo);
+}
+
+// Read the OS clock and the tsc at (approximately) the same instant by
+// bracketing the clock read with two tsc reads.
+static void sample_nanos_and_tsc(jlong& nanos, jlong& tsc) {
+  const jlong before = ordered_rdtsc();
+  nanos = os_clock_nanos();
+  const jlong after = ordered_rdtsc();
+  tsc = before + (after - before) / 2;
+}
+
+static jlong tsc_to_nanos(jlong tsc, jlong base, jlong tsc_base, jlong mult) {
+  return base + (jlong)(((__int128)(tsc - tsc_base) * mult) >> 32);
+}
+
+// Only called by the WatcherThread, the one writer after initialization.
+static void begin_nanos_update() {
+  Atomic::release_store(&nanos_seq, nanos_seq + 1);
+  OrderAccess::storestore();
+}
+
+static void end_nanos_update() {
+  Atomic::release_store(&nanos_seq, nanos_seq + 1);
+}
+
+// Re-fits the conversion so that it matches the OS clock again by the next
+// check. The new line starts where the old one is now, so nanos() does not
+// jump. Its slope is the frequency measured since calibration, corrected by
+// at most 1/NANOS_MAX_SLEW to take back the current offset from the OS clock.
+// The offset is therefore taken back by one interval as long as it stays
+// below NANOS_CHECK_INTERVAL_MILLISECS / NANOS_MAX_SLEW (500us).
+static void recalibrate_nanos() {
+  jlong os_now, tsc_now;
+  sample_nanos_and_tsc(os_now, tsc_now);
+  const jlong tsc_base = nanos_tsc_base;
+  if (tsc_now <= tsc_base || tsc_now <= nanos_calibration_tsc || os_now <= nanos_calibration_start) {
+    return;
+  }
+  const jlong now = tsc_to_nanos(tsc_now, nanos_base, tsc_base, nanos_mult);
+  const jlong measured = (jlong)(((__int128)(os_now - nanos_calibration_start) << 32) /
+                                 (tsc_now - nanos_calibration_tsc));
+  // Ticks until the next check, estimated from the interval just ended
+  const jlong interval = tsc_now - tsc_base;
+  const jlong max_slew = measured / NANOS_MAX_SLEW;
+  const jlong correction = (jlong)(((__int128)(os_now - now) << 32) / interval);
+  const jlong mult = measured + clamp(correction, -max_slew, max_slew);
+
+  begin_nanos_update();
+  Atomic::store(&nanos_base, now);
+  Atomic::store(&nanos_tsc_base, tsc_now);
+  Atomic::store(&nanos_mult, mult);
+  end_nanos_update();
+  log_trace(os)("tsc nanos offset from the OS clock: " JLONG_FORMAT " ns", now - os_now);
+}
+
+// Continues nanos() from its current value on top of the OS clock.
+static void switch_nanos_to_os_clock() {
+  jlong os_now, tsc_now;
+  sample_nanos_and_tsc(os_now, tsc_now);
+  const jlong now = tsc_to_nanos(tsc_now, nanos_base, nanos_tsc_base, nanos_mult);
+
+  begin_nanos_update();
+  Atomic::store(&nanos_os_offset, now - os_now);
+  Atomic::store(&nanos_use_os_clock, true);
+  end_nanos_update();
+  log_warning(os)("The kernel no longer uses tsc as its clock source, javaTimeNanos uses clock_gettime");
+}
+
+class TscNanosCheckTask : public PeriodicTask {
+ public:
+  TscNanosCheckTask() : PeriodicTask(NANOS_CHECK_INTERVAL_MILLISECS) {}
+
+  void task() {
+    if (nanos_use_os_clock) {
+      return;
+    }
+    // The clocksource watchdog switches away from a tsc it finds unstable
+    if (!kernel_uses_tsc_clocksource()) {
+      switch_nanos_to_os_clock();
+      return;
+    }
+    recalibrate_nanos();
+  }
+};
+
+void Rdtsc::initialize_nanos() {
+  assert(UseTSCForNanoTime, "invariant");
+  assert(!nanos_enabled, "invariant");
+  if (!is_supported()) {
+    warning("Ignoring UseTSCForNanoTime, hardware does not support invariant tsc");
+    FLAG_SET_DEFAULT(UseTSCForNanoTime, false);
+    return;
+  }
+  if (!kernel_uses_tsc_clocksource()) {
+    warning("Ignoring UseTSCForNanoTime, the kernel does not use tsc as its clock source");
+    FLAG_SET_DEFAULT(UseTSCForNanoTime, false);
+    return;
+  }
+
+  jlong nanos_start, tsc_start, nanos_end, tsc_end;
+  sample_nanos_and_tsc(nanos_start, tsc_start);
+  os::naked_short_sleep(NANOS_CALIBRATION_MILLISECS);
+  sample_nanos_and_tsc(nanos_end, tsc_end);
+
+  if (tsc_end <= tsc_start || nanos_end <= nanos_start) {
+    warning("Ignoring UseTSCForNanoTime, tsc calibration failed");
+    FLAG_SET_DEFAULT(UseTSCForNanoTime, false);
+    return;
+  }
+
+  nanos_calibration_start = nanos_start;
+  nanos_calibration_tsc = tsc_start;
+  nanos_mult = (jlong)(((__int128)(nanos_end - nanos_start) << 32) / (tsc_end - tsc_start));
+  nanos_base = nanos_end;
+  nanos_tsc_base = tsc_end;
+  Atomic::release_store(&nanos_enabled, true);
+  // Started by the WatcherThread once it runs
+  TscNanosCheckTask* task = new TscNanosCheckTask();
+  task->enroll();
+  log_info(os)("Using tsc for javaTimeNanos, " JLONG_FORMAT " ticks per millisecond",
+               (jlong)(((__int128)(tsc_end - tsc_start) * NANOSECS_PER_MILLISEC) / (nanos_end - nanos_start)));
+}
+
+bool Rdtsc::is_nanos_enabled() {
+  return nanos_enabled;
+}
+
+// Continues from the OS clock value sampled at calibration, so switching
+// javaTimeNanos() over to the tsc does not make it jump.
+jlong Rdtsc::nanos() {
+  assert(nanos_enabled, "invariant");
+  while (true) {
+    const jlong seq = Atomic::load_acquire(&nanos_seq);
+    if ((seq & 1) != 0) {
+      SpinPause();
+      continue;
+    }
+    jlong result;
+    if (Atomic::load(&nanos_use_os_clock)) {
+      result = os_clock_nanos() + Atomic::load(&nanos_os_offset);
+    } else {
+      result = tsc_to_nanos(ordered_rdtsc(), Atomic::load(&nanos_base),
+                            Atomic::load(&nanos_tsc_base), Atomic::load(&nanos_mult));
+    }
+    OrderAccess::loadload();
+    if (Atomic::load(&nanos_seq) == seq) {
+      return result;
+    }
+  }
+}
+
+#endif // defined(LINUX) && defined(_LP64)
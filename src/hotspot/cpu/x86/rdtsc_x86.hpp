@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -46,6 +46,15 @@ class Rdtsc : AllStatic {
   static bool  is_elapsed_counter_enabled(); // turn off with -XX:-UseFastUnorderedTimeStamps
   static jlong epoch();
   static bool  initialize();
+
+  // Calibrated tsc to nanoseconds conversion backing os::javaTimeNanos()
+  // when UseTSCForNanoTime is set. Unlike elapsed_counter() this requires
+  // the OS to consider the tsc synchronized across all cpus. A periodic
+  // task re-fits the conversion against the OS clock, and moves nanos()
+  // over to the OS clock if the kernel stops using the tsc.
+  static void  initialize_nanos();
+  static bool  is_nanos_enabled();
+  static jlong nanos();
 };
 
 #endif // CPU_X86_RDTSC_X86_HPP
@@ -33,6 +33,7 @@
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
+#include "rdtsc_x86.hpp"
 #include "runtime/globals_extension.hpp"
 #include "runtime/java.hpp"
 #include "runtime/os.inline.hpp"
@@ -2205,6 +2206,12 @@ void VM_Version::initialize() {
     check_virtualizations();
   }
   _vm_version_initialized = true;
+
+#if defined(LINUX) && defined(_LP64)
+  if (UseTSCForNanoTime) {
+    Rdtsc::initialize_nanos();
+  }
+#endif
 }
 
 typedef enum {
@@ -95,6 +95,19 @@
   product(bool, PrintMemoryMapAtExit, false, DIAGNOSTIC,                \
           "Print an annotated memory map at exit")                      \
                                                                         \
+  product(bool, UseRseq, false, EXPERIMENTAL,                           \
+          "Read the current processor and NUMA node from the rseq area "\
+          "the C library registered for the thread instead of calling " \
+          "getcpu")                                                     \
+                                                                        \
+  product(uint, PreStartedJavaThreads, 0, EXPERIMENTAL,                 \
+          "Number of threads with the default Java thread stack size "  \
+          "kept created and parked, so that starting a Java thread can "\
+          "take one of them instead of calling pthread_create. The "    \
+          "pool is filled a few threads at a time by starting Java "    \
+          "threads and released at VM exit")                            \
+          range(0, 64)                                                  \
+                                                                        \
 // end of RUNTIME_OS_FLAGS
 
 //
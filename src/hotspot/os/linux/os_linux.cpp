@@ -120,6 +120,7 @@
 # include <sys/ioctl.h>
 # include <linux/elf-em.h>
 # include <sys/prctl.h>
+# include <sys/auxv.h>
 #ifdef __GLIBC__
 # include <malloc.h>
 #endif
@@ -791,6 +792,144 @@ bool os::Linux::manually_expand_stack(JavaThread * t, address addr) {
 //////////////////////////////////////////////////////////////////////////////
 // create new thread
 
+//////////////////////////////////////////////////////////////////////////////
+// pool of pre-started threads (see PreStartedJavaThreads)
+//
+// Pooled threads are created with the attributes of a default sized Java
+// thread and park on their own semaphore until os::create_thread() hands
+// them a Thread to run. From then on they behave exactly like a thread
+// created by os::create_thread() itself.
+//
+// The pool is filled by newly started Java threads, never by the thread
+// calling os::create_thread(), and each of them creates at most
+// thread_pool_fill_batch threads. The idle threads are released in
+// before_exit().
+
+class PooledThread : public CHeapObj<mtThread> {
+ public:
+  pthread_t       _tid;
+  Thread*         _thread;  // null when released unused
+  PooledThread*   _next;
+  PosixSemaphore  _assigned;
+
+  PooledThread() : _tid(0), _thread(nullptr), _next(nullptr), _assigned(0) {}
+};
+
+static const uint thread_pool_fill_batch = 4;
+
+static pthread_mutex_t thread_pool_lock = PTHREAD_MUTEX_INITIALIZER;
+static PooledThread* thread_pool_head = nullptr;
+static uint thread_pool_count = 0;      // idle plus being created, protected by thread_pool_lock
+static size_t thread_pool_stack_size = 0;  // 0 until the first default sized Java thread
+static size_t thread_pool_guard_size = 0;
+static volatile bool thread_pool_needs_fill = false;
+static bool thread_pool_drained = false;  // protected by thread_pool_lock
+
+static void *thread_native_entry(Thread *thread);
+
+static void* pooled_thread_entry(PooledThread* pooled) {
+  pooled->_assigned.wait();
+  Thread* thread = pooled->_thread;
+  delete pooled;
+  if (thread == nullptr) {
+    // Released by os::Linux::drain_thread_pool()
+    return nullptr;
+  }
+  return thread_native_entry(thread);
+}
+
+// Create up to thread_pool_fill_batch threads towards PreStartedJavaThreads.
+static void fill_thread_pool() {
+  pthread_mutex_lock(&thread_pool_lock);
+  const size_t stack_size = thread_pool_stack_size;
+  const size_t guard_size = thread_pool_guard_size;
+  pthread_mutex_unlock(&thread_pool_lock);
+
+  pthread_attr_t attr;
+  if (pthread_attr_init(&attr) != 0) {
+    return;
+  }
+  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+  pthread_attr_setguardsize(&attr, guard_size);
+  if (pthread_attr_setstacksize(&attr, stack_size) != 0) {
+    pthread_attr_destroy(&attr);
+    return;
+  }
+
+  pthread_mutex_lock(&thread_pool_lock);
+  for (uint created = 0; created < thread_pool_fill_batch; created++) {
+    if (thread_pool_drained || thread_pool_count >= PreStartedJavaThreads) {
+      Atomic::store(&thread_pool_needs_fill, false);
+      break;
+    }
+    thread_pool_count++;
+    pthread_mutex_unlock(&thread_pool_lock);
+
+    PooledThread* pooled = new (std::nothrow) PooledThread();
+    int ret = (pooled == nullptr) ? ENOMEM :
+              pthread_create(&pooled->_tid, &attr, (void* (*)(void*)) pooled_thread_entry, pooled);
+
+    pthread_mutex_lock(&thread_pool_lock);
+    if (ret != 0) {
+      delete pooled;
+      thread_pool_count--;
+      log_info(os, thread)("Failed to pre-start pooled thread (%s)", os::errno_name(ret));
+      break;
+    }
+    if (thread_pool_drained) {
+      // Drained while this one was being created
+      thread_pool_count--;
+      pooled->_assigned.signal();
+      continue;
+    }
+    pooled->_next = thread_pool_head;
+    thread_pool_head = pooled;
+  }
+  pthread_mutex_unlock(&thread_pool_lock);
+
+  pthread_attr_destroy(&attr);
+}
+
+// Take an idle pooled thread created with the given stack and guard sizes,
+// or return null. The first call records the sizes.
+static PooledThread* take_pooled_thread(size_t stack_size, size_t guard_size) {
+  pthread_mutex_lock(&thread_pool_lock);
+  if (thread_pool_stack_size == 0) {
+    thread_pool_stack_size = stack_size;
+    thread_pool_guard_size = guard_size;
+  }
+  PooledThread* pooled = nullptr;
+  if (stack_size == thread_pool_stack_size && guard_size == thread_pool_guard_size) {
+    pooled = thread_pool_head;
+    if (pooled != nullptr) {
+      thread_pool_head = pooled->_next;
+      thread_pool_count--;
+    }
+    if (!thread_pool_drained && thread_pool_count < PreStartedJavaThreads) {
+      // Topped up by the next Java thread to start
+      Atomic::store(&thread_pool_needs_fill, true);
+    }
+  }
+  pthread_mutex_unlock(&thread_pool_lock);
+  return pooled;
+}
+
+void os::Linux::drain_thread_pool() {
+  pthread_mutex_lock(&thread_pool_lock);
+  thread_pool_drained = true;
+  Atomic::store(&thread_pool_needs_fill, false);
+  PooledThread* pooled = thread_pool_head;
+  thread_pool_head = nullptr;
+  while (pooled != nullptr) {
+    PooledThread* next = pooled->_next;
+    thread_pool_count--;
+    // The thread frees its PooledThread and exits
+    pooled->_assigned.signal();
+    pooled = next;
+  }
+  pthread_mutex_unlock(&thread_pool_lock);
+}
+
 // Thread start routine for all newly created threads
 static void *thread_native_entry(Thread *thread) {
 
@@ -854,6 +993,12 @@ static void *thread_native_entry(Thread *thread) {
     os::naked_short_sleep(100);
   }
 
+  // Java threads top up the pool of pre-started threads themselves, so that
+  // the thread calling os::create_thread() does not pay for it.
+  if (Atomic::load(&thread_pool_needs_fill) && thread->is_Java_thread()) {
+    fill_thread_pool();
+  }
+
   // call one more level start routine
   thread->call_run();
 
@@ -1044,14 +1189,26 @@ bool os::create_thread(Thread* thread, ThreadType thr_type,
 
   ThreadState state;
 
+  PooledThread* pooled = nullptr;
+  if (PreStartedJavaThreads > 0 && thr_type == java_thread && req_stack_size == 0) {
+    pooled = take_pooled_thread(stack_size, guard_size);
+  }
+
   {
     ResourceMark rm;
     pthread_t tid;
     int ret = 0;
-    int limit = 3;
-    do {
-      ret = pthread_create(&tid, &attr, (void* (*)(void*)) thread_native_entry, thread);
-    } while (ret == EAGAIN && limit-- > 0);
+    if (pooled != nullptr) {
+      tid = pooled->_tid;
+      pooled->_thread = thread;
+      // The pooled thread owns and frees its PooledThread from here on.
+      pooled->_assigned.signal();
+    } else {
+      int limit = 3;
+      do {
+        ret = pthread_create(&tid, &attr, (void* (*)(void*)) thread_native_entry, thread);
+      } while (ret == EAGAIN && limit-- > 0);
+    }
 
     char buf[64];
     if (ret == 0) {
@@ -3095,6 +3252,10 @@ size_t os::numa_get_groups_num() {
 }
 
 int os::numa_get_group_id() {
+  int node_id = Linux::rseq_node_id();
+  if (node_id != -1) {
+    return node_id;
+  }
   int cpu_id = Linux::sched_getcpu();
   if (cpu_id != -1) {
     int lgrp_id = Linux::get_node_by_cpu(cpu_id);
@@ -3193,6 +3354,80 @@ void os::Linux::sched_getcpu_init() {
   }
 }
 
+// Restartable sequences (rseq) make the kernel keep the current CPU and,
+// on Linux 6.3 and later, the current NUMA node of a thread in a per-thread
+// area in user memory, so reading them is a plain load instead of a getcpu
+// call. glibc 2.35 and later registers that area for every thread and
+// exports its location relative to the thread pointer in __rseq_offset and
+// __rseq_size. Only that area is used. A thread can register a single area,
+// and a libc that does not register one leaves the registration to
+// libraries such as tcmalloc or librseq, so HotSpot never registers its own.
+
+#ifndef AT_RSEQ_FEATURE_SIZE
+  #define AT_RSEQ_FEATURE_SIZE 27
+#endif
+
+// Layout of the kernel's struct rseq (include/uapi/linux/rseq.h)
+struct RseqArea {
+  volatile uint32_t cpu_id_start;
+  volatile int32_t  cpu_id;
+  volatile uint64_t rseq_cs;
+  volatile uint32_t flags;
+  volatile uint32_t node_id;
+  volatile uint32_t mm_cid;
+};
+
+static bool      rseq_enabled = false;
+static bool      rseq_has_node_id = false;
+static ptrdiff_t rseq_libc_offset = 0;
+
+static char* rseq_thread_pointer() {
+#if defined(AMD64)
+  char* tp;
+  __asm__ volatile ("mov %%fs:0, %0" : "=r" (tp));
+  return tp;
+#elif defined(AARCH64)
+  return (char*) __builtin_thread_pointer();
+#else
+  return nullptr;
+#endif
+}
+
+void os::Linux::rseq_init() {
+  const size_t node_id_end = offset_of(RseqArea, node_id) + sizeof(uint32_t);
+  const unsigned int* libc_size = (const unsigned int*) dlsym(RTLD_DEFAULT, "__rseq_size");
+  const ptrdiff_t* libc_offset = (const ptrdiff_t*) dlsym(RTLD_DEFAULT, "__rseq_offset");
+  // __rseq_size is 0 when the libc did not register, for example because of
+  // the glibc.pthread.rseq tunable.
+  if (libc_size != nullptr && libc_offset != nullptr && *libc_size > 0 &&
+      rseq_thread_pointer() != nullptr) {
+    rseq_libc_offset = *libc_offset;
+    rseq_enabled = true;
+    // Older glibc versions only promise the original 20 byte layout.
+    rseq_has_node_id = *libc_size >= node_id_end &&
+                       getauxval(AT_RSEQ_FEATURE_SIZE) >= node_id_end;
+  }
+  log_info(os)("rseq is %s%s", rseq_enabled ? "enabled, registered by libc" : "not available",
+               rseq_has_node_id ? ", with NUMA node id" : "");
+}
+
+static RseqArea* rseq_area() {
+  if (!rseq_enabled) {
+    return nullptr;
+  }
+  return (RseqArea*) (rseq_thread_pointer() + rseq_libc_offset);
+}
+
+int os::Linux::rseq_cpu_id() {
+  RseqArea* area = rseq_area();
+  return area != nullptr ? area->cpu_id : -1;
+}
+
+int os::Linux::rseq_node_id() {
+  RseqArea* area = rseq_has_node_id ? rseq_area() : nullptr;
+  return area != nullptr && area->cpu_id >= 0 ? (int) area->node_id : -1;
+}
+
 // Something to do with the numa-aware allocator needs these symbols
 extern "C" JNIEXPORT void numa_warn(int number, char *where, ...) { }
 extern "C" JNIEXPORT void numa_error(char *where) { }
@@ -4650,6 +4885,9 @@ jint os::init_2(void) {
 
   Linux::libpthread_init();
   Linux::sched_getcpu_init();
+  if (UseRseq) {
+    Linux::rseq_init();
+  }
   log_info(os)("HotSpot is running with %s, %s",
                Linux::libc_version(), Linux::libpthread_version());
 
@@ -4885,7 +5123,10 @@ static bool should_warn_invalid_processor_id() {
 }
 
 uint os::processor_id() {
-  const int id = Linux::sched_getcpu();
+  int id = Linux::rseq_cpu_id();
+  if (id < 0) {
+    id = Linux::sched_getcpu();
+  }
 
   if (id < processor_count()) {
     return (uint)id;
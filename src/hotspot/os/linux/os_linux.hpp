@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1999, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1999, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -123,6 +123,13 @@ class os::Linux {
 
   static void libpthread_init();
   static void sched_getcpu_init();
+  static void rseq_init();
+  // Current CPU and NUMA node from the thread's rseq area, -1 if not available
+  static int rseq_cpu_id();
+  static int rseq_node_id();
+  // Releases the idle threads pre-started for PreStartedJavaThreads and
+  // stops starting new ones.
+  static void drain_thread_pool();
   static bool libnuma_init();
   static void* libnuma_dlsym(void* handle, const char* name);
   // libnuma v2 (libnuma_1.2) symbols
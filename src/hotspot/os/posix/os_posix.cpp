@@ -39,6 +39,7 @@
 #include "runtime/osThread.hpp"
 #include "runtime/park.hpp"
 #include "runtime/perfMemory.hpp"
+#include "runtime/safepointMechanism.inline.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "services/attachListener.hpp"
 #include "utilities/align.hpp"
@@ -60,6 +61,9 @@
 #endif
 #ifdef LINUX
 #include "os_linux.hpp"
+#if defined(X86) && defined(_LP64) && !defined(ZERO)
+#include "rdtsc_x86.hpp"
+#endif
 #endif
 
 #include <dirent.h>
@@ -1512,6 +1516,11 @@ void os::javaTimeSystemUTC(jlong &seconds, jlong &nanos) {
 #if !defined(__APPLE__) && !defined(AIX)
 
 jlong os::javaTimeNanos() {
+#if defined(LINUX) && defined(X86) && defined(_LP64) && !defined(ZERO)
+  if (Rdtsc::is_nanos_enabled()) {
+    return Rdtsc::nanos();
+  }
+#endif
   struct timespec tp;
   int status = clock_gettime(CLOCK_MONOTONIC, &tp);
   assert(status == 0, "clock_gettime error: %s", os::strerror(errno));
@@ -1797,6 +1806,21 @@ void Parker::park(bool isAbsolute, jlong time) {
     to_abstime(&absTime, time, isAbsolute, false);
   }
 
+  // Optionally spin for a short while before blocking. A thread that is unparked
+  // during the spin, typically an idle carrier thread that is handed new work, then
+  // returns without a round trip through the kernel on either side: unpark() only
+  // signals the condition variable of a thread that is blocked on it.
+  for (int i = 0; i < ParkSpinIterations; i++) {
+    if (Atomic::load(&_counter) > 0 && Atomic::xchg(&_counter, 0) > 0) {
+      return;
+    }
+    // We spin in the VM state, so don't delay a safepoint.
+    if ((i & 0xFF) == 0 && (SafepointMechanism::local_poll_armed(jt) || jt->is_interrupted(false))) {
+      break;
+    }
+    SpinPause();
+  }
+
   // Enter safepoint region
   // Beware of deadlocks such as 6317397.
   // The per-thread Parker:: mutex is a classic leaf-lock.
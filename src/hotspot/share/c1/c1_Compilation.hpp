@@ -265,8 +265,11 @@ class Compilation: public StackObj {
 
   // will compilation make optimistic assumptions that might lead to
   // deoptimization and that the runtime will account for?
+  // With C1TieredLoopOptimizations, tier 2 and 3 code is optimized too: a
+  // failed assumption deoptimizes into the interpreter, which keeps
+  // profiling, and the recompiled method is no longer optimistic.
   bool is_optimistic() {
-    return CompilerConfig::is_c1_only_no_jvmci() && !is_profiling() &&
+    return ((CompilerConfig::is_c1_only_no_jvmci() && !is_profiling()) || C1TieredLoopOptimizations) &&
       (RangeCheckElimination || UseLoopInvariantCodeMotion) &&
       method()->method_data()->trap_count(Deoptimization::Reason_none) == 0;
   }
@@ -104,6 +104,11 @@
   product(bool, UseLoopInvariantCodeMotion, true,                           \
           "Simple loop invariant code motion for short loops during GVN")   \
                                                                             \
+  product(bool, C1TieredLoopOptimizations, false, EXPERIMENTAL,             \
+          "Also use range check elimination and loop invariant code "       \
+          "motion, which deoptimize if their assumptions fail, for C1 "     \
+          "compilations at all tiers with tiered compilation")              \
+                                                                            \
   develop(bool, TracePredicateFailedTraps, false,                           \
           "trace runtime traps caused by predicate failure")                \
                                                                             \
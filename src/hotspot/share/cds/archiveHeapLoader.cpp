@@ -220,6 +220,13 @@ void ArchiveHeapLoader::init_loaded_heap_relocation(LoadedArchiveHeapRegion* loa
   _runtime_offset = loaded_region->_runtime_offset;
 }
 
+bool ArchiveHeapLoader::can_map() {
+  if (!UseCompressedClassPointers) {
+    return false;
+  }
+  return Universe::heap()->can_map_archived_objects();
+}
+
 bool ArchiveHeapLoader::can_load() {
   if (!UseCompressedOops) {
     // Pointer relocation for uncompressed oops is unimplemented.
@@ -42,17 +42,15 @@ class ArchiveHeapLoader : AllStatic {
 public:
   // At runtime, the heap region in the CDS archive can be used in two different ways,
   // depending on the GC type:
-  // - Mapped: (G1 only) the region is directly mapped into the Java heap
+  // - Mapped: (G1 and Shenandoah) the region is directly mapped into the Java heap
   // - Loaded: At VM start-up, the objects in the heap region are copied into the
   //           Java heap. This is easier to implement than mapping but
   //           slightly less efficient, as the embedded pointers need to be relocated.
   static bool can_use() { return can_map() || can_load(); }
 
-  // Can this VM map archived heap region? Currently only G1+compressed{oops,cp}
-  static bool can_map() {
-    CDS_JAVA_HEAP_ONLY(return (UseG1GC && UseCompressedClassPointers);)
-    NOT_CDS_JAVA_HEAP(return false;)
-  }
+  // Can this VM map archived heap region? Requires compressed class pointers and
+  // a region-based collector that can place the region at the top of its heap.
+  static bool can_map() NOT_CDS_JAVA_HEAP_RETURN_(false);
 
   // Can this VM load the objects from archived heap region into the heap at start-up?
   static bool can_load()  NOT_CDS_JAVA_HEAP_RETURN_(false);
@@ -2025,8 +2025,7 @@ void FileMapInfo::map_or_load_heap_region() {
       success = ArchiveHeapLoader::load_heap_region(this);
     } else {
       if (!UseCompressedOops && !ArchiveHeapLoader::can_map()) {
-        // TODO - remove implicit knowledge of G1
-        log_info(cds)("Cannot use CDS heap data. UseG1GC is required for -XX:-UseCompressedOops");
+        log_info(cds)("Cannot use CDS heap data. UseG1GC or UseShenandoahGC is required for -XX:-UseCompressedOops");
       } else {
         log_info(cds)("Cannot use CDS heap data. UseEpsilonGC, UseG1GC, UseSerialGC, UseParallelGC, or UseShenandoahGC are required.");
       }
@@ -2076,9 +2075,9 @@ bool FileMapInfo::can_use_heap_region() {
                 CompressedOops::mode(), p2i(CompressedOops::base()), CompressedOops::shift());
   log_info(cds)("    heap range = [" PTR_FORMAT " - "  PTR_FORMAT "]",
                 UseCompressedOops ? p2i(CompressedOops::begin()) :
-                                    UseG1GC ? p2i((address)G1CollectedHeap::heap()->reserved().start()) : 0L,
+                                    p2i((address)Universe::heap()->reserved_region().start()),
                 UseCompressedOops ? p2i(CompressedOops::end()) :
-                                    UseG1GC ? p2i((address)G1CollectedHeap::heap()->reserved().end()) : 0L);
+                                    p2i((address)Universe::heap()->reserved_region().end()));
 
   assert(archive_narrow_klass_base == CompressedKlassPointers::base(), "Unexpected encoding base encountered "
          "(" PTR_FORMAT ", expected " PTR_FORMAT ")", p2i(CompressedKlassPointers::base()), p2i(archive_narrow_klass_base));
@@ -2132,20 +2131,23 @@ address FileMapInfo::heap_region_requested_address() {
 bool FileMapInfo::map_heap_region() {
   if (map_heap_region_impl()) {
 #ifdef ASSERT
-    // The "old" regions must be parsable -- we cannot have any unused space
-    // at the start of the lowest G1 region that contains archived objects.
-    assert(is_aligned(_mapped_heap_memregion.start(), G1HeapRegion::GrainBytes), "must be");
-
     // Make sure we map at the very top of the heap - see comments in
     // init_heap_region_relocation().
-    MemRegion heap_range = G1CollectedHeap::heap()->reserved();
+    MemRegion heap_range = Universe::heap()->reserved_region();
     assert(heap_range.contains(_mapped_heap_memregion), "must be");
 
     address heap_end = (address)heap_range.end();
     address mapped_heap_region_end = (address)_mapped_heap_memregion.end();
     assert(heap_end >= mapped_heap_region_end, "must be");
-    assert(heap_end - mapped_heap_region_end < (intx)(G1HeapRegion::GrainBytes),
-           "must be at the top of the heap to avoid fragmentation");
+#if INCLUDE_G1GC
+    if (UseG1GC) {
+      // The "old" regions must be parsable -- we cannot have any unused space
+      // at the start of the lowest G1 region that contains archived objects.
+      assert(is_aligned(_mapped_heap_memregion.start(), G1HeapRegion::GrainBytes), "must be");
+      assert(heap_end - mapped_heap_region_end < (intx)(G1HeapRegion::GrainBytes),
+             "must be at the top of the heap to avoid fragmentation");
+    }
+#endif
 #endif
 
     ArchiveHeapLoader::set_mapped();
@@ -2156,7 +2158,7 @@ bool FileMapInfo::map_heap_region() {
 }
 
 bool FileMapInfo::map_heap_region_impl() {
-  assert(UseG1GC, "the following code assumes G1");
+  assert(ArchiveHeapLoader::can_map(), "the following code assumes a mapping collector");
 
   FileMapRegion* r = region_at(MetaspaceShared::hp);
   size_t size = r->used();
@@ -2170,7 +2172,7 @@ bool FileMapInfo::map_heap_region_impl() {
   log_info(cds)("Preferred address to map heap data (to avoid relocation) is " INTPTR_FORMAT, p2i(requested_start));
 
   // allocate from java heap
-  HeapWord* start = G1CollectedHeap::heap()->alloc_archive_region(word_size, (HeapWord*)requested_start);
+  HeapWord* start = Universe::heap()->alloc_archive_region(word_size, (HeapWord*)requested_start);
   if (start == nullptr) {
     log_info(cds)("UseSharedSpaces: Unable to allocate java heap region for archive heap.");
     return false;
@@ -2270,17 +2272,17 @@ void FileMapInfo::fixup_mapped_heap_region() {
   if (ArchiveHeapLoader::is_mapped()) {
     assert(!_mapped_heap_memregion.is_empty(), "sanity");
 
-    // Populate the archive regions' G1BlockOffsetTables. That ensures
-    // fast G1BlockOffsetTable::block_start operations for any given address
-    // within the archive regions when trying to find start of an object
-    // (e.g. during card table scanning).
-    G1CollectedHeap::heap()->populate_archive_regions_bot(_mapped_heap_memregion);
+    // Let the GC finish setting up the archive regions, e.g. G1 populates their
+    // G1BlockOffsetTables. That ensures fast G1BlockOffsetTable::block_start
+    // operations for any given address within the archive regions when trying
+    // to find start of an object (e.g. during card table scanning).
+    Universe::heap()->complete_mapped_archive_space(_mapped_heap_memregion);
   }
 }
 
 // dealloc the archive regions from java heap
 void FileMapInfo::dealloc_heap_region() {
-  G1CollectedHeap::heap()->dealloc_archive_regions(_mapped_heap_memregion);
+  Universe::heap()->dealloc_archive_regions(_mapped_heap_memregion);
 }
 #endif // INCLUDE_CDS_JAVA_HEAP
 
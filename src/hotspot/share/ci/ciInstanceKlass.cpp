@@ -32,6 +32,7 @@
 #include "memory/allocation.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/resourceArea.hpp"
+#include "oops/constantPool.hpp"
 #include "oops/instanceKlass.inline.hpp"
 #include "oops/klass.inline.hpp"
 #include "oops/oop.inline.hpp"
@@ -640,6 +641,58 @@ ciInstanceKlass* ciInstanceKlass::implementor() {
   return impl;
 }
 
+// Whether the permitted subclasses of the sealed class ik, and in turn their
+// subclasses, can only be subtypes of k if they are among the classes loaded
+// now. Permitted subclasses that are sealed themselves are followed recursively;
+// a non-sealed permitted subclass opens the hierarchy, which is only harmless
+// if k is a class which is not a subclass of it.
+static bool sealed_subclasses_exclude(InstanceKlass* ik, InstanceKlass* k) {
+  assert(ik->is_sealed(), "must be sealed");
+  constantPoolHandle cp(Thread::current(), ik->constants());
+  Array<u2>* permitted = ik->permitted_subclasses();
+  for (int i = 0; i < permitted->length(); i++) {
+    Klass* sub = ConstantPool::klass_at_if_loaded(cp, permitted->at(i));
+    if (sub == nullptr || !sub->is_instance_klass()) {
+      // Not loaded yet, so it could still be loaded as a subtype of k.
+      return false;
+    }
+    InstanceKlass* isub = InstanceKlass::cast(sub);
+    if (isub->is_subtype_of(k)) {
+      return false;
+    }
+    if (isub->is_final()) {
+      continue;
+    }
+    if (isub->is_sealed()) {
+      if (!sealed_subclasses_exclude(isub, k)) {
+        return false;
+      }
+      continue;
+    }
+    if (k->is_interface() || isub->is_interface() || k->is_subtype_of(isub)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// ------------------------------------------------------------------
+// ciInstanceKlass::sealed_hierarchy_excludes
+//
+// Is this class sealed, and can no instance of it or of any class its
+// sealed hierarchy permits ever be a subtype of k?  The answer does not
+// change when further classes are loaded, so no dependency is needed.
+bool ciInstanceKlass::sealed_hierarchy_excludes(ciInstanceKlass* k) {
+  assert(is_loaded() && k->is_loaded(), "must be loaded");
+  VM_ENTRY_MARK;
+  InstanceKlass* ik = get_instanceKlass();
+  InstanceKlass* kk = k->get_instanceKlass();
+  if (!ik->is_sealed() || ik->is_subtype_of(kk)) {
+    return false;
+  }
+  return sealed_subclasses_exclude(ik, kk);
+}
+
 // Utility class for printing of the contents of the static fields for
 // use by compilation replay.  It only prints out the information that
 // could be consumed by the compiler, so for primitive types it prints
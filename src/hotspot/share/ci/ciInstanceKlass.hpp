@@ -255,6 +255,10 @@ class ciInstanceKlass : public ciKlass {
   bool is_leaf_type();
   ciInstanceKlass* implementor();
 
+  // Is this class sealed, and can nothing in its sealed hierarchy be a
+  // subtype of k?
+  bool sealed_hierarchy_excludes(ciInstanceKlass* k);
+
   ciInstanceKlass* unique_implementor() {
     assert(is_loaded(), "must be loaded");
     ciInstanceKlass* impl = implementor();
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "classfile/classPreloader.hpp"
+#include "classfile/javaClasses.hpp"
+#include "classfile/symbolTable.hpp"
+#include "classfile/systemDictionary.hpp"
+#include "logging/log.hpp"
+#include "memory/allocation.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/instanceKlass.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/handles.inline.hpp"
+#include "runtime/java.hpp"
+#include "runtime/javaThread.inline.hpp"
+#include "utilities/growableArray.hpp"
+#include "utilities/istream.hpp"
+
+Symbol** ClassPreloader::_names = nullptr;
+InstanceKlass* volatile* ClassPreloader::_preloaded = nullptr;
+int ClassPreloader::_num_names = 0;
+volatile int ClassPreloader::_next = 0;
+volatile int ClassPreloader::_num_already_loaded = 0;
+volatile int ClassPreloader::_num_failed = 0;
+
+bool ClassPreloader::read_class_list(const char* path) {
+  FileInput input(path, "rt");
+  if (!input.is_open()) {
+    log_warning(class, preload)("Could not open class list %s", path);
+    return false;
+  }
+  GrowableArrayCHeap<Symbol*, mtClass> names;
+  inputStream in(&input);
+  for (; !in.done(); in.next()) {
+    char* line = in.current_line();
+    // Skip comments and the @ lines describing lambda proxies and the like.
+    if (*line == '#' || *line == '@') {
+      continue;
+    }
+    // The class name is the first token; an id or super class may follow.
+    size_t len = strcspn(line, " \t");
+    if (len == 0) {
+      continue;
+    }
+    names.append(SymbolTable::new_symbol(line, (int)len));
+  }
+
+  _num_names = names.length();
+  _names = NEW_C_HEAP_ARRAY(Symbol*, _num_names, mtClass);
+  _preloaded = NEW_C_HEAP_ARRAY(InstanceKlass* volatile, _num_names, mtClass);
+  for (int i = 0; i < _num_names; i++) {
+    _names[i] = names.at(i);
+    _preloaded[i] = nullptr;
+  }
+  return true;
+}
+
+void ClassPreloader::initialize(TRAPS) {
+  if (PreloadClassList == nullptr || !read_class_list(PreloadClassList)) {
+    return;
+  }
+  log_info(class, preload)("Preloading %d classes from %s with %u threads",
+                           _num_names, PreloadClassList, PreloadClassListThreads);
+
+  for (uint i = 0; i < PreloadClassListThreads; i++) {
+    char name[32];
+    jio_snprintf(name, sizeof(name), "Class Preloader Thread#%u", i);
+    Handle thread_oop = JavaThread::create_system_thread_object(name, CHECK);
+
+    ClassPreloaderThread* thread = new ClassPreloaderThread(&preloader_thread_entry);
+    JavaThread::vm_exit_on_osthread_failure(thread);
+
+    JavaThread::start_internal_daemon(THREAD, thread, thread_oop, NormPriority);
+  }
+}
+
+void ClassPreloader::preload(int index, TRAPS) {
+  Symbol* name = _names[index];
+  Handle loader(THREAD, SystemDictionary::java_system_loader());
+  if (SystemDictionary::find_instance_klass(THREAD, name, loader, Handle()) != nullptr) {
+    // Loaded during startup, or the application got here first.
+    Atomic::inc(&_num_already_loaded);
+    return;
+  }
+
+  Klass* k = SystemDictionary::resolve_or_null(name, loader, Handle(), THREAD);
+  if (HAS_PENDING_EXCEPTION || k == nullptr || !k->is_instance_klass()) {
+    CLEAR_PENDING_EXCEPTION;
+    Atomic::inc(&_num_failed);
+    return;
+  }
+  InstanceKlass* ik = InstanceKlass::cast(k);
+  Atomic::release_store(&_preloaded[index], ik);
+
+  // Link, and thus verify, the class ahead of its first use. An error is
+  // reported again when the application links the class itself.
+  ik->link_class(THREAD);
+  if (HAS_PENDING_EXCEPTION) {
+    CLEAR_PENDING_EXCEPTION;
+    Atomic::inc(&_num_failed);
+  }
+}
+
+void ClassPreloader::preloader_thread_entry(JavaThread* thread, TRAPS) {
+  // The threads claim the names in list order, so the classes needed first
+  // are likely to be preloaded first.
+  int index;
+  while ((index = Atomic::fetch_then_add(&_next, 1)) < _num_names) {
+    HandleMark hm(THREAD);
+    ResourceMark rm(THREAD);
+    preload(index, THREAD);
+  }
+}
+
+void ClassPreloader::print_statistics_at_exit() {
+  if (_num_names == 0 || !log_is_enabled(Info, class, preload)) {
+    return;
+  }
+  int preloaded = 0;
+  int used = 0;
+  for (int i = 0; i < _num_names; i++) {
+    InstanceKlass* ik = Atomic::load_acquire(&_preloaded[i]);
+    if (ik != nullptr) {
+      preloaded++;
+      if (ik->is_initialized() || ik->is_in_error_state()) {
+        used++;
+      }
+    }
+  }
+  int reached = MIN2(Atomic::load(&_next), _num_names);
+  log_info(class, preload)("Preloaded %d of %d classes (%d already loaded, %d failed, %d not reached)",
+                           preloaded, _num_names, Atomic::load(&_num_already_loaded),
+                           Atomic::load(&_num_failed), _num_names - reached);
+  log_info(class, preload)("%d preloaded classes used by the application (%.1f%%)",
+                           used, percent_of(used, preloaded));
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef SHARE_CLASSFILE_CLASSPRELOADER_HPP
+#define SHARE_CLASSFILE_CLASSPRELOADER_HPP
+
+#include "memory/allStatic.hpp"
+#include "runtime/javaThread.hpp"
+#include "utilities/exceptions.hpp"
+
+class InstanceKlass;
+class Symbol;
+
+// Speculatively loads and links the classes named in PreloadClassList with
+// the system class loader, on PreloadClassListThreads background threads,
+// so that they are ready when the application first uses them. The list has
+// the format of a CDS class list; only the class names are used.
+//
+// Preloading does not initialize any class. Whether a preloaded class has been
+// initialized by the application at exit tells whether preloading it paid off.
+class ClassPreloader : AllStatic {
+  static Symbol** _names;
+  // The class loaded by the preloader for each name, if any.
+  static InstanceKlass* volatile* _preloaded;
+  static int _num_names;
+  static volatile int _next;
+  static volatile int _num_already_loaded;
+  static volatile int _num_failed;
+
+  static bool read_class_list(const char* path);
+  static void preload(int index, TRAPS);
+  static void preloader_thread_entry(JavaThread* thread, TRAPS);
+
+ public:
+  // Start the preloader threads. Called once the system class loader is set up.
+  static void initialize(TRAPS);
+
+  static void print_statistics_at_exit();
+};
+
+class ClassPreloaderThread : public JavaThread {
+  friend class ClassPreloader;
+  ClassPreloaderThread(ThreadFunction entry_point) : JavaThread(entry_point) {}
+
+ public:
+  // Hide this thread from external view.
+  bool is_hidden_from_external_view() const { return true; }
+};
+
+#endif // SHARE_CLASSFILE_CLASSPRELOADER_HPP
@@ -25,7 +25,9 @@
 #include "precompiled.hpp"
 #include "classfile/classFileParser.hpp"
 #include "classfile/fieldLayoutBuilder.hpp"
+#include "classfile/symbolTable.hpp"
 #include "jvm.h"
+#include "logging/log.hpp"
 #include "memory/resourceArea.hpp"
 #include "oops/array.hpp"
 #include "oops/fieldStreams.inline.hpp"
@@ -33,6 +35,8 @@
 #include "oops/instanceKlass.inline.hpp"
 #include "oops/klass.inline.hpp"
 #include "runtime/fieldDescriptor.inline.hpp"
+#include "runtime/globals.hpp"
+#include "utilities/istream.hpp"
 
 
 LayoutRawBlock::LayoutRawBlock(Kind kind, int size) :
@@ -492,6 +496,7 @@ FieldLayoutBuilder::FieldLayoutBuilder(const Symbol* classname, const InstanceKl
   _field_info(field_info),
   _info(info),
   _root_group(nullptr),
+  _hot_group(nullptr),
   _contended_groups(GrowableArray<FieldGroup*>(8)),
   _static_fields(nullptr),
   _layout(nullptr),
@@ -501,6 +506,67 @@ FieldLayoutBuilder::FieldLayoutBuilder(const Symbol* classname, const InstanceKl
   _has_nonstatic_fields(false),
   _is_contended(is_contended) {}
 
+FieldLayoutBuilder::HotFieldTable* FieldLayoutBuilder::_hot_fields = nullptr;
+
+// Each line of the hints file names a class, in internal form, followed by
+// the names of its hot non-static fields:
+//   java/util/HashMap table size modCount
+// Lines starting with '#' are comments.
+void FieldLayoutBuilder::initialize_layout_hints() {
+  if (FieldLayoutHintsFile == nullptr) {
+    return;
+  }
+  FileInput input(FieldLayoutHintsFile, "rt");
+  if (!input.is_open()) {
+    log_warning(class)("Could not open field layout hints file %s", FieldLayoutHintsFile);
+    return;
+  }
+  _hot_fields = new (mtClass) HotFieldTable();
+  int num_classes = 0;
+  inputStream in(&input);
+  for (; !in.done(); in.next()) {
+    const char* line = in.current_line();
+    if (*line == '#') {
+      continue;
+    }
+    size_t len = strcspn(line, " \t");
+    if (len == 0) {
+      continue;
+    }
+    // The symbols are kept alive by the reference counts taken here.
+    Symbol* class_name = SymbolTable::new_symbol(line, (int)len);
+    HotFieldList* fields = nullptr;
+    HotFieldList** existing = _hot_fields->get(class_name);
+    if (existing != nullptr) {
+      fields = *existing;
+    } else {
+      fields = new HotFieldList();
+      _hot_fields->put(class_name, fields);
+      num_classes++;
+    }
+    line += len;
+    for (;;) {
+      line += strspn(line, " \t");
+      len = strcspn(line, " \t");
+      if (len == 0) {
+        break;
+      }
+      fields->append(SymbolTable::new_symbol(line, (int)len));
+      line += len;
+    }
+  }
+  log_info(class)("Read field layout hints for %d classes from %s", num_classes, FieldLayoutHintsFile);
+}
+
+bool FieldLayoutBuilder::is_hot_field(const HotFieldList* hot_fields, const FieldInfo& fieldinfo) const {
+  Symbol* name = fieldinfo.name(_constant_pool);
+  for (int i = 0; i < hot_fields->length(); i++) {
+    if (hot_fields->at(i) == name) {
+      return true;
+    }
+  }
+  return false;
+}
 
 FieldGroup* FieldLayoutBuilder::get_or_create_contended_group(int g) {
   assert(g > 0, "must only be called for named contended groups");
@@ -525,6 +591,7 @@ void FieldLayoutBuilder::prologue() {
   _static_layout->initialize_static_layout();
   _static_fields = new FieldGroup();
   _root_group = new FieldGroup();
+  _hot_group = new FieldGroup();
 }
 
 // Field sorting for regular classes:
@@ -532,7 +599,15 @@ void FieldLayoutBuilder::prologue() {
 //   - non-static fields are also sorted according to their contention group
 //     (support of the @Contended annotation)
 //   - @Contended annotation is ignored for static fields
+//   - non-static fields listed in the layout hints are moved to the hot group
 void FieldLayoutBuilder::regular_field_sorting() {
+  const HotFieldList* hot_fields = nullptr;
+  if (_hot_fields != nullptr) {
+    HotFieldList** fields = _hot_fields->get(_classname);
+    if (fields != nullptr) {
+      hot_fields = *fields;
+    }
+  }
   int idx = 0;
   for (GrowableArrayIterator<FieldInfo> it = _field_info->begin(); it != _field_info->end(); ++it, ++idx) {
     FieldInfo ctrl = _field_info->at(0);
@@ -550,6 +625,8 @@ void FieldLayoutBuilder::regular_field_sorting() {
         } else {
           group = get_or_create_contended_group(g);
         }
+      } else if (hot_fields != nullptr && is_hot_field(hot_fields, fieldinfo)) {
+        group = _hot_group;
       } else {
         group = _root_group;
       }
@@ -577,6 +654,7 @@ void FieldLayoutBuilder::regular_field_sorting() {
     }
   }
   _root_group->sort_by_size();
+  _hot_group->sort_by_size();
   _static_fields->sort_by_size();
   if (!_contended_groups.is_empty()) {
     for (int i = 0; i < _contended_groups.length(); i++) {
@@ -597,6 +675,8 @@ void FieldLayoutBuilder::insert_contended_padding(LayoutRawBlock* slot) {
 //   - primitive fields are allocated first (from the biggest to the smallest)
 //   - then oop fields are allocated, either in existing gaps or at the end of
 //     the layout
+//   - fields of the hot group, if any, are allocated before all other
+//     non-contended fields, following the same rules
 void FieldLayoutBuilder::compute_regular_layout() {
   bool need_tail_padding = false;
   prologue();
@@ -609,6 +689,8 @@ void FieldLayoutBuilder::compute_regular_layout() {
     insert_contended_padding(_layout->start());
     need_tail_padding = true;
   }
+  _layout->add(_hot_group->primitive_fields());
+  _layout->add(_hot_group->oop_fields());
   _layout->add(_root_group->primitive_fields());
   _layout->add(_root_group->oop_fields());
 
@@ -645,6 +727,13 @@ void FieldLayoutBuilder::epilogue() {
     _super_klass->nonstatic_oop_map_count());
   }
 
+  if (_hot_group->oop_fields() != nullptr) {
+    for (int i = 0; i < _hot_group->oop_fields()->length(); i++) {
+      LayoutRawBlock* b = _hot_group->oop_fields()->at(i);
+      nonstatic_oop_maps->add(b->offset(), 1);
+    }
+  }
+
   if (_root_group->oop_fields() != nullptr) {
     for (int i = 0; i < _root_group->oop_fields()->length(); i++) {
       LayoutRawBlock* b = _root_group->oop_fields()->at(i);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2020, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,6 +30,7 @@
 #include "memory/allocation.hpp"
 #include "oops/fieldStreams.hpp"
 #include "utilities/growableArray.hpp"
+#include "utilities/resourceHash.hpp"
 
 // Classes below are used to compute the field layout of classes.
 
@@ -224,8 +225,16 @@ class FieldLayout : public ResourceObj {
 //  Steps 1 and 4 are common to all layout computations. Step 2 and 3
 //  can vary with the allocation strategy.
 //
+// Classes listed in the FieldLayoutHintsFile get their listed (hot) non-static
+// fields allocated before their other fields, so that fields accessed together
+// end up at the lowest offsets and share as few cache lines as possible.
+//
 class FieldLayoutBuilder : public ResourceObj {
  private:
+  typedef GrowableArrayCHeap<Symbol*, mtClass> HotFieldList;
+  typedef ResourceHashtable<const Symbol*, HotFieldList*, 256, AnyObj::C_HEAP, mtClass,
+                            Symbol::compute_hash> HotFieldTable;
+  static HotFieldTable* _hot_fields;
 
   const Symbol* _classname;
   const InstanceKlass* _super_klass;
@@ -233,6 +242,7 @@ class FieldLayoutBuilder : public ResourceObj {
   GrowableArray<FieldInfo>* _field_info;
   FieldLayoutInfo* _info;
   FieldGroup* _root_group;
+  FieldGroup* _hot_group;   // non-static fields listed in the FieldLayoutHintsFile
   GrowableArray<FieldGroup*> _contended_groups;
   FieldGroup* _static_fields;
   FieldLayout* _layout;
@@ -251,6 +261,8 @@ class FieldLayoutBuilder : public ResourceObj {
     return _alignment;
   }
 
+  static void initialize_layout_hints();
+
   void build_layout();
   void compute_regular_layout();
   void insert_contended_padding(LayoutRawBlock* slot);
@@ -260,6 +272,7 @@ class FieldLayoutBuilder : public ResourceObj {
   void epilogue();
   void regular_field_sorting();
   FieldGroup* get_or_create_contended_group(int g);
+  bool is_hot_field(const HotFieldList* hot_fields, const FieldInfo& fieldinfo) const;
 };
 
 #endif // SHARE_CLASSFILE_FIELDLAYOUTBUILDER_HPP
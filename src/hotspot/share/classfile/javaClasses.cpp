@@ -1604,6 +1604,8 @@ int java_lang_Thread::_eetop_offset;
 int java_lang_Thread::_jvmti_thread_state_offset;
 int java_lang_Thread::_jvmti_VTMS_transition_disable_count_offset;
 int java_lang_Thread::_jvmti_is_in_VTMS_transition_offset;
+int java_lang_Thread::_tlab_size_hint_offset;
+int java_lang_Thread::_cpu_time_offset;
 int java_lang_Thread::_interrupted_offset;
 int java_lang_Thread::_interruptLock_offset;
 int java_lang_Thread::_tid_offset;
@@ -1694,6 +1696,22 @@ int java_lang_Thread::is_in_VTMS_transition_offset() {
   return _jvmti_is_in_VTMS_transition_offset;
 }
 
+jlong java_lang_Thread::tlab_size_hint(oop java_thread) {
+  return java_thread->long_field(_tlab_size_hint_offset);
+}
+
+void java_lang_Thread::set_tlab_size_hint(oop java_thread, jlong value) {
+  java_thread->long_field_put(_tlab_size_hint_offset, value);
+}
+
+jlong java_lang_Thread::cpu_time(oop java_thread) {
+  return java_thread->long_field(_cpu_time_offset);
+}
+
+void java_lang_Thread::set_cpu_time(oop java_thread, jlong value) {
+  java_thread->long_field_put(_cpu_time_offset, value);
+}
+
 void java_lang_Thread::clear_scopedValueBindings(oop java_thread) {
   assert(java_thread != nullptr, "need a java_lang_Thread pointer here");
   java_thread->obj_field_put(_scopedValueBindings_offset, nullptr);
@@ -2090,7 +2108,7 @@ bool java_lang_VirtualThread::set_onWaitingList(oop vthread, OopHandle& list_hea
       for (;;) {
         oop head = list_head.resolve();
         java_lang_VirtualThread::set_next(vthread, head);
-        if (list_head.cmpxchg(head, vthread) == head) return true;
+        if (list_head.cmpxchg(head, vthread) == head) return head == nullptr;
       }
     }
   }
@@ -2301,6 +2319,7 @@ class BacktraceBuilder: public StackObj {
     trace_conts_offset   = java_lang_Throwable::trace_conts_offset,
     trace_next_offset    = java_lang_Throwable::trace_next_offset,
     trace_hidden_offset  = java_lang_Throwable::trace_hidden_offset,
+    trace_thrower_offset = java_lang_Throwable::trace_thrower_offset,
     trace_size           = java_lang_Throwable::trace_size,
     trace_chunk_size     = java_lang_Throwable::trace_chunk_size
   };
@@ -2437,6 +2456,12 @@ class BacktraceBuilder: public StackObj {
       _head->obj_at_put(trace_hidden_offset, _methods);
     }
   }
+
+  // Remember the exception type in the first chunk so that inspecting
+  // the stack trace can be attributed to it (see HotExceptionStackTraceDepth).
+  void set_thrower(oop mirror) {
+    objArrayOop(_backtrace())->obj_at_put(trace_thrower_offset, mirror);
+  }
 };
 
 struct BacktraceElement : public StackObj {
@@ -2662,6 +2687,17 @@ void java_lang_Throwable::fill_in_stack_trace(Handle throwable, const methodHand
 
   BacktraceBuilder bt(CHECK);
 
+  if (HotExceptionStackTraceDepth > 0) {
+    // Exception types that are thrown very often and whose stack traces
+    // nobody looks at only get a shallow backtrace.
+    InstanceKlass* ik = InstanceKlass::cast(throwable->klass());
+    if (ik->record_exception_fill() > HotExceptionThreshold &&
+        (max_depth == 0 || max_depth > HotExceptionStackTraceDepth)) {
+      max_depth = HotExceptionStackTraceDepth;
+    }
+    bt.set_thrower(ik->java_mirror());
+  }
+
   // If there is no Java frame just return the method that was being called
   // with bci 0
   if (!thread->has_last_Java_frame()) {
@@ -2886,6 +2922,17 @@ void java_lang_Throwable::get_stack_trace_elements(int depth, Handle backtrace,
     THROW(vmSymbols::java_lang_IndexOutOfBoundsException());
   }
 
+  if (HotExceptionStackTraceDepth > 0) {
+    // Someone looks at stack traces of this type, never shorten them again.
+    oop thrower = objArrayOop(backtrace())->obj_at(trace_thrower_offset);
+    if (thrower != nullptr) {
+      InstanceKlass* ik = InstanceKlass::cast(java_lang_Class::as_Klass(thrower));
+      if (!ik->exception_trace_inspected()) {
+        ik->set_exception_trace_inspected();
+      }
+    }
+  }
+
   objArrayHandle result(THREAD, objArrayOop(backtrace()));
   BacktraceIterator iter(result, THREAD);
 
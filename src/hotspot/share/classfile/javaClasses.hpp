@@ -347,6 +347,8 @@ class java_lang_Class : AllStatic {
   macro(java_lang_Thread, jvmti_thread_state, intptr_signature, false) \
   macro(java_lang_Thread, jvmti_VTMS_transition_disable_count, int_signature, false) \
   macro(java_lang_Thread, jvmti_is_in_VTMS_transition, bool_signature, false) \
+  macro(java_lang_Thread, tlab_size_hint, long_signature, false) \
+  macro(java_lang_Thread, cpu_time, long_signature, false) \
   JFR_ONLY(macro(java_lang_Thread, jfr_epoch, short_signature, false))
 
 class java_lang_Thread : AllStatic {
@@ -363,6 +365,8 @@ class java_lang_Thread : AllStatic {
   static int _jvmti_thread_state_offset;
   static int _jvmti_VTMS_transition_disable_count_offset;
   static int _jvmti_is_in_VTMS_transition_offset;
+  static int _tlab_size_hint_offset;
+  static int _cpu_time_offset;
   static int _interrupted_offset;
   static int _interruptLock_offset;
   static int _tid_offset;
@@ -423,6 +427,12 @@ class java_lang_Thread : AllStatic {
   static bool is_in_VTMS_transition(oop java_thread);
   static void set_is_in_VTMS_transition(oop java_thread, bool val);
   static int  is_in_VTMS_transition_offset();
+  // Average number of bytes allocated per mount, see VirtualThreadTLABSizeHints
+  static jlong tlab_size_hint(oop java_thread);
+  static void set_tlab_size_hint(oop java_thread, jlong value);
+  // CPU time used by a virtual thread in earlier mounts, see VirtualThreadCPUTime
+  static jlong cpu_time(oop java_thread);
+  static void set_cpu_time(oop java_thread, jlong value);
 
   // Clear all scoped value bindings on error
   static void clear_scopedValueBindings(oop java_thread);
@@ -580,6 +590,8 @@ class java_lang_VirtualThread : AllStatic {
   static int cmpxchg_state(oop vthread, int old_state, int new_state);
   static oop next(oop vthread);
   static void set_next(oop vthread, oop next_vthread);
+  // Pushes vthread on the list unless it is already on it. Returns true if the
+  // list was empty, i.e. if the consumer of the list needs to be woken up.
   static bool set_onWaitingList(oop vthread, OopHandle& list_head);
   static jbyte recheckInterval(oop vthread);
   static void set_recheckInterval(oop vthread, jbyte value);
@@ -607,7 +619,8 @@ class java_lang_Throwable: AllStatic {
     trace_conts_offset   = 4,
     trace_next_offset    = 5,
     trace_hidden_offset  = 6,
-    trace_size           = 7,
+    trace_thrower_offset = 7,
+    trace_size           = 8,
     trace_chunk_size     = 32
   };
 
@@ -1041,6 +1041,21 @@ size_t CodeCache::unallocated_capacity() {
   return unallocated_cap;
 }
 
+size_t CodeCache::freelist_capacity(CodeBlobType code_blob_type) {
+  CodeHeap* heap = get_code_heap(code_blob_type);
+  return (heap != nullptr) ? heap->allocated_in_freelist() : 0;
+}
+
+int CodeCache::freelist_length(CodeBlobType code_blob_type) {
+  CodeHeap* heap = get_code_heap(code_blob_type);
+  return (heap != nullptr) ? heap->freelist_length() : 0;
+}
+
+size_t CodeCache::max_allocated_capacity(CodeBlobType code_blob_type) {
+  CodeHeap* heap = get_code_heap(code_blob_type);
+  return (heap != nullptr) ? heap->max_allocated_capacity() : 0;
+}
+
 size_t CodeCache::max_capacity() {
   size_t max_cap = 0;
   FOR_ALL_ALLOCABLE_HEAPS(heap) {
@@ -1358,15 +1373,19 @@ void CodeCache::mark_for_deoptimization(DeoptimizationScope* deopt_scope, Method
   }
 }
 
-void CodeCache::make_marked_nmethods_deoptimized() {
+uint CodeCache::make_marked_nmethods_deoptimized() {
+  uint count = 0;
   RelaxedNMethodIterator iter(RelaxedNMethodIterator::not_unloading);
   while(iter.next()) {
     nmethod* nm = iter.method();
     if (nm->is_marked_for_deoptimization() && !nm->has_been_deoptimized() && nm->can_be_deoptimized()) {
-      nm->make_not_entrant();
+      if (nm->make_not_entrant()) {
+        count++;
+      }
       nm->make_deoptimized();
     }
   }
+  return count;
 }
 
 // Marks compiled methods dependent on dependee.
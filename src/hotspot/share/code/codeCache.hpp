@@ -246,6 +246,10 @@ class CodeCache : AllStatic {
   static size_t unallocated_capacity(CodeBlobType code_blob_type);
   static size_t unallocated_capacity();
   static size_t max_capacity();
+  // Free space inside the used part of a code heap: the fragmentation
+  static size_t freelist_capacity(CodeBlobType code_blob_type);
+  static int    freelist_length(CodeBlobType code_blob_type);
+  static size_t max_allocated_capacity(CodeBlobType code_blob_type);
 
   static double reverse_free_ratio();
 
@@ -297,7 +301,8 @@ class CodeCache : AllStatic {
  public:
   static void mark_all_nmethods_for_deoptimization(DeoptimizationScope* deopt_scope);
   static void mark_for_deoptimization(DeoptimizationScope* deopt_scope, Method* dependee);
-  static void make_marked_nmethods_deoptimized();
+  // Returns the number of nmethods made not entrant.
+  static uint make_marked_nmethods_deoptimized();
 
   // Marks dependents during classloading
   static void mark_dependents_on(DeoptimizationScope* deopt_scope, InstanceKlass* dependee);
@@ -2066,6 +2066,25 @@ bool nmethod::make_not_entrant() {
   return true;
 }
 
+// Resets the counters of a method whose nmethod is unloaded as cold. The
+// counters have kept growing since the method was compiled, so without this
+// the first call after unloading would trigger a recompilation. Keep a count
+// of one to tell the method apart from a never executed one.
+static void reset_counters_of_cold_method(Method* method) {
+  MethodCounters* mcs = method->method_counters();
+  if (mcs != nullptr) {
+    mcs->invocation_counter()->init();
+    mcs->invocation_counter()->increment();
+    mcs->backedge_counter()->init();
+  }
+  MethodData* mdo = method->method_data();
+  if (mdo != nullptr) {
+    mdo->invocation_counter()->init();
+    mdo->invocation_counter()->increment();
+    mdo->backedge_counter()->init();
+  }
+}
+
 // For concurrent GCs, there must be a handshake between unlink and flush
 void nmethod::unlink() {
   if (is_unlinked()) {
@@ -2075,6 +2094,15 @@ void nmethod::unlink() {
 
   flush_dependencies();
 
+  // Done here rather than in is_cold(), which may be evaluated more than once
+  // per cycle. Only the current code of a live method is considered, and not
+  // OSR nmethods: they share the counters with the method's normal code,
+  // which is still in use.
+  if (ColdNMethodResetsCounters && !is_osr_method() && method() != nullptr &&
+      method()->code() == this && method()->method_holder()->is_loader_alive() && is_cold()) {
+    reset_counters_of_cold_method(method());
+  }
+
   // unlink_from_method will take the NMethodState_lock.
   // In this case we don't strictly need it when unlinking nmethods from
   // the Method, because it is only concurrently unlinked by
@@ -2316,7 +2344,10 @@ bool nmethod::is_cold() {
   }
 
   // Other code can be phased out more gradually after N GCs
-  return CodeCache::previous_completed_gc_marking_cycle() > _gc_epoch + 2 * CodeCache::cold_gc_count();
+  if (CodeCache::previous_completed_gc_marking_cycle() <= _gc_epoch + 2 * CodeCache::cold_gc_count()) {
+    return false;
+  }
+  return true;
 }
 
 // The _is_unloading_state encodes a tuple comprising the unloading cycle
@@ -23,11 +23,13 @@
  */
 
 #include "precompiled.hpp"
+#include "classfile/classLoaderDataGraph.hpp"
 #include "code/scopeDesc.hpp"
 #include "compiler/compilationPolicy.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/compilerDefinitions.inline.hpp"
 #include "compiler/compilerOracle.hpp"
+#include "logging/log.hpp"
 #include "memory/resourceArea.hpp"
 #include "oops/methodData.hpp"
 #include "oops/method.inline.hpp"
@@ -39,8 +41,10 @@
 #include "runtime/frame.inline.hpp"
 #include "runtime/globals_extension.hpp"
 #include "runtime/handles.inline.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/safepointVerifiers.hpp"
+#include "runtime/timer.hpp"
 #ifdef COMPILER1
 #include "c1/c1_Compiler.hpp"
 #endif
@@ -197,6 +201,13 @@ bool CompilationPolicy::is_trivial(const methodHandle& method) {
   return false;
 }
 
+bool CompilationPolicy::is_too_big_for_c2(const methodHandle& method) {
+  return Tier4MaxBytecodeSize > 0 &&
+         method->code_size() > Tier4MaxBytecodeSize &&
+         CompilerConfig::is_c1_enabled() &&
+         !CompilationModeFlag::disable_intermediate();
+}
+
 bool CompilationPolicy::force_comp_at_level_simple(const methodHandle& method) {
   if (CompilationModeFlag::quick_internal()) {
 #if INCLUDE_JVMCI
@@ -533,6 +544,66 @@ bool CompilationPolicy::verify_level(CompLevel level) {
 #endif
 
 
+class HotMethodsClosure : public KlassClosure {
+  outputStream* const _out;
+  const double _threshold_scaling;
+  const int _level;
+  int _count;
+
+public:
+  HotMethodsClosure(outputStream* out, double threshold_scaling) :
+    _out(out), _threshold_scaling(threshold_scaling),
+    _level(CompilationPolicy::highest_compile_level()), _count(0) {}
+
+  void do_klass(Klass* k) {
+    if (!k->is_instance_klass()) {
+      return;
+    }
+    InstanceKlass* ik = InstanceKlass::cast(k);
+    // Hidden classes get different names in every run.
+    if (ik->is_hidden()) {
+      return;
+    }
+    Array<Method*>* methods = ik->methods();
+    for (int i = 0; i < methods->length(); i++) {
+      Method* m = methods->at(i);
+      if (m->highest_comp_level() < _level && m->highest_osr_comp_level() < _level) {
+        continue;
+      }
+      ResourceMark rm;
+      _out->print_cr("CompileThresholdScaling,%s.%s%s,%f",
+                     ik->name()->as_C_string(), m->name()->as_C_string(),
+                     m->signature()->as_C_string(), _threshold_scaling);
+      _count++;
+    }
+  }
+
+  int count() const { return _count; }
+};
+
+int CompilationPolicy::print_hot_methods(outputStream* out, double threshold_scaling) {
+  if (highest_compile_level() == CompLevel_none) {
+    return 0;
+  }
+  HotMethodsClosure closure(out, threshold_scaling);
+  MutexLocker mcld(ClassLoaderDataGraph_lock);
+  ClassLoaderDataGraph::loaded_classes_do_keepalive(&closure);
+  return closure.count();
+}
+
+void CompilationPolicy::dump_hot_methods_at_exit() {
+  if (DumpHotMethodsFile == nullptr) {
+    return;
+  }
+  fileStream out(DumpHotMethodsFile);
+  if (!out.is_open()) {
+    warning("Could not open DumpHotMethodsFile %s", DumpHotMethodsFile);
+    return;
+  }
+  int count = print_hot_methods(&out, DumpHotMethodsThresholdScaling);
+  log_info(jit, compilation)("Wrote %d hot methods to %s", count, DumpHotMethodsFile);
+}
+
 CompLevel CompilationPolicy::highest_compile_level() {
   CompLevel level = CompLevel_none;
   // Setup the maximum level available for the current compiler configuration.
@@ -624,6 +695,7 @@ CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue) {
   Method* max_method = nullptr;
 
   jlong t = nanos_to_millis(os::javaTimeNanos());
+  jlong now = os::elapsed_counter();
   // Iterate through the queue and find a method with a maximum rate.
   for (CompileTask* task = compile_queue->first(); task != nullptr;) {
     CompileTask* next_task = task->next();
@@ -646,14 +718,14 @@ CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue) {
       continue;
     }
     update_rate(t, mh);
-    if (max_task == nullptr || compare_methods(method, max_method)) {
+    if (max_task == nullptr || compare_tasks(task, max_task, now)) {
       // Select a method with the highest rate
       max_task = task;
       max_method = method;
     }
 
     if (task->is_blocking()) {
-      if (max_blocking_task == nullptr || compare_methods(method, max_blocking_task->method())) {
+      if (max_blocking_task == nullptr || compare_tasks(task, max_blocking_task, now)) {
         max_blocking_task = task;
       }
     }
@@ -707,6 +779,25 @@ void CompilationPolicy::reprofile(ScopeDesc* trap_scope, bool is_osr) {
   }
 }
 
+void CompilationPolicy::thaw_event(Method* m, CompLevel level) {
+  assert(Tier0ThawWeight > 0, "should not be called");
+  // The frame continues in the middle of the method, so we count a back
+  // branch as well: a later loop event can then request an OSR compilation.
+  if (level == CompLevel_full_profile) {
+    MethodData* mdo = m->method_data();
+    if (mdo != nullptr) {
+      mdo->invocation_counter()->increment(Tier0ThawWeight);
+      mdo->backedge_counter()->increment(Tier0ThawWeight);
+    }
+  } else if (level == CompLevel_none || level == CompLevel_limited_profile) {
+    MethodCounters* mcs = m->method_counters();
+    if (mcs != nullptr) {
+      mcs->invocation_counter()->increment(Tier0ThawWeight);
+      mcs->backedge_counter()->increment(Tier0ThawWeight);
+    }
+  }
+}
+
 nmethod* CompilationPolicy::event(const methodHandle& method, const methodHandle& inlinee,
                                       int branch_bci, int bci, CompLevel comp_level, nmethod* nm, TRAPS) {
   if (PrintTieredEvents) {
@@ -802,6 +893,13 @@ void CompilationPolicy::compile(const methodHandle& mh, int bci, CompLevel level
   if (bci != InvocationEntryBci && mh->is_not_osr_compilable(level)) {
     return;
   }
+  if (level == CompLevel_full_optimization && !CompilationModeFlag::disable_intermediate() &&
+      mh->method_data() != nullptr && mh->method_data()->decompile_count() > 0 &&
+      DeoptimizationStorm::is_active()) {
+    // Postpone the recompilation until the deoptimization storm is over. The
+    // method keeps running in lower tiers in the meantime.
+    return;
+  }
   if (!CompileBroker::compilation_is_in_queue(mh)) {
     if (PrintTieredEvents) {
       print_event(COMPILE, mh(), mh(), bci, level);
@@ -877,6 +975,26 @@ double CompilationPolicy::weight(Method* method) {
   return (double)(method->rate() + 1) * (method->invocation_count() + 1) * (method->backedge_count() + 1);
 }
 
+// Weight of a task, increased by its weight for every TieredCompileTaskAgingMillis
+// it waited in the queue.
+static double aged_weight(CompileTask* task, double weight, jlong now) {
+  double waited_ms = TimeHelper::counter_to_millis(now - task->time_queued());
+  return weight * (1.0 + waited_ms / TieredCompileTaskAgingMillis);
+}
+
+bool CompilationPolicy::compare_tasks(CompileTask* x, CompileTask* y, jlong now) {
+  if (TieredCompileTaskAgingMillis == 0) {
+    return compare_methods(x->method(), y->method());
+  }
+  Method* mx = x->method();
+  Method* my = y->method();
+  if (mx->highest_comp_level() != my->highest_comp_level()) {
+    // recompilation after deopt
+    return mx->highest_comp_level() > my->highest_comp_level();
+  }
+  return aged_weight(x, weight(mx), now) > aged_weight(y, weight(my), now);
+}
+
 // Apply heuristics and return true if x should be compiled before y
 bool CompilationPolicy::compare_methods(Method* x, Method* y) {
   if (x->highest_comp_level() > y->highest_comp_level()) {
@@ -1028,6 +1146,11 @@ CompLevel CompilationPolicy::common(const methodHandle& method, CompLevel cur_le
   } else {
     if (is_trivial(method) || method->is_native()) {
       next_level = CompilationModeFlag::disable_intermediate() ? CompLevel_full_optimization : CompLevel_simple;
+    } else if (is_too_big_for_c2(method)) {
+      // Go straight to the final C1 level once the method would get profiled.
+      if (cur_level == CompLevel_none && Predicate::apply(method, cur_level, i, b)) {
+        next_level = CompLevel_simple;
+      }
     } else {
       switch(cur_level) {
       default: break;
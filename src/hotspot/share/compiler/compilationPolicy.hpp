@@ -207,6 +207,9 @@ class CompilationPolicy : AllStatic {
   inline static double weight(Method* method);
   // Apply heuristics and return true if x should be compiled before y
   inline static bool compare_methods(Method* x, Method* y);
+  // Compare tasks like compare_methods(), taking the time they waited in
+  // the queue into account if TieredCompileTaskAgingMillis is set.
+  inline static bool compare_tasks(CompileTask* x, CompileTask* y, jlong now);
   // Compute event rate for a given method. The rate is the number of event (invocations + backedges)
   // per millisecond.
   inline static void update_rate(jlong t, const methodHandle& method);
@@ -231,6 +234,8 @@ class CompilationPolicy : AllStatic {
   // Simple methods are as good being compiled with C1 as C2.
   // This function tells if it's such a function.
   inline static bool is_trivial(const methodHandle& method);
+  // Is the method too big to be worth compiling with C2 (see Tier4MaxBytecodeSize)?
+  inline static bool is_too_big_for_c2(const methodHandle& method);
   // Force method to be compiled at CompLevel_simple?
   inline static bool force_comp_at_level_simple(const methodHandle& method);
 
@@ -266,6 +271,11 @@ class CompilationPolicy : AllStatic {
   static CompileTask* select_task_helper(CompileQueue* compile_queue);
   // Return initial compile level to use with Xcomp (depends on compilation mode).
   static void reprofile(ScopeDesc* trap_scope, bool is_osr);
+  // A frame of method m executing at the given level has been thawed from a
+  // continuation. Account for it like an invocation, so that methods which
+  // virtual threads keep resuming in get compiled like those they call.
+  // Called in a leaf context: must not lock or safepoint.
+  static void thaw_event(Method* m, CompLevel level);
   static nmethod* event(const methodHandle& method, const methodHandle& inlinee,
                         int branch_bci, int bci, CompLevel comp_level, nmethod* nm, TRAPS);
   // Select task is called by CompileBroker. We should return a task or nullptr.
@@ -280,6 +290,14 @@ class CompilationPolicy : AllStatic {
   static CompLevel initial_compile_level(const methodHandle& method);
   // Return highest level possible
   static CompLevel highest_compile_level();
+
+  // Print a CompileThresholdScaling command for every loaded method that has
+  // been compiled at the highest level, so that a later run reading them with
+  // CompileCommandFile compiles these methods sooner. Returns the number of
+  // methods printed.
+  static int print_hot_methods(outputStream* out, double threshold_scaling);
+  // Print the hot methods to DumpHotMethodsFile, if set.
+  static void dump_hot_methods_at_exit();
 };
 
 #endif // SHARE_COMPILER_COMPILATIONPOLICY_HPP
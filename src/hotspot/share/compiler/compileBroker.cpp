@@ -64,10 +64,12 @@
 #include "runtime/jniHandles.inline.hpp"
 #include "runtime/os.hpp"
 #include "runtime/perfData.hpp"
+#include "runtime/perfHistograms.hpp"
 #include "runtime/safepointVerifiers.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/threads.hpp"
 #include "runtime/threadSMR.hpp"
+#include "runtime/timer.hpp"
 #include "runtime/timerTrace.hpp"
 #include "runtime/vframe.inline.hpp"
 #include "utilities/debug.hpp"
@@ -336,6 +338,7 @@ void CompileQueue::add(CompileTask* task) {
   if (_size > _peak_size) {
     _peak_size = _size;
   }
+  PerfHistograms::record_compile_queue_length(_size);
 
   // Mark the method as being in the compile queue.
   task->method()->set_queued_for_compilation();
@@ -1881,6 +1884,41 @@ CompileLog* CompileBroker::get_log(CompilerThread* ct) {
 // CompileBroker::compiler_thread_loop
 //
 // The main loop run by a CompilerThread.
+// CPU time of the current compiler thread, or 0 if not supported.
+static jlong compile_cpu_time() {
+  return os::is_thread_cpu_time_supported() ? os::current_thread_cpu_time() : 0;
+}
+
+// With CompilerCPUPercent below 100, pause the compiler thread after a
+// compilation such that all compiler threads together use at most that share
+// of the CPUs available to the VM. os::active_processor_count() takes the CPU
+// quota of a container into account. Assumes that all compiler threads are
+// busy, which is the case during warm-up when throttling matters. Pauses
+// shorter than a millisecond are accumulated in debt_ns.
+void CompileBroker::throttle_compilation(CompilerThread* thread, jlong cpu_time_ns, jlong& debt_ns) {
+  if (CompilerCPUPercent >= 100 || cpu_time_ns <= 0) {
+    return;
+  }
+  int threads = 0;
+  if (compiler1() != nullptr) {
+    threads += compiler1()->num_compiler_threads();
+  }
+  if (compiler2() != nullptr) {
+    threads += compiler2()->num_compiler_threads();
+  }
+  double cpus = os::active_processor_count() * CompilerCPUPercent / 100.0;
+  double duty = cpus / MAX2(threads, 1);
+  if (duty >= 1.0) {
+    return;
+  }
+  debt_ns += (jlong)(cpu_time_ns * (1.0 / duty - 1.0));
+  if (debt_ns >= (jlong)NANOSECS_PER_MILLISEC) {
+    jlong sleep_ns = MIN2(debt_ns, (jlong)NANOSECS_PER_SEC);
+    debt_ns = 0;
+    thread->sleep_nanos(sleep_ns);
+  }
+}
+
 void CompileBroker::compiler_thread_loop() {
   CompilerThread* thread = CompilerThread::current();
   CompileQueue* queue = thread->queue();
@@ -1915,6 +1953,7 @@ void CompileBroker::compiler_thread_loop() {
   }
 
   thread->start_idle_timer();
+  jlong throttle_debt_ns = 0;
 
   // Poll for new compilation tasks as long as the JVM runs. Compilation
   // should only be disabled if something went wrong while initializing the
@@ -1924,6 +1963,7 @@ void CompileBroker::compiler_thread_loop() {
   while (!is_compilation_disabled_forever()) {
     // We need this HandleMark to avoid leaking VM handles.
     HandleMark hm(thread);
+    jlong compile_cpu_ns = 0;
 
     CompileTask* task = queue->get(thread);
     if (task == nullptr) {
@@ -1959,6 +1999,7 @@ void CompileBroker::compiler_thread_loop() {
         // Compile the method.
         if ((UseCompiler || AlwaysCompileLoopMethods) && CompileBroker::should_compile_new_jobs()) {
           invoke_compiler_on_method(task);
+          compile_cpu_ns = compile_cpu_time() - task->cpu_time_started();
           thread->start_idle_timer();
         } else {
           // After compilation is disabled, remove remaining methods from queue
@@ -1974,6 +2015,9 @@ void CompileBroker::compiler_thread_loop() {
         assert(!thread->has_pending_exception(), "should have been handled");
       }
     }
+    // Throttle after the task has been released, so that waiters on a
+    // blocking compilation are not delayed.
+    throttle_compilation(thread, compile_cpu_ns, throttle_debt_ns);
   }
 
   // Shut down compiler runtime
@@ -2116,6 +2160,8 @@ void CompileBroker::handle_compile_error(CompilerThread* thread, CompileTask* ta
 
 static void post_compilation_event(EventCompilation& event, CompileTask* task) {
   assert(task != nullptr, "invariant");
+  jlong queue_time_ns = (jlong)(TimeHelper::counter_to_seconds(task->time_started() - task->time_queued()) * NANOSECS_PER_SEC);
+  jlong cpu_time_ns = compile_cpu_time() - task->cpu_time_started();
   CompilerEvent::CompilationEvent::post(event,
                                         task->compile_id(),
                                         task->compiler()->type(),
@@ -2125,7 +2171,9 @@ static void post_compilation_event(EventCompilation& event, CompileTask* task) {
                                         task->osr_bci() != CompileBroker::standard_entry_bci,
                                         task->nm_total_size(),
                                         task->num_inlined_bytecodes(),
-                                        task->arena_bytes());
+                                        task->arena_bytes(),
+                                        queue_time_ns,
+                                        cpu_time_ns);
 }
 
 int DirectivesStack::_depth = 0;
@@ -2147,6 +2195,7 @@ static void whitebox_lock_compilation() {
 // Compile a method.
 //
 void CompileBroker::invoke_compiler_on_method(CompileTask* task) {
+  task->mark_started(os::elapsed_counter(), compile_cpu_time());
   task->print_ul();
   elapsedTimer time;
 
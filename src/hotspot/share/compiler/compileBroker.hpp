@@ -263,6 +263,7 @@ class CompileBroker: AllStatic {
   static void free_buffer_blob_if_allocated(CompilerThread* thread);
 
   static void invoke_compiler_on_method(CompileTask* task);
+  static void throttle_compilation(CompilerThread* thread, jlong cpu_time_ns, jlong& debt_ns);
   static void handle_compile_error(CompilerThread* thread, CompileTask* task, ciEnv* ci_env,
                                    int compilable, const char* failure_reason);
   static void update_compile_perf_data(CompilerThread *thread, const methodHandle& method, bool is_osr);
@@ -115,6 +115,7 @@ void CompileTask::initialize(int compile_id,
   _hot_count = hot_count;
   _time_queued = os::elapsed_counter();
   _time_started = 0;
+  _cpu_time_started = 0;
   _compile_reason = compile_reason;
   _nm_content_size = 0;
   AbstractCompiler* comp = compiler();
@@ -54,7 +54,8 @@ class CompilerEvent : AllStatic {
    public:
     static void post(EventCompilation& event, int compile_id, CompilerType type, Method* method,
                      int compile_level, bool success, bool is_osr, int code_size,
-                     int inlined_bytecodes, size_t arenaBytes) NOT_JFR_RETURN();
+                     int inlined_bytecodes, size_t arenaBytes, jlong queue_time_ns,
+                     jlong cpu_time_ns) NOT_JFR_RETURN();
   };
 
   class CompilationFailureEvent : AllStatic {
@@ -94,6 +94,12 @@
   product(bool, CICompilerCountPerCPU, false,                               \
           "1 compiler thread for log(N CPUs)")                              \
                                                                             \
+  product(uint, CompilerCPUPercent, 100, EXPERIMENTAL,                      \
+          "Limit the CPU time used by all compiler threads together to "    \
+          "this percentage of the CPUs available to the VM, by pausing "    \
+          "compiler threads after compilations")                            \
+          range(1, 100)                                                     \
+                                                                            \
   develop(intx, CICrashAt, -1,                                              \
           "id of compilation to trigger assert in compiler thread for "     \
           "the purpose of testing, e.g. generation of replay data")         \
@@ -211,6 +217,18 @@
           "Back edge threshold at which tier 4 OSR compilation is invoked") \
           range(0, max_jint)                                                \
                                                                             \
+  product(intx, Tier4MaxBytecodeSize, 0, EXPERIMENTAL,                      \
+          "Compile methods with more bytecodes than this only at tier 1, "  \
+          "skipping profiling and C2, because C2 would take too long for "  \
+          "them. 0 means no limit.")                                        \
+          range(0, max_jint)                                                \
+                                                                            \
+  product(uint, Tier0ThawWeight, 0, EXPERIMENTAL,                           \
+          "Number of invocations and back branches added to the counters "  \
+          "of a method when an interpreted or profiled frame of it is "     \
+          "thawed from a continuation. 0 disables.")                        \
+          range(0, 1024)                                                    \
+                                                                            \
   product(intx, Tier0Delay, 20, DIAGNOSTIC,                                 \
           "If C2 queue size grows over this amount per compiler thread "    \
           "do not start profiling in the interpreter")                      \
@@ -247,6 +265,13 @@
           "given timeout in milliseconds")                                  \
           range(0, max_intx)                                                \
                                                                             \
+  product(intx, TieredCompileTaskAgingMillis, 0, EXPERIMENTAL,              \
+          "Increase the priority of a task in the compile queue by its "    \
+          "initial priority for every given number of milliseconds it "     \
+          "waited, so that tasks are not starved by a steady stream of "    \
+          "hotter ones. 0 disables aging.")                                 \
+          range(0, max_intx)                                                \
+                                                                            \
   product(intx, TieredStopAtLevel, 4,                                       \
           "Stop at given compilation level")                                \
           range(0, 4)                                                       \
@@ -298,6 +323,16 @@
   product(ccstr, CompileCommandFile, nullptr,                               \
           "Read compiler commands from this file [.hotspot_compiler]")      \
                                                                             \
+  product(ccstr, DumpHotMethodsFile, nullptr, EXPERIMENTAL,                 \
+          "At exit, write a CompileThresholdScaling command for every "     \
+          "method compiled at the highest tier to this file. Reading it "   \
+          "with CompileCommandFile makes them reach that tier sooner.")     \
+                                                                            \
+  product(double, DumpHotMethodsThresholdScaling, 0.1, EXPERIMENTAL,        \
+          "CompileThresholdScaling value written by DumpHotMethodsFile "    \
+          "and Compiler.dump_hot_methods")                                  \
+          range(0.0, 1.0)                                                   \
+                                                                            \
   product(ccstr, CompilerDirectivesFile, nullptr, DIAGNOSTIC,               \
           "Read compiler directives from this file")                        \
                                                                             \
@@ -124,7 +124,6 @@ class EpsilonHeap : public CollectedHeap {
   void prepare_for_verify() override {}
   void verify(VerifyOption option) override {}
 
-  MemRegion reserved_region() const { return _reserved; }
   bool is_in_reserved(const void* addr) const { return _reserved.contains(addr); }
 
   // Support for loading objects from CDS archive into the heap
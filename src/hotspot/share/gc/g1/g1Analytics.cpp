@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2016, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -88,6 +88,7 @@ G1Analytics::G1Analytics(const G1Predictions* predictor) :
     _constant_other_time_ms_seq(TruncatedSeqLength),
     _young_other_cost_per_region_ms_seq(TruncatedSeqLength),
     _non_young_other_cost_per_region_ms_seq(TruncatedSeqLength),
+    _old_region_time_ratio_seq(TruncatedSeqLength),
     _recent_prev_end_times_for_all_gcs_sec(NumPrevPausesForHeuristics),
     _long_term_pause_time_ratio(0.0),
     _short_term_pause_time_ratio(0.0) {
@@ -213,6 +214,10 @@ void G1Analytics::report_constant_other_time_ms(double constant_other_time_ms) {
   _constant_other_time_ms_seq.add(constant_other_time_ms);
 }
 
+void G1Analytics::report_old_region_time_ratio(double ratio) {
+  _old_region_time_ratio_seq.add(ratio);
+}
+
 void G1Analytics::report_pending_cards(double pending_cards, bool for_young_only_phase) {
   _pending_cards_seq.add(pending_cards, for_young_only_phase);
 }
@@ -277,6 +282,13 @@ double G1Analytics::predict_non_young_other_time_ms(size_t non_young_num) const
   return non_young_num * predict_zero_bounded(&_non_young_other_cost_per_region_ms_seq);
 }
 
+double G1Analytics::predict_old_region_time_ratio() const {
+  if (!enough_samples_available(&_old_region_time_ratio_seq)) {
+    return 1.0;
+  }
+  return MAX2(predict_zero_bounded(&_old_region_time_ratio_seq), 1.0);
+}
+
 double G1Analytics::predict_remark_time_ms() const {
   return predict_zero_bounded(&_concurrent_mark_remark_times_ms);
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2016, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -69,6 +69,9 @@ class G1Analytics: public CHeapObj<mtGC> {
   TruncatedSeq _constant_other_time_ms_seq;
   TruncatedSeq _young_other_cost_per_region_ms_seq;
   TruncatedSeq _non_young_other_cost_per_region_ms_seq;
+  // Ratio between the observed and the predicted time to evacuate old regions
+  // in mixed gcs.
+  TruncatedSeq _old_region_time_ratio_seq;
 
   TruncatedSeq _cost_per_byte_ms_during_cm_seq;
 
@@ -136,6 +139,7 @@ class G1Analytics: public CHeapObj<mtGC> {
   void report_young_other_cost_per_region_ms(double other_cost_per_region_ms);
   void report_non_young_other_cost_per_region_ms(double other_cost_per_region_ms);
   void report_constant_other_time_ms(double constant_other_time_ms);
+  void report_old_region_time_ratio(double ratio);
   void report_pending_cards(double pending_cards, bool for_young_only_phase);
   void report_card_rs_length(double card_rs_length, bool for_young_only_phase);
   void report_code_root_rs_length(double code_root_rs_length, bool for_young_only_phase);
@@ -164,6 +168,10 @@ class G1Analytics: public CHeapObj<mtGC> {
 
   double predict_non_young_other_time_ms(size_t non_young_num) const;
 
+  // Factor to apply to the cost model prediction for old regions. Never below 1.0,
+  // and 1.0 until enough mixed gcs have been observed.
+  double predict_old_region_time_ratio() const;
+
   double predict_remark_time_ms() const;
 
   double predict_cleanup_time_ms() const;
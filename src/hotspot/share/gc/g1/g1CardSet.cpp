@@ -30,6 +30,7 @@
 #include "gc/shared/gcLogPrecious.hpp"
 #include "gc/shared/gcTraceTime.inline.hpp"
 #include "memory/allocation.inline.hpp"
+#include "memory/resourceArea.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/globals_extension.hpp"
 #include "runtime/java.hpp"
@@ -37,6 +38,7 @@
 #include "utilities/concurrentHashTable.inline.hpp"
 #include "utilities/concurrentHashTableTasks.inline.hpp"
 #include "utilities/globalDefinitions.hpp"
+#include "utilities/growableArray.hpp"
 
 G1CardSet::ContainerPtr G1CardSet::FullCardSet = (G1CardSet::ContainerPtr)-1;
 uint G1CardSet::_split_card_shift = 0;
@@ -1016,6 +1018,44 @@ size_t G1CardSet::num_containers() {
   return cl._count;
 }
 
+size_t G1CardSet::coarsen_howl_containers_to_full() {
+  // Containers can not be freed while scanning the table, as that happens inside a
+  // critical section, so first collect the candidates. Table entries are only
+  // removed at a safepoint.
+  ResourceMark rm;
+  GrowableArray<G1CardSetHashTableValue*> candidates;
+  auto collect =
+    [&] (G1CardSetHashTableValue* value) {
+      ContainerPtr container = Atomic::load(&value->_container);
+      if (container_type(container) == ContainerHowl && container != FullCardSet) {
+        candidates.append(value);
+      }
+      return true;
+    };
+  _table->iterate(collect);
+
+  size_t num_coarsened = 0;
+  for (int i = 0; i < candidates.length(); i++) {
+    G1CardSetHashTableValue* table_entry = candidates.at(i);
+    ContainerPtr container = acquire_container(&table_entry->_container);
+    if (container_type(container) == ContainerHowl && container != FullCardSet &&
+        Atomic::cmpxchg(&table_entry->_container, container, FullCardSet) == container) {
+      // Release the hash table reference, as in coarsen_container().
+      bool should_free = release_container(container);
+      assert(!should_free, "must have had more than one reference");
+      G1ReleaseCardsets rel(this);
+      container_ptr<G1CardSetHowl>(container)->iterate(rel, _config->num_buckets_in_howl());
+
+      uint prev_occupied = Atomic::xchg(&table_entry->_num_occupied, _config->max_cards_in_region(), memory_order_relaxed);
+      Atomic::add(&_num_occupied, (size_t)(_config->max_cards_in_region() - prev_occupied), memory_order_relaxed);
+      _coarsen_stats.record_coarsening(ContainerHowl, false /* collision */);
+      num_coarsened++;
+    }
+    release_and_maybe_free_container(container);
+  }
+  return num_coarsened;
+}
+
 G1CardSetCoarsenStats G1CardSet::coarsen_stats() {
   return _coarsen_stats;
 }
@@ -366,6 +366,11 @@ class G1CardSet : public CHeapObj<mtGCCardSet> {
 
   size_t num_containers();
 
+  // Coarsens all Howl containers to Full, releasing the memory of their buckets.
+  // May be called concurrently with adding cards, but not at a safepoint.
+  // Returns the number of containers coarsened by this call.
+  size_t coarsen_howl_containers_to_full();
+
   static G1CardSetCoarsenStats coarsen_stats();
   static void print_coarsen_stats(outputStream* out);
 
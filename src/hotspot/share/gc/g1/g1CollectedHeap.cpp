@@ -61,6 +61,7 @@
 #include "gc/g1/g1ParScanThreadState.inline.hpp"
 #include "gc/g1/g1PeriodicGCTask.hpp"
 #include "gc/g1/g1Policy.hpp"
+#include "gc/g1/g1PretenureTable.hpp"
 #include "gc/g1/g1RedirtyCardsQueue.hpp"
 #include "gc/g1/g1RegionPinCache.inline.hpp"
 #include "gc/g1/g1RegionToSpaceMapper.hpp"
@@ -1566,6 +1567,7 @@ bool G1CollectedHeap::should_do_concurrent_full_gc(GCCause::Cause cause) {
     case GCCause::_wb_breakpoint:           return true;
     case GCCause::_codecache_GC_aggressive: return true;
     case GCCause::_codecache_GC_threshold:  return true;
+    case GCCause::_native_memory_pressure:  return true;
     default:                                return is_user_requested_concurrent_full_gc(cause);
   }
 }
@@ -1678,7 +1680,8 @@ bool G1CollectedHeap::try_collect_concurrently(GCCause::Cause cause,
     VMThread::execute(&op);
 
     // Request is trivially finished.
-    if (cause == GCCause::_g1_periodic_collection) {
+    if (cause == GCCause::_g1_periodic_collection ||
+        cause == GCCause::_native_memory_pressure) {
       LOG_COLLECT_CONCURRENTLY_COMPLETE(cause, op.gc_succeeded());
       return op.gc_succeeded();
     }
@@ -1906,6 +1909,14 @@ void G1CollectedHeap::object_iterate(ObjectClosure* cl) {
   heap_region_iterate(&blk);
 }
 
+void G1CollectedHeap::object_iterate_part(ObjectClosure* cl, uint part) {
+  assert_at_safepoint();
+  G1HeapRegion* r = region_at_or_null(part);
+  if (r != nullptr && !r->is_free() && !r->is_continues_humongous()) {
+    r->object_iterate(cl);
+  }
+}
+
 class G1ParallelObjectIterator : public ParallelObjectIteratorImpl {
 private:
   G1CollectedHeap*  _heap;
@@ -1934,6 +1945,26 @@ void G1CollectedHeap::keep_alive(oop obj) {
   G1BarrierSet::enqueue_preloaded(obj);
 }
 
+// Detached pins bypass the thread-local G1RegionPinCache and update the
+// region pin count directly, so they may be released by any thread.
+bool G1CollectedHeap::pin_object_detached(oop obj) {
+  assert(obj != nullptr, "obj must not be null");
+  assert(!is_stw_gc_active(), "must not pin objects during a GC pause");
+  assert(obj->is_typeArray(), "must be typeArray");
+
+  heap_region_containing(obj)->add_pinned_object_count(1);
+  return true;
+}
+
+void G1CollectedHeap::unpin_object_detached(oop obj) {
+  assert(obj != nullptr, "obj must not be null");
+  assert(!is_stw_gc_active(), "must not unpin objects during a GC pause");
+
+  G1HeapRegion* hr = heap_region_containing(obj);
+  assert(hr->pinned_count() > 0, "unbalanced unpin of region %u", hr->hrm_index());
+  hr->add_pinned_object_count(~(size_t)0);
+}
+
 void G1CollectedHeap::heap_region_iterate(G1HeapRegionClosure* cl) const {
   _hrm.iterate(cl);
 }
@@ -2507,6 +2538,9 @@ void G1CollectedHeap::unload_classes_and_code(const char* description, BoolObjec
   {
     CodeCache::UnlinkingScope scope(is_alive);
     bool unloading_occurred = SystemDictionary::do_unloading(timer);
+    if (unloading_occurred && policy()->pretenure_table() != nullptr) {
+      policy()->pretenure_table()->clear();
+    }
     GCTraceTime(Debug, gc, phases) t("G1 Complete Cleaning", timer);
     complete_cleaning(unloading_occurred);
   }
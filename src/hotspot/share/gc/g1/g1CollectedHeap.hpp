@@ -559,6 +559,9 @@ class G1CollectedHeap : public CollectedHeap {
   void pin_object(JavaThread* thread, oop obj) override;
   void unpin_object(JavaThread* thread, oop obj) override;
 
+  bool pin_object_detached(oop obj) override;
+  void unpin_object_detached(oop obj) override;
+
   void resize_heap_if_necessary();
 
   // Check if there is memory to uncommit and if so schedule a task to do it.
@@ -700,23 +703,29 @@ class G1CollectedHeap : public CollectedHeap {
   template <typename Func>
   void iterate_regions_in_range(MemRegion range, const Func& func);
 
+  bool can_map_archived_objects() const override { return true; }
+
   // Commit the required number of G1 region(s) according to the size requested
   // and mark them as 'old' region(s). Preferred address is treated as a hint for
   // the location of the archive space in the heap. The returned address may or may
   // not be same as the preferred address.
   // This API is only used for allocating heap space for the archived heap objects
   // in the CDS archive.
-  HeapWord* alloc_archive_region(size_t word_size, HeapWord* preferred_addr);
+  HeapWord* alloc_archive_region(size_t word_size, HeapWord* preferred_addr) override;
 
   // Populate the G1BlockOffsetTable for archived regions with the given
   // memory range.
   void populate_archive_regions_bot(MemRegion range);
 
+  void complete_mapped_archive_space(MemRegion archive_space) override {
+    populate_archive_regions_bot(archive_space);
+  }
+
   // For the specified range, uncommit the containing G1 regions
   // which had been allocated by alloc_archive_regions. This should be called
   // at JVM init time if the archive heap's contents cannot be used (e.g., if
   // CRC check fails).
-  void dealloc_archive_regions(MemRegion range);
+  void dealloc_archive_regions(MemRegion range) override;
 
 private:
 
@@ -1074,6 +1083,10 @@ class G1CollectedHeap : public CollectedHeap {
 
   ParallelObjectIteratorImpl* parallel_object_iterator(uint thread_num) override;
 
+  // Incremental heap inspection iterates one region per part.
+  uint object_iterate_parts() const override { return max_reserved_regions(); }
+  void object_iterate_part(ObjectClosure* cl, uint part) override;
+
   // Keep alive an object that was loaded with AS_NO_KEEPALIVE.
   void keep_alive(oop obj) override;
 
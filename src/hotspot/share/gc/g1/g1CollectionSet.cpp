@@ -303,6 +303,7 @@ double G1CollectionSet::finalize_young_part(double target_pause_time_ms, G1Survi
   double predicted_eden_time = _policy->predict_young_region_other_time_ms(eden_region_length) +
                                _policy->predict_eden_copy_time_ms(eden_region_length);
   double remaining_time_ms = MAX2(target_pause_time_ms - (predicted_base_time_ms + predicted_eden_time), 0.0);
+  _policy->record_predicted_young_time_ms(predicted_base_time_ms + predicted_eden_time);
 
   log_trace(gc, ergo, cset)("Added young regions to CSet. Eden: %u regions, Survivors: %u regions, "
                             "predicted eden time: %1.2fms, predicted base time: %1.2fms, target pause time: %1.2fms, remaining time: %1.2fms",
@@ -390,6 +391,7 @@ void G1CollectionSet::move_candidates_to_collection_set(G1CollectionCandidateReg
   for (G1HeapRegion* r : *regions) {
     _g1h->clear_region_attr(r);
     add_old_region(r);
+    _policy->record_old_region_added_to_cset(r);
   }
   candidates()->remove(regions);
 }
@@ -32,9 +32,12 @@
 #include "gc/g1/g1HeapRegionRemSet.inline.hpp"
 #include "gc/g1/g1Policy.hpp"
 #include "gc/shared/gc_globals.hpp"
+#include "gc/shared/suspendibleThreadSet.hpp"
 #include "logging/log.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/iterator.hpp"
+#include "memory/resourceArea.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/java.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "utilities/debug.hpp"
@@ -149,6 +152,8 @@ G1ConcurrentRefine::G1ConcurrentRefine(G1Policy* policy) :
   _pending_cards_target(PendingCardsTargetUninitialized),
   _last_adjust(),
   _needs_adjust(false),
+  _rem_set_budget_check_needed(false),
+  _rem_set_budget_coarsenings(0),
   _threads_needed(policy, adjust_threads_period_ms()),
   _thread_control(G1ConcRefinementThreads),
   _dcqs(G1BarrierSet::dirty_card_queue_set())
@@ -225,6 +230,7 @@ void G1ConcurrentRefine::adjust_after_gc(double logged_cards_time_ms,
     // thread, in case it is waiting.
     _dcqs.set_mutator_refinement_threshold(SIZE_MAX);
     _needs_adjust = true;
+    _rem_set_budget_check_needed = G1RemSetMemoryBudgetPercent > 0;
     if (is_pending_cards_target_initialized()) {
       _thread_control.activate(0);
     }
@@ -295,6 +301,95 @@ void G1ConcurrentRefine::adjust_young_list_target_length() {
   }
 }
 
+class G1ConcurrentRefine::RemSetBudgetClosure : public G1HeapRegionClosure {
+  struct Candidate {
+    G1HeapRegion* _region;
+    size_t _used_bytes;
+  };
+
+  GrowableArray<Candidate> _candidates;
+  size_t _used_bytes;
+
+  static size_t used_bytes(G1CardSet* card_set) {
+    return card_set->mem_size() - MIN2(card_set->unused_mem_size(), card_set->mem_size());
+  }
+
+  static int compare_used_bytes(Candidate* a, Candidate* b) {
+    // Largest first.
+    if (a->_used_bytes > b->_used_bytes) {
+      return -1;
+    } else if (a->_used_bytes < b->_used_bytes) {
+      return 1;
+    }
+    return 0;
+  }
+
+public:
+  RemSetBudgetClosure() :
+    _candidates(),
+    _used_bytes(used_bytes(G1CollectedHeap::heap()->young_regions_cardset())) {}
+
+  bool do_heap_region(G1HeapRegion* r) override {
+    G1HeapRegionRemSet* rem_set = r->rem_set();
+    // Group card sets are accounted for once, above.
+    if (!rem_set->has_group_cardset()) {
+      size_t used = used_bytes(rem_set->card_set());
+      _used_bytes += used;
+      if (r->is_old_or_humongous() && rem_set->is_tracked()) {
+        _candidates.append({r, used});
+      }
+    }
+    return false;
+  }
+
+  size_t used_bytes() const { return _used_bytes; }
+
+  // Coarsens the card sets of the candidates, largest first, until the used
+  // memory does not exceed the budget. Returns the number of containers coarsened.
+  size_t coarsen_until(size_t budget) {
+    _candidates.sort(compare_used_bytes);
+
+    size_t num_coarsened = 0;
+    for (int i = 0; i < _candidates.length(); i++) {
+      if (_used_bytes <= budget || SuspendibleThreadSet::should_yield()) {
+        break;
+      }
+      const Candidate& c = _candidates.at(i);
+      G1CardSet* card_set = c._region->rem_set()->card_set();
+      num_coarsened += card_set->coarsen_howl_containers_to_full();
+      _used_bytes -= c._used_bytes - MIN2(used_bytes(card_set), c._used_bytes);
+    }
+    return num_coarsened;
+  }
+};
+
+bool G1ConcurrentRefine::coarsen_rem_sets_if_over_budget() {
+  assert_current_thread_is_primary_refinement_thread();
+
+  if (!_rem_set_budget_check_needed) {
+    return false;
+  }
+  _rem_set_budget_check_needed = false;
+
+  G1CollectedHeap* g1h = G1CollectedHeap::heap();
+  ResourceMark rm;
+  RemSetBudgetClosure cl;
+  g1h->heap_region_iterate(&cl);
+
+  const size_t budget = g1h->capacity() / 100 * G1RemSetMemoryBudgetPercent;
+  const size_t used_before = cl.used_bytes();
+  if (used_before > budget) {
+    // Coarsening frees the Howl buckets into the card set's free lists, to be
+    // reused by later additions to that card set.
+    size_t num_coarsened = cl.coarsen_until(budget);
+    Atomic::add(&_rem_set_budget_coarsenings, num_coarsened, memory_order_relaxed);
+    log_debug(gc, remset)("Remembered sets over budget: used %zuB budget %zuB, "
+                          "coarsened %zu containers, now used %zuB",
+                          used_before, budget, num_coarsened, cl.used_bytes());
+  }
+  return true;
+}
+
 bool G1ConcurrentRefine::adjust_threads_periodically() {
   assert_current_thread_is_primary_refinement_thread();
 
@@ -28,6 +28,7 @@
 #include "gc/g1/g1ConcurrentRefineStats.hpp"
 #include "gc/g1/g1ConcurrentRefineThreadsNeeded.hpp"
 #include "memory/allocation.hpp"
+#include "runtime/atomic.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/growableArray.hpp"
@@ -115,6 +116,8 @@ class G1ConcurrentRefine : public CHeapObj<mtGC> {
   Ticks _last_adjust;
   Ticks _last_deactivate;
   bool _needs_adjust;
+  bool _rem_set_budget_check_needed;
+  size_t _rem_set_budget_coarsenings;
   G1ConcurrentRefineThreadsNeeded _threads_needed;
   G1ConcurrentRefineThreadControl _thread_control;
   G1DirtyCardQueueSet& _dcqs;
@@ -151,6 +154,8 @@ class G1ConcurrentRefine : public CHeapObj<mtGC> {
 
   void adjust_threads_wanted(size_t available_bytes);
 
+  class RemSetBudgetClosure;    // Helper class for the remembered set budget.
+
   NONCOPYABLE(G1ConcurrentRefine);
 
 public:
@@ -197,6 +202,19 @@ class G1ConcurrentRefine : public CHeapObj<mtGC> {
   // precondition: current thread is the primary refinement thread.
   bool is_thread_adjustment_needed() const;
 
+  // If requested at the end of the last GC, checks the memory used by the
+  // remembered sets against G1RemSetMemoryBudgetPercent of the committed heap,
+  // and if over budget coarsens the largest remembered sets of old regions
+  // until back below it. Returns true if the check was performed.
+  // precondition: current thread is the primary refinement thread.
+  bool coarsen_rem_sets_if_over_budget();
+
+  // Total number of card set containers coarsened to meet the remembered set
+  // memory budget.
+  size_t rem_set_budget_coarsenings() const {
+    return Atomic::load(&_rem_set_budget_coarsenings);
+  }
+
   // Reduce the number of active threads wanted.
   // precondition: current thread is the primary refinement thread.
   void reduce_threads_wanted();
@@ -171,6 +171,10 @@ void G1PrimaryConcurrentRefineThread::do_refinement_step() {
   // refinement.  However, adjustment may be pending but temporarily
   // blocked. In that case we *do* try refinement, rather than possibly
   // uselessly spinning while waiting for adjustment to succeed.
+  if (cr()->coarsen_rem_sets_if_over_budget()) {
+    // Checking the remembered set budget counts as the work of this round.
+    return;
+  }
   if (!cr()->adjust_threads_periodically()) {
     // No adjustment, so try refinement, with the target as a cuttoff.
     if (!try_refinement_step(cr()->pending_cards_target())) {
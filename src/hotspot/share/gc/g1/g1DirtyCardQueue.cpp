@@ -50,16 +50,30 @@
 #include "utilities/macros.hpp"
 #include "utilities/nonblockingQueue.inline.hpp"
 #include "utilities/pair.hpp"
+#include "utilities/powerOfTwo.hpp"
 #include "utilities/quickSort.hpp"
 #include "utilities/ticks.hpp"
 
 G1DirtyCardQueue::G1DirtyCardQueue(G1DirtyCardQueueSet* qset) :
   PtrQueue(qset),
-  _refinement_stats(new G1ConcurrentRefineStats())
+  _refinement_stats(new G1ConcurrentRefineStats()),
+  _card_filter(nullptr)
 { }
 
 G1DirtyCardQueue::~G1DirtyCardQueue() {
   delete _refinement_stats;
+  FREE_C_HEAP_ARRAY(G1CardTable::CardValue*, _card_filter);
+}
+
+static size_t card_filter_size() {
+  return round_up_power_of_2(G1DirtyCardFilterSize);
+}
+
+G1CardTable::CardValue** G1DirtyCardQueue::card_filter() {
+  if (_card_filter == nullptr) {
+    _card_filter = NEW_C_HEAP_ARRAY(G1CardTable::CardValue*, card_filter_size(), mtGC);
+  }
+  return _card_filter;
 }
 
 // Assumed to be zero by concurrent threads.
@@ -101,13 +115,48 @@ void G1DirtyCardQueueSet::enqueue(G1DirtyCardQueue& queue,
   }
 }
 
+bool G1DirtyCardQueueSet::deduplicate_full_buffer(G1DirtyCardQueue& queue) {
+  assert(queue.index() == 0, "precondition");
+  assert(G1DirtyCardFilterSize > 0, "precondition");
+  // Only cards in the buffer being filled are filtered.  This buffer has
+  // not been published yet, so refinement has not seen, or cleaned, any of
+  // its cards; a duplicate would just find a clean card when refined.  The
+  // filter is direct mapped and is cleared for each buffer, so it never
+  // drops a card that is not already in the buffer.
+  CardValue** filter = queue.card_filter();
+  const size_t mask = card_filter_size() - 1;
+  memset(filter, 0, card_filter_size() * sizeof(CardValue*));
+
+  void** buffer = queue.buffer();
+  const size_t capacity = buffer_capacity();
+  size_t fill = capacity;
+  // Cards are added at decreasing indexes; keep the first occurrence of
+  // each card in enqueue order, which is scanning from the high end.
+  for (size_t i = capacity; i > 0; --i) {
+    CardValue* card = static_cast<CardValue*>(buffer[i - 1]);
+    size_t slot = reinterpret_cast<uintptr_t>(card) & mask;
+    if (filter[slot] == card) {
+      continue;
+    }
+    filter[slot] = card;
+    buffer[--fill] = card;
+  }
+  queue.set_index(fill);
+  // Reuse the buffer only if a reasonable part of it was freed, so the
+  // filter is not run again after only a few more cards.
+  return fill >= capacity / 8;
+}
+
 void G1DirtyCardQueueSet::handle_zero_index(G1DirtyCardQueue& queue) {
   assert(queue.index() == 0, "precondition");
+  if (G1DirtyCardFilterSize > 0 && queue.buffer() != nullptr && deduplicate_full_buffer(queue)) {
+    return;
+  }
   BufferNode* old_node = exchange_buffer_with_new(queue);
   if (old_node != nullptr) {
-    assert(old_node->index() == 0, "invariant");
+    assert(old_node->index() == 0 || G1DirtyCardFilterSize > 0, "invariant");
     G1ConcurrentRefineStats* stats = queue.refinement_stats();
-    stats->inc_dirtied_cards(old_node->capacity());
+    stats->inc_dirtied_cards(old_node->size());
     handle_completed_buffer(old_node, stats);
   }
 }
@@ -43,6 +43,8 @@ class Thread;
 // A ptrQueue whose elements are "oops", pointers to object heads.
 class G1DirtyCardQueue: public PtrQueue {
   G1ConcurrentRefineStats* _refinement_stats;
+  // Lazily allocated table for G1DirtyCardFilterSize.
+  G1CardTable::CardValue** _card_filter;
 
 public:
   G1DirtyCardQueue(G1DirtyCardQueueSet* qset);
@@ -55,6 +57,8 @@ class G1DirtyCardQueue: public PtrQueue {
     return _refinement_stats;
   }
 
+  G1CardTable::CardValue** card_filter();
+
   // Compiler support.
   static ByteSize byte_offset_of_index() {
     return PtrQueue::byte_offset_of_index<G1DirtyCardQueue>();
@@ -222,6 +226,11 @@ class G1DirtyCardQueueSet: public PtrQueueSet {
   // Called when queue is full or has no buffer.
   void handle_zero_index(G1DirtyCardQueue& queue);
 
+  // Remove duplicate cards from the full buffer of queue, compacting the
+  // remaining cards to the end of the buffer.  Returns true if that freed
+  // enough space for the queue to keep using the buffer.
+  bool deduplicate_full_buffer(G1DirtyCardQueue& queue);
+
   // Enqueue the buffer, and optionally perform refinement by the mutator.
   // Mutator refinement is only done by Java threads, and only if there
   // are more than mutator_refinement_threshold cards in the completed buffers.
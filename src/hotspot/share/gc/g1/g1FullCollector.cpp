@@ -353,13 +353,16 @@ void G1FullCollector::phase2_prepare_compaction() {
 
   bool has_free_compaction_targets = phase2b_forward_oops();
 
+  bool compact_humongous = scope()->do_maximal_compaction() ||
+                           (has_humongous() && is_fragmented_by_humongous());
+
   // Try to avoid OOM immediately after Full GC in case there are no free regions
   // left after determining the result locations (i.e. this phase). Prepare to
   // maximally compact the tail regions of the compaction queues serially.
-  if (scope()->do_maximal_compaction() || !has_free_compaction_targets) {
+  if (compact_humongous || !has_free_compaction_targets) {
     phase2c_prepare_serial_compaction();
 
-    if (scope()->do_maximal_compaction() &&
+    if (compact_humongous &&
         has_humongous() &&
         serial_compaction_point()->has_regions()) {
       phase2d_prepare_humongous_compaction();
@@ -367,6 +370,38 @@ void G1FullCollector::phase2_prepare_compaction() {
   }
 }
 
+bool G1FullCollector::is_fragmented_by_humongous() const {
+  if (G1HumongousCompactionFragmentationPercent == 0) {
+    return false;
+  }
+
+  // Humongous objects and pinned regions stay in place. Everything in
+  // between is compacted or free, so the runs of such regions are the
+  // contiguous space humongous allocations can use after this collection.
+  uint num_movable = 0;
+  uint largest_run = 0;
+  uint current_run = 0;
+  for (uint i = 0; i < _heap->max_reserved_regions(); i++) {
+    G1HeapRegion* hr = _heap->region_at_or_null(i);
+    if (hr != nullptr && (hr->is_humongous() || hr->has_pinned_objects())) {
+      current_run = 0;
+      continue;
+    }
+    num_movable++;
+    current_run++;
+    largest_run = MAX2(largest_run, current_run);
+  }
+
+  if (num_movable == 0) {
+    return false;
+  }
+
+  uint fragmented_percent = (uint)(100.0 * (num_movable - largest_run) / num_movable);
+  log_debug(gc, phases)("Humongous fragmentation: %u%% of %u regions outside largest run of %u regions (threshold %u%%)",
+                        fragmented_percent, num_movable, largest_run, G1HumongousCompactionFragmentationPercent);
+  return fragmented_percent >= G1HumongousCompactionFragmentationPercent;
+}
+
 void G1FullCollector::phase2a_determine_worklists() {
   GCTraceTime(Debug, gc, phases) debug("Phase 2: Determine work lists", scope()->timer());
 
@@ -494,7 +529,8 @@ void G1FullCollector::phase4_do_compaction() {
   }
 
   if (!_humongous_compaction_regions.is_empty()) {
-    assert(scope()->do_maximal_compaction(), "Only compact humongous during maximal compaction");
+    assert(scope()->do_maximal_compaction() || G1HumongousCompactionFragmentationPercent > 0,
+           "Only compact humongous during maximal compaction or if fragmented");
     task.humongous_compaction();
   }
 }
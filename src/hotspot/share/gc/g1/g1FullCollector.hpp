@@ -161,6 +161,11 @@ class G1FullCollector : StackObj {
   void phase2c_prepare_serial_compaction();
   void phase2d_prepare_humongous_compaction();
 
+  // Whether humongous objects split the rest of the heap enough to be moved
+  // even if this is not a maximal compaction, see
+  // G1HumongousCompactionFragmentationPercent.
+  bool is_fragmented_by_humongous() const;
+
   void phase3_adjust_pointers();
   void phase4_do_compaction();
   void phase5_reset_metadata();
@@ -264,6 +264,19 @@ void G1GCPhaseTimes::record_gc_pause_end() {
 #undef ASSERT_PHASE_UNINITIALIZED
 
 // record the time a phase took in seconds
+double G1GCPhaseTimes::sum_evacuation_busy_time_secs() {
+  double uninitialized = WorkerDataArray<double>::uninitialized();
+  double sum = 0.0;
+  for (uint i = 0; i < _max_gc_threads; i++) {
+    double worker_start = _gc_par_phases[GCWorkerStart]->get(i);
+    double worker_end = _gc_par_phases[GCWorkerEnd]->get(i);
+    if (worker_start != uninitialized && worker_end != uninitialized) {
+      sum += (worker_end - worker_start) - worker_time(Termination, i);
+    }
+  }
+  return sum;
+}
+
 void G1GCPhaseTimes::record_time_secs(GCParPhases phase, uint worker_id, double secs) {
   _gc_par_phases[phase]->set(worker_id, secs);
 }
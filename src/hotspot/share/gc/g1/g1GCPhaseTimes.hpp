@@ -272,6 +272,10 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
   // return the average time for a phase in milliseconds
   double average_time_ms(GCParPhases phase) const;
 
+  // Sum over the workers of the time spent in the evacuation task so far,
+  // excluding termination, in seconds.
+  double sum_evacuation_busy_time_secs();
+
   size_t sum_thread_work_items(GCParPhases phase, uint index = 0);
 
   void record_pre_evacuate_prepare_time_ms(double ms) {
@@ -30,6 +30,7 @@
 #include "gc/g1/g1HeapRegionPrinter.hpp"
 #include "gc/g1/g1OopClosures.inline.hpp"
 #include "gc/g1/g1ParScanThreadState.inline.hpp"
+#include "gc/g1/g1PretenureTable.hpp"
 #include "gc/g1/g1RootClosures.hpp"
 #include "gc/g1/g1StringDedup.hpp"
 #include "gc/g1/g1Trace.hpp"
@@ -73,6 +74,9 @@ G1ParScanThreadState::G1ParScanThreadState(G1CollectedHeap* g1h,
     _plab_allocator(nullptr),
     _age_table(false),
     _tenuring_threshold(g1h->policy()->tenuring_threshold()),
+    _pretenure_table(g1h->policy()->pretenure_table()),
+    _pretenure_samples(nullptr),
+    _pretenure_probe_counter(0),
     _scanner(g1h, this),
     _worker_id(worker_id),
     _last_enqueued_card(SIZE_MAX),
@@ -114,6 +118,10 @@ G1ParScanThreadState::G1ParScanThreadState(G1CollectedHeap* g1h,
 
   _oops_into_optional_regions = new G1OopStarChunkedList[_max_num_optional_regions];
 
+  if (_pretenure_table != nullptr) {
+    _pretenure_samples = new G1PretenureSamples();
+  }
+
   initialize_numa_stats();
 }
 
@@ -123,6 +131,9 @@ size_t G1ParScanThreadState::flush_stats(size_t* surviving_young_words, uint num
   // Update allocation statistics.
   _plab_allocator->flush_and_retire_stats(num_workers);
   _g1h->policy()->record_age_table(&_age_table);
+  if (_pretenure_samples != nullptr) {
+    _pretenure_table->merge(_pretenure_samples);
+  }
 
   if (_evacuation_failed_info.has_failed()) {
     _g1h->gc_tracer_stw()->report_evacuation_failed(_evacuation_failed_info);
@@ -142,6 +153,7 @@ G1ParScanThreadState::~G1ParScanThreadState() {
   FREE_C_HEAP_ARRAY(size_t, _surviving_young_words_base);
   delete[] _oops_into_optional_regions;
   FREE_C_HEAP_ARRAY(size_t, _obj_alloc_stat);
+  delete _pretenure_samples;
 }
 
 size_t G1ParScanThreadState::lab_waste_words() const {
@@ -386,13 +398,22 @@ HeapWord* G1ParScanThreadState::allocate_in_next_plab(G1HeapRegionAttr* dest,
   }
 }
 
-G1HeapRegionAttr G1ParScanThreadState::next_region_attr(G1HeapRegionAttr const region_attr, markWord const m, uint& age) {
+bool G1ParScanThreadState::should_pretenure(Klass* klass) {
+  if (_pretenure_table == nullptr || !_pretenure_table->should_pretenure(klass)) {
+    return false;
+  }
+  // Keep copying some objects into the survivor space to notice when the
+  // class stops surviving.
+  return (++_pretenure_probe_counter % G1PretenureTable::ProbeInterval) != 0;
+}
+
+G1HeapRegionAttr G1ParScanThreadState::next_region_attr(G1HeapRegionAttr const region_attr, markWord const m, Klass* klass, uint& age) {
   assert(region_attr.is_young() || region_attr.is_old(), "must be either Young or Old");
 
   if (region_attr.is_young()) {
     age = !m.has_displaced_mark_helper() ? m.age()
                                          : m.displaced_mark_helper().age();
-    if (age < _tenuring_threshold) {
+    if (age < _tenuring_threshold && (age > 0 || !should_pretenure(klass))) {
       return region_attr;
     }
   }
@@ -477,15 +498,19 @@ oop G1ParScanThreadState::do_copy_to_survivor_space(G1HeapRegionAttr const regio
   // Get the klass once.  We'll need it again later, and this avoids
   // re-decoding when it's compressed.
   Klass* klass = old->klass();
-  const size_t word_sz = old->size_given_klass(klass);
+  const size_t old_word_sz = old->size_given_klass(klass);
 
   // JNI only allows pinning of typeArrays, so we only need to keep those in place.
   if (region_attr.is_pinned() && klass->is_typeArray_klass()) {
-    return handle_evacuation_failure_par(old, old_mark, word_sz, true /* cause_pinned */);
+    return handle_evacuation_failure_par(old, old_mark, old_word_sz, true /* cause_pinned */);
   }
 
+  // The copy of a stack chunk may be smaller than the original.
+  const size_t trimmed_word_sz = ContinuationGCSupport::trimmed_stack_chunk_size(old, klass);
+  const size_t word_sz = trimmed_word_sz != 0 ? trimmed_word_sz : old_word_sz;
+
   uint age = 0;
-  G1HeapRegionAttr dest_attr = next_region_attr(region_attr, old_mark, age);
+  G1HeapRegionAttr dest_attr = next_region_attr(region_attr, old_mark, klass, age);
   G1HeapRegion* const from_region = _g1h->heap_region_containing(old);
   uint node_index = from_region->node_index();
 
@@ -498,7 +523,7 @@ oop G1ParScanThreadState::do_copy_to_survivor_space(G1HeapRegionAttr const regio
     if (obj_ptr == nullptr) {
       // This will either forward-to-self, or detect that someone else has
       // installed a forwarding pointer.
-      return handle_evacuation_failure_par(old, old_mark, word_sz, false /* cause_pinned */);
+      return handle_evacuation_failure_par(old, old_mark, old_word_sz, false /* cause_pinned */);
     }
   }
 
@@ -510,12 +535,16 @@ oop G1ParScanThreadState::do_copy_to_survivor_space(G1HeapRegionAttr const regio
     // Doing this after all the allocation attempts also tests the
     // undo_allocation() method too.
     undo_allocation(dest_attr, obj_ptr, word_sz, node_index);
-    return handle_evacuation_failure_par(old, old_mark, word_sz, false /* cause_pinned */);
+    return handle_evacuation_failure_par(old, old_mark, old_word_sz, false /* cause_pinned */);
   }
 
   // We're going to allocate linearly, so might as well prefetch ahead.
   Prefetch::write(obj_ptr, PrefetchCopyIntervalInBytes);
-  Copy::aligned_disjoint_words(cast_from_oop<HeapWord*>(old), obj_ptr, word_sz);
+  if (trimmed_word_sz != 0) {
+    ContinuationGCSupport::copy_trimmed_stack_chunk(old, obj_ptr, trimmed_word_sz);
+  } else {
+    Copy::aligned_disjoint_words(cast_from_oop<HeapWord*>(old), obj_ptr, word_sz);
+  }
 
   const oop obj = cast_to_oop(obj_ptr);
   // Because the forwarding is done with memory_order_relaxed there is no
@@ -532,6 +561,10 @@ oop G1ParScanThreadState::do_copy_to_survivor_space(G1HeapRegionAttr const regio
       _surviving_young_words[young_index] += word_sz;
     }
 
+    if (_pretenure_samples != nullptr && region_attr.is_young() && age <= 1) {
+      _pretenure_samples->add(klass, age, dest_attr.is_young());
+    }
+
     if (dest_attr.is_young()) {
       if (age < markWord::max_age) {
         age++;
@@ -638,6 +671,11 @@ void G1ParScanThreadStateSet::flush_stats() {
   dcq.merge_bufferlists(rdcqs());
   rdcqs()->verify_empty();
 
+  G1PretenureTable* pretenure_table = _g1h->policy()->pretenure_table();
+  if (pretenure_table != nullptr) {
+    pretenure_table->update();
+  }
+
   _flushed = true;
 }
 
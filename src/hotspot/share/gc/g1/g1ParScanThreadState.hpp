@@ -47,6 +47,8 @@ class G1EvacFailureRegions;
 class G1EvacuationRootClosures;
 class G1OopStarChunkedList;
 class G1PLABAllocator;
+class G1PretenureSamples;
+class G1PretenureTable;
 class G1HeapRegion;
 class PreservedMarks;
 class PreservedMarksSet;
@@ -64,6 +66,13 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
   AgeTable _age_table;
   // Local tenuring threshold.
   uint _tenuring_threshold;
+  // Pretenuring decisions and the samples gathered for them; null if
+  // pretenuring is disabled.
+  G1PretenureTable* _pretenure_table;
+  G1PretenureSamples* _pretenure_samples;
+  // Selects the objects of pretenured classes still copied into the survivor
+  // space for sampling.
+  uint _pretenure_probe_counter;
   G1ScanEvacuatedObjClosure _scanner;
 
   uint _worker_id;
@@ -208,7 +217,8 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
                                   bool previous_plab_refill_failed,
                                   uint node_index);
 
-  inline G1HeapRegionAttr next_region_attr(G1HeapRegionAttr const region_attr, markWord const m, uint& age);
+  inline bool should_pretenure(Klass* klass);
+  inline G1HeapRegionAttr next_region_attr(G1HeapRegionAttr const region_attr, markWord const m, Klass* klass, uint& age);
 
   void report_promotion_event(G1HeapRegionAttr const dest_attr,
                               oop const old, size_t word_sz, uint age,
@@ -28,6 +28,7 @@
 #include "gc/g1/g1ConcurrentMarkThread.inline.hpp"
 #include "gc/g1/g1GCCounters.hpp"
 #include "gc/g1/g1PeriodicGCTask.hpp"
+#include "gc/shared/nativeMemoryPressure.hpp"
 #include "gc/shared/suspendibleThreadSet.hpp"
 #include "logging/log.hpp"
 #include "runtime/globals.hpp"
@@ -85,14 +86,52 @@ void G1PeriodicGCTask::check_for_periodic_gc() {
   }
 }
 
+bool G1PeriodicGCTask::should_start_native_memory_pressure_gc(G1CollectedHeap* g1h,
+                                                              G1GCCounters* counters) {
+  SuspendibleThreadSetJoiner sts;
+
+  // A concurrent cycle in progress will find the dead buffers.
+  if (g1h->concurrent_mark()->cm_thread()->in_progress()) {
+    return false;
+  }
+
+  if (!NativeMemoryPressure::should_collect()) {
+    return false;
+  }
+
+  *counters = G1GCCounters(g1h);
+  return true;
+}
+
+void G1PeriodicGCTask::check_for_native_memory_pressure_gc() {
+  if (!NativeMemoryPressure::is_enabled()) {
+    return;
+  }
+
+  G1CollectedHeap* g1h = G1CollectedHeap::heap();
+  G1GCCounters counters;
+  if (should_start_native_memory_pressure_gc(g1h, &counters)) {
+    NativeMemoryPressure::record_collection();
+    if (!g1h->try_collect(GCCause::_native_memory_pressure, counters)) {
+      log_debug(gc, ergo)("Native memory pressure GC request denied. Skipping.");
+    }
+  }
+}
+
 G1PeriodicGCTask::G1PeriodicGCTask(const char* name) :
   G1ServiceTask(name) { }
 
 void G1PeriodicGCTask::execute() {
   check_for_periodic_gc();
+  check_for_native_memory_pressure_gc();
   // G1PeriodicGCInterval is a manageable flag and can be updated
   // during runtime. If no value is set, wait a second and run it
   // again to see if the value has been updated. Otherwise use the
-  // real value provided.
-  schedule(G1PeriodicGCInterval == 0 ? 1000 : G1PeriodicGCInterval);
+  // real value provided. Native memory pressure is checked at least
+  // once a second.
+  uintx delay = G1PeriodicGCInterval == 0 ? 1000 : G1PeriodicGCInterval;
+  if (NativeMemoryPressure::is_enabled()) {
+    delay = MIN2(delay, (uintx)1000);
+  }
+  schedule(delay);
 }
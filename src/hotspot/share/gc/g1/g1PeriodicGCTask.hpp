@@ -30,12 +30,17 @@
 class G1CollectedHeap;
 class G1GCCounters;
 
-// Task handling periodic GCs
+// Task handling periodic GCs, and GCs started because of native memory
+// pressure (see NativeMemoryPressure).
 class G1PeriodicGCTask : public G1ServiceTask {
   bool should_start_periodic_gc(G1CollectedHeap* g1h,
                                 G1GCCounters* counters);
   void check_for_periodic_gc();
 
+  bool should_start_native_memory_pressure_gc(G1CollectedHeap* g1h,
+                                              G1GCCounters* counters);
+  void check_for_native_memory_pressure_gc();
+
 public:
   G1PeriodicGCTask(const char* name);
   virtual void execute();
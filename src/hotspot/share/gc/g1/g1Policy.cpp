@@ -39,6 +39,7 @@
 #include "gc/g1/g1IHOPControl.hpp"
 #include "gc/g1/g1GCPhaseTimes.hpp"
 #include "gc/g1/g1Policy.hpp"
+#include "gc/g1/g1PretenureTable.hpp"
 #include "gc/g1/g1SurvivorRegions.hpp"
 #include "gc/g1/g1YoungGenSizer.hpp"
 #include "gc/shared/concurrentGCBreakpoints.hpp"
@@ -71,6 +72,8 @@ G1Policy::G1Policy(STWGCTimer* gc_timer) :
   _free_regions_at_end_of_collection(0),
   _card_rs_length(0),
   _pending_cards_at_gc_start(0),
+  _predicted_young_time_ms(0.0),
+  _predicted_old_time_ms(0.0),
   _concurrent_start_to_mixed(),
   _collection_set(nullptr),
   _g1h(nullptr),
@@ -78,14 +81,17 @@ G1Policy::G1Policy(STWGCTimer* gc_timer) :
   _phase_times(nullptr),
   _mark_remark_start_sec(0),
   _mark_cleanup_start_sec(0),
+  _evacuation_worker_count("Evacuate Collection Set", ParallelGCThreads),
   _tenuring_threshold(MaxTenuringThreshold),
   _max_survivor_regions(0),
-  _survivors_age_table(true)
+  _survivors_age_table(true),
+  _pretenure_table(G1PretenureSurvivalPercent > 0 ? new G1PretenureTable() : nullptr)
 {
 }
 
 G1Policy::~G1Policy() {
   delete _ihop_control;
+  delete _pretenure_table;
 }
 
 G1CollectorState* G1Policy::collector_state() const { return _g1h->collector_state(); }
@@ -601,6 +607,12 @@ void G1Policy::record_full_collection_end() {
 
   _old_gen_alloc_tracker.reset_after_gc(_g1h->humongous_regions_count() * G1HeapRegion::GrainBytes);
 
+  // All survivors have been compacted into old regions, so the next young
+  // collection will not see any second survivals.
+  if (_pretenure_table != nullptr) {
+    _pretenure_table->clear();
+  }
+
   record_pause(G1GCPauseType::FullGC, _full_collection_start_sec, end_sec);
 }
 
@@ -936,6 +948,18 @@ void G1Policy::record_young_collection_end(bool concurrent_operation_is_full_mar
 
     _analytics->report_constant_other_time_ms(constant_other_time_ms(pause_time_ms));
 
+    // Attribute the difference between the pause time and the young part of the
+    // prediction to the old regions. Only do so if the old regions were expected
+    // to make up a significant part of the pause, otherwise the ratio is noise.
+    if (G1GCPauseTypeHelper::is_mixed_pause(this_pause) &&
+        _predicted_old_time_ms > pause_time_ms * 0.1) {
+      double old_time_ms = MAX2(pause_time_ms - _predicted_young_time_ms, 0.0);
+      double ratio = old_time_ms / _predicted_old_time_ms;
+      log_debug(gc, ergo, cset)("Old regions predicted: %1.2fms, observed: %1.2fms, ratio: %1.2f",
+                                _predicted_old_time_ms, old_time_ms, ratio);
+      _analytics->report_old_region_time_ratio(ratio);
+    }
+
     _analytics->report_pending_cards((double)pending_cards_at_gc_start(), is_young_only_pause);
     _analytics->report_card_rs_length((double)_card_rs_length, is_young_only_pause);
     _analytics->report_code_root_rs_length((double)total_code_roots_scanned, is_young_only_pause);
@@ -1159,12 +1183,24 @@ double G1Policy::predict_region_non_copy_time_ms(G1HeapRegion* hr,
   return region_elapsed_time_ms;
 }
 
-double G1Policy::predict_region_total_time_ms(G1HeapRegion* hr, bool for_young_only_phase) const {
+double G1Policy::predict_region_model_time_ms(G1HeapRegion* hr, bool for_young_only_phase) const {
   return
     predict_region_non_copy_time_ms(hr, for_young_only_phase) +
     predict_region_copy_time_ms(hr, for_young_only_phase);
 }
 
+double G1Policy::predict_region_total_time_ms(G1HeapRegion* hr, bool for_young_only_phase) const {
+  double time_ms = predict_region_model_time_ms(hr, for_young_only_phase);
+  if (G1UseOldRegionTimeRatio && hr->is_old()) {
+    time_ms *= _analytics->predict_old_region_time_ratio();
+  }
+  return time_ms;
+}
+
+void G1Policy::record_old_region_added_to_cset(G1HeapRegion* hr) {
+  _predicted_old_time_ms += predict_region_model_time_ms(hr, collector_state()->in_young_only_phase());
+}
+
 bool G1Policy::should_allocate_mutator_region() const {
   uint young_list_length = _g1h->young_regions_count();
   return young_list_length < young_list_target_length();
@@ -1273,6 +1309,7 @@ void G1Policy::decide_on_concurrent_start_pause() {
     } else if (_g1h->is_user_requested_concurrent_full_gc(cause) ||
                (cause == GCCause::_codecache_GC_threshold) ||
                (cause == GCCause::_codecache_GC_aggressive) ||
+               (cause == GCCause::_native_memory_pressure) ||
                (cause == GCCause::_wb_breakpoint)) {
       // Initiate a concurrent start.  A concurrent start must be a young only
       // GC, so the collector state must be updated to reflect this.
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2016, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -35,6 +35,7 @@
 #include "gc/g1/g1Predictions.hpp"
 #include "gc/g1/g1YoungGenSizer.hpp"
 #include "gc/shared/gcCause.hpp"
+#include "gc/shared/workerCountController.hpp"
 #include "runtime/atomic.hpp"
 #include "utilities/pair.hpp"
 #include "utilities/ticks.hpp"
@@ -52,6 +53,7 @@ class G1CollectionSetChooser;
 class G1CollectionCandidateRegionList;
 class G1IHOPControl;
 class G1Analytics;
+class G1PretenureTable;
 class G1SurvivorRegions;
 class GCPolicyCounters;
 class STWGCTimer;
@@ -107,6 +109,12 @@ class G1Policy: public CHeapObj<mtGC> {
 
   size_t _pending_cards_at_gc_start;
 
+  // Uncorrected cost model predictions for the current collection set, split
+  // into the young (base and eden) part and the old regions, used to derive
+  // the old region time ratio after a mixed gc.
+  double _predicted_young_time_ms;
+  double _predicted_old_time_ms;
+
   G1ConcurrentStartToMixedTimeTracker _concurrent_start_to_mixed;
 
   bool should_update_surv_rate_group_predictors() {
@@ -155,6 +163,9 @@ class G1Policy: public CHeapObj<mtGC> {
   double predict_region_code_root_scan_time(G1HeapRegion* hr, bool for_young_only_phase) const;
   // Non-copy time for a region is handling remembered sets and other time.
   double predict_region_non_copy_time_ms(G1HeapRegion* hr, bool for_young_only_phase) const;
+  // Total time for a region according to the cost model only, without the
+  // old region time ratio applied.
+  double predict_region_model_time_ms(G1HeapRegion* hr, bool for_young_only_phase) const;
 
 public:
 
@@ -164,9 +175,17 @@ class G1Policy: public CHeapObj<mtGC> {
   // bytes_to_copy is non-null.
   double predict_eden_copy_time_ms(uint count, size_t* bytes_to_copy = nullptr) const;
   // Total time for a region is handling remembered sets (as a single unit), copying its live data
-  // and other time.
+  // and other time. With G1UseOldRegionTimeRatio, the prediction for old regions is
+  // scaled by how much mixed gcs recently exceeded the cost model.
   double predict_region_total_time_ms(G1HeapRegion* hr, bool for_young_only_phase) const;
 
+  // Track the cost model predictions of the collection set being built.
+  void record_predicted_young_time_ms(double time_ms) {
+    _predicted_young_time_ms = time_ms;
+    _predicted_old_time_ms = 0.0;
+  }
+  void record_old_region_added_to_cset(G1HeapRegion* hr);
+
   void cset_regions_freed() {
     bool update = should_update_surv_rate_group_predictors();
 
@@ -212,6 +231,9 @@ class G1Policy: public CHeapObj<mtGC> {
   double _mark_remark_start_sec;
   double _mark_cleanup_start_sec;
 
+  // Picks the number of evacuation workers with UseGCWorkerCountFeedback.
+  WorkerCountController _evacuation_worker_count;
+
   // Updates the internal young gen maximum and target and desired lengths.
   // If no parameters are passed, predict pending cards, card set remset length and
   // code root remset length using the prediction model.
@@ -292,6 +314,8 @@ class G1Policy: public CHeapObj<mtGC> {
 
   G1GCPhaseTimes* phase_times() const;
 
+  WorkerCountController* evacuation_worker_count() { return &_evacuation_worker_count; }
+
   // Check the current value of the young list RSet length and
   // compare it against the last prediction. If the current value is
   // higher, recalculate the young list target length prediction.
@@ -421,6 +445,9 @@ class G1Policy: public CHeapObj<mtGC> {
 
   AgeTable _survivors_age_table;
 
+  // Per-class survival statistics for pretenuring; null if disabled.
+  G1PretenureTable* _pretenure_table;
+
   size_t desired_survivor_size(uint max_regions) const;
 
   // Fraction used when predicting how many optional regions to include in
@@ -456,6 +483,8 @@ class G1Policy: public CHeapObj<mtGC> {
 
   void print_age_table();
 
+  G1PretenureTable* pretenure_table() const { return _pretenure_table; }
+
   void update_survivors_policy();
 };
 
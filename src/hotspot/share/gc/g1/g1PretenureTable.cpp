@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/g1PretenureTable.hpp"
+#include "gc/shared/gc_globals.hpp"
+#include "logging/log.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/klass.hpp"
+#include "runtime/safepoint.hpp"
+
+G1PretenureSamples::G1PretenureSamples() :
+  _samples(NEW_C_HEAP_ARRAY(Sample, G1PretenureTable::TableSize, mtGC)) {
+  memset(_samples, 0, G1PretenureTable::TableSize * sizeof(Sample));
+}
+
+G1PretenureSamples::~G1PretenureSamples() {
+  FREE_C_HEAP_ARRAY(Sample, _samples);
+}
+
+G1PretenureTable::G1PretenureTable() :
+  _entries(NEW_C_HEAP_ARRAY(Entry, TableSize, mtGC)),
+  _num_pretenured(0) {
+  clear();
+}
+
+G1PretenureTable::~G1PretenureTable() {
+  FREE_C_HEAP_ARRAY(Entry, _entries);
+}
+
+void G1PretenureTable::clear_entry(Entry* e) {
+  e->_klass = nullptr;
+  e->_first_survivals = 0;
+  e->_second_survivals = 0;
+  e->_prev_first_survivals = 0;
+  e->_survival_rate = 0.0;
+  e->_num_samples = 0;
+  e->_pretenure = false;
+}
+
+void G1PretenureTable::clear() {
+  for (uint i = 0; i < TableSize; i++) {
+    clear_entry(&_entries[i]);
+  }
+  _num_pretenured = 0;
+}
+
+void G1PretenureTable::merge(G1PretenureSamples* samples) {
+  assert_at_safepoint();
+  for (uint i = 0; i < TableSize; i++) {
+    G1PretenureSamples::Sample* s = &samples->_samples[i];
+    if (s->_klass == nullptr) {
+      continue;
+    }
+    Entry* e = &_entries[i];
+    if (e->_klass == nullptr) {
+      e->_klass = s->_klass;
+    }
+    if (e->_klass == s->_klass) {
+      e->_first_survivals += s->_first_survivals;
+      e->_second_survivals += s->_second_survivals;
+    }
+    s->_klass = nullptr;
+    s->_first_survivals = 0;
+    s->_second_survivals = 0;
+  }
+}
+
+void G1PretenureTable::update() {
+  assert_at_safepoint();
+  uint num_pretenured = 0;
+  for (uint i = 0; i < TableSize; i++) {
+    Entry* e = &_entries[i];
+    if (e->_klass == nullptr) {
+      continue;
+    }
+    if (e->_first_survivals == 0 && e->_second_survivals == 0) {
+      // No object of this class has been evacuated; free the slot.
+      clear_entry(e);
+      continue;
+    }
+    if (e->_prev_first_survivals >= MinFirstSurvivals) {
+      double rate = MIN2(1.0, (double)e->_second_survivals / e->_prev_first_survivals);
+      e->_survival_rate = e->_num_samples == 0 ? rate : (e->_survival_rate + rate) / 2.0;
+      e->_num_samples++;
+
+      bool pretenure = e->_num_samples > 1 &&
+                       e->_survival_rate * 100.0 >= G1PretenureSurvivalPercent;
+      if (pretenure != e->_pretenure) {
+        ResourceMark rm;
+        log_debug(gc, age)("%s pretenuring objects of %s (second survival rate %1.2f%%)",
+                           pretenure ? "Start" : "Stop", e->_klass->external_name(), e->_survival_rate * 100.0);
+        e->_pretenure = pretenure;
+      }
+    }
+    e->_prev_first_survivals = e->_first_survivals;
+    e->_first_survivals = 0;
+    e->_second_survivals = 0;
+    num_pretenured += e->_pretenure ? 1 : 0;
+  }
+  _num_pretenured = num_pretenured;
+  log_debug(gc, age)("Pretenured classes: %u", _num_pretenured);
+}
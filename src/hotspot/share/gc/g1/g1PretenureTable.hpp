@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_G1_G1PRETENURETABLE_HPP
+#define SHARE_GC_G1_G1PRETENURETABLE_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class Klass;
+
+// Per-class survival statistics used to pretenure objects during young
+// collections.
+//
+// For every class we count the objects copied from eden into the survivor
+// space (first survivals), and the objects copied out of the survivor space
+// at age one in the next collection (second survivals). Their ratio is the
+// fraction of objects of that class that survive a young collection once they
+// survived one. Objects of classes where this fraction reaches
+// G1PretenureSurvivalPercent are copied from eden directly into old regions,
+// saving the repeated copies through the survivor space.
+//
+// Both structures are small direct-mapped tables indexed by the Klass*; on a
+// collision the class already using a slot wins and the samples of the other
+// are dropped. The table is cleared whenever classes are unloaded, so all
+// classes in it are live.
+
+// Samples gathered by a single worker thread during one collection.
+class G1PretenureSamples : public CHeapObj<mtGC> {
+  friend class G1PretenureTable;
+
+  struct Sample {
+    Klass* _klass;
+    size_t _first_survivals;
+    size_t _second_survivals;
+  };
+
+  Sample* _samples;
+
+public:
+  G1PretenureSamples();
+  ~G1PretenureSamples();
+
+  // Record that an object of the given klass at the given age (zero or one)
+  // has been copied; to_survivor tells whether it has been copied into the
+  // survivor space.
+  inline void add(Klass* klass, uint age, bool to_survivor);
+};
+
+class G1PretenureTable : public CHeapObj<mtGC> {
+  friend class G1PretenureSamples;
+
+  static const uint TableSize = 1024;
+  // Minimum number of first survivals of a class in a collection to consider
+  // its second survivals in the next one a meaningful sample.
+  static const size_t MinFirstSurvivals = 64;
+
+  struct Entry {
+    Klass* _klass;
+    size_t _first_survivals;
+    size_t _second_survivals;
+    // First survivals of the previous collection.
+    size_t _prev_first_survivals;
+    // Decaying average of the second survival rate.
+    double _survival_rate;
+    uint _num_samples;
+    bool _pretenure;
+  };
+
+  Entry* _entries;
+  // Number of classes currently pretenured.
+  uint _num_pretenured;
+
+  static uint index_for(Klass* klass) {
+    uintptr_t value = (uintptr_t)klass;
+    return (uint)((value >> LogHeapWordSize) ^ (value >> 16)) & (TableSize - 1);
+  }
+
+  void clear_entry(Entry* e);
+
+public:
+  // Every ProbeInterval'th object of a pretenured class is still copied into
+  // the survivor space so that its survival rate can be monitored.
+  static const uint ProbeInterval = 8;
+
+  G1PretenureTable();
+  ~G1PretenureTable();
+
+  // Whether objects of the given klass should be copied into an old region
+  // at their first evacuation.
+  bool should_pretenure(Klass* klass) const {
+    const Entry& e = _entries[index_for(klass)];
+    return e._pretenure && e._klass == klass;
+  }
+
+  // Add the samples of a worker thread, and reset them.
+  void merge(G1PretenureSamples* samples);
+
+  // Update the pretenuring decisions from the samples merged for the current
+  // collection.
+  void update();
+
+  // Forget all classes, e.g. after class unloading.
+  void clear();
+
+  uint num_pretenured() const { return _num_pretenured; }
+};
+
+inline void G1PretenureSamples::add(Klass* klass, uint age, bool to_survivor) {
+  if (age == 0 && !to_survivor) {
+    return;
+  }
+  Sample& s = _samples[G1PretenureTable::index_for(klass)];
+  if (s._klass != klass) {
+    if (s._klass != nullptr) {
+      return;
+    }
+    s._klass = klass;
+  }
+  if (age == 0) {
+    s._first_survivals++;
+  } else {
+    s._second_survivals++;
+  }
+}
+
+#endif // SHARE_GC_G1_G1PRETENURETABLE_HPP
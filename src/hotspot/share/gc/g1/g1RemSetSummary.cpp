@@ -52,6 +52,7 @@ void G1RemSetSummary::update() {
 
   G1CollectedHeap* g1h = G1CollectedHeap::heap();
   g1h->concurrent_refine()->threads_do(&collector);
+  _budget_coarsenings = g1h->concurrent_refine()->rem_set_budget_coarsenings();
 }
 
 void G1RemSetSummary::set_rs_thread_vtime(uint thread, double value) {
@@ -68,7 +69,8 @@ double G1RemSetSummary::rs_thread_vtime(uint thread) const {
 
 G1RemSetSummary::G1RemSetSummary(bool should_update) :
   _num_vtimes(G1ConcRefinementThreads),
-  _rs_threads_vtimes(NEW_C_HEAP_ARRAY(double, _num_vtimes, mtGC)) {
+  _rs_threads_vtimes(NEW_C_HEAP_ARRAY(double, _num_vtimes, mtGC)),
+  _budget_coarsenings(0) {
 
   memset(_rs_threads_vtimes, 0, sizeof(double) * _num_vtimes);
 
@@ -86,6 +88,7 @@ void G1RemSetSummary::set(G1RemSetSummary* other) {
   assert(_num_vtimes == other->_num_vtimes, "just checking");
 
   memcpy(_rs_threads_vtimes, other->_rs_threads_vtimes, sizeof(double) * _num_vtimes);
+  _budget_coarsenings = other->_budget_coarsenings;
 }
 
 void G1RemSetSummary::subtract_from(G1RemSetSummary* other) {
@@ -95,6 +98,7 @@ void G1RemSetSummary::subtract_from(G1RemSetSummary* other) {
   for (uint i = 0; i < _num_vtimes; i++) {
     set_rs_thread_vtime(i, other->rs_thread_vtime(i) - rs_thread_vtime(i));
   }
+  _budget_coarsenings = other->_budget_coarsenings - _budget_coarsenings;
 }
 
 class RegionTypeCounter {
@@ -331,6 +335,14 @@ void G1RemSetSummary::print_on(outputStream* out, bool show_thread_times) {
     out->cr();
   }
 
+  if (G1RemSetMemoryBudgetPercent > 0) {
+    size_t budget = G1CollectedHeap::heap()->capacity() / 100 * G1RemSetMemoryBudgetPercent;
+    out->print_cr(" Remembered set memory budget = " SIZE_FORMAT "%s (%u%% of committed heap), "
+                  SIZE_FORMAT " containers coarsened to meet it.",
+                  byte_size_in_proper_unit(budget), proper_unit_for_byte_size(budget),
+                  G1RemSetMemoryBudgetPercent, _budget_coarsenings);
+  }
+
   HRRSStatsIter blk;
   G1CollectedHeap::heap()->heap_region_iterate(&blk);
   blk.print_summary_on(out);
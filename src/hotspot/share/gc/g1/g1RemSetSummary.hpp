@@ -37,6 +37,9 @@ class G1RemSetSummary {
   size_t _num_vtimes;
   double* _rs_threads_vtimes;
 
+  // Card set containers coarsened to meet the G1RemSetMemoryBudgetPercent budget.
+  size_t _budget_coarsenings;
+
   void set_rs_thread_vtime(uint thread, double value);
 
   // update this summary with current data from various places
@@ -55,6 +58,8 @@ class G1RemSetSummary {
   void print_on(outputStream* out, bool show_thread_times);
 
   double rs_thread_vtime(uint thread) const;
+
+  size_t budget_coarsenings() const { return _budget_coarsenings; }
 };
 
 #endif // SHARE_GC_G1_G1REMSETSUMMARY_HPP
@@ -470,6 +470,9 @@ void G1YoungCollector::set_young_collection_default_active_worker_threads(){
   uint active_workers = WorkerPolicy::calc_active_workers(workers()->max_workers(),
                                                           workers()->active_workers(),
                                                           Threads::number_of_non_daemon_threads());
+  if (UseGCWorkerCountFeedback) {
+    active_workers = policy()->evacuation_worker_count()->workers(active_workers);
+  }
   active_workers = workers()->set_active_workers(active_workers);
   log_info(gc,task)("Using %u workers of %u for evacuation", active_workers, workers()->max_workers());
 }
@@ -728,6 +731,9 @@ void G1YoungCollector::evacuate_initial_collection_set(G1ParScanThreadStateSet*
   Tickspan total_processing = Ticks::now() - start_processing;
 
   p->record_initial_evac_time(task_time.seconds() * 1000.0);
+  if (UseGCWorkerCountFeedback) {
+    policy()->evacuation_worker_count()->record(num_workers, task_time.seconds(), p->sum_evacuation_busy_time_secs());
+  }
   p->record_or_add_nmethod_list_cleanup_time((total_processing - task_time).seconds() * 1000.0);
 
   rem_set()->complete_evac_phase(has_optional_evacuation_work);
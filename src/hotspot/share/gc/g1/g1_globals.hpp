@@ -136,6 +136,11 @@
                "Concurrently preclean java.lang.ref.references instances "  \
                "before the Remark pause.")                                  \
                                                                             \
+  product(bool, G1UseOldRegionTimeRatio, false, EXPERIMENTAL,               \
+          "Scale the predicted evacuation time of old regions by the "      \
+          "ratio of observed to predicted old region time in recent "       \
+          "mixed gcs when selecting the collection set.")                   \
+                                                                            \
   product(double, G1LastPLABAverageOccupancy, 50.0, EXPERIMENTAL,           \
                "The expected average occupancy of the last PLAB in "        \
                "percent.")                                                  \
@@ -164,6 +169,13 @@
           "Size of an update buffer")                                       \
           constraint(G1UpdateBufferSizeConstraintFunc, AtParse)             \
                                                                             \
+  product(uint, G1DirtyCardFilterSize, 0, EXPERIMENTAL,                     \
+          "Number of entries of the per-thread filter used to remove "      \
+          "duplicate cards from a full update buffer before handing it to " \
+          "refinement, rounded up to a power of 2. The buffer is reused "   \
+          "if that frees enough space. 0 disables the filter.")             \
+          range(0, 64*K)                                                    \
+                                                                            \
   product(uint, G1RSetUpdatingPauseTimePercent, 10,                         \
           "A target percentage of time that is allowed to be spend on "     \
           "processing remembered set update buffers during the collection " \
@@ -204,6 +216,13 @@
           "set container.")                                                 \
           range(1, 100)                                                     \
                                                                             \
+  product(uint, G1RemSetMemoryBudgetPercent, 0, EXPERIMENTAL,               \
+          "Percentage of the committed heap the remembered sets may use. "  \
+          "Once exceeded after a GC, concurrent refinement coarsens the "   \
+          "largest remembered sets of old regions to Full card set "        \
+          "containers. 0 means no budget.")                                 \
+          range(0, 100)                                                     \
+                                                                            \
   product(uint, G1RemSetCoarsenHowlToFullPercent, 90, EXPERIMENTAL,         \
           "Percentage at which to coarsen a Howl card set to Full card "    \
           "set container.")                                                 \
@@ -253,6 +272,13 @@
           "Regions with live bytes exceeding this will not be retained.")   \
           range(0, 100)                                                     \
                                                                             \
+  product(uint, G1PretenureSurvivalPercent, 0, EXPERIMENTAL,                \
+          "Copy young objects of a class directly into old regions at "     \
+          "their first evacuation if at least this percentage of the "      \
+          "objects of that class that survived one young collection also "  \
+          "survived the next one. 0 disables pretenuring.")                 \
+          range(0, 100)                                                     \
+                                                                            \
   product(uint, G1HeapWastePercent, 5,                                     \
           "Amount of space, expressed as a percentage of the heap size, "   \
           "that G1 is willing not to collect to avoid expensive GCs.")      \
@@ -262,6 +288,14 @@
           "The target number of mixed GCs after a marking cycle.")          \
           range(0, max_uintx)                                               \
                                                                             \
+  product(uint, G1HumongousCompactionFragmentationPercent, 0, EXPERIMENTAL, \
+          "Also move humongous objects in full collections that are not "   \
+          "last-ditch ones if at least this percentage of the regions not " \
+          "occupied by humongous objects or pinned is outside their "       \
+          "largest contiguous range. 0 means only move them in last-ditch " \
+          "collections.")                                                   \
+          range(0, 100)                                                     \
+                                                                            \
   product(uint, G1EagerReclaimRemSetThreshold, 0, EXPERIMENTAL,             \
           "Maximum number of remembered set entries a humongous region "    \
           "otherwise eligible for eager reclaim may have to be a candidate "\
@@ -47,9 +47,12 @@
 #include "memory/universe.hpp"
 #include "nmt/memTracker.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/cpuTimeCounters.hpp"
 #include "runtime/handles.inline.hpp"
+#include "runtime/init.hpp"
 #include "runtime/java.hpp"
+#include "runtime/safepoint.hpp"
 #include "runtime/vmThread.hpp"
 #include "services/memoryManager.hpp"
 #include "utilities/macros.hpp"
@@ -124,6 +127,15 @@ jint ParallelScavengeHeap::initialize() {
     return JNI_ENOMEM;
   }
 
+  if (ParallelPinOldObjects) {
+    const size_t regions = align_up(old_rs.size() / HeapWordSize, ParallelCompactData::RegionSize)
+                           >> ParallelCompactData::Log2RegionSize;
+    uint* counts = NEW_C_HEAP_ARRAY(uint, regions, mtGC);
+    memset(counts, 0, regions * sizeof(uint));
+    _old_pin_counts = counts;
+    update_old_pin_limit();
+  }
+
   // Create CPU time counter
   CPUTimeCounters::create_counter(CPUTimeGroups::CPUTimeType::gc_parallel_workers);
 
@@ -886,14 +898,70 @@ GrowableArray<MemoryPool*> ParallelScavengeHeap::memory_pools() {
   return memory_pools;
 }
 
+bool ParallelScavengeHeap::is_pinnable_by_count(oop obj) const {
+  if (_old_pin_counts == nullptr) {
+    return false;
+  }
+  // The limit only changes at safepoints, and the caller is in VM state, so
+  // pin and unpin of the same object always agree on the outcome.
+  HeapWord* const limit = Atomic::load(&_old_pin_limit);
+  HeapWord* const addr = cast_from_oop<HeapWord*>(obj);
+  return old_gen()->object_space()->bottom() <= addr && addr + obj->size() <= limit;
+}
+
+volatile uint* ParallelScavengeHeap::old_pin_count_addr(oop obj) const {
+  // Count the pin in the region holding the last word of the object, so that
+  // the dense prefix covers the whole object.
+  HeapWord* const last = cast_from_oop<HeapWord*>(obj) + obj->size() - 1;
+  const size_t index = pointer_delta(last, old_gen()->object_space()->bottom())
+                       >> ParallelCompactData::Log2RegionSize;
+  return &_old_pin_counts[index];
+}
+
 void ParallelScavengeHeap::pin_object(JavaThread* thread, oop obj) {
+  if (is_pinnable_by_count(obj)) {
+    Atomic::inc(old_pin_count_addr(obj));
+    return;
+  }
   GCLocker::lock_critical(thread);
 }
 
 void ParallelScavengeHeap::unpin_object(JavaThread* thread, oop obj) {
+  if (is_pinnable_by_count(obj)) {
+    assert(Atomic::load(old_pin_count_addr(obj)) > 0, "unbalanced unpin");
+    Atomic::dec(old_pin_count_addr(obj));
+    return;
+  }
   GCLocker::unlock_critical(thread);
 }
 
+void ParallelScavengeHeap::update_old_pin_limit() {
+  assert(_old_pin_counts != nullptr, "precondition");
+  assert(SafepointSynchronize::is_at_safepoint() || !is_init_completed(), "must be");
+  // Objects below the limit are never moved by a full GC while pinned, so the
+  // old gen top cannot fall below any pinned region and the limit can be
+  // raised or lowered freely here.
+  MutableSpace* const space = old_gen()->object_space();
+  HeapWord* const limit = space->bottom() + align_down(pointer_delta(space->top(), space->bottom()),
+                                                       ParallelCompactData::RegionSize);
+  Atomic::store(&_old_pin_limit, limit);
+}
+
+HeapWord* ParallelScavengeHeap::old_pinned_prefix_end() const {
+  MutableSpace* const space = old_gen()->object_space();
+  if (_old_pin_counts == nullptr) {
+    return space->bottom();
+  }
+  assert(SafepointSynchronize::is_at_safepoint(), "must be");
+  size_t regions = pointer_delta(_old_pin_limit, space->bottom()) >> ParallelCompactData::Log2RegionSize;
+  for (; regions > 0; --regions) {
+    if (_old_pin_counts[regions - 1] != 0) {
+      break;
+    }
+  }
+  return space->bottom() + (regions << ParallelCompactData::Log2RegionSize);
+}
+
 void ParallelScavengeHeap::update_parallel_worker_threads_cpu_time() {
   assert(Thread::current()->is_VM_thread(),
          "Must be called from VM thread to avoid races");
@@ -84,6 +84,16 @@ class ParallelScavengeHeap : public CollectedHeap {
 
   WorkerThreads _workers;
 
+  // Per compaction region pin counts for the old gen, used when
+  // ParallelPinOldObjects is enabled. Objects below _old_pin_limit are
+  // pinned by counting instead of by locking out all GCs, and the full GC
+  // keeps every region up to the highest pinned one in the dense prefix.
+  volatile uint* _old_pin_counts;
+  HeapWord* volatile _old_pin_limit;
+
+  bool is_pinnable_by_count(oop obj) const;
+  volatile uint* old_pin_count_addr(oop obj) const;
+
   void initialize_serviceability() override;
 
   void trace_actual_reserved_page_size(const size_t reserved_heap_size, const ReservedSpace rs);
@@ -120,7 +130,9 @@ class ParallelScavengeHeap : public CollectedHeap {
     _eden_pool(nullptr),
     _survivor_pool(nullptr),
     _old_pool(nullptr),
-    _workers("GC Thread", ParallelGCThreads) { }
+    _workers("GC Thread", ParallelGCThreads),
+    _old_pin_counts(nullptr),
+    _old_pin_limit(nullptr) { }
 
   Name kind() const override {
     return CollectedHeap::Parallel;
@@ -182,7 +194,6 @@ class ParallelScavengeHeap : public CollectedHeap {
 
   bool requires_barriers(stackChunkOop obj) const override;
 
-  MemRegion reserved_region() const { return _reserved; }
   HeapWord* base() const { return _reserved.start(); }
 
   // Memory allocation.   "gc_time_limit_was_exceeded" will
@@ -252,6 +263,13 @@ class ParallelScavengeHeap : public CollectedHeap {
 
   void pin_object(JavaThread* thread, oop obj) override;
   void unpin_object(JavaThread* thread, oop obj) override;
+
+  // Support for counted pinning of old gen objects.  Must be called at a
+  // safepoint after the old gen top may have changed.
+  void update_old_pin_limit();
+  // The end of the highest old gen compaction region containing a pinned
+  // object, or the bottom of the old gen if there is none.
+  HeapWord* old_pinned_prefix_end() const;
 };
 
 // Class that can be used to print information about the
@@ -41,7 +41,12 @@
           "for a system GC")                                                \
                                                                             \
   product(bool, PSChunkLargeArrays, true,                                   \
-          "Process large arrays in chunks")
+          "Process large arrays in chunks")                                 \
+                                                                            \
+  product(bool, ParallelPinOldObjects, false, EXPERIMENTAL,                 \
+          "Pin old generation objects in JNI critical regions by counting " \
+          "per compaction region instead of blocking all collections; "     \
+          "full collections do not move regions with pinned objects")
 
 // end of GC_PARALLEL_FLAGS
 
@@ -883,6 +883,9 @@ void PSParallelCompact::summary_phase()
       maximum_compaction ? full_region_prefix_end
                          : compute_dense_prefix_for_old_space(old_space,
                                                               full_region_prefix_end);
+    // Regions holding objects pinned by counting must not move; they are
+    // region aligned and below top, as fill_dense_prefix_end requires.
+    dense_prefix_end = MAX2(dense_prefix_end, ParallelScavengeHeap::heap()->old_pinned_prefix_end());
     SpaceId id = old_space_id;
     _space_info[id].set_dense_prefix(dense_prefix_end);
 
@@ -1061,6 +1064,10 @@ bool PSParallelCompact::invoke_no_policy(bool clear_all_soft_refs) {
     // done before resizing.
     post_compact();
 
+    if (ParallelPinOldObjects) {
+      heap->update_old_pin_limit();
+    }
+
     // Let the size policy know we're done
     size_policy->major_collection_end(old_gen->used_in_bytes(), gc_cause);
 
@@ -583,6 +583,11 @@ bool PSScavenge::invoke(bool clear_soft_refs) {
     // Track memory usage and detect low memory
     MemoryService::track_memory_usage();
     heap->update_counters();
+
+    // Promotion may have raised the old gen top.
+    if (ParallelPinOldObjects) {
+      heap->update_old_pin_limit();
+    }
   }
 
   if (VerifyAfterGC && heap->total_collections() >= VerifyGCStartAt) {
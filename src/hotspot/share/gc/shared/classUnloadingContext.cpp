@@ -28,6 +28,7 @@
 #include "code/nmethod.hpp"
 #include "gc/shared/classUnloadingContext.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
 #include "utilities/growableArray.hpp"
 
 ClassUnloadingContext* ClassUnloadingContext::_context = nullptr;
@@ -36,6 +37,7 @@ ClassUnloadingContext::ClassUnloadingContext(uint num_workers,
                                              bool unregister_nmethods_during_purge,
                                              bool lock_nmethod_free_separately) :
   _cld_head(nullptr),
+  _cld_purge_next(nullptr),
   _num_nmethod_unlink_workers(num_workers),
   _unlinked_nmethods(nullptr),
   _unregister_nmethods_during_purge(unregister_nmethods_during_purge),
@@ -73,16 +75,36 @@ void ClassUnloadingContext::register_unloading_class_loader_data(ClassLoaderData
 
   cld->set_unloading_next(_cld_head);
   _cld_head = cld;
+  _cld_purge_next = cld;
 }
 
 void ClassUnloadingContext::purge_class_loader_data() {
-  for (ClassLoaderData* cld = _cld_head; cld != nullptr;) {
+  for (ClassLoaderData* cld = _cld_purge_next; cld != nullptr;) {
     assert(cld->is_unloading(), "invariant");
 
     ClassLoaderData* next = cld->unloading_next();
     delete cld;
     cld = next;
   }
+  _cld_purge_next = nullptr;
+}
+
+bool ClassUnloadingContext::purge_class_loader_data_slice(jlong time_budget_ns) {
+  const jlong start = os::javaTimeNanos();
+
+  while (_cld_purge_next != nullptr) {
+    ClassLoaderData* cld = _cld_purge_next;
+    assert(cld->is_unloading(), "invariant");
+
+    _cld_purge_next = cld->unloading_next();
+    delete cld;
+
+    if (os::javaTimeNanos() - start >= time_budget_ns) {
+      break;
+    }
+  }
+
+  return _cld_purge_next == nullptr;
 }
 
 void ClassUnloadingContext::classes_unloading_do(void f(Klass* const)) {
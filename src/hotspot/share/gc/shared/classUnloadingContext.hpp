@@ -36,6 +36,8 @@ class ClassUnloadingContext : public CHeapObj<mtGC> {
   static ClassUnloadingContext* _context;
 
   ClassLoaderData* volatile _cld_head;
+  // The next unloaded ClassLoaderData to delete when purging in slices.
+  ClassLoaderData* _cld_purge_next;
 
   const uint _num_nmethod_unlink_workers;
 
@@ -65,6 +67,9 @@ class ClassUnloadingContext : public CHeapObj<mtGC> {
 
   void register_unloading_class_loader_data(ClassLoaderData* cld);
   void purge_class_loader_data();
+  // Deletes unloaded ClassLoaderData not yet purged until time_budget_ns have
+  // passed. Returns true if there are none left.
+  bool purge_class_loader_data_slice(jlong time_budget_ns);
 
   void classes_unloading_do(void f(Klass* const));
 
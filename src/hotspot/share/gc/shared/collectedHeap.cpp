@@ -53,6 +53,7 @@
 #include "runtime/init.hpp"
 #include "runtime/javaThread.hpp"
 #include "runtime/perfData.hpp"
+#include "runtime/perfHistograms.hpp"
 #include "runtime/threadSMR.hpp"
 #include "runtime/vmThread.hpp"
 #include "services/heapDumper.hpp"
@@ -209,10 +210,16 @@ void CollectedHeap::trace_heap(GCWhen::Type when, const GCTracer* gc_tracer) {
 
 void CollectedHeap::trace_heap_before_gc(const GCTracer* gc_tracer) {
   trace_heap(GCWhen::BeforeGC, gc_tracer);
+  if (PerfHistograms::is_enabled()) {
+    PerfHistograms::record_heap_before_gc(used());
+  }
 }
 
 void CollectedHeap::trace_heap_after_gc(const GCTracer* gc_tracer) {
   trace_heap(GCWhen::AfterGC, gc_tracer);
+  if (PerfHistograms::is_enabled()) {
+    PerfHistograms::record_heap_after_gc(used());
+  }
 }
 
 // Default implementation, for collectors that don't support the feature.
@@ -246,6 +246,8 @@ class CollectedHeap : public CHeapObj<mtGC> {
 
   void initialize_reserved_region(const ReservedHeapSpace& rs);
 
+  MemRegion reserved_region() const { return _reserved; }
+
   virtual size_t capacity() const = 0;
   virtual size_t used() const = 0;
 
@@ -403,6 +405,19 @@ class CollectedHeap : public CHeapObj<mtGC> {
     return nullptr;
   }
 
+  // Support for incremental heap inspection. Heaps that can be iterated one part
+  // at a time, with the parts visited at different safepoints, return the number
+  // of parts here; 0 means not supported.
+  virtual uint object_iterate_parts() const {
+    return 0;
+  }
+
+  // Iterate over the objects in the given part. Called at a safepoint, possibly
+  // from several workers at a time, each for a different part.
+  virtual void object_iterate_part(ObjectClosure* cl, uint part) {
+    ShouldNotReachHere();
+  }
+
   // Keep alive an object that was loaded with AS_NO_KEEPALIVE.
   virtual void keep_alive(oop obj) {}
 
@@ -498,12 +513,28 @@ class CollectedHeap : public CHeapObj<mtGC> {
   virtual void pin_object(JavaThread* thread, oop obj) = 0;
   virtual void unpin_object(JavaThread* thread, oop obj) = 0;
 
+  // Pin an object independently of the calling thread, so that the pin can
+  // outlive the current native call and be released by another thread (e.g.
+  // for asynchronous I/O on a heap array). Returns false if the collector
+  // only supports thread-bound pinning; the caller must then fall back to
+  // copying. Must not be used on objects the caller can't keep reachable.
+  virtual bool pin_object_detached(oop obj) { return false; }
+  virtual void unpin_object_detached(oop obj) { ShouldNotReachHere(); }
+
   // Support for loading objects from CDS archive into the heap
   // (usually as a snapshot of the old generation).
   virtual bool can_load_archived_objects() const { return false; }
   virtual HeapWord* allocate_loaded_archive_space(size_t size) { return nullptr; }
   virtual void complete_loaded_archive_space(MemRegion archive_space) { }
 
+  // Support for mapping the CDS archive heap region directly into the heap,
+  // without copying the objects. The archive space is allocated at the top of
+  // the heap; preferred_addr is only a hint.
+  virtual bool can_map_archived_objects() const { return false; }
+  virtual HeapWord* alloc_archive_region(size_t word_size, HeapWord* preferred_addr) { return nullptr; }
+  virtual void complete_mapped_archive_space(MemRegion archive_space) { }
+  virtual void dealloc_archive_regions(MemRegion range) { }
+
   virtual bool is_oop(oop object) const;
   // Non product verification and debugging.
 #ifndef PRODUCT
@@ -35,6 +35,15 @@ class ContinuationGCSupport : public AllStatic {
   // Relativize and transform to use a bitmap for future oop iteration for the
   // given oop if it is a stack chunk.
   static void transform_stack_chunk(oop obj);
+
+  // Stack chunks are often much larger than the frames they hold, e.g. when a
+  // virtual thread parked with a shallower stack than it had at its first freeze.
+  // With TrimStackChunks, a copying GC can drop the unused start of the stack when
+  // it copies a chunk that it sees for the first time. Returns the size in words of
+  // the trimmed copy of klass's instance obj, or 0 if obj is not to be trimmed.
+  static size_t trimmed_stack_chunk_size(oop obj, Klass* klass);
+  // Copies the stack chunk obj trimmed to size words to the uninitialized memory at to.
+  static void copy_trimmed_stack_chunk(oop obj, HeapWord* to, size_t size);
 };
 
 #endif // SHARE_GC_SHARED_CONTINUATIONGCSUPPORT_HPP
@@ -27,9 +27,13 @@
 
 #include "gc/shared/continuationGCSupport.hpp"
 
-#include "oops/instanceStackChunkKlass.hpp"
+#include "oops/instanceStackChunkKlass.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "oops/stackChunkOop.inline.hpp"
+#include "runtime/continuationJavaClasses.inline.hpp"
+#include "runtime/globals.hpp"
+#include "utilities/align.hpp"
+#include "utilities/copy.hpp"
 
 inline bool ContinuationGCSupport::relativize_stack_chunk(oop obj) {
   if (!obj->is_stackChunk()) {
@@ -53,4 +57,47 @@ inline void ContinuationGCSupport::transform_stack_chunk(oop obj) {
   }
 }
 
+// The number of unused words at the start of the stack of chunk that can be dropped.
+static inline int trimmable_stack_words(stackChunkOop chunk) {
+  // Chunks in GC mode have a bitmap indexed from the start of the stack, and a
+  // lock-stack is stored at the start of the stack.
+  if (chunk->is_gc_mode() || chunk->has_lockstack() || chunk->is_empty()) {
+    return 0;
+  }
+  // Keep the metadata words just below sp, which belong to the top frame, and keep
+  // the frames at their stack alignment.
+  const int trim = align_down(chunk->sp() - frame::metadata_words, 2);
+  return trim >= TrimStackChunksMinWords ? trim : 0;
+}
+
+inline size_t ContinuationGCSupport::trimmed_stack_chunk_size(oop obj, Klass* klass) {
+  if (!TrimStackChunks || !klass->is_stack_chunk_instance_klass()) {
+    return 0;
+  }
+  stackChunkOop chunk = stackChunkOopDesc::cast(obj);
+  const int trim = trimmable_stack_words(chunk);
+  if (trim == 0) {
+    return 0;
+  }
+  return InstanceStackChunkKlass::cast(klass)->instance_size(chunk->stack_size() - trim);
+}
+
+inline void ContinuationGCSupport::copy_trimmed_stack_chunk(oop obj, HeapWord* to, size_t size) {
+  stackChunkOop chunk = stackChunkOopDesc::cast(obj);
+  const int trim = trimmable_stack_words(chunk);
+  assert(trim > 0, "must be trimmable");
+  const int new_stack_size = chunk->stack_size() - trim;
+  assert(InstanceStackChunkKlass::cast(obj->klass())->instance_size(new_stack_size) == size, "must be");
+
+  // The header, then the used part of the stack. The GC data after the stack is
+  // initialized when the copy is transformed.
+  const size_t header_words = InstanceStackChunkKlass::offset_of_stack() >> LogHeapWordSize;
+  Copy::aligned_disjoint_words(cast_from_oop<HeapWord*>(obj), to, header_words);
+  Copy::aligned_disjoint_words((HeapWord*)(chunk->start_address() + trim), to + header_words, new_stack_size);
+
+  jdk_internal_vm_StackChunk::set_size(to, new_stack_size);
+  jdk_internal_vm_StackChunk::set_sp(to, chunk->sp() - trim);
+  jdk_internal_vm_StackChunk::set_bottom(to, chunk->bottom() - trim);
+}
+
 #endif // SHARE_GC_SHARED_CONTINUATIONGCSUPPORT_INLINE_HPP
@@ -78,6 +78,9 @@ const char* GCCause::to_string(GCCause::Cause cause) {
     case _metadata_GC_clear_soft_refs:
       return "Metadata GC Clear Soft References";
 
+    case _native_memory_pressure:
+      return "Native Memory Pressure";
+
     case _g1_inc_collection_pause:
       return "G1 Evacuation Pause";
 
@@ -65,6 +65,7 @@ class GCCause : public AllStatic {
     _codecache_GC_aggressive,
     _metadata_GC_threshold,
     _metadata_GC_clear_soft_refs,
+    _native_memory_pressure,
 
     _g1_inc_collection_pause,
     _g1_compaction_pause,
@@ -25,6 +25,7 @@
 #include "precompiled.hpp"
 #include "gc/shared/gcTimer.hpp"
 #include "gc/shared/gc_globals.hpp"
+#include "runtime/perfHistograms.hpp"
 #include "utilities/growableArray.hpp"
 
 // the "time" parameter for most functions
@@ -44,10 +45,12 @@ void GCTimer::register_gc_end(const Ticks& time) {
 
 void GCTimer::register_gc_pause_start(const char* name, const Ticks& time) {
   _time_partitions.report_gc_phase_start_top_level(name, time, GCPhase::PausePhaseType);
+  _pause_start = time;
 }
 
 void GCTimer::register_gc_pause_end(const Ticks& time) {
   _time_partitions.report_gc_phase_end(time);
+  PerfHistograms::record_gc_pause((time - _pause_start).nanoseconds());
 }
 
 void GCTimer::register_gc_phase_start(const char* name, const Ticks& time) {
@@ -141,6 +141,7 @@ class GCTimer {
  protected:
   Ticks _gc_start;
   Ticks _gc_end;
+  Ticks _pause_start;
   TimePartitions _time_partitions;
 
  public:
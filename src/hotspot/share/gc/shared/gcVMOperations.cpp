@@ -194,6 +194,18 @@ void VM_GC_HeapInspection::doit() {
   }
 }
 
+void VM_GC_IncrementalHeapInspection::doit() {
+  Universe::heap()->ensure_parsability(false);
+  WorkerThreads* workers = Universe::heap()->safepoint_workers();
+  if (workers != nullptr) {
+    const uint capped_parallel_thread_num = MIN2(_parallel_thread_num, workers->max_workers());
+    WithActiveWorkers with_active_workers(workers, capped_parallel_thread_num);
+    HeapInspection::incremental_step(_inspection, _out, workers, _max_pause_millis);
+  } else {
+    HeapInspection::incremental_step(_inspection, _out, nullptr, _max_pause_millis);
+  }
+}
+
 VM_CollectForMetadataAllocation::VM_CollectForMetadataAllocation(ClassLoaderData* loader_data,
                                                                  size_t size,
                                                                  Metaspace::MetadataType mdtype,
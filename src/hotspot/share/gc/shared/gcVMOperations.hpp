@@ -156,6 +156,8 @@ class VM_GC_Operation: public VM_GC_Sync_Operation {
 };
 
 
+class IncrementalHeapInspection;
+
 class VM_GC_HeapInspection: public VM_GC_Operation {
  private:
   outputStream* _out;
@@ -179,6 +181,29 @@ class VM_GC_HeapInspection: public VM_GC_Operation {
   bool collect();
 };
 
+// One step of an incremental heap inspection, see HeapInspection::incremental_step().
+// The requesting thread executes steps until the inspection is done.
+class VM_GC_IncrementalHeapInspection: public VM_GC_Operation {
+ private:
+  IncrementalHeapInspection* _inspection;
+  outputStream* _out;
+  uint _parallel_thread_num;
+  jlong _max_pause_millis;
+ public:
+  VM_GC_IncrementalHeapInspection(IncrementalHeapInspection* inspection, outputStream* out,
+                                  uint parallel_thread_num, jlong max_pause_millis) :
+    VM_GC_Operation(0 /* total collections,      dummy, ignored */,
+                    GCCause::_heap_inspection /* GC Cause */,
+                    0 /* total full collections, dummy, ignored */,
+                    false), _inspection(inspection), _out(out),
+                    _parallel_thread_num(parallel_thread_num),
+                    _max_pause_millis(max_pause_millis) {}
+
+  virtual VMOp_Type type() const { return VMOp_GC_IncrementalHeapInspection; }
+  virtual bool skip_operation() const { return false; }
+  virtual void doit();
+};
+
 class VM_CollectForAllocation : public VM_GC_Operation {
  protected:
   size_t    _word_size; // Size of object to be allocated (in number of words)
@@ -135,6 +135,16 @@
           "ParallelGCThreads parallel collectors will use for garbage "     \
           "collection work")                                                \
                                                                             \
+  product(bool, UseGCWorkerCountFeedback, false, EXPERIMENTAL,              \
+          "Choose the number of active GC workers from the measured "       \
+          "parallel efficiency of earlier phases, and never use more "      \
+          "active workers than the processors available to the process")   \
+                                                                            \
+  product(uint, GCWorkerEfficiencyTarget, 80, EXPERIMENTAL,                 \
+          "Parallel efficiency, in percent, that UseGCWorkerCountFeedback " \
+          "aims for when choosing the number of active GC workers")         \
+          range(1, 100)                                                     \
+                                                                            \
   product(bool, InjectGCWorkerCreationFailure, false, DIAGNOSTIC,           \
              "Inject thread creation failures for "                         \
              "UseDynamicNumberOfGCThreads")                                 \
@@ -218,6 +228,11 @@
                "ParallelRefProcEnabled is true. Specify 0 to disable and "  \
                "use all threads.")                                          \
                                                                             \
+  product(bool, FuseReferenceProcessingPhases, false, EXPERIMENTAL,         \
+          "Process PhantomReferences together with Soft, Weak and Final "   \
+          "references when no FinalReferences were discovered, instead "    \
+          "of in a separate phase")                                         \
+                                                                            \
   product(uint, InitiatingHeapOccupancyPercent, 45,                         \
           "The percent occupancy (IHOP) of the current old generation "     \
           "capacity above which a concurrent mark cycle will be initiated " \
@@ -536,6 +551,19 @@
           "Soft limit for maximum heap size (in bytes)")                    \
           constraint(SoftMaxHeapSizeConstraintFunc,AfterMemoryInit)         \
                                                                             \
+  product(uintx, SoftMaxHeapSizeTrackingInterval, 0, EXPERIMENTAL,          \
+          "Interval in milliseconds at which SoftMaxHeapSize is adjusted "  \
+          "to MaxRAMPercentage of the current physical memory or "          \
+          "container limit, if not set by the user. 0 means disabled")     \
+          range(0, 10000)                                                   \
+                                                                            \
+  product(size_t, NativeMemoryPressureGCThreshold, 0, EXPERIMENTAL,       \
+          "Start a concurrent old collection when the native memory "      \
+          "allocated through Unsafe, e.g. for direct buffers, has grown "   \
+          "by this many bytes since its lowest point after the previous "   \
+          "such collection. Requires -XX:NativeMemoryTracking. "           \
+          "0 means disabled")                                               \
+                                                                            \
   product(size_t, NewSize, ScaleForWordSize(1*M),                           \
           "Initial new generation size (in bytes)")                         \
           constraint(NewSizeConstraintFunc,AfterErgo)                       \
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/gc_globals.hpp"
+#include "gc/shared/nativeMemoryPressure.hpp"
+#include "logging/log.hpp"
+#include "nmt/mallocTracker.hpp"
+#include "nmt/memTracker.hpp"
+
+size_t NativeMemoryPressure::_low_water = SIZE_MAX;
+
+size_t NativeMemoryPressure::used() {
+  return MallocMemorySummary::as_snapshot()->by_type(mtOther)->malloc_size();
+}
+
+bool NativeMemoryPressure::is_enabled() {
+  return NativeMemoryPressureGCThreshold > 0 && MemTracker::enabled();
+}
+
+bool NativeMemoryPressure::should_collect() {
+  if (!is_enabled()) {
+    return false;
+  }
+
+  const size_t current = used();
+  _low_water = MIN2(_low_water, current);
+  const size_t growth = current - _low_water;
+
+  log_debug(gc, ergo)("Native memory pressure: used " SIZE_FORMAT "K, growth " SIZE_FORMAT "K, threshold " SIZE_FORMAT "K",
+                      current / K, growth / K, NativeMemoryPressureGCThreshold / K);
+
+  return growth >= NativeMemoryPressureGCThreshold;
+}
+
+void NativeMemoryPressure::record_collection() {
+  _low_water = used();
+}
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_SHARED_NATIVEMEMORYPRESSURE_HPP
+#define SHARE_GC_SHARED_NATIVEMEMORYPRESSURE_HPP
+
+#include "memory/allStatic.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+// Native memory allocated through Unsafe, which backs direct buffers and
+// MemorySegment arenas, is only freed once the GC has found the owning
+// objects dead. The heap itself may see little allocation while such
+// memory builds up, so the heuristics can use this as an additional
+// trigger, see NativeMemoryPressureGCThreshold.
+//
+// The amount of memory is taken from Native Memory Tracking, which
+// accounts for Unsafe allocations as mtOther.
+class NativeMemoryPressure : AllStatic {
+  // Lowest amount of memory seen since the last triggered collection.
+  static size_t _low_water;
+
+  static size_t used();
+
+public:
+  static bool is_enabled();
+
+  // Returns true if the memory has grown by at least the threshold since
+  // its lowest point after the previous triggered collection. The caller
+  // is expected to start a collection and then call record_collection().
+  // Only one thread per heuristic may call these.
+  static bool should_collect();
+  static void record_collection();
+};
+
+#endif // SHARE_GC_SHARED_NATIVEMEMORYPRESSURE_HPP
@@ -196,9 +196,15 @@ ReferenceProcessorStats ReferenceProcessor::process_discovered_references(RefPro
 
   phase_times.set_processing_is_mt(processing_is_mt());
 
+  // Without Final references nothing is kept alive between the first and the
+  // phantom phase, so Phantom references see the same liveness in either and
+  // can be processed in the first phase, saving a round of worker startup.
+  const bool fuse_phantom = FuseReferenceProcessingPhases &&
+                            phase_times.ref_discovered(REF_FINAL) == 0;
+
   {
     RefProcTotalPhaseTimesTracker tt(SoftWeakFinalRefsPhase, &phase_times);
-    process_soft_weak_final_refs(proxy_task, phase_times);
+    process_soft_weak_final_refs(proxy_task, phase_times, fuse_phantom);
   }
 
   {
@@ -208,7 +214,7 @@ ReferenceProcessorStats ReferenceProcessor::process_discovered_references(RefPro
 
   {
     RefProcTotalPhaseTimesTracker tt(PhantomRefsPhase, &phase_times);
-    process_phantom_refs(proxy_task, phase_times);
+    process_phantom_refs(proxy_task, phase_times, fuse_phantom);
   }
 
   phase_times.set_total_time_ms((os::elapsedTime() - start_time) * 1000);
@@ -483,11 +489,15 @@ void RefProcTask::process_discovered_list(uint worker_id,
 }
 
 class RefProcSoftWeakFinalPhaseTask: public RefProcTask {
+  bool const _with_phantom;
+
 public:
   RefProcSoftWeakFinalPhaseTask(ReferenceProcessor& ref_processor,
-                                ReferenceProcessorPhaseTimes* phase_times)
+                                ReferenceProcessorPhaseTimes* phase_times,
+                                bool with_phantom)
     : RefProcTask(ref_processor,
-                  phase_times) {}
+                  phase_times),
+      _with_phantom(with_phantom) {}
 
   void rp_work(uint worker_id,
                BoolObjectClosure* is_alive,
@@ -502,6 +512,10 @@ class RefProcSoftWeakFinalPhaseTask: public RefProcTask {
 
     process_discovered_list(worker_id, REF_FINAL, is_alive, keep_alive, enqueue);
 
+    if (_with_phantom) {
+      process_discovered_list(worker_id, REF_PHANTOM, is_alive, keep_alive, enqueue);
+    }
+
     // Close the reachable set; needed for collectors which keep_alive_closure do
     // not immediately complete their work.
     complete_gc->do_void();
@@ -722,12 +736,14 @@ void ReferenceProcessor::run_task(RefProcTask& task, RefProcProxyTask& proxy_tas
 }
 
 void ReferenceProcessor::process_soft_weak_final_refs(RefProcProxyTask& proxy_task,
-                                                      ReferenceProcessorPhaseTimes& phase_times) {
+                                                      ReferenceProcessorPhaseTimes& phase_times,
+                                                      bool with_phantom) {
 
   size_t const num_soft_refs = phase_times.ref_discovered(REF_SOFT);
   size_t const num_weak_refs = phase_times.ref_discovered(REF_WEAK);
   size_t const num_final_refs = phase_times.ref_discovered(REF_FINAL);
-  size_t const num_total_refs = num_soft_refs + num_weak_refs + num_final_refs;
+  size_t const num_phantom_refs = with_phantom ? phase_times.ref_discovered(REF_PHANTOM) : 0;
+  size_t const num_total_refs = num_soft_refs + num_weak_refs + num_final_refs + num_phantom_refs;
 
   if (num_total_refs == 0) {
     log_debug(gc, ref)("Skipped SoftWeakFinalRefsPhase of Reference Processing: no references");
@@ -741,17 +757,26 @@ void ReferenceProcessor::process_soft_weak_final_refs(RefProcProxyTask& proxy_ta
     maybe_balance_queues(_discoveredSoftRefs);
     maybe_balance_queues(_discoveredWeakRefs);
     maybe_balance_queues(_discoveredFinalRefs);
+    if (with_phantom) {
+      maybe_balance_queues(_discoveredPhantomRefs);
+    }
   }
 
   log_reflist("SoftWeakFinalRefsPhase Soft before", _discoveredSoftRefs, _max_num_queues);
   log_reflist("SoftWeakFinalRefsPhase Weak before", _discoveredWeakRefs, _max_num_queues);
   log_reflist("SoftWeakFinalRefsPhase Final before", _discoveredFinalRefs, _max_num_queues);
+  if (with_phantom) {
+    log_reflist("SoftWeakFinalRefsPhase Phantom before", _discoveredPhantomRefs, _max_num_queues);
+  }
 
-  RefProcSoftWeakFinalPhaseTask phase_task(*this, &phase_times);
+  RefProcSoftWeakFinalPhaseTask phase_task(*this, &phase_times, with_phantom);
   run_task(phase_task, proxy_task, false);
 
   verify_total_count_zero(_discoveredSoftRefs, "SoftReference");
   verify_total_count_zero(_discoveredWeakRefs, "WeakReference");
+  if (with_phantom) {
+    verify_total_count_zero(_discoveredPhantomRefs, "PhantomReference");
+  }
   log_reflist("SoftWeakFinalRefsPhase Final after", _discoveredFinalRefs, _max_num_queues);
 }
 
@@ -780,7 +805,8 @@ void ReferenceProcessor::process_final_keep_alive(RefProcProxyTask& proxy_task,
 }
 
 void ReferenceProcessor::process_phantom_refs(RefProcProxyTask& proxy_task,
-                                              ReferenceProcessorPhaseTimes& phase_times) {
+                                              ReferenceProcessorPhaseTimes& phase_times,
+                                              bool already_processed) {
 
   size_t const num_phantom_refs = phase_times.ref_discovered(REF_PHANTOM);
 
@@ -789,6 +815,11 @@ void ReferenceProcessor::process_phantom_refs(RefProcProxyTask& proxy_task,
     return;
   }
 
+  if (already_processed) {
+    log_debug(gc, ref)("Skipped PhantomRefsPhase of Reference Processing: processed in SoftWeakFinalRefsPhase");
+    return;
+  }
+
   RefProcMTDegreeAdjuster a(this, PhantomRefsPhase, num_phantom_refs);
 
   if (processing_is_mt()) {
@@ -256,17 +256,21 @@ class ReferenceProcessor : public ReferenceDiscoverer {
   void run_task(RefProcTask& task, RefProcProxyTask& proxy_task, bool marks_oops_alive);
 
   // Drop Soft/Weak/Final references with a null or live referent, and clear
-  // and enqueue non-Final references.
+  // and enqueue non-Final references. If with_phantom, Phantom references are
+  // processed in the same task.
   void process_soft_weak_final_refs(RefProcProxyTask& proxy_task,
-                                    ReferenceProcessorPhaseTimes& phase_times);
+                                    ReferenceProcessorPhaseTimes& phase_times,
+                                    bool with_phantom);
 
   // Keep alive followers of Final references, and enqueue.
   void process_final_keep_alive(RefProcProxyTask& proxy_task,
                                 ReferenceProcessorPhaseTimes& phase_times);
 
   // Drop and keep alive live Phantom references, or clear and enqueue if dead.
+  // Does nothing if already_processed.
   void process_phantom_refs(RefProcProxyTask& proxy_task,
-                            ReferenceProcessorPhaseTimes& phase_times);
+                            ReferenceProcessorPhaseTimes& phase_times,
+                            bool already_processed);
 
   // Work methods used by the process_* methods. All methods return the number of
   // removed elements.
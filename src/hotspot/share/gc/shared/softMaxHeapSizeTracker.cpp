@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/gc_globals.hpp"
+#include "gc/shared/gcArguments.hpp"
+#include "gc/shared/softMaxHeapSizeTracker.hpp"
+#include "logging/log.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/globals_extension.hpp"
+#include "runtime/os.hpp"
+#include "runtime/task.hpp"
+#include "utilities/align.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+size_t SoftMaxHeapSizeTracker::_initial_soft_max = 0;
+
+class SoftMaxHeapSizeTrackerTask : public PeriodicTask {
+public:
+  SoftMaxHeapSizeTrackerTask(size_t interval_ms) : PeriodicTask(interval_ms) {}
+  void task() {
+    SoftMaxHeapSizeTracker::update();
+  }
+};
+
+void SoftMaxHeapSizeTracker::initialize() {
+  if (SoftMaxHeapSizeTrackingInterval == 0) {
+    return;
+  }
+  _initial_soft_max = SoftMaxHeapSize;
+  const size_t interval = align_up(MAX2(SoftMaxHeapSizeTrackingInterval, (uintx)PeriodicTask::min_interval),
+                                   (uintx)PeriodicTask::interval_gran);
+  SoftMaxHeapSizeTrackerTask* task = new SoftMaxHeapSizeTrackerTask(interval);
+  task->enroll();
+}
+
+void SoftMaxHeapSizeTracker::update() {
+  if (!FLAG_IS_DEFAULT(SoftMaxHeapSize) && !FLAG_IS_ERGO(SoftMaxHeapSize)) {
+    // Set by the user, do not override
+    return;
+  }
+
+  const julong phys_mem = os::physical_memory();
+  const julong limit = (julong)((double)phys_mem * MaxRAMPercentage / 100);
+  size_t target = (size_t)MIN2(limit, (julong)_initial_soft_max);
+  target = MAX2(align_down(target, HeapAlignment), MinHeapSize);
+
+  const size_t current = Atomic::load(&SoftMaxHeapSize);
+  if (target != current) {
+    log_info(gc, ergo)("SoftMaxHeapSize: " SIZE_FORMAT "M -> " SIZE_FORMAT "M (physical memory " JULONG_FORMAT "M)",
+                       current / M, target / M, phys_mem / M);
+    FLAG_SET_ERGO(SoftMaxHeapSize, target);
+  }
+}
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_SHARED_SOFTMAXHEAPSIZETRACKER_HPP
+#define SHARE_GC_SHARED_SOFTMAXHEAPSIZETRACKER_HPP
+
+#include "memory/allStatic.hpp"
+
+// Periodically re-reads the physical memory available to the process, which
+// follows the container memory limit, and moves SoftMaxHeapSize with it so that
+// collectors honoring the soft limit shrink and uncommit the heap when the limit
+// is lowered at runtime. A SoftMaxHeapSize set on the command line or through
+// management is left alone.
+class SoftMaxHeapSizeTracker : AllStatic {
+  // SoftMaxHeapSize as set up during initialization. The tracked value
+  // never exceeds it.
+  static size_t _initial_soft_max;
+
+public:
+  static void initialize();
+  static void update();
+};
+
+#endif // SHARE_GC_SHARED_SOFTMAXHEAPSIZETRACKER_HPP
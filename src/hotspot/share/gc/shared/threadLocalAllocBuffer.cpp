@@ -48,6 +48,7 @@ ThreadLocalAllocBuffer::ThreadLocalAllocBuffer() :
   _end(nullptr),
   _allocation_end(nullptr),
   _desired_size(0),
+  _resized_desired_size(0),
   _refill_waste_limit(0),
   _allocated_before_last_gc(0),
   _bytes_since_last_sample_point(0),
@@ -172,6 +173,21 @@ void ThreadLocalAllocBuffer::resize() {
   set_refill_waste_limit(initial_refill_waste_limit());
 }
 
+void ThreadLocalAllocBuffer::set_desired_size_hint(size_t size_hint) {
+  size_t new_size = _resized_desired_size;
+  if (size_hint > new_size) {
+    new_size = align_object_size(MIN2(size_hint, max_size()));
+  }
+  if (new_size != _desired_size) {
+    log_trace(gc, tlab)("TLAB size hint: thread: " PTR_FORMAT " [id: %2d]"
+                        " hint: " SIZE_FORMAT " desired_size: " SIZE_FORMAT " -> " SIZE_FORMAT,
+                        p2i(thread()), thread()->osthread()->thread_id(),
+                        size_hint, _desired_size, new_size);
+    _desired_size = new_size;
+    set_refill_waste_limit(initial_refill_waste_limit());
+  }
+}
+
 void ThreadLocalAllocBuffer::reset_statistics() {
   _number_of_refills = 0;
   _refill_waste      = 0;
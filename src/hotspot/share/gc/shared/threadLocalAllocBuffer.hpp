@@ -54,6 +54,7 @@ class ThreadLocalAllocBuffer: public CHeapObj<mtThread> {
   HeapWord* _allocation_end;                     // end for allocations (actual TLAB end, excluding alignment_reserve)
 
   size_t    _desired_size;                       // desired size   (including alignment_reserve)
+  size_t    _resized_desired_size;               // desired size before any size hint
   size_t    _refill_waste_limit;                 // hold onto tlab if free() is larger than this
   size_t    _allocated_before_last_gc;           // total bytes allocated up until the last gc
   size_t    _bytes_since_last_sample_point;      // bytes since last sample point.
@@ -77,7 +78,7 @@ class ThreadLocalAllocBuffer: public CHeapObj<mtThread> {
   void set_allocation_end(HeapWord* ptr)         { _allocation_end = ptr; }
   void set_top(HeapWord* top)                    { _top = top; }
   void set_pf_top(HeapWord* pf_top)              { _pf_top = pf_top; }
-  void set_desired_size(size_t desired_size)     { _desired_size = desired_size; }
+  void set_desired_size(size_t desired_size)     { _desired_size = _resized_desired_size = desired_size; }
   void set_refill_waste_limit(size_t waste)      { _refill_waste_limit = waste;  }
 
   size_t initial_refill_waste_limit();
@@ -119,6 +120,9 @@ class ThreadLocalAllocBuffer: public CHeapObj<mtThread> {
   HeapWord* hard_end();
   HeapWord* pf_top() const                       { return _pf_top; }
   size_t desired_size() const                    { return _desired_size; }
+  // Makes the next refills use at least size_hint words, until the next
+  // resize or size hint. A size hint of zero removes any previous one.
+  void set_desired_size_hint(size_t size_hint);
   size_t used() const                            { return pointer_delta(top(), start()); }
   size_t used_bytes() const                      { return pointer_delta(top(), start(), 1); }
   size_t free() const                            { return pointer_delta(end(), top()); }
@@ -42,6 +42,11 @@
   product(bool, ResizeTLAB, true,                                           \
           "Dynamically resize TLAB size for threads")                       \
                                                                             \
+  product(bool, VirtualThreadTLABSizeHints, false, EXPERIMENTAL,            \
+          "Track the average allocation per mount of each virtual thread "  \
+          "and grow the TLAB of the carrier to it while the virtual "       \
+          "thread is mounted. Requires ResizeTLAB")                         \
+                                                                            \
   product(bool, ZeroTLAB, false,                                            \
           "Zero out the newly created TLAB")                                \
                                                                             \
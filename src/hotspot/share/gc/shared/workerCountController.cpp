@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/gc_globals.hpp"
+#include "gc/shared/workerCountController.hpp"
+#include "gc/shared/workerPolicy.hpp"
+#include "logging/log.hpp"
+
+WorkerCountController::WorkerCountController(const char* name, uint max_workers) :
+  _name(name),
+  _max_workers(max_workers),
+  _last_workers(0),
+  _efficiency() { }
+
+void WorkerCountController::record(uint active_workers, double wall_time_secs, double busy_time_secs) {
+  assert(active_workers > 0, "must be");
+  if (wall_time_secs <= 0.0) {
+    return;
+  }
+  double efficiency = clamp(busy_time_secs / (wall_time_secs * active_workers), 0.0, 1.0);
+  _efficiency.add(efficiency);
+  _last_workers = active_workers;
+
+  log_debug(gc, task)("%s: %u workers, parallel efficiency %.2f (average %.2f)",
+                      _name, active_workers, efficiency, _efficiency.davg());
+}
+
+uint WorkerCountController::workers(uint default_workers) const {
+  uint result = default_workers;
+  if (_last_workers != 0) {
+    // The number of workers that would have been busy at the target efficiency.
+    double busy_workers = _efficiency.davg() * _last_workers;
+    result = (uint)ceil(busy_workers * 100.0 / GCWorkerEfficiencyTarget);
+  }
+  result = clamp(result, 1u, _max_workers);
+  return WorkerPolicy::limit_by_processor_quota(result);
+}
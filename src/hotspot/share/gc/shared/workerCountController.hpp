@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_SHARED_WORKERCOUNTCONTROLLER_HPP
+#define SHARE_GC_SHARED_WORKERCOUNTCONTROLLER_HPP
+
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/numberSeq.hpp"
+
+// Feedback controller for the number of active workers of one parallel
+// phase, used with UseGCWorkerCountFeedback.
+//
+// After each run of the phase the collector reports the wall time of the
+// run and the total time its workers spent on useful work, i.e. not waiting
+// for termination. The parallel efficiency busy / (wall * workers) tells how
+// many workers the phase actually kept busy. The controller recommends the
+// number of workers that would have run at GCWorkerEfficiencyTarget, which
+// shrinks the gang when workers mostly wait, and grows it by up to
+// 100 / GCWorkerEfficiencyTarget when they are all busy. The recommendation
+// never exceeds the processors currently available to the process, which
+// accounts for container CPU quotas.
+class WorkerCountController {
+  const char* const _name;
+  const uint _max_workers;
+  uint _last_workers;
+  TruncatedSeq _efficiency;
+
+public:
+  WorkerCountController(const char* name, uint max_workers);
+
+  // Record a run of the phase with active_workers workers.
+  void record(uint active_workers, double wall_time_secs, double busy_time_secs);
+
+  // The number of workers to use for the next run. Returns default_workers,
+  // limited to the available processors, until a run has been recorded.
+  uint workers(uint default_workers) const;
+};
+
+#endif // SHARE_GC_SHARED_WORKERCOUNTCONTROLLER_HPP
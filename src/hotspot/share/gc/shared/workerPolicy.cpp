@@ -159,19 +159,29 @@ uint WorkerPolicy::calc_active_workers(uintx total_workers,
                                                      application_workers);
   }
   assert(new_active_workers > 0, "Always need at least 1");
-  return new_active_workers;
+  return limit_by_processor_quota(new_active_workers);
 }
 
 uint WorkerPolicy::calc_active_conc_workers(uintx total_workers,
                                             uintx active_workers,
                                             uintx application_workers) {
   if (!UseDynamicNumberOfGCThreads || !FLAG_IS_DEFAULT(ConcGCThreads)) {
-    return ConcGCThreads;
+    return limit_by_processor_quota(ConcGCThreads);
   } else {
     uint no_of_gc_threads = calc_default_active_workers(total_workers,
                                                         1, /* Minimum number of workers */
                                                         active_workers,
                                                         application_workers);
-    return no_of_gc_threads;
+    return limit_by_processor_quota(no_of_gc_threads);
+  }
+}
+
+uint WorkerPolicy::limit_by_processor_quota(uint workers) {
+  if (!UseGCWorkerCountFeedback) {
+    return workers;
   }
+  // os::active_processor_count() honors the container CPU quota, and is
+  // re-evaluated periodically, so quota changes are picked up.
+  uint processors = (uint)MAX2(os::active_processor_count(), 1);
+  return MIN2(workers, processors);
 }
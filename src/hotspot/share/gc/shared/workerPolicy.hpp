@@ -72,6 +72,10 @@ class WorkerPolicy : public AllStatic {
                                        uintx active_workers,
                                        uintx application_workers);
 
+  // With UseGCWorkerCountFeedback, returns workers limited to the number of
+  // processors currently available to the process. Otherwise returns workers.
+  static uint limit_by_processor_quota(uint workers);
+
 };
 
 #endif // SHARE_GC_SHARED_WORKERPOLICY_HPP
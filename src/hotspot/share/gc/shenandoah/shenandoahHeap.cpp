@@ -83,6 +83,7 @@
 #include "prims/jvmtiTagMap.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/globals.hpp"
+#include "runtime/init.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/java.hpp"
 #include "runtime/orderAccess.hpp"
@@ -2103,6 +2104,16 @@ void ShenandoahHeap::unpin_object(JavaThread* thr, oop o) {
   r->record_unpin();
 }
 
+// Region pin counts are global, so pins are never bound to a thread.
+bool ShenandoahHeap::pin_object_detached(oop o) {
+  heap_region_containing(o)->record_pin();
+  return true;
+}
+
+void ShenandoahHeap::unpin_object_detached(oop o) {
+  unpin_object(nullptr, o);
+}
+
 void ShenandoahHeap::sync_pinned_region_status() {
   ShenandoahHeapLocker locker(lock());
 
@@ -2162,12 +2173,13 @@ void ShenandoahHeap::assert_gc_workers(uint nworkers) {
 
   if (ShenandoahSafepoint::is_at_shenandoah_safepoint()) {
     // Use ParallelGCThreads inside safepoints
-    assert(nworkers == ParallelGCThreads, "Use ParallelGCThreads (%u) within safepoint, not %u",
-           ParallelGCThreads, nworkers);
+    // (or fewer, when limited by the processor quota)
+    assert(nworkers == ParallelGCThreads || (UseGCWorkerCountFeedback && nworkers < ParallelGCThreads),
+           "Use ParallelGCThreads (%u) within safepoint, not %u", ParallelGCThreads, nworkers);
   } else {
     // Use ConcGCThreads outside safepoints
-    assert(nworkers == ConcGCThreads, "Use ConcGCThreads (%u) outside safepoints, %u",
-           ConcGCThreads, nworkers);
+    assert(nworkers == ConcGCThreads || (UseGCWorkerCountFeedback && nworkers < ConcGCThreads),
+           "Use ConcGCThreads (%u) outside safepoints, %u", ConcGCThreads, nworkers);
   }
 }
 #endif
@@ -2569,3 +2581,73 @@ void ShenandoahHeap::complete_loaded_archive_space(MemRegion archive_space) {
          p2i(end), p2i(end_reg->top()));
 #endif
 }
+
+bool ShenandoahHeap::can_map_archived_objects() const {
+  // CDS guarantees no objects straddle multiple regions only as long as regions
+  // are as large as MIN_GC_REGION_ALIGNMENT, see allocate_loaded_archive_space().
+  return ShenandoahHeapRegion::region_size_bytes() >= ArchiveHeapWriter::MIN_GC_REGION_ALIGNMENT;
+}
+
+HeapWord* ShenandoahHeap::alloc_archive_region(size_t word_size, HeapWord* preferred_addr) {
+#if INCLUDE_CDS_JAVA_HEAP
+  assert(!is_init_completed(), "Expect to be called at JVM init time");
+
+  // The archived objects are mapped into regular regions at the very top of the
+  // heap, like G1 does. The first region starts with an object, and the last
+  // region is only filled up to the end of the archive space, so the regions
+  // stay parsable without any filler objects.
+  size_t num = ShenandoahHeapRegion::required_regions(word_size * HeapWordSize);
+  if (num >= num_regions()) {
+    log_info(gc, heap)("Unable to allocate regions as archive heap is too large; size requested = " SIZE_FORMAT
+                       " bytes, heap = " SIZE_FORMAT " bytes", word_size * HeapWordSize, max_capacity());
+    return nullptr;
+  }
+
+  // Mapping over the committed regions replaces the pages anyway.
+  FlagSetting fs(AlwaysPreTouch, false);
+
+  ShenandoahHeapLocker locker(lock(), false);
+  size_t start_idx = num_regions() - num;
+  for (size_t c = start_idx; c < num_regions(); c++) {
+    if (!get_region(c)->is_empty()) {
+      return nullptr;
+    }
+  }
+
+  HeapWord* start = get_region(start_idx)->bottom();
+  HeapWord* end = start + word_size;
+  for (size_t c = start_idx; c < num_regions(); c++) {
+    ShenandoahHeapRegion* r = get_region(c);
+    r->make_regular_bypass();
+    r->set_top(MIN2(end, r->end()));
+  }
+  increase_used(word_size * HeapWordSize);
+  _free_set->rebuild();
+
+  return start;
+#else
+  assert(false, "Archive heap loader should not be available, should not be here");
+  return nullptr;
+#endif // INCLUDE_CDS_JAVA_HEAP
+}
+
+void ShenandoahHeap::complete_mapped_archive_space(MemRegion archive_space) {
+  // The mapped space has the same shape as the loaded one.
+  complete_loaded_archive_space(archive_space);
+}
+
+void ShenandoahHeap::dealloc_archive_regions(MemRegion range) {
+  assert(!is_init_completed(), "Expect to be called at JVM init time");
+
+  ShenandoahHeapLocker locker(lock(), false);
+  size_t start_idx = heap_region_index_containing(range.start());
+  size_t end_idx = heap_region_index_containing(range.last());
+  for (size_t c = start_idx; c <= end_idx; c++) {
+    ShenandoahHeapRegion* r = get_region(c);
+    assert(r->is_regular(), "Allocated by alloc_archive_region");
+    r->make_trash();
+    r->recycle();
+  }
+  decrease_used(range.byte_size());
+  _free_set->rebuild();
+}
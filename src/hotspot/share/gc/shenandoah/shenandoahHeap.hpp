@@ -499,7 +499,6 @@ class ShenandoahHeap : public CollectedHeap, public ShenandoahSpaceInfo {
 
   bool requires_barriers(stackChunkOop obj) const override;
 
-  MemRegion reserved_region() const { return _reserved; }
   bool is_in_reserved(const void* addr) const { return _reserved.contains(addr); }
 
   void collect(GCCause::Cause cause) override;
@@ -538,6 +537,9 @@ class ShenandoahHeap : public CollectedHeap, public ShenandoahSpaceInfo {
   void pin_object(JavaThread* thread, oop obj) override;
   void unpin_object(JavaThread* thread, oop obj) override;
 
+  bool pin_object_detached(oop obj) override;
+  void unpin_object_detached(oop obj) override;
+
   void sync_pinned_region_status();
   void assert_pinned_region_status() NOT_DEBUG_RETURN;
 
@@ -547,6 +549,11 @@ class ShenandoahHeap : public CollectedHeap, public ShenandoahSpaceInfo {
   HeapWord* allocate_loaded_archive_space(size_t size) override;
   void complete_loaded_archive_space(MemRegion archive_space) override;
 
+  bool can_map_archived_objects() const override;
+  HeapWord* alloc_archive_region(size_t word_size, HeapWord* preferred_addr) override;
+  void complete_mapped_archive_space(MemRegion archive_space) override;
+  void dealloc_archive_regions(MemRegion range) override;
+
 // ---------- Allocation support
 //
 private:
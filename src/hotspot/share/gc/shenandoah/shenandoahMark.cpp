@@ -25,10 +25,12 @@
 
 #include "precompiled.hpp"
 
+#include "gc/shared/partialArrayTaskStepper.hpp"
 #include "gc/shenandoah/shenandoahBarrierSet.hpp"
 #include "gc/shenandoah/shenandoahClosures.inline.hpp"
 #include "gc/shenandoah/shenandoahMark.inline.hpp"
 #include "gc/shenandoah/shenandoahOopClosures.inline.hpp"
+#include "gc/shenandoah/shenandoahPhaseTimings.hpp"
 #include "gc/shenandoah/shenandoahReferenceProcessor.hpp"
 #include "gc/shenandoah/shenandoahTaskqueue.inline.hpp"
 #include "gc/shenandoah/shenandoahUtils.hpp"
@@ -61,6 +63,7 @@ void ShenandoahMark::clear() {
   // Clean up marking stacks.
   ShenandoahObjToScanQueueSet* queues = ShenandoahHeap::heap()->marking_context()->task_queues();
   queues->clear();
+  ShenandoahHeap::heap()->marking_context()->reset_partial_array_state_allocator();
 
   // Cancel SATB buffers.
   ShenandoahBarrierSet::satb_mark_queue_set().abandon_partial_marking();
@@ -124,6 +127,20 @@ void ShenandoahMark::mark_loop(uint worker_id, TaskTerminator* terminator, Shena
   }
 }
 
+// Counts the successful steals of one marking worker, and reports them to
+// the phase timings when the worker leaves the marking loop.
+class ShenandoahMarkStealCounter : public StackObj {
+private:
+  uint const _worker_id;
+  size_t _steals;
+public:
+  ShenandoahMarkStealCounter(uint worker_id) : _worker_id(worker_id), _steals(0) {}
+  ~ShenandoahMarkStealCounter() {
+    ShenandoahHeap::heap()->phase_timings()->record_mark_steals(_worker_id, _steals);
+  }
+  void record_steal() { _steals++; }
+};
+
 template <class T, ShenandoahGenerationType GENERATION, bool CANCELLABLE, StringDedupMode STRING_DEDUP>
 void ShenandoahMark::mark_loop_work(T* cl, ShenandoahLiveData* live_data, uint worker_id, TaskTerminator *terminator, StringDedup::Requests* const req) {
   uintx stride = ShenandoahMarkLoopStride;
@@ -133,6 +150,10 @@ void ShenandoahMark::mark_loop_work(T* cl, ShenandoahLiveData* live_data, uint w
   ShenandoahObjToScanQueue* q;
   ShenandoahMarkTask t;
 
+  // Partial array tasks are sized by the number of workers that can steal them.
+  PartialArrayTaskStepper stepper(heap->workers()->active_workers(), ObjArrayMarkingStride);
+  ShenandoahMarkStealCounter steals(worker_id);
+
   heap->ref_processor()->set_mark_closure(worker_id, cl);
 
   /*
@@ -153,7 +174,7 @@ void ShenandoahMark::mark_loop_work(T* cl, ShenandoahLiveData* live_data, uint w
 
     for (uint i = 0; i < stride; i++) {
       if (q->pop(t)) {
-        do_task<T, GENERATION, STRING_DEDUP>(q, cl, live_data, req, &t);
+        do_task<T, GENERATION, STRING_DEDUP>(q, cl, live_data, req, worker_id, &stepper, &t);
       } else {
         assert(q->is_empty(), "Must be empty");
         q = queues->claim_next();
@@ -180,9 +201,13 @@ void ShenandoahMark::mark_loop_work(T* cl, ShenandoahLiveData* live_data, uint w
 
     uint work = 0;
     for (uint i = 0; i < stride; i++) {
-      if (q->pop(t) ||
-          queues->steal(worker_id, t)) {
-        do_task<T, GENERATION, STRING_DEDUP>(q, cl, live_data, req, &t);
+      bool found = q->pop(t);
+      if (!found && queues->steal(worker_id, t)) {
+        steals.record_steal();
+        found = true;
+      }
+      if (found) {
+        do_task<T, GENERATION, STRING_DEDUP>(q, cl, live_data, req, worker_id, &stepper, &t);
         work++;
       } else {
         break;
@@ -37,6 +37,8 @@ enum StringDedupMode {
   ALWAYS_DEDUP   // Enqueue Strings for deduplication
 };
 
+class PartialArrayState;
+class PartialArrayTaskStepper;
 class ShenandoahMarkingContext;
 class ShenandoahReferenceProcessor;
 
@@ -67,7 +69,8 @@ class ShenandoahMark: public StackObj {
 // ---------- Marking loop and tasks
 private:
   template <class T, ShenandoahGenerationType GENERATION, StringDedupMode STRING_DEDUP>
-  inline void do_task(ShenandoahObjToScanQueue* q, T* cl, ShenandoahLiveData* live_data, StringDedup::Requests* const req, ShenandoahMarkTask* task);
+  inline void do_task(ShenandoahObjToScanQueue* q, T* cl, ShenandoahLiveData* live_data, StringDedup::Requests* const req,
+                      uint worker_id, const PartialArrayTaskStepper* stepper, ShenandoahMarkTask* task);
 
   template <class T>
   inline void do_chunked_array_start(ShenandoahObjToScanQueue* q, T* cl, oop array, bool weak);
@@ -75,6 +78,14 @@ class ShenandoahMark: public StackObj {
   template <class T>
   inline void do_chunked_array(ShenandoahObjToScanQueue* q, T* cl, oop array, int chunk, int pow, bool weak);
 
+  template <class T>
+  inline void start_partial_array(ShenandoahObjToScanQueue* q, T* cl, uint worker_id,
+                                  const PartialArrayTaskStepper* stepper, oop array, bool weak);
+
+  template <class T>
+  inline void do_partial_array(ShenandoahObjToScanQueue* q, T* cl, uint worker_id,
+                               const PartialArrayTaskStepper* stepper, PartialArrayState* state, bool weak);
+
   template <ShenandoahGenerationType GENERATION>
   inline void count_liveness(ShenandoahLiveData* live_data, oop obj);
 
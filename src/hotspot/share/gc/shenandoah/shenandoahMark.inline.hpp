@@ -28,6 +28,8 @@
 #include "gc/shenandoah/shenandoahMark.hpp"
 
 #include "gc/shared/continuationGCSupport.inline.hpp"
+#include "gc/shared/partialArrayState.hpp"
+#include "gc/shared/partialArrayTaskStepper.inline.hpp"
 #include "gc/shenandoah/shenandoahAsserts.hpp"
 #include "gc/shenandoah/shenandoahBarrierSet.inline.hpp"
 #include "gc/shenandoah/shenandoahHeap.inline.hpp"
@@ -40,6 +42,7 @@
 #include "oops/compressedOops.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/prefetch.inline.hpp"
+#include "utilities/checkedCast.hpp"
 #include "utilities/devirtualizer.inline.hpp"
 #include "utilities/powerOfTwo.hpp"
 
@@ -58,7 +61,16 @@ void ShenandoahMark::dedup_string(oop obj, StringDedup::Requests* const req) {
 }
 
 template <class T, ShenandoahGenerationType GENERATION, StringDedupMode STRING_DEDUP>
-void ShenandoahMark::do_task(ShenandoahObjToScanQueue* q, T* cl, ShenandoahLiveData* live_data, StringDedup::Requests* const req, ShenandoahMarkTask* task) {
+void ShenandoahMark::do_task(ShenandoahObjToScanQueue* q, T* cl, ShenandoahLiveData* live_data, StringDedup::Requests* const req,
+                             uint worker_id, const PartialArrayTaskStepper* stepper, ShenandoahMarkTask* task) {
+  if (task->is_partial_array_state()) {
+    // Case 5: Part of an array split with the shared partial array machinery.
+    bool weak = task->is_weak();
+    cl->set_weak(weak);
+    do_partial_array<T>(q, cl, worker_id, stepper, task->to_partial_array_state(), weak);
+    return;
+  }
+
   oop obj = task->obj();
 
   shenandoah_assert_not_forwarded(nullptr, obj);
@@ -83,7 +95,11 @@ void ShenandoahMark::do_task(ShenandoahObjToScanQueue* q, T* cl, ShenandoahLiveD
     } else if (obj->is_objArray()) {
       // Case 2: Object array instance and no chunk is set. Must be the first
       // time we visit it, start the chunked processing.
-      do_chunked_array_start<T>(q, cl, obj, weak);
+      if (ShenandoahMarkPartialArrays) {
+        start_partial_array<T>(q, cl, worker_id, stepper, obj, weak);
+      } else {
+        do_chunked_array_start<T>(q, cl, obj, weak);
+      }
     } else {
       // Case 3: Primitive array. Do nothing, no oops there. We use the same
       // performance tweak TypeArrayKlass::oop_oop_iterate_impl is using:
@@ -231,6 +247,62 @@ inline void ShenandoahMark::do_chunked_array(ShenandoahObjToScanQueue* q, T* cl,
   array->oop_iterate_range(cl, from, to);
 }
 
+template <class T>
+inline void ShenandoahMark::start_partial_array(ShenandoahObjToScanQueue* q, T* cl, uint worker_id,
+                                                const PartialArrayTaskStepper* stepper, oop obj, bool weak) {
+  assert(obj->is_objArray(), "expect object array");
+  objArrayOop array = objArrayOop(obj);
+  size_t len = array->length();
+
+  // Mark objArray klass metadata
+  if (Devirtualizer::do_metadata(cl)) {
+    Devirtualizer::do_klass(cl, array->klass());
+  }
+
+  PartialArrayTaskStepper::Step step = stepper->start(len);
+
+  // Push the partial tasks before processing the initial chunk, so that
+  // other workers can steal them while we are busy.
+  if (step._ncreate > 0) {
+    assert(step._index < len, "invariant");
+    assert(((len - step._index) % stepper->chunk_size()) == 0, "invariant");
+    PartialArrayStateAllocator* allocator = ShenandoahHeap::heap()->marking_context()->partial_array_state_allocator();
+    PartialArrayState* state = allocator->allocate(worker_id, array, array, step._index, len, step._ncreate);
+    for (uint i = 0; i < step._ncreate; ++i) {
+      bool pushed = q->push(ShenandoahMarkTask(state, weak));
+      assert(pushed, "overflow queue should always succeed pushing");
+    }
+  } else {
+    assert(step._index == len, "invariant");
+  }
+
+  // The initial chunk is the irregular head of the array, if any.
+  array->oop_iterate_range(cl, 0, checked_cast<int>(step._index));
+}
+
+template <class T>
+inline void ShenandoahMark::do_partial_array(ShenandoahObjToScanQueue* q, T* cl, uint worker_id,
+                                             const PartialArrayTaskStepper* stepper, PartialArrayState* state, bool weak) {
+  objArrayOop array = objArrayOop(state->destination());
+  assert(array->is_objArray(), "expect object array");
+
+  // Claim a chunk, and push the additional tasks first, as above.
+  PartialArrayTaskStepper::Step step = stepper->next(state);
+  if (step._ncreate > 0) {
+    state->add_references(step._ncreate);
+    for (uint i = 0; i < step._ncreate; ++i) {
+      bool pushed = q->push(ShenandoahMarkTask(state, weak));
+      assert(pushed, "overflow queue should always succeed pushing");
+    }
+  }
+
+  array->oop_iterate_range(cl,
+                           checked_cast<int>(step._index),
+                           checked_cast<int>(step._index + stepper->chunk_size()));
+
+  ShenandoahHeap::heap()->marking_context()->partial_array_state_allocator()->release(worker_id, state);
+}
+
 template <ShenandoahGenerationType GENERATION>
 class ShenandoahSATBBufferClosure : public SATBBufferClosure {
 private:
@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "gc/shared/markBitMap.inline.hpp"
+#include "gc/shared/partialArrayState.hpp"
 #include "gc/shenandoah/shenandoahHeap.inline.hpp"
 #include "gc/shenandoah/shenandoahHeapRegion.inline.hpp"
 #include "gc/shenandoah/shenandoahMarkingContext.hpp"
@@ -36,12 +37,17 @@ ShenandoahMarkingContext::ShenandoahMarkingContext(MemRegion heap_region, MemReg
   _top_at_mark_starts_base(NEW_C_HEAP_ARRAY(HeapWord*, num_regions, mtGC)),
   _top_at_mark_starts(_top_at_mark_starts_base -
                       ((uintx) heap_region.start() >> ShenandoahHeapRegion::region_size_bytes_shift())),
-  _task_queues(new ShenandoahObjToScanQueueSet(max_queues)) {
+  _task_queues(new ShenandoahObjToScanQueueSet(max_queues)),
+  _partial_array_state_allocator(nullptr),
+  _max_queues(max_queues) {
   assert(max_queues > 0, "At least one queue");
   for (uint i = 0; i < max_queues; ++i) {
     ShenandoahObjToScanQueue* task_queue = new ShenandoahObjToScanQueue();
     _task_queues->register_queue(i, task_queue);
   }
+  if (ShenandoahMarkPartialArrays) {
+    _partial_array_state_allocator = new PartialArrayStateAllocator(max_queues);
+  }
 }
 
 ShenandoahMarkingContext::~ShenandoahMarkingContext() {
@@ -50,6 +56,16 @@ ShenandoahMarkingContext::~ShenandoahMarkingContext() {
     delete q;
   }
   delete _task_queues;
+  delete _partial_array_state_allocator;
+}
+
+void ShenandoahMarkingContext::reset_partial_array_state_allocator() {
+  if (_partial_array_state_allocator != nullptr) {
+    // The allocator has no way to find the states left behind by cleared
+    // queues, so replace it and let its arenas release them all.
+    delete _partial_array_state_allocator;
+    _partial_array_state_allocator = new PartialArrayStateAllocator(_max_queues);
+  }
 }
 
 bool ShenandoahMarkingContext::is_bitmap_clear() const {
@@ -31,6 +31,7 @@
 #include "memory/memRegion.hpp"
 #include "oops/oopsHierarchy.hpp"
 
+class PartialArrayStateAllocator;
 class ShenandoahObjToScanQueueSet;
 
 /**
@@ -50,6 +51,10 @@ class ShenandoahMarkingContext : public CHeapObj<mtGC> {
   // Marking task queues
   ShenandoahObjToScanQueueSet* _task_queues;
 
+  // States for large arrays marked with ShenandoahMarkPartialArrays
+  PartialArrayStateAllocator* _partial_array_state_allocator;
+  const uint _max_queues;
+
 public:
   ShenandoahMarkingContext(MemRegion heap_region, MemRegion bitmap_region, size_t num_regions, uint max_queues);
   ~ShenandoahMarkingContext();
@@ -91,6 +96,11 @@ class ShenandoahMarkingContext : public CHeapObj<mtGC> {
 
   // Task queues
   ShenandoahObjToScanQueueSet* task_queues() const { return _task_queues; }
+
+  PartialArrayStateAllocator* partial_array_state_allocator() const { return _partial_array_state_allocator; }
+  // Drop all states, including those referenced from abandoned tasks.
+  // Task queues must have been cleared, and no marking workers may be active.
+  void reset_partial_array_state_allocator();
 };
 
 #endif // SHARE_GC_SHENANDOAH_SHENANDOAHMARKINGCONTEXT_HPP
@@ -28,6 +28,7 @@
 #include "gc/shenandoah/shenandoahHeap.inline.hpp"
 #include "gc/shenandoah/shenandoahPacer.hpp"
 #include "gc/shenandoah/shenandoahPhaseTimings.hpp"
+#include "jfr/jfrEvents.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/javaThread.inline.hpp"
 #include "runtime/mutexLocker.hpp"
@@ -252,6 +253,7 @@ void ShenandoahPacer::pace_for_alloc(size_t words) {
     return;
   }
 
+  EventShenandoahPacingStall event;
   double start = os::elapsedTime();
 
   size_t max_ms = ShenandoahPacingMaxDelay;
@@ -272,6 +274,11 @@ void ShenandoahPacer::pace_for_alloc(size_t words) {
       //     and start Degenerated GC cycle.
       //  b) The budget had been replenished, which means our claim is satisfied.
       ShenandoahThreadLocalData::add_paced_time(JavaThread::current(), end - start);
+      if (event.should_commit()) {
+        event.set_size(words * HeapWordSize);
+        event.set_satisfied(Atomic::load(&_budget) >= 0);
+        event.commit();
+      }
       break;
     }
   }
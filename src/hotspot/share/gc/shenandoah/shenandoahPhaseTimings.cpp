@@ -50,9 +50,14 @@ const char* ShenandoahPhaseTimings::_phase_names[] = {
 #undef SHENANDOAH_PHASE_DECLARE_NAME
 
 ShenandoahPhaseTimings::ShenandoahPhaseTimings(uint max_workers) :
-  _max_workers(max_workers) {
+  _max_workers(max_workers),
+  _mark_steals(NEW_C_HEAP_ARRAY(size_t, max_workers, mtGC)) {
   assert(_max_workers > 0, "Must have some GC threads");
 
+  for (uint i = 0; i < _max_workers; i++) {
+    _mark_steals[i] = 0;
+  }
+
   // Initialize everything to sane defaults
   for (uint i = 0; i < _num_phases; i++) {
 #define SHENANDOAH_WORKER_DATA_NULL(type, title) \
@@ -181,6 +186,12 @@ void ShenandoahPhaseTimings::record_workers_end(Phase phase) {
   assert(is_worker_phase(phase), "Phase should accept worker phase times: %s", phase_name(phase));
 }
 
+void ShenandoahPhaseTimings::record_mark_steals(uint worker_id, size_t steals) {
+  assert(worker_id < _max_workers, "Out of bound: %u", worker_id);
+  // Every worker only ever updates its own slot.
+  _mark_steals[worker_id] += steals;
+}
+
 void ShenandoahPhaseTimings::flush_par_workers_to_cycle() {
   for (uint pi = 0; pi < _num_phases; pi++) {
     Phase phase = Phase(pi);
@@ -227,6 +238,9 @@ void ShenandoahPhaseTimings::flush_cycle_to_global() {
       _worker_data[i]->reset();
     }
   }
+  for (uint c = 0; c < _max_workers; c++) {
+    _mark_steals[c] = 0;
+  }
   OrderAccess::fence();
 }
 
@@ -261,6 +275,18 @@ void ShenandoahPhaseTimings::print_cycle_on(outputStream* out) const {
       out->cr();
     }
   }
+
+  size_t total_steals = 0;
+  for (uint c = 0; c < _max_workers; c++) {
+    total_steals += _mark_steals[c];
+  }
+  if (total_steals > 0) {
+    out->print(SHENANDOAH_PHASE_NAME_FORMAT " " SIZE_FORMAT_W(8) " steals, workers: ", "Mark Task Steals", total_steals);
+    for (uint c = 0; c < _max_workers; c++) {
+      out->print(SIZE_FORMAT ", ", _mark_steals[c]);
+    }
+    out->cr();
+  }
 }
 
 void ShenandoahPhaseTimings::print_global_on(outputStream* out) const {
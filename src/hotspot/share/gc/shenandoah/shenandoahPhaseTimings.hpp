@@ -211,6 +211,9 @@ class ShenandoahPhaseTimings : public CHeapObj<mtGC> {
   ShenandoahWorkerData* _worker_data[_num_phases];
   ShenandoahCollectorPolicy* _policy;
 
+  // Successful marking task steals per worker, for the current cycle.
+  size_t* const       _mark_steals;
+
   static bool is_worker_phase(Phase phase);
   static bool is_root_work_phase(Phase phase);
 
@@ -228,6 +231,8 @@ class ShenandoahPhaseTimings : public CHeapObj<mtGC> {
   void record_workers_start(Phase phase);
   void record_workers_end(Phase phase);
 
+  void record_mark_steals(uint worker_id, size_t steals);
+
   void flush_par_workers_to_cycle();
   void flush_cycle_to_global();
 
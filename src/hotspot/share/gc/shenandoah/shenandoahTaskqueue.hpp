@@ -35,6 +35,7 @@
 #include "runtime/mutex.hpp"
 #include "utilities/debug.hpp"
 
+class PartialArrayState;
 class ShenandoahHeap;
 
 template<class E, MemTag MT, unsigned int N = TASKQUEUE_SIZE>
@@ -120,6 +121,12 @@ class BufferedOverflowTaskQueue: public OverflowTaskQueue<E, MT, N>
 // if/when Arrays 2.0 bring 2^64-sized arrays, we might need to steal another bit for power. We could regain
 // some bits back if chunks are counted in ObjArrayMarkingStride units.
 //
+// With ShenandoahMarkPartialArrays, large arrays are instead split with the shared PartialArrayState
+// machinery. Such tasks carry a PartialArrayState pointer in place of the oop, and are tagged with the
+// otherwise unused combination of chunk == 0 and all pow bits set:
+//
+//    |xx------state--------|11111|0000000000|
+//
 // There is also a fallback version that uses plain fields, when we don't have enough space to steal the
 // bits from the native pointer. It is useful to debug the optimized version.
 //
@@ -160,6 +167,8 @@ class ShenandoahMarkTask
   static const int chunk_range_mask = right_n_bits(chunk_bits);
   static const int pow_range_mask   = right_n_bits(pow_bits);
 
+  static const uintptr_t partial_array_tag = ((uintptr_t) pow_range_mask) << pow_shift;
+
   inline oop decode_oop(uintptr_t val) const {
     STATIC_ASSERT(oop_shift == 0);
     return cast_to_oop(val & oop_extract_mask);
@@ -230,6 +239,16 @@ class ShenandoahMarkTask
     _obj = enc;
   }
 
+  ShenandoahMarkTask(PartialArrayState* state, bool weak) {
+    uintptr_t enc_state = reinterpret_cast<uintptr_t>(state);
+    assert((enc_state & ~oop_extract_mask) == 0, "state is not encodable: " PTR_FORMAT, p2i(state));
+    uintptr_t enc = enc_state | skip_live_extract_mask | partial_array_tag;
+    if (weak) {
+      enc |= weak_extract_mask;
+    }
+    _obj = enc;
+  }
+
   // Trivially copyable.
 
 public:
@@ -237,6 +256,14 @@ class ShenandoahMarkTask
   inline int  chunk()          const { return decode_chunk(_obj); }
   inline int  pow()            const { return decode_pow(_obj);   }
 
+  inline bool is_partial_array_state() const {
+    return (_obj & chunk_pow_extract_mask) == partial_array_tag;
+  }
+  inline PartialArrayState* to_partial_array_state() const {
+    assert(is_partial_array_state(), "not a partial array task");
+    return reinterpret_cast<PartialArrayState*>(_obj & oop_extract_mask);
+  }
+
   inline bool is_not_chunked() const { return decode_not_chunked(_obj); }
   inline bool is_weak()        const { return decode_weak(_obj);        }
   inline bool count_liveness() const { return decode_cnt_live(_obj);    }
@@ -262,6 +289,7 @@ class ShenandoahMarkTask
   static const int pow_max         = nth_bit(pow_bits) - 1;
 
   oop _obj;
+  PartialArrayState* _state;
   bool _skip_live;
   bool _weak;
   int _chunk;
@@ -269,17 +297,27 @@ class ShenandoahMarkTask
 
 public:
   ShenandoahMarkTask(oop o = nullptr, bool skip_live = false, bool weak = false, int chunk = 0, int pow = 0):
-    _obj(o), _skip_live(skip_live), _weak(weak), _chunk(chunk), _pow(pow) {
+    _obj(o), _state(nullptr), _skip_live(skip_live), _weak(weak), _chunk(chunk), _pow(pow) {
     assert(0 <= chunk && chunk <= chunk_max, "chunk is in range: %d", chunk);
     assert(0 <= pow && pow <= pow_max, "pow is in range: %d", pow);
   }
 
+  ShenandoahMarkTask(PartialArrayState* state, bool weak):
+    _obj(nullptr), _state(state), _skip_live(true), _weak(weak), _chunk(0), _pow(0) {
+    assert(state != nullptr, "sanity");
+  }
+
   // Trivially copyable.
 
   inline oop obj()             const { return _obj; }
   inline int chunk()           const { return _chunk; }
   inline int pow()             const { return _pow; }
-  inline bool is_not_chunked() const { return _chunk == 0; }
+  inline bool is_partial_array_state() const { return _state != nullptr; }
+  inline PartialArrayState* to_partial_array_state() const {
+    assert(is_partial_array_state(), "not a partial array task");
+    return _state;
+  }
+  inline bool is_not_chunked() const { return _chunk == 0 && _state == nullptr; }
   inline bool is_weak()        const { return _weak; }
   inline bool count_liveness() const { return !_skip_live; }
 
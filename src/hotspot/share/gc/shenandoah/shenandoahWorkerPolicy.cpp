@@ -25,48 +25,49 @@
 #include "precompiled.hpp"
 
 #include "gc/shared/gc_globals.hpp"
+#include "gc/shared/workerPolicy.hpp"
 #include "gc/shenandoah/shenandoahWorkerPolicy.hpp"
 
 uint ShenandoahWorkerPolicy::calc_workers_for_init_marking() {
-  return ParallelGCThreads;
+  return WorkerPolicy::limit_by_processor_quota(ParallelGCThreads);
 }
 
 uint ShenandoahWorkerPolicy::calc_workers_for_conc_marking() {
-  return ConcGCThreads;
+  return WorkerPolicy::limit_by_processor_quota(ConcGCThreads);
 }
 
 uint ShenandoahWorkerPolicy::calc_workers_for_final_marking() {
-  return ParallelGCThreads;
+  return WorkerPolicy::limit_by_processor_quota(ParallelGCThreads);
 }
 
 uint ShenandoahWorkerPolicy::calc_workers_for_conc_refs_processing() {
-  return ConcGCThreads;
+  return WorkerPolicy::limit_by_processor_quota(ConcGCThreads);
 }
 
 uint ShenandoahWorkerPolicy::calc_workers_for_conc_root_processing() {
-  return ConcGCThreads;
+  return WorkerPolicy::limit_by_processor_quota(ConcGCThreads);
 }
 
 uint ShenandoahWorkerPolicy::calc_workers_for_conc_evac() {
-  return ConcGCThreads;
+  return WorkerPolicy::limit_by_processor_quota(ConcGCThreads);
 }
 
 uint ShenandoahWorkerPolicy::calc_workers_for_fullgc() {
-  return ParallelGCThreads;
+  return WorkerPolicy::limit_by_processor_quota(ParallelGCThreads);
 }
 
 uint ShenandoahWorkerPolicy::calc_workers_for_stw_degenerated() {
-  return ParallelGCThreads;
+  return WorkerPolicy::limit_by_processor_quota(ParallelGCThreads);
 }
 
 uint ShenandoahWorkerPolicy::calc_workers_for_conc_update_ref() {
-  return ConcGCThreads;
+  return WorkerPolicy::limit_by_processor_quota(ConcGCThreads);
 }
 
 uint ShenandoahWorkerPolicy::calc_workers_for_final_update_ref() {
-  return ParallelGCThreads;
+  return WorkerPolicy::limit_by_processor_quota(ParallelGCThreads);
 }
 
 uint ShenandoahWorkerPolicy::calc_workers_for_conc_reset() {
-  return ConcGCThreads;
+  return WorkerPolicy::limit_by_processor_quota(ConcGCThreads);
 }
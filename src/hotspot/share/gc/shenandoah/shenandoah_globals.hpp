@@ -311,6 +311,11 @@
           "checking for cancellation, yielding, etc. Larger values improve "\
           "marking performance at expense of responsiveness.")              \
                                                                             \
+  product(bool, ShenandoahMarkPartialArrays, false, EXPERIMENTAL,           \
+          "Mark large object arrays with the shared partial array task "    \
+          "machinery, which sizes the number of stealable chunks by the "   \
+          "active worker count, instead of the fixed chunk encoding.")      \
+                                                                            \
   product(uintx, ShenandoahParallelRegionStride, 0, EXPERIMENTAL,           \
           "How many regions to process at once during parallel region "     \
           "iteration. Affects heaps with lots of regions. "                 \
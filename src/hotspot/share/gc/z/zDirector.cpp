@@ -23,6 +23,7 @@
 
 #include "precompiled.hpp"
 #include "gc/shared/gc_globals.hpp"
+#include "gc/shared/nativeMemoryPressure.hpp"
 #include "gc/z/zCollectedHeap.hpp"
 #include "gc/z/zDirector.hpp"
 #include "gc/z/zDriver.hpp"
@@ -597,6 +598,23 @@ static bool rule_major_proactive(const ZDirectorStats& stats) {
   return time_until_gc <= 0;
 }
 
+static bool rule_major_native_memory_pressure() {
+  if (ZCollectionIntervalOnly || !NativeMemoryPressure::is_enabled()) {
+    // Rule disabled
+    return false;
+  }
+
+  // Perform GC if enough native memory has been allocated through Unsafe
+  // since the last such GC. Only a major GC finds the old buffers dead and
+  // lets their memory be freed.
+  if (!NativeMemoryPressure::should_collect()) {
+    return false;
+  }
+
+  NativeMemoryPressure::record_collection();
+  return true;
+}
+
 static GCCause::Cause make_minor_gc_decision(const ZDirectorStats& stats) {
   if (ZDriver::minor()->is_busy()) {
     return GCCause::_no_gc;
@@ -634,6 +652,10 @@ static GCCause::Cause make_major_gc_decision(const ZDirectorStats& stats) {
     return GCCause::_z_warmup;
   }
 
+  if (rule_major_native_memory_pressure()) {
+    return GCCause::_native_memory_pressure;
+  }
+
   if (rule_major_proactive(stats)) {
     return GCCause::_z_proactive;
   }
@@ -249,6 +249,7 @@ static bool should_clear_all_soft_references(GCCause::Cause cause) {
   case GCCause::_z_warmup:
   case GCCause::_z_allocation_rate:
   case GCCause::_z_proactive:
+  case GCCause::_native_memory_pressure:
   case GCCause::_metadata_GC_threshold:
   case GCCause::_codecache_GC_threshold:
   case GCCause::_codecache_GC_aggressive:
@@ -287,6 +288,7 @@ static bool should_preclean_young(GCCause::Cause cause) {
   case GCCause::_z_warmup:
   case GCCause::_z_allocation_rate:
   case GCCause::_z_proactive:
+  case GCCause::_native_memory_pressure:
   case GCCause::_metadata_GC_threshold:
   case GCCause::_codecache_GC_threshold:
   case GCCause::_codecache_GC_aggressive:
@@ -352,6 +354,7 @@ void ZDriverMajor::collect(const ZDriverRequest& request) {
   case GCCause::_z_allocation_rate:
   case GCCause::_z_allocation_stall:
   case GCCause::_z_proactive:
+  case GCCause::_native_memory_pressure:
   case GCCause::_codecache_GC_threshold:
   case GCCause::_metadata_GC_threshold:
     // Start asynchronous GC
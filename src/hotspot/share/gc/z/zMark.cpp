@@ -79,6 +79,8 @@ static const ZStatSubPhase ZSubPhaseConcurrentMarkRootColoredYoung("Concurrent M
 static const ZStatSubPhase ZSubPhaseConcurrentMarkRootUncoloredOld("Concurrent Mark Root Uncolored", ZGenerationId::old);
 static const ZStatSubPhase ZSubPhaseConcurrentMarkRootColoredOld("Concurrent Mark Root Colored", ZGenerationId::old);
 
+static const ZStatSampler ZSamplerMarkStackUsage("Memory", "Mark Stack Usage", ZStatUnitBytes);
+
 ZMark::ZMark(ZGeneration* generation, ZPageTable* page_table)
   : _generation(generation),
     _page_table(page_table),
@@ -1012,6 +1014,10 @@ bool ZMark::end() {
 }
 
 void ZMark::free() {
+  // Sample the mark stack space used by this mark before it is shrunk,
+  // so that the statistics show the high-water mark across cycles
+  ZStatSample(ZSamplerMarkStackUsage, _allocator.size());
+
   // Free any unused mark stack space
   _allocator.free();
 
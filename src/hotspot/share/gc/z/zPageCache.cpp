@@ -60,14 +60,14 @@ ZPageCache::ZPageCache()
     _large(),
     _last_commit(0) {}
 
-ZPage* ZPageCache::alloc_small_page() {
+ZPage* ZPageCache::remove_first_per_numa(ZPerNUMA<ZList<ZPage> >* lists, bool* local) {
   const uint32_t numa_id = ZNUMA::id();
   const uint32_t numa_count = ZNUMA::count();
 
   // Try NUMA local page cache
-  ZPage* const l1_page = _small.get(numa_id).remove_first();
+  ZPage* const l1_page = lists->addr(numa_id)->remove_first();
   if (l1_page != nullptr) {
-    ZStatInc(ZCounterPageCacheHitL1);
+    *local = true;
     return l1_page;
   }
 
@@ -79,9 +79,9 @@ ZPage* ZPageCache::alloc_small_page() {
       remote_numa_id = 0;
     }
 
-    ZPage* const l2_page = _small.get(remote_numa_id).remove_first();
+    ZPage* const l2_page = lists->addr(remote_numa_id)->remove_first();
     if (l2_page != nullptr) {
-      ZStatInc(ZCounterPageCacheHitL2);
+      *local = false;
       return l2_page;
     }
 
@@ -91,14 +91,24 @@ ZPage* ZPageCache::alloc_small_page() {
   return nullptr;
 }
 
+ZPage* ZPageCache::alloc_small_page() {
+  bool local;
+  ZPage* const page = remove_first_per_numa(&_small, &local);
+  if (page != nullptr) {
+    ZStatInc(local ? ZCounterPageCacheHitL1 : ZCounterPageCacheHitL2);
+  }
+
+  return page;
+}
+
 ZPage* ZPageCache::alloc_medium_page() {
-  ZPage* const page = _medium.remove_first();
+  bool local;
+  ZPage* const page = remove_first_per_numa(&_medium, &local);
   if (page != nullptr) {
-    ZStatInc(ZCounterPageCacheHitL1);
-    return page;
+    ZStatInc(local ? ZCounterPageCacheHitL1 : ZCounterPageCacheHitL2);
   }
 
-  return nullptr;
+  return page;
 }
 
 ZPage* ZPageCache::alloc_large_page(size_t size) {
@@ -118,7 +128,8 @@ ZPage* ZPageCache::alloc_large_page(size_t size) {
 
 ZPage* ZPageCache::alloc_oversized_medium_page(size_t size) {
   if (size <= ZPageSizeMedium) {
-    return _medium.remove_first();
+    bool local;
+    return remove_first_per_numa(&_medium, &local);
   }
 
   return nullptr;
@@ -192,7 +203,7 @@ void ZPageCache::free_page(ZPage* page) {
   if (type == ZPageType::small) {
     _small.get(page->numa_id()).insert_first(page);
   } else if (type == ZPageType::medium) {
-    _medium.insert_first(page);
+    _medium.get(page->numa_id()).insert_first(page);
   } else {
     _large.insert_first(page);
   }
@@ -240,7 +251,7 @@ void ZPageCache::flush_per_numa_lists(ZPageCacheFlushClosure* cl, ZPerNUMA<ZList
 void ZPageCache::flush(ZPageCacheFlushClosure* cl, ZList<ZPage>* to) {
   // Prefer flushing large, then medium and last small pages
   flush_list(cl, &_large, to);
-  flush_list(cl, &_medium, to);
+  flush_per_numa_lists(cl, &_medium, to);
   flush_per_numa_lists(cl, &_small, to);
 
   if (cl->_flushed > cl->_requested) {
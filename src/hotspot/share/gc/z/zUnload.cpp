@@ -27,6 +27,7 @@
 #include "code/codeBehaviours.hpp"
 #include "code/codeCache.hpp"
 #include "code/dependencyContext.hpp"
+#include "gc/shared/classUnloadingContext.hpp"
 #include "gc/shared/gcBehaviours.hpp"
 #include "gc/shared/suspendibleThreadSet.hpp"
 #include "gc/z/zBarrier.inline.hpp"
@@ -37,8 +38,11 @@
 #include "gc/z/zStat.hpp"
 #include "gc/z/zUncoloredRoot.inline.hpp"
 #include "gc/z/zUnload.hpp"
+#include "logging/log.hpp"
+#include "memory/metaspace.hpp"
 #include "memory/metaspaceUtils.hpp"
 #include "oops/access.inline.hpp"
+#include "runtime/os.hpp"
 
 static const ZStatSubPhase ZSubPhaseConcurrentClassesUnlink("Concurrent Classes Unlink", ZGenerationId::old);
 static const ZStatSubPhase ZSubPhaseConcurrentClassesPurge("Concurrent Classes Purge", ZGenerationId::old);
@@ -152,6 +156,22 @@ void ZUnload::unlink() {
   DependencyContext::cleaning_end();
 }
 
+void ZUnload::purge_class_loader_data_in_slices() {
+  ClassUnloadingContext* const context = ClassUnloadingContext::context();
+  const jlong time_budget_ns = (jlong)ZClassUnloadingPurgeSliceMillis * NANOSECS_PER_MILLISEC;
+  size_t slices = 1;
+
+  while (!context->purge_class_loader_data_slice(time_budget_ns)) {
+    // Return the metaspace freed by this slice, and let waiting
+    // metaspace allocations in, before starting on the next one.
+    Metaspace::purge(true /* classes_unloaded */);
+    os::naked_yield();
+    slices++;
+  }
+
+  log_debug(gc, class, unload)("Purged class loader data in " SIZE_FORMAT " slices", slices);
+}
+
 void ZUnload::purge() {
   if (!ClassUnloading) {
     return;
@@ -164,6 +184,10 @@ void ZUnload::purge() {
     ZNMethod::purge();
   }
 
+  if (ZClassUnloadingPurgeSliceMillis > 0) {
+    purge_class_loader_data_in_slices();
+  }
+
   ClassLoaderDataGraph::purge(/*at_safepoint*/false);
   CodeCache::purge_exception_caches();
 }
@@ -30,6 +30,8 @@ class ZUnload {
 private:
   ZWorkers* const _workers;
 
+  void purge_class_loader_data_in_slices();
+
 public:
   ZUnload(ZWorkers* workers);
 
@@ -61,6 +61,12 @@
           "0: Claim tree "                                                  \
           "1: Simple Striped ")                                             \
                                                                             \
+  product(uint, ZClassUnloadingPurgeSliceMillis, 0, EXPERIMENTAL,          \
+          "Purge unloaded class loader data in slices of at most this "     \
+          "many milliseconds, returning freed metaspace after each slice. " \
+          "0 means all at once")                                            \
+          range(0, max_jint)                                                \
+                                                                            \
   product(bool, ZVerifyRemembered, trueInDebug, DIAGNOSTIC,                 \
           "Verify remembered sets")                                         \
                                                                             \
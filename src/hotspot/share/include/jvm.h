@@ -100,6 +100,19 @@ JNIEXPORT void JNICALL
 JVM_ArrayCopy(JNIEnv *env, jclass ignored, jobject src, jint src_pos,
               jobject dst, jint dst_pos, jint length);
 
+/*
+ * Pin a primitive array so its elements can be accessed directly across
+ * native calls and threads, e.g. by asynchronous I/O. Returns the address of
+ * the first element, or NULL if the collector cannot pin the array; the
+ * caller must then copy. Every successful pin must be released with
+ * JVM_UnpinArray, and the array must be kept reachable until then.
+ */
+JNIEXPORT void * JNICALL
+JVM_PinArray(JNIEnv *env, jarray array);
+
+JNIEXPORT void JNICALL
+JVM_UnpinArray(JNIEnv *env, jarray array);
+
 /*
  * Return an array of all properties as alternating name and value pairs.
  */
@@ -262,6 +275,13 @@ JVM_MoreStackWalk(JNIEnv *env, jobject stackStream, jint mode, jlong anchor,
                   jint last_batch_count, jint buffer_size, jint start_index,
                   jobjectArray frames);
 
+JNIEXPORT jint JNICALL
+JVM_FillCallerLocations(JNIEnv *env, jint mode, jint skip_frames, jobject contScope,
+                        jobjectArray classes, jlongArray locations);
+
+JNIEXPORT void JNICALL
+JVM_InitCallerFrameInfo(JNIEnv *env, jobject frameInfo, jclass holder, jlong location);
+
 JNIEXPORT void JNICALL
 JVM_SetStackWalkContinuation(JNIEnv *env, jobject stackStream, jlong anchor, jobjectArray frames, jobject cont);
 
@@ -1157,6 +1177,9 @@ JVM_VirtualThreadPinnedEvent(jint reasonCode, jstring reasonString);
 JNIEXPORT jobject JNICALL
 JVM_TakeVirtualThreadListToUnblock(JNIEnv* env, jclass ignored);
 
+JNIEXPORT jint JNICALL
+JVM_GetCarrierThreadStates(JNIEnv* env, jclass ignored, jobjectArray carriers, jlongArray states);
+
 /*
  * Core reflection support.
  */
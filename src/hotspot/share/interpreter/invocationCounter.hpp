@@ -63,6 +63,7 @@ class InvocationCounter {
   void set_carry_on_overflow();
   void set(uint count);
   void increment()                 { _counter += count_increment; }
+  void increment(uint n)           { if (count() < count_limit - n) _counter += n * count_increment; }
 
   // Accessors
   bool carry() const               { return (_counter & carry_mask) != 0; }
@@ -437,27 +437,32 @@ inline unsigned int OopMapCache::hash_value_for(const methodHandle& method, int
 }
 
 OopMapCacheEntry* volatile OopMapCache::_old_entries = nullptr;
+volatile size_t OopMapCache::_num_lookups = 0;
+volatile size_t OopMapCache::_num_hits = 0;
+volatile size_t OopMapCache::_num_evictions = 0;
 
-OopMapCache::OopMapCache() {
-  for(int i = 0; i < size; i++) _array[i] = nullptr;
+OopMapCache::OopMapCache() : _size(InterpreterOopMapCacheSize) {
+  _array = NEW_C_HEAP_ARRAY(OopMapCacheEntry* volatile, _size, mtClass);
+  for(int i = 0; i < _size; i++) _array[i] = nullptr;
 }
 
 
 OopMapCache::~OopMapCache() {
   // Deallocate oop maps that are allocated out-of-line
   flush();
+  FREE_C_HEAP_ARRAY(OopMapCacheEntry* volatile, _array);
 }
 
 OopMapCacheEntry* OopMapCache::entry_at(int i) const {
-  return Atomic::load_acquire(&(_array[i % size]));
+  return Atomic::load_acquire(&(_array[i % _size]));
 }
 
 bool OopMapCache::put_at(int i, OopMapCacheEntry* entry, OopMapCacheEntry* old) {
-  return Atomic::cmpxchg(&_array[i % size], old, entry) == old;
+  return Atomic::cmpxchg(&_array[i % _size], old, entry) == old;
 }
 
 void OopMapCache::flush() {
-  for (int i = 0; i < size; i++) {
+  for (int i = 0; i < _size; i++) {
     OopMapCacheEntry* entry = _array[i];
     if (entry != nullptr) {
       _array[i] = nullptr;  // no barrier, only called in OopMapCache destructor
@@ -468,7 +473,7 @@ void OopMapCache::flush() {
 
 void OopMapCache::flush_obsolete_entries() {
   assert(SafepointSynchronize::is_at_safepoint(), "called by RedefineClasses in a safepoint");
-  for (int i = 0; i < size; i++) {
+  for (int i = 0; i < _size; i++) {
     OopMapCacheEntry* entry = _array[i];
     if (entry != nullptr && !entry->is_empty() && entry->method()->is_old()) {
       // Cache entry is occupied by an old redefined method and we don't want
@@ -490,6 +495,10 @@ void OopMapCache::lookup(const methodHandle& method,
                          int bci,
                          InterpreterOopMap* entry_for) {
   int probe = hash_value_for(method, bci);
+  const bool count = log_is_enabled(Info, interpreter, oopmap);
+  if (count) {
+    Atomic::inc(&_num_lookups, memory_order_relaxed);
+  }
 
   if (log_is_enabled(Debug, interpreter, oopmap)) {
     static int count = 0;
@@ -508,6 +517,9 @@ void OopMapCache::lookup(const methodHandle& method,
       if (entry != nullptr && !entry->is_empty() && entry->match(method, bci)) {
         entry_for->copy_from(entry);
         assert(!entry_for->is_empty(), "A non-empty oop map should be returned");
+        if (count) {
+          Atomic::inc(&_num_hits, memory_order_relaxed);
+        }
         log_debug(interpreter, oopmap)("- found at hash %d", probe + i);
         return;
       }
@@ -553,6 +565,9 @@ void OopMapCache::lookup(const methodHandle& method,
     // Instead of synchronizing on GlobalCounter here and incurring heavy thread
     // walk, we do this clean up out of band.
     enqueue_for_cleanup(old);
+    if (count) {
+      Atomic::inc(&_num_evictions, memory_order_relaxed);
+    }
   } else {
     OopMapCacheEntry::deallocate(tmp);
   }
@@ -615,6 +630,18 @@ void OopMapCache::cleanup() {
   }
 }
 
+void OopMapCache::log_statistics() {
+  size_t lookups = Atomic::load(&_num_lookups);
+  if (lookups == 0) {
+    return;
+  }
+  size_t hits = Atomic::load(&_num_hits);
+  log_info(interpreter, oopmap)("Oop map cache: size %d, lookups " SIZE_FORMAT ", hits " SIZE_FORMAT
+                                " (%.1f%%), evictions " SIZE_FORMAT,
+                                InterpreterOopMapCacheSize, lookups, hits,
+                                percent_of(hits, lookups), Atomic::load(&_num_evictions));
+}
+
 void OopMapCache::compute_one_oop_map(const methodHandle& method, int bci, InterpreterOopMap* entry) {
   // Due to the invariants above it's tricky to allocate a temporary OopMapCacheEntry on the stack
   OopMapCacheEntry* tmp = NEW_C_HEAP_OBJ(OopMapCacheEntry, mtClass);
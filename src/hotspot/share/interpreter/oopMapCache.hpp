@@ -151,10 +151,15 @@ class InterpreterOopMap: ResourceObj {
 class OopMapCache : public CHeapObj<mtClass> {
  static OopMapCacheEntry* volatile _old_entries;
  private:
-  static constexpr int size = 32;        // Use fixed size for now
   static constexpr int probe_depth = 3;  // probe depth in case of collisions
 
-  OopMapCacheEntry* volatile _array[size];
+  // Statistics, only gathered when -Xlog:interpreter+oopmap=info is enabled
+  static volatile size_t _num_lookups;
+  static volatile size_t _num_hits;
+  static volatile size_t _num_evictions;
+
+  const int _size;                        // InterpreterOopMapCacheSize
+  OopMapCacheEntry* volatile* _array;
 
   unsigned int hash_value_for(const methodHandle& method, int bci) const;
   OopMapCacheEntry* entry_at(int i) const;
@@ -186,6 +191,9 @@ class OopMapCache : public CHeapObj<mtClass> {
 
   // Clean up the old entries
   static void cleanup();
+
+  // Log the hit rate of all caches
+  static void log_statistics();
 };
 
 #endif // SHARE_INTERPRETER_OOPMAPCACHE_HPP
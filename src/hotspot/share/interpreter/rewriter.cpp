@@ -370,6 +370,42 @@ void Rewriter::maybe_rewrite_ldc(address bcp, int offset, bool is_wide,
 
 
 // Rewrites a method given the index_map information
+// Compute the bytecode the interpreter would eventually rewrite the _iload
+// at bci to under RewriteFrequentPairs: the last _iload of a run becomes
+// _fast_icaload if followed by _caload and _fast_iload otherwise, and each
+// earlier _iload becomes _fast_iload2 if its successor became _fast_iload.
+// Doing this at link time yields the same code as rewriting at run time.
+Bytecodes::Code Rewriter::frequent_pair_for_iload(address code_base, int bci, int code_length) {
+  const int len = Bytecodes::length_for(Bytecodes::_iload);
+  int last = bci;
+  while (last + len < code_length && code_base[last + len] == Bytecodes::_iload) {
+    last += len;
+  }
+  Bytecodes::Code result =
+    (last + len < code_length && code_base[last + len] == Bytecodes::_caload)
+    ? Bytecodes::_fast_icaload
+    : Bytecodes::_fast_iload;
+  for (int b = last; b > bci; b -= len) {
+    result = (result == Bytecodes::_fast_iload) ? Bytecodes::_fast_iload2 : Bytecodes::_fast_iload;
+  }
+  return result;
+}
+
+void Rewriter::rewrite_frequent_pairs(Method* method) {
+  const address code_base = method->code_base();
+  const int code_length = method->code_size();
+
+  int bc_length;
+  for (int bci = 0; bci < code_length; bci += bc_length) {
+    address bcp = code_base + bci;
+    bc_length = Bytecodes::length_at(method, bcp);
+    // The lookahead only sees bytecodes this loop has not rewritten yet.
+    if (*bcp == Bytecodes::_iload) {
+      (*bcp) = frequent_pair_for_iload(code_base, bci, code_length);
+    }
+  }
+}
+
 void Rewriter::scan_method(Thread* thread, Method* method, bool reverse, bool* invokespecial_error) {
 
   int nof_jsrs = 0;
@@ -490,6 +526,15 @@ void Rewriter::scan_method(Thread* thread, Method* method, bool reverse, bool* i
       case Bytecodes::_fast_aldc_w:  // if reverse=true
         maybe_rewrite_ldc(bcp, prefix_length+1, true, reverse);
         break;
+      case Bytecodes::_fast_iload     :
+      case Bytecodes::_fast_iload2    :
+      case Bytecodes::_fast_icaload   : {
+        if (reverse) {
+          (*bcp) = Bytecodes::_iload;
+          bc_length = Bytecodes::length_for(Bytecodes::_iload);
+        }
+        break;
+      }
       case Bytecodes::_jsr            : // fall through
       case Bytecodes::_jsr_w          : nof_jsrs++;                   break;
       case Bytecodes::_monitorenter   : // fall through
@@ -508,6 +553,11 @@ void Rewriter::scan_method(Thread* thread, Method* method, bool reverse, bool* i
   // have to be rewritten, so we run the oopMapGenerator on the method
   if (nof_jsrs > 0) {
     method->set_has_jsrs();
+  } else if (!reverse && RewriteFrequentPairsAtLink && RewriteBytecodes &&
+             RewriteFrequentPairs && !CDSConfig::is_dumping_archive()) {
+    // Methods with jsrs are skipped, since rewrite_jsrs may still relocate
+    // and widen their loads.
+    rewrite_frequent_pairs(method);
   }
 }
 
@@ -32,6 +32,7 @@
 #include "jfr/recorder/service/jfrOptionSet.hpp"
 #include "jfr/recorder/service/jfrOptionSet.hpp"
 #include "jfr/recorder/repository/jfrRepository.hpp"
+#include "jfr/support/jfrAllocationProfile.hpp"
 #include "jfr/support/jfrResolution.hpp"
 #include "jfr/support/jfrThreadLocal.hpp"
 #include "runtime/java.hpp"
@@ -69,6 +70,7 @@ void Jfr::on_create_vm_3() {
 void Jfr::on_unloading_classes() {
   if (JfrRecorder::is_created() || JfrRecorder::is_started_on_commandline()) {
     JfrCheckpointManager::on_unloading_classes();
+    JfrAllocationProfile::on_unloading_classes();
   }
 }
 
@@ -59,7 +59,6 @@ class BFSClosure : public BasicOopIterateClosure {
   void iterate(const Edge* parent);
   void process(UnifiedOopRef reference, const oop pointee);
 
-  void process_root_set();
   void process_queue();
 
  public:
@@ -67,6 +66,7 @@ class BFSClosure : public BasicOopIterateClosure {
 
   BFSClosure(EdgeQueue* edge_queue, EdgeStore* edge_store, JFRBitSet* mark_bits);
   void process();
+  void process_root_set();
   void do_root(UnifiedOopRef ref);
 
   virtual void do_oop(oop* ref);
@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/workerThread.hpp"
+#include "jfr/leakprofiler/chains/dfsClosure.hpp"
+#include "jfr/leakprofiler/chains/edge.hpp"
+#include "jfr/leakprofiler/chains/edgeQueue.hpp"
+#include "jfr/leakprofiler/chains/edgeStore.hpp"
+#include "jfr/leakprofiler/chains/jfrbitset.hpp"
+#include "jfr/leakprofiler/chains/parallelBFSClosure.hpp"
+#include "jfr/leakprofiler/utilities/granularTimer.hpp"
+#include "jfr/leakprofiler/utilities/unifiedOopRef.inline.hpp"
+#include "logging/log.hpp"
+#include "memory/iterator.inline.hpp"
+#include "memory/universe.hpp"
+#include "oops/access.inline.hpp"
+#include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "utilities/align.hpp"
+
+// Per worker closure, expanding the frontier edges claimed by the worker.
+class ParallelBFSClosure : public BasicOopIterateClosure {
+ private:
+  static const size_t buffer_size = 256;
+
+  ParallelBFS* const _bfs;
+  const Edge* _current_parent;
+  ParallelBFS::PendingEdge _buffer[buffer_size];
+  size_t _buffer_top;
+
+  void closure_impl(UnifiedOopRef reference, const oop pointee) {
+    assert(!reference.is_null(), "invariant");
+    assert(reference.dereference() == pointee, "invariant");
+    if (!_bfs->_mark_bits->par_mark_obj(pointee)) {
+      return;
+    }
+    // is the pointee a sample object?
+    if (pointee->mark().is_marked()) {
+      _bfs->add_chain(_current_parent, reference);
+    }
+    _buffer[_buffer_top]._parent = _current_parent;
+    _buffer[_buffer_top]._reference = reference;
+    if (++_buffer_top == buffer_size) {
+      flush();
+    }
+  }
+
+ public:
+  virtual ReferenceIterationMode reference_iteration_mode() { return DO_FIELDS_EXCEPT_REFERENT; }
+
+  ParallelBFSClosure(ParallelBFS* bfs) : _bfs(bfs), _current_parent(nullptr), _buffer_top(0) {}
+
+  void iterate(const Edge* parent) {
+    assert(parent != nullptr, "invariant");
+    const oop pointee = parent->pointee();
+    assert(pointee != nullptr, "invariant");
+    _current_parent = parent;
+    pointee->oop_iterate(this);
+  }
+
+  void flush() {
+    _bfs->add_edges(_buffer, _buffer_top);
+    _buffer_top = 0;
+  }
+
+  virtual void do_oop(oop* ref) {
+    assert(ref != nullptr, "invariant");
+    assert(is_aligned(ref, HeapWordSize), "invariant");
+    const oop pointee = HeapAccess<AS_NO_KEEPALIVE>::oop_load(ref);
+    if (pointee != nullptr) {
+      closure_impl(UnifiedOopRef::encode_in_heap(ref), pointee);
+    }
+  }
+
+  virtual void do_oop(narrowOop* ref) {
+    assert(ref != nullptr, "invariant");
+    assert(is_aligned(ref, sizeof(narrowOop)), "invariant");
+    const oop pointee = HeapAccess<AS_NO_KEEPALIVE>::oop_load(ref);
+    if (pointee != nullptr) {
+      closure_impl(UnifiedOopRef::encode_in_heap(ref), pointee);
+    }
+  }
+};
+
+// Expands one frontier, [frontier_start, frontier_end) in the edge queue.
+class ParallelBFSTask : public WorkerTask {
+ private:
+  static const size_t chunk_size = 64;
+
+  ParallelBFS* const _bfs;
+  const size_t _frontier_end;
+  volatile size_t _claimed;
+
+ public:
+  ParallelBFSTask(ParallelBFS* bfs, size_t frontier_start, size_t frontier_end) :
+    WorkerTask("JFR Path To GC Roots"),
+    _bfs(bfs),
+    _frontier_end(frontier_end),
+    _claimed(frontier_start) {}
+
+  void work(uint worker_id) {
+    ParallelBFSClosure closure(_bfs);
+    while (!Atomic::load(&_bfs->_queue_full) && !GranularTimer::par_is_finished()) {
+      const size_t start = Atomic::fetch_then_add(&_claimed, chunk_size);
+      if (start >= _frontier_end) {
+        break;
+      }
+      const size_t end = MIN2(start + chunk_size, _frontier_end);
+      for (size_t idx = start; idx < end; ++idx) {
+        closure.iterate(_bfs->_edge_queue->element_at(idx));
+      }
+    }
+    closure.flush();
+  }
+
+  // Edges below this index have been expanded.
+  size_t unclaimed() const {
+    return MIN2(Atomic::load(&_claimed), _frontier_end);
+  }
+};
+
+ParallelBFS::ParallelBFS(WorkerThreads* workers, EdgeQueue* edge_queue, EdgeStore* edge_store, JFRBitSet* mark_bits) :
+  _workers(workers),
+  _edge_queue(edge_queue),
+  _edge_store(edge_store),
+  _mark_bits(mark_bits),
+  _lock(Mutex::nosafepoint, "ParallelBFS_lock"),
+  _overflow(),
+  _queue_full(false),
+  _current_frontier_level(0) {
+}
+
+bool ParallelBFS::is_supported(WorkerThreads* workers) {
+  // Parallel marking needs a contiguous reservation covering all objects.
+  return workers != nullptr &&
+         workers->active_workers() > 1 &&
+         !Universe::heap()->reserved_region().is_empty();
+}
+
+void ParallelBFS::add_chain(const Edge* parent, UnifiedOopRef reference) {
+  assert(parent != nullptr, "invariant");
+  Edge leak_edge(parent, reference);
+  MutexLocker ml(&_lock, Mutex::_no_safepoint_check_flag);
+  _edge_store->put_chain(&leak_edge, _current_frontier_level + 2);
+}
+
+void ParallelBFS::add_edges(const PendingEdge* edges, size_t count) {
+  if (count == 0) {
+    return;
+  }
+  MutexLocker ml(&_lock, Mutex::_no_safepoint_check_flag);
+  for (size_t i = 0; i < count; ++i) {
+    if (!_queue_full && _edge_queue->is_full()) {
+      Atomic::store(&_queue_full, true);
+    }
+    if (_queue_full) {
+      // Already marked, so these will only be visited by the DFS fallback.
+      _overflow.append(edges[i]);
+    } else {
+      _edge_queue->add(edges[i]._parent, edges[i]._reference);
+    }
+  }
+}
+
+void ParallelBFS::dfs_fallback(size_t unprocessed_idx) {
+  log_trace(jfr, system)("Parallel BFS front: " SIZE_FORMAT " filled edge queue, DFS to complete " SIZE_FORMAT " edges",
+                         _current_frontier_level, (_edge_queue->top() - unprocessed_idx) + (size_t)_overflow.length());
+  for (int i = 0; i < _overflow.length(); ++i) {
+    const Edge edge(_overflow.at(i)._parent, _overflow.at(i)._reference);
+    DFSClosure::find_leaks_from_edge(_edge_store, _mark_bits, &edge);
+  }
+  for (size_t idx = unprocessed_idx; idx < _edge_queue->top(); ++idx) {
+    const Edge* edge = _edge_queue->element_at(idx);
+    if (edge->pointee() != nullptr) {
+      DFSClosure::find_leaks_from_edge(_edge_store, _mark_bits, edge);
+    }
+  }
+}
+
+void ParallelBFS::process() {
+  assert(is_supported(_workers), "invariant");
+  _mark_bits->initialize_parallel(Universe::heap()->reserved_region());
+
+  size_t frontier_start = _edge_queue->bottom();
+  while (!GranularTimer::par_is_finished()) {
+    const size_t frontier_end = _edge_queue->top();
+    if (frontier_start == frontier_end) {
+      // complete
+      return;
+    }
+    ParallelBFSTask task(this, frontier_start, frontier_end);
+    _workers->run_task(&task);
+    log_trace(jfr, system)("Parallel BFS front: " SIZE_FORMAT " edges: " SIZE_FORMAT,
+                           _current_frontier_level, frontier_end - frontier_start);
+    if (_queue_full) {
+      dfs_fallback(task.unclaimed());
+      return;
+    }
+    frontier_start = frontier_end;
+    ++_current_frontier_level;
+  }
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef SHARE_JFR_LEAKPROFILER_CHAINS_PARALLELBFSCLOSURE_HPP
+#define SHARE_JFR_LEAKPROFILER_CHAINS_PARALLELBFSCLOSURE_HPP
+
+#include "jfr/leakprofiler/chains/jfrbitset.hpp"
+#include "jfr/leakprofiler/utilities/unifiedOopRef.hpp"
+#include "memory/allocation.hpp"
+#include "runtime/mutex.hpp"
+#include "utilities/growableArray.hpp"
+
+class Edge;
+class EdgeQueue;
+class EdgeStore;
+class WorkerThreads;
+
+// Breadth-first search of the heap using worker threads, one frontier at a time.
+//
+// The workers claim chunks of the current frontier in the edge queue and append
+// the edges they discover, which become the next frontier. Objects are marked with
+// JFRBitSet::par_mark_obj(), so every object is expanded by exactly one worker.
+// If the edge queue fills up, the remaining edges are searched depth-first by the
+// calling thread, as BFSClosure does.
+class ParallelBFS : public StackObj {
+  friend class ParallelBFSClosure;
+  friend class ParallelBFSTask;
+ public:
+  // An edge found by a worker that is not yet in the edge queue.
+  struct PendingEdge {
+    const Edge* _parent;
+    UnifiedOopRef _reference;
+  };
+
+ private:
+  WorkerThreads* _workers;
+  EdgeQueue* _edge_queue;
+  EdgeStore* _edge_store;
+  JFRBitSet* _mark_bits;
+  Mutex _lock; // serializes edge queue appends and edge store updates
+  GrowableArrayCHeap<PendingEdge, mtTracing> _overflow; // edges that found the queue full
+  volatile bool _queue_full;
+  size_t _current_frontier_level;
+
+  void add_chain(const Edge* parent, UnifiedOopRef reference);
+  void add_edges(const PendingEdge* edges, size_t count);
+  void dfs_fallback(size_t unprocessed_idx);
+
+ public:
+  ParallelBFS(WorkerThreads* workers, EdgeQueue* edge_queue, EdgeStore* edge_store, JFRBitSet* mark_bits);
+
+  // True if the heap of the current collector can be searched with a ParallelBFS.
+  static bool is_supported(WorkerThreads* workers);
+
+  // Searches from the root set edges in the edge queue,
+  // which must already have been processed by BFSClosure::process_root_set().
+  void process();
+};
+
+#endif // SHARE_JFR_LEAKPROFILER_CHAINS_PARALLELBFSCLOSURE_HPP
@@ -36,6 +36,7 @@
 #include "jfr/leakprofiler/chains/rootSetClosure.hpp"
 #include "jfr/leakprofiler/chains/edgeStore.hpp"
 #include "jfr/leakprofiler/chains/objectSampleMarker.hpp"
+#include "jfr/leakprofiler/chains/parallelBFSClosure.hpp"
 #include "jfr/leakprofiler/chains/pathToGcRootsOperation.hpp"
 #include "jfr/leakprofiler/checkpoint/eventEmitter.hpp"
 #include "jfr/leakprofiler/checkpoint/objectSampleCheckpoint.hpp"
@@ -45,6 +46,7 @@
 #include "logging/log.hpp"
 #include "memory/universe.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/globals.hpp"
 #include "runtime/safepoint.hpp"
 #include "utilities/globalDefinitions.hpp"
 
@@ -119,6 +121,10 @@ void PathToGcRootsOperation::doit() {
     // Do a depth-first search, but mark roots first
     // to avoid walking sideways over roots
     DFSClosure::find_leaks_from_root_set(_edge_store, &mark_bits);
+  } else if (LeakProfilerParallelBFS && ParallelBFS::is_supported(Universe::heap()->safepoint_workers())) {
+    bfs.process_root_set();
+    ParallelBFS parallel_bfs(Universe::heap()->safepoint_workers(), &edge_queue, _edge_store, &mark_bits);
+    parallel_bfs.process();
   } else {
     bfs.process();
   }
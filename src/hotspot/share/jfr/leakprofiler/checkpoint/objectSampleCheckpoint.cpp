@@ -339,8 +339,9 @@ void ObjectSampleCheckpoint::write_stacktrace(const JfrStackTrace* trace, JfrChe
   writer.write((u1)!trace->_reached_root);
   writer.write(trace->_nr_of_frames);
   // JfrStackFrames
-  for (u4 i = 0; i < trace->_nr_of_frames; ++i) {
-    const JfrStackFrame& frame = trace->_frames[i];
+  JfrStackFrameStream stream(*trace);
+  while (stream.has_next()) {
+    const JfrStackFrame& frame = stream.next();
     frame.write(writer);
     add_to_leakp_set(frame._klass, frame._methodid);
   }
@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "jfr/leakprofiler/utilities/granularTimer.hpp"
+#include "runtime/atomic.hpp"
 
 long GranularTimer::_granularity = 0;
 long GranularTimer::_counter = 0;
@@ -73,3 +74,15 @@ bool GranularTimer::is_finished() {
   }
   return false;
 }
+
+bool GranularTimer::par_is_finished() {
+  assert(_granularity != 0, "GranularTimer::par_is_finished must be called after GranularTimer::start");
+  if (Atomic::load(&_finished)) {
+    return true;
+  }
+  if (JfrTicks::now() > _finish_time_ticks) {
+    Atomic::store(&_finished, true);
+    return true;
+  }
+  return false;
+}
@@ -41,6 +41,8 @@ class GranularTimer : public AllStatic {
   static const JfrTicks& start_time();
   static const JfrTicks& end_time();
   static bool is_finished();
+  // May be called from several threads at once. Reads the clock on every call.
+  static bool par_is_finished();
 };
 
 #endif // SHARE_JFR_LEAKPROFILER_UTILITIES_GRANULARTIMER_HPP
@@ -25,9 +25,14 @@
 #include "precompiled.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "jfr/periodic/jfrNativeMemoryEvent.hpp"
+#include "memory/resourceArea.hpp"
+#include "nmt/mallocSampler.hpp"
+#include "nmt/memBaseline.hpp"
 #include "nmt/memTracker.hpp"
 #include "nmt/nmtUsage.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "utilities/globalDefinitions.hpp"
+#include "utilities/ostream.hpp"
 #include "utilities/ticks.hpp"
 
 static NMTUsage* get_usage(const Ticks& timestamp) {
@@ -88,3 +93,36 @@ void JfrNativeMemoryEvent::send_type_events(const Ticks& timestamp) {
     send_type_event(timestamp, mem_tag, usage->reserved(mem_tag), usage->committed(mem_tag));
   }
 }
+
+void JfrNativeMemoryEvent::send_sampled_site_events(const Ticks& timestamp) {
+  if (MemTracker::tracking_level() != NMT_summary || !MallocSampler::enabled()) {
+    return;
+  }
+
+  // Only the largest sites are sent, to bound the cost of symbolizing the stacks
+  const int max_sites = 20;
+
+  MemBaseline baseline;
+  {
+    MutexLocker locker(MemTracker::query_lock());
+    baseline.baseline(false);
+  }
+  if (!baseline.has_malloc_sites()) {
+    return;
+  }
+
+  ResourceMark rm;
+  MallocSiteIterator itr = baseline.malloc_sites(MemBaseline::by_size);
+  const MallocSite* site;
+  for (int i = 0; i < max_sites && (site = itr.next()) != nullptr; i++) {
+    stringStream st;
+    site->call_stack()->print_on(&st);
+    EventNativeMemorySampledSite event(UNTIMED);
+    event.set_starttime(timestamp);
+    event.set_stackTrace(st.as_string());
+    event.set_type(NMTUtil::tag_to_index(site->mem_tag()));
+    event.set_estimatedSize(site->size());
+    event.set_samples(site->count());
+    event.commit();
+  }
+}
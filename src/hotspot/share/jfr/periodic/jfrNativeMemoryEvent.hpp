@@ -39,6 +39,8 @@ class JfrNativeMemoryEvent : public AllStatic {
  public:
   static void send_total_event(const Ticks& timestamp);
   static void send_type_events(const Ticks& timestamp);
+  // The largest call sites sampled by MallocSampler
+  static void send_sampled_site_events(const Ticks& timestamp);
 };
 
 #endif //SHARE_JFR_PERIODIC_JFRNATIVEMEMORYEVENT_HPP
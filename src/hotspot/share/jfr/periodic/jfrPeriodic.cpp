@@ -45,6 +45,8 @@
 #include "jfr/periodic/jfrNativeMemoryEvent.hpp"
 #include "jfr/periodic/jfrNetworkUtilization.hpp"
 #include "jfr/recorder/jfrRecorder.hpp"
+#include "jfr/recorder/service/jfrEventThrottler.hpp"
+#include "jfr/support/jfrAllocationProfile.hpp"
 #include "jfr/utilities/jfrThreadIterator.hpp"
 #include "jfr/utilities/jfrTime.hpp"
 #include "jfrfiles/jfrPeriodic.hpp"
@@ -55,6 +57,7 @@
 #include "oops/oop.inline.hpp"
 #include "prims/jvmtiAgentList.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/continuationStatistics.hpp"
 #include "runtime/flags/jvmFlag.hpp"
 #include "runtime/globals.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
@@ -487,6 +490,10 @@ TRACE_REQUEST_FUNC(InitialSystemProperty) {
   }
 }
 
+TRACE_REQUEST_FUNC(EventThrottleStatistics) {
+  JfrEventThrottler::emit_statistics();
+}
+
 TRACE_REQUEST_FUNC(ThreadAllocationStatistics) {
   ResourceMark rm;
   int initial_size = Threads::number_of_threads();
@@ -512,6 +519,26 @@ TRACE_REQUEST_FUNC(ThreadAllocationStatistics) {
   }
 }
 
+TRACE_REQUEST_FUNC(ContinuationStatistics) {
+  ContinuationCounters counters;
+  ContinuationStatistics::collect(&counters);
+  EventContinuationStatistics event;
+  event.set_fastFreezes(counters.get(ContinuationCounters::fast_freezes));
+  event.set_slowFreezes(counters.get(ContinuationCounters::slow_freezes));
+  event.set_pinnedNative(counters.get(ContinuationCounters::pinned_native));
+  event.set_pinnedUpcall(counters.get(ContinuationCounters::pinned_upcall));
+  event.set_pinnedMonitor(counters.get(ContinuationCounters::pinned_monitor));
+  event.set_pinnedCriticalSection(counters.get(ContinuationCounters::pinned_critical_section));
+  event.set_failedFreezes(counters.get(ContinuationCounters::failed_freezes));
+  event.set_fastThaws(counters.get(ContinuationCounters::fast_thaws));
+  event.set_slowThaws(counters.get(ContinuationCounters::slow_thaws));
+  event.set_returnBarrierThaws(counters.get(ContinuationCounters::return_barrier_thaws));
+  event.set_frozen(counters.get(ContinuationCounters::words_frozen) << LogBytesPerWord);
+  event.set_thawed(counters.get(ContinuationCounters::words_thawed) << LogBytesPerWord);
+  event.set_chunksAllocated(counters.get(ContinuationCounters::chunks_allocated));
+  event.commit();
+}
+
 /**
  *  PhysicalMemory event represents:
  *
@@ -696,6 +723,9 @@ TRACE_REQUEST_FUNC(CodeCacheStatistics) {
       event.set_methodCount(CodeCache::nmethod_count(bt));
       event.set_adaptorCount(CodeCache::adapter_count(bt));
       event.set_unallocatedCapacity(CodeCache::unallocated_capacity(bt));
+      event.set_freeListSize(CodeCache::freelist_capacity(bt));
+      event.set_freeBlockCount(CodeCache::freelist_length(bt));
+      event.set_peakUsage(CodeCache::max_allocated_capacity(bt));
       event.set_fullCount(CodeCache::get_codemem_full_count(bt));
       event.commit();
     }
@@ -740,3 +770,11 @@ TRACE_REQUEST_FUNC(NativeMemoryUsage) {
 TRACE_REQUEST_FUNC(NativeMemoryUsageTotal) {
   JfrNativeMemoryEvent::send_total_event(timestamp());
 }
+
+TRACE_REQUEST_FUNC(ObjectAllocationProfile) {
+  JfrAllocationProfile::send_events(timestamp());
+}
+
+TRACE_REQUEST_FUNC(NativeMemorySampledSite) {
+  JfrNativeMemoryEvent::send_sampled_site_events(timestamp());
+}
@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "classfile/javaThreadStatus.hpp"
+#include "code/codeCache.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "jfr/recorder/jfrRecorder.hpp"
 #include "jfr/periodic/sampling/jfrCallTrace.hpp"
@@ -46,6 +47,7 @@
 #include "runtime/suspendedThreadTask.hpp"
 #include "runtime/threadCrashProtection.hpp"
 #include "runtime/threadSMR.hpp"
+#include "utilities/ostream.hpp"
 #include "utilities/systemMemoryBarrier.hpp"
 
 enum JfrSampleType {
@@ -100,12 +102,19 @@ static bool thread_state_in_native(JavaThread* thread) {
   return false;
 }
 
+static const uint MAX_NR_OF_JAVA_SAMPLES = 5;
+static const uint MAX_NR_OF_NATIVE_SAMPLES = 1;
+static const u4 MAX_NR_OF_NATIVE_FRAMES = 64;
+
 class JfrThreadSampleClosure {
  public:
-  JfrThreadSampleClosure(EventExecutionSample* events, EventNativeMethodSample* events_native);
+  JfrThreadSampleClosure(EventExecutionSample* events, EventNativeMethodSample* events_native,
+                         EventNativeStackSample* events_native_stack);
   ~JfrThreadSampleClosure() {}
   EventExecutionSample* next_event() { return &_events[_added_java++]; }
   EventNativeMethodSample* next_event_native() { return &_events_native[_added_native++]; }
+  // The NativeStackSample event accompanying the next native event.
+  EventNativeStackSample* next_event_native_stack() { return &_events_native_stack[_added_native]; }
   void commit_events(JfrSampleType type);
   bool do_sample_thread(JavaThread* thread, JfrStackFrame* frames, u4 max_frames, JfrSampleType type);
   uint java_entries() { return _added_java; }
@@ -116,9 +125,13 @@ class JfrThreadSampleClosure {
   bool sample_thread_in_native(JavaThread* thread, JfrStackFrame* frames, u4 max_frames);
   EventExecutionSample* _events;
   EventNativeMethodSample* _events_native;
+  EventNativeStackSample* _events_native_stack;
   Thread* _self;
   uint _added_java;
   uint _added_native;
+  // Raw native frames, symbolized when the events are committed.
+  address _native_pcs[MAX_NR_OF_NATIVE_SAMPLES][MAX_NR_OF_NATIVE_FRAMES];
+  u4 _native_depths[MAX_NR_OF_NATIVE_SAMPLES];
 };
 
 class OSThreadSampler : public SuspendedThreadTask {
@@ -210,6 +223,74 @@ void OSThreadSampler::take_sample() {
   run();
 }
 
+/*
+ * Records the native frames of a thread in native, walking frame pointers from
+ * the register state of the suspended thread. The walk stops at the first frame
+ * in the code cache, i.e. the native wrapper of the Java method, whose frames are
+ * recorded from the frame anchor by JfrNativeSamplerCallback. Frames are stored
+ * as raw pcs only, to be symbolized after the thread has been resumed.
+ */
+class OSNativeThreadSampler : public SuspendedThreadTask {
+ public:
+  OSNativeThreadSampler(JavaThread* thread, address* pcs, u4 max_depth) :
+    SuspendedThreadTask((Thread*)thread), _pcs(pcs), _max_depth(max_depth), _depth(0) {}
+
+  void take_sample() { run(); }
+  void do_task(const SuspendedThreadTaskContext& context);
+  void protected_task(const SuspendedThreadTaskContext& context);
+  u4 depth() const { return _depth; }
+
+ private:
+  address* const _pcs;
+  const u4 _max_depth;
+  u4 _depth;
+};
+
+class OSNativeThreadSamplerCallback : public CrashProtectionCallback {
+ public:
+  OSNativeThreadSamplerCallback(OSNativeThreadSampler& sampler, const SuspendedThreadTaskContext &context) :
+    _sampler(sampler), _context(context) {
+  }
+  virtual void call() {
+    _sampler.protected_task(_context);
+  }
+ private:
+  OSNativeThreadSampler& _sampler;
+  const SuspendedThreadTaskContext& _context;
+};
+
+void OSNativeThreadSampler::do_task(const SuspendedThreadTaskContext& context) {
+  if (JfrOptionSet::sample_protection()) {
+    OSNativeThreadSamplerCallback cb(*this, context);
+    ThreadCrashProtection crash_protection;
+    if (!crash_protection.call(cb)) {
+      log_error(jfr)("Thread native stack sampler crashed");
+      _depth = 0;
+    }
+  } else {
+    protected_task(context);
+  }
+}
+
+void OSNativeThreadSampler::protected_task(const SuspendedThreadTaskContext& context) {
+  JavaThread* const jt = JavaThread::cast(context.thread());
+  // Skip sample if we signaled a thread that moved to other state
+  if (!thread_state_in_native(jt)) {
+    return;
+  }
+  frame fr = os::fetch_frame_from_context(context.ucontext());
+  while (_depth < _max_depth && fr.pc() != nullptr) {
+    if (CodeCache::contains(fr.pc())) {
+      break;
+    }
+    _pcs[_depth++] = fr.pc();
+    if (!jt->is_in_full_stack((address)(fr.real_fp() + 1)) || os::is_first_C_frame(&fr)) {
+      break;
+    }
+    fr = os::get_sender_for_C_frame(&fr);
+  }
+}
+
 class JfrNativeSamplerCallback : public CrashProtectionCallback {
  public:
   JfrNativeSamplerCallback(JfrThreadSampleClosure& closure, JavaThread* jt, JfrStackFrame* frames, u4 max_frames) :
@@ -228,10 +309,15 @@ class JfrNativeSamplerCallback : public CrashProtectionCallback {
 };
 
 static void write_native_event(JfrThreadSampleClosure& closure, JavaThread* jt, oop thread_oop) {
+  EventNativeStackSample* const ev_stack = closure.next_event_native_stack();
   EventNativeMethodSample *ev = closure.next_event_native();
-  ev->set_starttime(JfrTicks::now());
+  const JfrTicks now = JfrTicks::now();
+  ev->set_starttime(now);
   ev->set_sampledThread(JfrThreadLocal::thread_id(jt));
   ev->set_state(static_cast<u8>(JavaThreadStatus::RUNNABLE));
+  ev_stack->set_starttime(now);
+  ev_stack->set_sampledThread(JfrThreadLocal::thread_id(jt));
+  ev_stack->set_state(static_cast<u8>(JavaThreadStatus::RUNNABLE));
 }
 
 void JfrNativeSamplerCallback::call() {
@@ -286,6 +372,13 @@ bool JfrThreadSampleClosure::sample_thread_in_native(JavaThread* thread, JfrStac
   // skip frames in stack chunks on the Java heap.
   StackWatermarkSet::start_processing(thread, StackWatermarkKind::gc);
 
+  _native_depths[_added_native] = 0;
+  if (EventNativeStackSample::is_enabled()) {
+    OSNativeThreadSampler native_sampler(thread, _native_pcs[_added_native], MAX_NR_OF_NATIVE_FRAMES);
+    native_sampler.take_sample();
+    _native_depths[_added_native] = native_sampler.depth();
+  }
+
   JfrNativeSamplerCallback cb(*this, thread, frames, max_frames);
   if (JfrOptionSet::sample_protection()) {
     ThreadCrashProtection crash_protection;
@@ -302,11 +395,25 @@ bool JfrThreadSampleClosure::sample_thread_in_native(JavaThread* thread, JfrStac
   traceid id = JfrStackTraceRepository::add(cb.stacktrace());
   assert(id != 0, "Stacktrace id should not be 0");
   event->set_stackTrace(id);
+  _events_native_stack[_added_native - 1].set_stackTrace(id);
   return true;
 }
 
-static const uint MAX_NR_OF_JAVA_SAMPLES = 5;
-static const uint MAX_NR_OF_NATIVE_SAMPLES = 1;
+// Symbolization may take locks and allocate, so it is done here,
+// after the sampled thread has been resumed and the Threads_lock released.
+static void commit_native_stack_event(EventNativeStackSample* event, const address* pcs, u4 depth) {
+  assert(depth > 0, "invariant");
+  stringStream frames;
+  char buf[256];
+  for (u4 i = 0; i < depth; ++i) {
+    if (!os::print_function_and_library_name(&frames, pcs[i], buf, sizeof(buf))) {
+      frames.print(PTR_FORMAT, p2i(pcs[i]));
+    }
+    frames.cr();
+  }
+  event->set_nativeFrames(frames.base());
+  event->commit();
+}
 
 void JfrThreadSampleClosure::commit_events(JfrSampleType type) {
   if (JAVA_SAMPLE == type) {
@@ -324,15 +431,27 @@ void JfrThreadSampleClosure::commit_events(JfrSampleType type) {
         _events_native[i].commit();
       }
     }
+    if (EventNativeStackSample::is_enabled()) {
+      for (uint i = 0; i < _added_native; ++i) {
+        if (_native_depths[i] > 0) {
+          commit_native_stack_event(&_events_native_stack[i], _native_pcs[i], _native_depths[i]);
+        }
+      }
+    }
   }
 }
 
-JfrThreadSampleClosure::JfrThreadSampleClosure(EventExecutionSample* events, EventNativeMethodSample* events_native) :
+JfrThreadSampleClosure::JfrThreadSampleClosure(EventExecutionSample* events, EventNativeMethodSample* events_native,
+                                               EventNativeStackSample* events_native_stack) :
   _events(events),
   _events_native(events_native),
+  _events_native_stack(events_native_stack),
   _self(Thread::current()),
   _added_java(0),
   _added_native(0) {
+  for (uint i = 0; i < MAX_NR_OF_NATIVE_SAMPLES; ++i) {
+    _native_depths[i] = 0;
+  }
 }
 
 class JfrThreadSampler : public NonJavaThread {
@@ -398,6 +517,14 @@ bool JfrThreadSampleClosure::do_sample_thread(JavaThread* thread, JfrStackFrame*
     return false;
   }
 
+  // Most threads, e.g. idle carriers of virtual threads, are not in the
+  // state sampled for. Skip them on an unordered read of their state, before
+  // paying for the trace flag and the memory barrier. A thread that changes
+  // state just now is missed in this round only.
+  if (JAVA_SAMPLE == type ? !thread_state_in_java(thread) : !thread_state_in_native(thread)) {
+    return false;
+  }
+
   bool ret = false;
   thread->set_trace_flag();  // Provides StoreLoad, needed to keep read of thread state from floating up.
   if (UseSystemMemoryBarrier) {
@@ -587,7 +714,8 @@ void JfrThreadSampler::task_stacktrace(JfrSampleType type, JavaThread** last_thr
   ResourceMark rm;
   EventExecutionSample samples[MAX_NR_OF_JAVA_SAMPLES];
   EventNativeMethodSample samples_native[MAX_NR_OF_NATIVE_SAMPLES];
-  JfrThreadSampleClosure sample_task(samples, samples_native);
+  EventNativeStackSample samples_native_stack[MAX_NR_OF_NATIVE_SAMPLES];
+  JfrThreadSampleClosure sample_task(samples, samples_native, samples_native_stack);
 
   const uint sample_limit = JAVA_SAMPLE == type ? MAX_NR_OF_JAVA_SAMPLES : MAX_NR_OF_NATIVE_SAMPLES;
   uint num_samples = 0;
@@ -595,6 +723,8 @@ void JfrThreadSampler::task_stacktrace(JfrSampleType type, JavaThread** last_thr
   {
     elapsedTimer sample_time;
     sample_time.start();
+    const jlong deadline_ns = FlightRecorderSamplingBudget == 0 ? max_jlong :
+                              os::javaTimeNanos() + (jlong)FlightRecorderSamplingBudget * (NANOUNITS / MICROUNITS);
     {
       MutexLocker tlock(Threads_lock);
       ThreadsListHandle tlh;
@@ -628,6 +758,10 @@ void JfrThreadSampler::task_stacktrace(JfrSampleType type, JavaThread** last_thr
           num_samples++;
         }
         enqueue_buffer = renew_if_full(enqueue_buffer);
+        if (deadline_ns != max_jlong && os::javaTimeNanos() > deadline_ns) {
+          log_trace(jfr)("JFR thread sampling stopped after exceeding the budget of %u us", FlightRecorderSamplingBudget);
+          break;
+        }
       }
       *last_thread = current;  // remember the thread we last attempted to sample
     }
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "jfr/recorder/repository/jfrChunkCompressor.hpp"
+#include "jfr/utilities/jfrTypes.hpp"
+#include "jvm_io.h"
+#include "logging/log.hpp"
+#include "runtime/interfaceSupport.inline.hpp"
+#include "runtime/javaThread.hpp"
+#include "runtime/os.hpp"
+#include "utilities/zipLibrary.hpp"
+
+static const size_t block_size = 1 * M;
+static const int compression_level = 1;
+static const char gzip_ext[] = ".gz";
+
+static bool compress_blocks(fio_fd in_fd, fio_fd out_fd, char* in, char* out, size_t out_size,
+                            char* tmp, size_t tmp_size, int64_t* bytes_read, int64_t* bytes_written) {
+  bool first = true;
+  while (true) {
+    const ssize_t read_result = os::read_at(in_fd, in, (unsigned int)block_size, *bytes_read);
+    if (read_result < 0) {
+      return false;
+    }
+    if (read_result == 0) {
+      return true;
+    }
+    *bytes_read += read_result;
+    const char* msg = nullptr;
+    char comment[64];
+    if (first) {
+      // Record the block size like the gzipped heap dumps do, so a reader can size its buffers.
+      jio_snprintf(comment, sizeof(comment), "JFR BLOCKSIZE=" SIZE_FORMAT, block_size);
+    }
+    const size_t compressed = ZipLibrary::compress(in, (size_t)read_result, out, out_size, tmp, tmp_size,
+                                                   compression_level, first ? comment : nullptr, &msg);
+    if (msg != nullptr || !os::write(out_fd, out, compressed)) {
+      return false;
+    }
+    *bytes_written += compressed;
+    first = false;
+  }
+}
+
+bool JfrChunkCompressor::compress(const char* chunk_path) {
+  assert(chunk_path != nullptr, "invariant");
+  size_t out_size = 0;
+  size_t tmp_size = 0;
+  const char* const msg = ZipLibrary::init_params(block_size, &out_size, &tmp_size, compression_level);
+  if (msg != nullptr) {
+    log_warning(jfr, system)("Unable to compress chunk: %s", msg);
+    return false;
+  }
+  out_size += 1024; // room for the comment in the first member
+  const size_t gz_path_len = strlen(chunk_path) + sizeof(gzip_ext);
+  char* const gz_path = NEW_C_HEAP_ARRAY_RETURN_NULL(char, gz_path_len, mtTracing);
+  char* const in = NEW_C_HEAP_ARRAY_RETURN_NULL(char, block_size, mtTracing);
+  char* const out = NEW_C_HEAP_ARRAY_RETURN_NULL(char, out_size, mtTracing);
+  char* const tmp = tmp_size > 0 ? NEW_C_HEAP_ARRAY_RETURN_NULL(char, tmp_size, mtTracing) : nullptr;
+  bool result = false;
+  if (gz_path != nullptr && in != nullptr && out != nullptr && (tmp != nullptr || tmp_size == 0)) {
+    jio_snprintf(gz_path, gz_path_len, "%s%s", chunk_path, gzip_ext);
+    const fio_fd in_fd = os::open(chunk_path, O_RDONLY, 0);
+    const fio_fd out_fd = os::open(gz_path, O_CREAT | O_TRUNC | O_WRONLY, S_IREAD | S_IWRITE);
+    int64_t bytes_read = 0;
+    int64_t bytes_written = 0;
+    if (in_fd != invalid_fd && out_fd != invalid_fd) {
+      // Compressing a large chunk takes a while, don't hold up safepoints meanwhile.
+      JavaThread* const jt = JavaThread::current_or_null();
+      if (jt != nullptr && jt->thread_state() == _thread_in_vm) {
+        ThreadToNativeFromVM transition(jt);
+        result = compress_blocks(in_fd, out_fd, in, out, out_size, tmp, tmp_size, &bytes_read, &bytes_written);
+      } else {
+        result = compress_blocks(in_fd, out_fd, in, out, out_size, tmp, tmp_size, &bytes_read, &bytes_written);
+      }
+    }
+    if (in_fd != invalid_fd) {
+      ::close(in_fd);
+    }
+    if (out_fd != invalid_fd) {
+      ::close(out_fd);
+      if (!result) {
+        remove(gz_path);
+      }
+    }
+    if (result) {
+      log_debug(jfr, system)("Compressed chunk %s (" INT64_FORMAT " -> " INT64_FORMAT " bytes)",
+                             chunk_path, bytes_read, bytes_written);
+    } else {
+      log_warning(jfr, system)("Unable to compress chunk %s", chunk_path);
+    }
+  }
+  FREE_C_HEAP_ARRAY(char, tmp);
+  FREE_C_HEAP_ARRAY(char, out);
+  FREE_C_HEAP_ARRAY(char, in);
+  FREE_C_HEAP_ARRAY(char, gz_path);
+  return result;
+}
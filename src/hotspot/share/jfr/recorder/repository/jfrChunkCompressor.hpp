@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef SHARE_JFR_RECORDER_REPOSITORY_JFRCHUNKCOMPRESSOR_HPP
+#define SHARE_JFR_RECORDER_REPOSITORY_JFRCHUNKCOMPRESSOR_HPP
+
+#include "memory/allStatic.hpp"
+
+//
+// Writes a gzip copy of a completed chunk file next to it, "<chunk>.gz".
+// Each block of the chunk is compressed as a separate gzip member, so the
+// copy is a valid gzip stream, decodable on its own.
+//
+class JfrChunkCompressor : AllStatic {
+ public:
+  static bool compress(const char* chunk_path);
+};
+
+#endif // SHARE_JFR_RECORDER_REPOSITORY_JFRCHUNKCOMPRESSOR_HPP
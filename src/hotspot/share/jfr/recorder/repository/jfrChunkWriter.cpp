@@ -238,6 +238,11 @@ void JfrChunkWriter::set_path(const char* path) {
   _chunk->set_path(path);
 }
 
+const char* JfrChunkWriter::path() const {
+  assert(_chunk != nullptr, "invariant");
+  return _chunk->path();
+}
+
 void JfrChunkWriter::set_time_stamp() {
   assert(_chunk != nullptr, "invariant");
   _chunk->set_time_stamp();
@@ -42,6 +42,7 @@ class JfrChunkWriter : public JfrChunkWriterBase {
  private:
   JfrChunk* _chunk;
   void set_path(const char* path);
+  const char* path() const;
   int64_t flush_chunk(bool flushpoint);
   bool open();
   int64_t close();
@@ -26,15 +26,18 @@
 #include "jfr/jfr.hpp"
 #include "jfr/jni/jfrJavaSupport.hpp"
 #include "jfr/recorder/jfrRecorder.hpp"
+#include "jfr/recorder/repository/jfrChunkCompressor.hpp"
 #include "jfr/recorder/repository/jfrChunkWriter.hpp"
 #include "jfr/recorder/repository/jfrEmergencyDump.hpp"
 #include "jfr/recorder/repository/jfrRepository.hpp"
+#include "jfr/recorder/service/jfrOptionSet.hpp"
 #include "jfr/recorder/service/jfrPostBox.hpp"
 #include "logging/log.hpp"
 #include "memory/resourceArea.hpp"
 #include "runtime/javaThread.hpp"
 #include "runtime/mutex.hpp"
 #include "runtime/os.hpp"
+#include "utilities/vmError.hpp"
 
 static JfrRepository* _instance = nullptr;
 
@@ -168,7 +171,11 @@ bool JfrRepository::open_chunk(bool vm_error /* false */) {
 }
 
 size_t JfrRepository::close_chunk() {
-  return _chunkwriter->close();
+  const size_t size_written = _chunkwriter->close();
+  if (JfrOptionSet::compress_chunks() && !VMError::is_error_reported()) {
+    JfrChunkCompressor::compress(_chunkwriter->path());
+  }
+  return size_written;
 }
 
 void JfrRepository::flush(JavaThread* jt) {
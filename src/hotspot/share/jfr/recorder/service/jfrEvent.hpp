@@ -168,12 +168,12 @@ class JfrEvent {
       set_endtime(JfrTicks::now());
     }
     if (T::isInstant || T::isRequestable) {
-      return T::hasThrottle ? JfrEventThrottler::accept(T::eventId, _untimed ? 0 : _start_time) : true;
+      return JfrEventThrottler::accept(T::eventId, _untimed ? 0 : _start_time);
     }
     if (_end_time - _start_time < JfrEventSetting::threshold(T::eventId)) {
       return false;
     }
-    return T::hasThrottle ? JfrEventThrottler::accept(T::eventId, _untimed ? 0 : _end_time) : true;
+    return JfrEventThrottler::accept(T::eventId, _untimed ? 0 : _end_time);
   }
 
   traceid thread_id(Thread* thread) {
@@ -24,6 +24,7 @@
  */
 
 #include "precompiled.hpp"
+#include "jfr/jfrEvents.hpp"
 #include "jfr/recorder/service/jfrEventThrottler.hpp"
 #include "jfr/utilities/jfrSpinlockHelper.hpp"
 #include "logging/log.hpp"
@@ -35,7 +36,15 @@ constexpr static const JfrSamplerParams _disabled_params = {
                                                              false // reconfigure
                                                            };
 
-static JfrEventThrottler* _throttler = nullptr;
+JfrEventThrottler* volatile JfrEventThrottler::_throttlers[LAST_EVENT_ID + 1] = {};
+static volatile int _create_lock = 0;
+
+// If the throttler is off, it accepts all events.
+constexpr static const int64_t event_throttler_off = -2;
+
+inline bool is_disabled(int64_t event_sample_size) {
+  return event_sample_size == event_throttler_off;
+}
 
 JfrEventThrottler::JfrEventThrottler(JfrEventId event_id) :
   JfrAdaptiveSampler(),
@@ -43,35 +52,62 @@ JfrEventThrottler::JfrEventThrottler(JfrEventId event_id) :
   _sample_size(0),
   _period_ms(0),
   _sample_size_ewma(0),
+  _population(0),
+  _accepted(0),
   _event_id(event_id),
   _disabled(false),
   _update(false) {}
 
+// The throttler for jdk.ObjectAllocationSample is created eagerly, since the event
+// is throttled by default. Throttlers for other event types are created on demand.
 bool JfrEventThrottler::create() {
-  assert(_throttler == nullptr, "invariant");
-  _throttler = new JfrEventThrottler(JfrObjectAllocationSampleEvent);
-  return _throttler != nullptr && _throttler->initialize();
+  assert(for_event(JfrObjectAllocationSampleEvent) == nullptr, "invariant");
+  return create(JfrObjectAllocationSampleEvent) != nullptr;
 }
 
-void JfrEventThrottler::destroy() {
-  delete _throttler;
-  _throttler = nullptr;
+JfrEventThrottler* JfrEventThrottler::create(JfrEventId event_id) {
+  JfrEventThrottler* const throttler = new JfrEventThrottler(event_id);
+  if (throttler == nullptr) {
+    return nullptr;
+  }
+  if (!throttler->initialize()) {
+    delete throttler;
+    return nullptr;
+  }
+  Atomic::release_store(&_throttlers[event_id], throttler);
+  return throttler;
 }
 
-// There is currently only one throttler instance, for the jdk.ObjectAllocationSample event.
-// When introducing additional throttlers, also add a lookup map keyed by event id.
-JfrEventThrottler* JfrEventThrottler::for_event(JfrEventId event_id) {
-  assert(_throttler != nullptr, "JfrEventThrottler has not been properly initialized");
-  assert(event_id == JfrObjectAllocationSampleEvent, "Event type has an unconfigured throttler");
-  return event_id == JfrObjectAllocationSampleEvent ? _throttler : nullptr;
+// Called at shutdown, when no more events are committed.
+void JfrEventThrottler::destroy() {
+  for (int i = 0; i <= LAST_EVENT_ID; i++) {
+    delete _throttlers[i];
+    _throttlers[i] = nullptr;
+  }
 }
 
 void JfrEventThrottler::configure(JfrEventId event_id, int64_t sample_size, int64_t period_ms) {
-  if (event_id != JfrObjectAllocationSampleEvent) {
+  if (event_id < FIRST_EVENT_ID || event_id > LAST_EVENT_ID) {
+    // Not a native event type
     return;
   }
-  assert(_throttler != nullptr, "JfrEventThrottler has not been properly initialized");
-  _throttler->configure(sample_size, period_ms);
+  JfrEventThrottler* throttler = for_event(event_id);
+  if (throttler == nullptr) {
+    if (is_disabled(sample_size)) {
+      // Nothing to turn off
+      return;
+    }
+    JfrSpinlockHelper mutex(&_create_lock);
+    throttler = for_event(event_id);
+    if (throttler == nullptr) {
+      throttler = create(event_id);
+      if (throttler == nullptr) {
+        log_warning(jfr, system, throttle)("Unable to create throttler for event type id %u", event_id);
+        return;
+      }
+    }
+  }
+  throttler->configure(sample_size, period_ms);
 }
 
 /*
@@ -90,13 +126,6 @@ void JfrEventThrottler::configure(int64_t sample_size, int64_t period_ms) {
   reconfigure();
 }
 
-// Predicate for event selection.
-bool JfrEventThrottler::accept(JfrEventId event_id, int64_t timestamp /* 0 */) {
-  JfrEventThrottler* const throttler = for_event(event_id);
-  if (throttler == nullptr) return true;
-  return _throttler->_disabled ? true : _throttler->sample(timestamp);
-}
-
 /*
  * The window_lookback_count defines the history in number of windows to take into account
  * when the JfrAdaptiveSampler engine is calculating an expected weighted moving average (EWMA) over the population.
@@ -136,9 +165,6 @@ inline void set_low_rate(JfrSamplerParams& params, int64_t event_sample_size, in
   params.window_duration_ms = period_ms;
 }
 
-// If the throttler is off, it accepts all events.
-constexpr static const int64_t event_throttler_off = -2;
-
 /*
  * Set the number of sample points and window duration.
  */
@@ -193,10 +219,6 @@ inline void normalize(int64_t* sample_size, int64_t* period_ms) {
   }
 }
 
-inline bool is_disabled(int64_t event_sample_size) {
-  return event_sample_size == event_throttler_off;
-}
-
 const JfrSamplerParams& JfrEventThrottler::update_params(const JfrSamplerWindow* expired) {
   _disabled = is_disabled(_sample_size);
   if (_disabled) {
@@ -236,20 +258,17 @@ inline double compute_ewma_alpha_coefficient(size_t lookback_count) {
  *
  * Excerpt:
  *
- * "jdk.ObjectAllocationSample: avg.sample size: 19.8377, window set point: 20 ..."
+ * "event type 21: avg.sample size: 19.8377, window set point: 20 ..."
  *
  * Monitoring the relation of average sample size to the window set point, i.e the target,
  * is a good indicator of how the throttler is performing over time.
- *
- * Note: there is currently only one throttler instance, for the ObjectAllocationSample event.
- * When introducing additional throttlers, also provide a map from the event id to the event name.
  */
-static void log(const JfrSamplerWindow* expired, double* sample_size_ewma) {
+static void log(JfrEventId event_id, const JfrSamplerWindow* expired, double* sample_size_ewma) {
   assert(sample_size_ewma != nullptr, "invariant");
   if (log_is_enabled(Debug, jfr, system, throttle)) {
     *sample_size_ewma = exponentially_weighted_moving_average(static_cast<double>(expired->sample_size()), compute_ewma_alpha_coefficient(expired->params().window_lookback_count), *sample_size_ewma);
-    log_debug(jfr, system, throttle)("jdk.ObjectAllocationSample: avg.sample size: %0.4f, window set point: %zu, sample size: %zu, population size: %zu, ratio: %.4f, window duration: %zu ms\n",
-      *sample_size_ewma, expired->params().sample_points_per_window, expired->sample_size(), expired->population_size(),
+    log_debug(jfr, system, throttle)("event type %u: avg.sample size: %0.4f, window set point: %zu, sample size: %zu, population size: %zu, ratio: %.4f, window duration: %zu ms\n",
+      event_id, *sample_size_ewma, expired->params().sample_points_per_window, expired->sample_size(), expired->population_size(),
       expired->population_size() == 0 ? 0 : static_cast<double>(expired->sample_size()) / static_cast<double>(expired->population_size()),
       expired->params().window_duration_ms);
   }
@@ -268,9 +287,38 @@ static void log(const JfrSamplerWindow* expired, double* sample_size_ewma) {
 const JfrSamplerParams& JfrEventThrottler::next_window_params(const JfrSamplerWindow* expired) {
   assert(expired != nullptr, "invariant");
   assert(_lock, "invariant");
-  log(expired, &_sample_size_ewma);
+  log(_event_id, expired, &_sample_size_ewma);
+  _population += expired->population_size();
+  _accepted += expired->sample_size();
   if (_update) {
     return update_params(expired); // Updates _last_params in-place.
   }
   return _disabled ? _disabled_params : _last_params;
 }
+
+/*
+ * The accepted events of a throttled event type are a sample of its population.
+ * To allow totals to be reconstructed, each throttled event type reports how many
+ * events its accepted events stand for. The counts cover the expired windows only.
+ */
+void JfrEventThrottler::emit_statistics() {
+  for (int i = FIRST_EVENT_ID; i <= LAST_EVENT_ID; i++) {
+    JfrEventThrottler* const throttler = for_event(static_cast<JfrEventId>(i));
+    if (throttler == nullptr) {
+      continue;
+    }
+    uint64_t population;
+    uint64_t accepted;
+    {
+      JfrSpinlockHelper mutex(&throttler->_lock);
+      population = throttler->_population;
+      accepted = throttler->_accepted;
+    }
+    EventEventThrottleStatistics event;
+    event.set_throttledEventId(i);
+    event.set_population(population);
+    event.set_accepted(accepted);
+    event.set_weight(accepted == 0 ? 0 : static_cast<float>(static_cast<double>(population) / static_cast<double>(accepted)));
+    event.commit();
+  }
+}
@@ -28,6 +28,7 @@
 
 #include "jfrfiles/jfrEventIds.hpp"
 #include "jfr/support/jfrAdaptiveSampler.hpp"
+#include "runtime/atomic.hpp"
 
 class JfrEventThrottler : public JfrAdaptiveSampler {
   friend class JfrRecorder;
@@ -36,22 +37,37 @@ class JfrEventThrottler : public JfrAdaptiveSampler {
   int64_t _sample_size;
   int64_t _period_ms;
   double _sample_size_ewma;
+  uint64_t _population;  // events considered in expired windows, updated under _lock
+  uint64_t _accepted;    // events accepted in expired windows, updated under _lock
   JfrEventId _event_id;
   bool _disabled;
   bool _update;
 
+  static JfrEventThrottler* volatile _throttlers[LAST_EVENT_ID + 1];
+
   static bool create();
   static void destroy();
+  static JfrEventThrottler* create(JfrEventId event_id);
   JfrEventThrottler(JfrEventId event_id);
   void configure(int64_t event_sample_size, int64_t period_ms);
 
   const JfrSamplerParams& update_params(const JfrSamplerWindow* expired);
   const JfrSamplerParams& next_window_params(const JfrSamplerWindow* expired);
-  static JfrEventThrottler* for_event(JfrEventId event_id);
+  static JfrEventThrottler* for_event(JfrEventId event_id) {
+    return Atomic::load_acquire(&_throttlers[event_id]);
+  }
 
  public:
+  // Any native event type can be throttled. A throttler is created the
+  // first time a rate is configured for the event type.
   static void configure(JfrEventId event_id, int64_t event_sample_size, int64_t period_ms);
-  static bool accept(JfrEventId event_id, int64_t timestamp = 0);
+  static bool accept(JfrEventId event_id, int64_t timestamp = 0) {
+    JfrEventThrottler* const throttler = for_event(event_id);
+    return throttler == nullptr || throttler->_disabled || throttler->sample(timestamp);
+  }
+
+  // Emits an EventThrottleStatistics event for each throttled event type.
+  static void emit_statistics();
 };
 
 #endif // SHARE_JFR_RECORDER_SERVICE_JFREVENTTHROTTLER_HPP
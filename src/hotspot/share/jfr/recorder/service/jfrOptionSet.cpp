@@ -127,6 +127,14 @@ void JfrOptionSet::set_retransform(jboolean value) {
   _retransform = value;
 }
 
+bool JfrOptionSet::compress_chunks() {
+  return _compress_chunks == JNI_TRUE;
+}
+
+void JfrOptionSet::set_compress_chunks(jboolean value) {
+  _compress_chunks = value;
+}
+
 bool JfrOptionSet::sample_protection() {
   return _sample_protection == JNI_TRUE;
 }
@@ -167,6 +175,7 @@ const char* const default_stack_depth = "64";
 const char* const default_retransform = "true";
 const char* const default_old_object_queue_size = "256";
 const char* const default_preserve_repository = "false";
+const char* const default_compress_chunks = "false";
 DEBUG_ONLY(const char* const default_sample_protection = "false";)
 
 // statics
@@ -263,6 +272,13 @@ static DCmdArgument<bool> _dcmd_preserve_repository(
   false,
   default_preserve_repository);
 
+static DCmdArgument<bool> _dcmd_compress_chunks(
+  "compress-chunks",
+  "Write a gzip copy of each completed chunk to the disk repository",
+  "BOOLEAN",
+  false,
+  default_compress_chunks);
+
 static DCmdParser _parser;
 
 static void register_parser_options() {
@@ -278,6 +294,7 @@ static void register_parser_options() {
   _parser.add_dcmd_option(&_dcmd_retransform);
   _parser.add_dcmd_option(&_dcmd_old_object_queue_size);
   _parser.add_dcmd_option(&_dcmd_preserve_repository);
+  _parser.add_dcmd_option(&_dcmd_compress_chunks);
   DEBUG_ONLY(_parser.add_dcmd_option(&_dcmd_sample_protection);)
 }
 
@@ -318,6 +335,7 @@ jlong JfrOptionSet::_num_global_buffers = 0;
 jlong JfrOptionSet::_old_object_queue_size = 0;
 u4 JfrOptionSet::_stack_depth = STACK_DEPTH_DEFAULT;
 jboolean JfrOptionSet::_retransform = JNI_TRUE;
+jboolean JfrOptionSet::_compress_chunks = JNI_FALSE;
 #ifdef ASSERT
 jboolean JfrOptionSet::_sample_protection = JNI_FALSE;
 #else
@@ -332,6 +350,9 @@ bool JfrOptionSet::initialize(JavaThread* thread) {
   if (_dcmd_retransform.is_set()) {
     set_retransform(_dcmd_retransform.value());
   }
+  if (_dcmd_compress_chunks.is_set()) {
+    set_compress_chunks(_dcmd_compress_chunks.value());
+  }
   set_old_object_queue_size(_dcmd_old_object_queue_size.value());
   return adjust_memory_options();
 }
@@ -46,6 +46,7 @@ class JfrOptionSet : public AllStatic {
   static jlong _old_object_queue_size;
   static u4 _stack_depth;
   static jboolean _retransform;
+  static jboolean _compress_chunks;
   static jboolean _sample_protection;
 
   static bool initialize(JavaThread* thread);
@@ -69,6 +70,8 @@ class JfrOptionSet : public AllStatic {
   static void set_stackdepth(u4 depth);
   static bool can_retransform();
   static void set_retransform(jboolean value);
+  static bool compress_chunks();
+  static void set_compress_chunks(jboolean value);
   static bool compressed_integers();
   static bool allow_retransforms();
   static bool allow_event_retransforms();
@@ -54,9 +54,68 @@ JfrStackFrame::JfrStackFrame(const traceid& id, int bci, u1 type, const Instance
 JfrStackFrame::JfrStackFrame(const traceid& id, int bci, u1 type, int lineno, const InstanceKlass* ik) :
   _klass(ik), _methodid(id), _line(lineno), _bci(bci), _type(type) {}
 
+JfrStackFrameSegment::JfrStackFrameSegment(const JfrStackFrame* frames, u4 nr_of_frames,
+                                           const JfrStackFrameSegment* parent, traceid hash,
+                                           const JfrStackFrameSegment* next) :
+  _parent(parent),
+  _next(next),
+  _frames(nullptr),
+  _hash(hash),
+  _nr_of_frames(nr_of_frames) {
+  assert(nr_of_frames > 0 && nr_of_frames <= max_frames, "invariant");
+  copy_frames(&_frames, nr_of_frames, frames);
+}
+
+JfrStackFrameSegment::~JfrStackFrameSegment() {
+  FREE_C_HEAP_ARRAY(JfrStackFrame, _frames);
+}
+
+traceid JfrStackFrameSegment::hash(const JfrStackFrame* frames, u4 nr_of_frames, const JfrStackFrameSegment* parent) {
+  traceid hash = parent != nullptr ? parent->_hash : 1;
+  for (u4 i = 0; i < nr_of_frames; ++i) {
+    hash = (hash * 31) + frames[i]._methodid;
+    hash = (hash * 31) + frames[i]._bci;
+    hash = (hash * 31) + frames[i]._type;
+  }
+  return hash;
+}
+
+bool JfrStackFrameSegment::equals(const JfrStackFrame* frames, u4 nr_of_frames, const JfrStackFrameSegment* parent) const {
+  if (_parent != parent || _nr_of_frames != nr_of_frames) {
+    return false;
+  }
+  for (u4 i = 0; i < nr_of_frames; ++i) {
+    if (!_frames[i].equals(frames[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+JfrStackFrameStream::JfrStackFrameStream(const JfrStackTrace& trace) :
+  _frames(trace._segment != nullptr ? trace._segment->_frames : trace._frames),
+  _segment(trace._segment),
+  _index(0),
+  _length(trace._segment != nullptr ? trace._segment->_nr_of_frames : trace._nr_of_frames) {}
+
+const JfrStackFrame& JfrStackFrameStream::next() {
+  assert(has_next(), "invariant");
+  const JfrStackFrame& frame = _frames[_index++];
+  if (_index == _length && _segment != nullptr) {
+    _segment = _segment->_parent;
+    if (_segment != nullptr) {
+      _frames = _segment->_frames;
+      _length = _segment->_nr_of_frames;
+      _index = 0;
+    }
+  }
+  return frame;
+}
+
 JfrStackTrace::JfrStackTrace(JfrStackFrame* frames, u4 max_frames) :
   _next(nullptr),
   _frames(frames),
+  _segment(nullptr),
   _id(0),
   _hash(0),
   _nr_of_frames(0),
@@ -66,18 +125,19 @@ JfrStackTrace::JfrStackTrace(JfrStackFrame* frames, u4 max_frames) :
   _lineno(false),
   _written(false) {}
 
-JfrStackTrace::JfrStackTrace(traceid id, const JfrStackTrace& trace, const JfrStackTrace* next) :
+JfrStackTrace::JfrStackTrace(traceid id, const JfrStackTrace& trace, const JfrStackFrameSegment* segment, const JfrStackTrace* next) :
   _next(next),
   _frames(nullptr),
+  _segment(segment),
   _id(id),
   _hash(trace._hash),
   _nr_of_frames(trace._nr_of_frames),
   _max_frames(trace._max_frames),
-  _frames_ownership(true),
+  _frames_ownership(false),
   _reached_root(trace._reached_root),
   _lineno(trace._lineno),
   _written(false) {
-  copy_frames(&_frames, trace._nr_of_frames, trace._frames);
+  assert(segment != nullptr, "invariant");
 }
 
 JfrStackTrace::~JfrStackTrace() {
@@ -87,23 +147,24 @@ JfrStackTrace::~JfrStackTrace() {
 }
 
 template <typename Writer>
-static void write_stacktrace(Writer& w, traceid id, bool reached_root, u4 nr_of_frames, const JfrStackFrame* frames) {
+static void write_stacktrace(Writer& w, const JfrStackTrace& trace, traceid id, bool reached_root, u4 nr_of_frames) {
   w.write((u8)id);
   w.write((u1)!reached_root);
   w.write(nr_of_frames);
-  for (u4 i = 0; i < nr_of_frames; ++i) {
-    frames[i].write(w);
+  JfrStackFrameStream stream(trace);
+  while (stream.has_next()) {
+    stream.next().write(w);
   }
 }
 
 void JfrStackTrace::write(JfrChunkWriter& sw) const {
   assert(!_written, "invariant");
-  write_stacktrace(sw, _id, _reached_root, _nr_of_frames, _frames);
+  write_stacktrace(sw, *this, _id, _reached_root, _nr_of_frames);
   _written = true;
 }
 
 void JfrStackTrace::write(JfrCheckpointWriter& cpw) const {
-  write_stacktrace(cpw, _id, _reached_root, _nr_of_frames, _frames);
+  write_stacktrace(cpw, *this, _id, _reached_root, _nr_of_frames);
 }
 
 bool JfrStackFrame::equals(const JfrStackFrame& rhs) const {
@@ -114,8 +175,10 @@ bool JfrStackTrace::equals(const JfrStackTrace& rhs) const {
   if (_reached_root != rhs._reached_root || _nr_of_frames != rhs._nr_of_frames || _hash != rhs._hash) {
     return false;
   }
-  for (u4 i = 0; i < _nr_of_frames; ++i) {
-    if (!_frames[i].equals(rhs._frames[i])) {
+  JfrStackFrameStream lhs_frames(*this);
+  JfrStackFrameStream rhs_frames(rhs);
+  while (lhs_frames.has_next()) {
+    if (!lhs_frames.next().equals(rhs_frames.next())) {
       return false;
     }
   }
@@ -35,6 +35,7 @@ class JfrCheckpointWriter;
 class JfrChunkWriter;
 
 class JfrStackFrame {
+  friend class JfrStackFrameSegment;
   friend class ObjectSampleCheckpoint;
  private:
   const InstanceKlass* _klass;
@@ -61,8 +62,35 @@ class JfrStackFrame {
   };
 };
 
+// A run of frames of stored stack traces, hash-consed together with the
+// segment below it (towards the root). Segments are aligned from the root,
+// so traces sharing their root-most frames share the storage for them,
+// whatever their depth.
+class JfrStackFrameSegment : public JfrCHeapObj {
+  friend class JfrStackFrameStream;
+  friend class JfrStackTraceRepository;
+ private:
+  const JfrStackFrameSegment* _parent;
+  const JfrStackFrameSegment* _next;
+  JfrStackFrame* _frames;
+  traceid _hash;
+  u4 _nr_of_frames;
+
+  JfrStackFrameSegment(const JfrStackFrame* frames, u4 nr_of_frames, const JfrStackFrameSegment* parent,
+                       traceid hash, const JfrStackFrameSegment* next);
+  ~JfrStackFrameSegment();
+
+  const JfrStackFrameSegment* next() const { return _next; }
+  bool equals(const JfrStackFrame* frames, u4 nr_of_frames, const JfrStackFrameSegment* parent) const;
+  static traceid hash(const JfrStackFrame* frames, u4 nr_of_frames, const JfrStackFrameSegment* parent);
+
+ public:
+  static const u4 max_frames = 16;
+};
+
 class JfrStackTrace : public JfrCHeapObj {
   friend class JfrNativeSamplerCallback;
+  friend class JfrStackFrameStream;
   friend class JfrStackTraceRepository;
   friend class ObjectSampleCheckpoint;
   friend class ObjectSampler;
@@ -71,6 +99,7 @@ class JfrStackTrace : public JfrCHeapObj {
  private:
   const JfrStackTrace* _next;
   JfrStackFrame* _frames;
+  const JfrStackFrameSegment* _segment;
   traceid _id;
   traceid _hash;
   u4 _nr_of_frames;
@@ -100,7 +129,7 @@ class JfrStackTrace : public JfrCHeapObj {
   bool have_lineno() const { return _lineno; }
   bool full_stacktrace() const { return _reached_root; }
 
-  JfrStackTrace(traceid id, const JfrStackTrace& trace, const JfrStackTrace* next);
+  JfrStackTrace(traceid id, const JfrStackTrace& trace, const JfrStackFrameSegment* segment, const JfrStackTrace* next);
   JfrStackTrace(JfrStackFrame* frames, u4 max_frames);
   ~JfrStackTrace();
 
@@ -109,4 +138,20 @@ class JfrStackTrace : public JfrCHeapObj {
   traceid id() const { return _id; }
 };
 
+// Iterates the frames of a stack trace from the top, whether they are held
+// in a single array or in a chain of shared segments.
+class JfrStackFrameStream : public StackObj {
+ private:
+  const JfrStackFrame* _frames;
+  const JfrStackFrameSegment* _segment;
+  u4 _index;
+  u4 _length;
+
+ public:
+  JfrStackFrameStream(const JfrStackTrace& trace);
+
+  bool has_next() const { return _index < _length; }
+  const JfrStackFrame& next();
+};
+
 #endif // SHARE_JFR_RECORDER_STACKTRACE_JFRSTACKTRACE_HPP
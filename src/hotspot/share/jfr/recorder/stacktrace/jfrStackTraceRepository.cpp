@@ -53,6 +53,7 @@ static JfrStackTraceRepository& leak_profiler_instance() {
 
 JfrStackTraceRepository::JfrStackTraceRepository() : _last_entries(0), _entries(0) {
   memset(_table, 0, sizeof(_table));
+  memset(_segments, 0, sizeof(_segments));
 }
 
 JfrStackTraceRepository* JfrStackTraceRepository::create() {
@@ -119,6 +120,7 @@ size_t JfrStackTraceRepository::write(JfrChunkWriter& sw, bool clear) {
   }
   if (clear) {
     memset(_table, 0, sizeof(_table));
+    clear_segments();
     _entries = 0;
   }
   _last_entries = _entries;
@@ -139,6 +141,7 @@ size_t JfrStackTraceRepository::clear(JfrStackTraceRepository& repo) {
     }
   }
   memset(repo._table, 0, sizeof(repo._table));
+  repo.clear_segments();
   const size_t processed = repo._entries;
   repo._entries = 0;
   repo._last_entries = 0;
@@ -216,11 +219,53 @@ traceid JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
   }
 
   traceid id = ++_next_id;
-  _table[index] = new JfrStackTrace(id, stacktrace, _table[index]);
+  _table[index] = new JfrStackTrace(id, stacktrace, add_segments(stacktrace), _table[index]);
   ++_entries;
   return id;
 }
 
+// Stored traces keep their frames as a chain of hash-consed segments, split
+// at multiples of max_frames counted from the root-most frame. Deep traces
+// that only differ near the top, as with virtual threads or reactive code,
+// then share the storage for their common root-most frames.
+const JfrStackFrameSegment* JfrStackTraceRepository::add_segments(const JfrStackTrace& stacktrace) {
+  assert(JfrStacktrace_lock->owned_by_self(), "invariant");
+  const JfrStackFrameSegment* segment = nullptr;
+  u4 end = stacktrace._nr_of_frames;
+  while (end > 0) {
+    const u4 start = end > JfrStackFrameSegment::max_frames ? end - JfrStackFrameSegment::max_frames : 0;
+    segment = add_segment(stacktrace._frames + start, end - start, segment);
+    end = start;
+  }
+  return segment;
+}
+
+const JfrStackFrameSegment* JfrStackTraceRepository::add_segment(const JfrStackFrame* frames, u4 nr_of_frames,
+                                                                 const JfrStackFrameSegment* parent) {
+  const traceid hash = JfrStackFrameSegment::hash(frames, nr_of_frames, parent);
+  const size_t index = hash % TABLE_SIZE;
+  for (const JfrStackFrameSegment* entry = _segments[index]; entry != nullptr; entry = entry->next()) {
+    if (entry->_hash == hash && entry->equals(frames, nr_of_frames, parent)) {
+      return entry;
+    }
+  }
+  _segments[index] = new JfrStackFrameSegment(frames, nr_of_frames, parent, hash, _segments[index]);
+  return _segments[index];
+}
+
+// Segments are only released together with all the traces referring to them.
+void JfrStackTraceRepository::clear_segments() {
+  for (u4 i = 0; i < TABLE_SIZE; ++i) {
+    JfrStackFrameSegment* segment = _segments[i];
+    while (segment != nullptr) {
+      JfrStackFrameSegment* next = const_cast<JfrStackFrameSegment*>(segment->next());
+      delete segment;
+      segment = next;
+    }
+  }
+  memset(_segments, 0, sizeof(_segments));
+}
+
 // invariant is that the entry to be resolved actually exists in the table
 const JfrStackTrace* JfrStackTraceRepository::lookup_for_leak_profiler(traceid hash, traceid id) {
   const size_t index = (hash % TABLE_SIZE);
@@ -47,6 +47,7 @@ class JfrStackTraceRepository : public JfrCHeapObj {
  private:
   static const u4 TABLE_SIZE = 2053;
   JfrStackTrace* _table[TABLE_SIZE];
+  JfrStackFrameSegment* _segments[TABLE_SIZE];
   u4 _last_entries;
   u4 _entries;
 
@@ -68,6 +69,9 @@ class JfrStackTraceRepository : public JfrCHeapObj {
   static traceid next_id();
 
   traceid add_trace(const JfrStackTrace& stacktrace);
+  const JfrStackFrameSegment* add_segment(const JfrStackFrame* frames, u4 nr_of_frames, const JfrStackFrameSegment* parent);
+  const JfrStackFrameSegment* add_segments(const JfrStackTrace& stacktrace);
+  void clear_segments();
   static traceid add(JfrStackTraceRepository& repo, const JfrStackTrace& stacktrace);
   static traceid add(const JfrStackTrace& stacktrace);
   traceid record(JavaThread* current_thread, int skip, int64_t stack_filter_id, JfrStackFrame* frames, u4 max_frames);
@@ -40,6 +40,7 @@
 #include "logging/log.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/javaThread.hpp"
+#include "runtime/os.hpp"
 #include "runtime/safepoint.hpp"
 
 static int generation_offset = invalid_offset;
@@ -107,15 +108,24 @@ void JfrStringPool::destroy() {
   _instance = nullptr;
 }
 
-JfrStringPool::JfrStringPool(JfrChunkWriter& cw) : _mspace(nullptr), _chunkwriter(cw) {}
+JfrStringPool::JfrStringPool(JfrChunkWriter& cw) : _mspace(nullptr), _chunkwriter(cw), _preallocated_count(0) {
+  memset(_preallocated, 0, sizeof(_preallocated));
+}
 
 JfrStringPool::~JfrStringPool() {
   delete _mspace;
 }
 
-static const size_t string_pool_cache_count = 2;
+static const u4 string_pool_cache_count = 2;
 static const size_t string_pool_buffer_size = 512 * K;
 
+// One preallocated buffer per epoch for every eight processors, so that
+// threads adding strings concurrently spread over several buffers.
+static u4 string_pool_preallocated_count(u4 max_count) {
+  const u4 count = (u4)os::active_processor_count() / 8;
+  return clamp(count, string_pool_cache_count, max_count);
+}
+
 bool JfrStringPool::initialize() {
   if (!initialize_java_string_pool()) {
     return false;
@@ -129,12 +139,16 @@ bool JfrStringPool::initialize() {
                                                this);
 
   // preallocate buffer count to each of the epoch live lists
-  for (size_t i = 0; i < string_pool_cache_count * 2; ++i) {
+  _preallocated_count = string_pool_preallocated_count(max_preallocated);
+  for (u4 i = 0; i < _preallocated_count * 2; ++i) {
     Buffer* const buffer = mspace_allocate(string_pool_buffer_size, _mspace);
     if (buffer == nullptr) {
       return false;
     }
-    _mspace->add_to_live_list(buffer, i % 2 == 0);
+    const bool previous_epoch = i % 2 == 0;
+    _mspace->add_to_live_list(buffer, previous_epoch);
+    const u1 epoch = previous_epoch ? JfrTraceIdEpoch::previous() : JfrTraceIdEpoch::current();
+    _preallocated[epoch][i / 2] = buffer;
   }
   assert(_mspace->free_list_is_empty(), "invariant");
   return _mspace != nullptr;
@@ -173,8 +187,36 @@ BufferPtr JfrStringPool::flush(BufferPtr old, size_t used, size_t requested, Thr
 
 static const size_t lease_retry = 10;
 
+// Try the preallocated buffers of the current epoch first, starting at an
+// offset derived from the thread. Concurrent writers then mostly acquire
+// distinct buffers instead of all contending for the head of the live list.
+BufferPtr JfrStringPool::acquire_preallocated(Thread* thread, size_t size) {
+  assert(_preallocated_count > 0, "invariant");
+  const u1 epoch = JfrTraceIdEpoch::current();
+  const u4 start = (u4)(((uintptr_t)thread >> LogBytesPerWord) % _preallocated_count);
+  for (u4 i = 0; i < _preallocated_count; ++i) {
+    BufferPtr const buffer = _preallocated[epoch][(start + i) % _preallocated_count];
+    assert(buffer != nullptr, "invariant");
+    if (buffer->retired() || buffer->free_size() < size || !buffer->try_acquire(thread)) {
+      continue;
+    }
+    assert(!buffer->retired(), "invariant");
+    if (buffer->free_size() >= size) {
+      buffer->set_lease();
+      return buffer;
+    }
+    buffer->set_retired();
+    register_full(buffer, thread);
+  }
+  return nullptr;
+}
+
 BufferPtr JfrStringPool::lease(Thread* thread, size_t size /* 0 */) {
-  BufferPtr buffer = mspace_acquire_lease_with_retry(size, instance()._mspace, lease_retry, thread);
+  BufferPtr buffer = instance().acquire_preallocated(thread, size);
+  if (buffer != nullptr) {
+    return buffer;
+  }
+  buffer = mspace_acquire_lease_with_retry(size, instance()._mspace, lease_retry, thread);
   if (buffer == nullptr) {
     buffer = mspace_allocate_transient_lease_to_live_list(size,  instance()._mspace, thread);
   }
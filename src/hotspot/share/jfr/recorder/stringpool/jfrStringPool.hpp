@@ -55,10 +55,17 @@ class JfrStringPool : public JfrCHeapObj {
   typedef JfrStringPoolMspace::NodePtr BufferPtr;
 
  private:
+  static const u4 max_preallocated = 4;
+
   JfrStringPoolMspace* _mspace;
   JfrChunkWriter& _chunkwriter;
+  // The buffers preallocated to each epoch live list, which stay for the
+  // lifetime of the mspace.
+  BufferPtr _preallocated[2][max_preallocated];
+  u4 _preallocated_count;
 
   static BufferPtr lease(Thread* thread, size_t size = 0);
+  BufferPtr acquire_preallocated(Thread* thread, size_t size);
   static BufferPtr flush(BufferPtr old, size_t used, size_t requested, Thread* thread);
 
   JfrStringPool(JfrChunkWriter& cw);
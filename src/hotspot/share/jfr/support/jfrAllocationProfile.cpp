@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "classfile/classLoaderData.inline.hpp"
+#include "jfr/jfrEvents.hpp"
+#include "jfr/recorder/stacktrace/jfrStackTraceRepository.hpp"
+#include "jfr/support/jfrAllocationProfile.hpp"
+#include "jfr/support/jfrThreadLocal.hpp"
+#include "memory/allocation.hpp"
+#include "oops/klass.inline.hpp"
+#include "runtime/thread.hpp"
+#include "utilities/ticks.hpp"
+
+class JfrAllocationSite : public CHeapObj<mtTracing> {
+ public:
+  const Klass* _klass;
+  traceid _stack_trace_id;
+  int64_t _bytes;
+  int64_t _samples;
+  JfrAllocationSite* _next;
+
+  JfrAllocationSite(const Klass* klass, traceid stack_trace_id, JfrAllocationSite* next) :
+    _klass(klass), _stack_trace_id(stack_trace_id), _bytes(0), _samples(0), _next(next) {}
+};
+
+static const size_t table_size = 1021;
+// Bounds the footprint; samples of further sites only count towards the
+// total of their class.
+static const size_t max_sites = 16 * K;
+
+static JfrAllocationSite* _table[table_size];
+static size_t _site_count = 0;
+static volatile int _lock = 0;
+
+class JfrAllocationProfileLocker : public StackObj {
+ public:
+  JfrAllocationProfileLocker() {
+    Thread::SpinAcquire(&_lock, "JfrAllocationProfile");
+  }
+  ~JfrAllocationProfileLocker() {
+    Thread::SpinRelease(&_lock);
+  }
+};
+
+static size_t bucket(const Klass* klass, traceid stack_trace_id) {
+  return (size_t)((((uintptr_t)klass >> LogBytesPerWord) * 31 + stack_trace_id) % table_size);
+}
+
+static void add(const Klass* klass, traceid stack_trace_id, int64_t weight) {
+  JfrAllocationProfileLocker lock;
+  if (_site_count >= max_sites) {
+    stack_trace_id = 0;
+  }
+  const size_t index = bucket(klass, stack_trace_id);
+  JfrAllocationSite* site = _table[index];
+  while (site != nullptr && (site->_klass != klass || site->_stack_trace_id != stack_trace_id)) {
+    site = site->_next;
+  }
+  if (site == nullptr) {
+    site = new JfrAllocationSite(klass, stack_trace_id, _table[index]);
+    _table[index] = site;
+    ++_site_count;
+  }
+  site->_bytes += weight;
+  site->_samples++;
+}
+
+static JfrAllocationSite* detach_all() {
+  JfrAllocationProfileLocker lock;
+  JfrAllocationSite* list = nullptr;
+  for (size_t i = 0; i < table_size; ++i) {
+    JfrAllocationSite* site = _table[i];
+    while (site != nullptr) {
+      JfrAllocationSite* const next = site->_next;
+      site->_next = list;
+      list = site;
+      site = next;
+    }
+    _table[i] = nullptr;
+  }
+  _site_count = 0;
+  return list;
+}
+
+void JfrAllocationProfile::sample(const Klass* klass, Thread* thread) {
+  assert(klass != nullptr, "invariant");
+  assert(thread != nullptr, "invariant");
+  if (!EventObjectAllocationProfile::is_enabled()) {
+    return;
+  }
+  JfrThreadLocal* const tl = thread->jfr_thread_local();
+  const int64_t allocated_bytes = thread->allocated_bytes();
+  const int64_t weight = allocated_bytes - tl->last_profiled_allocated_bytes();
+  if (weight <= 0) {
+    return;
+  }
+  tl->set_last_profiled_allocated_bytes(allocated_bytes);
+  add(klass, JfrStackTraceRepository::record(thread), weight);
+}
+
+void JfrAllocationProfile::send_events(const Ticks& timestamp) {
+  JfrAllocationSite* site = detach_all();
+  while (site != nullptr) {
+    if (site->_klass->class_loader_data()->is_unloading()) {
+      JfrAllocationSite* const next = site->_next;
+      delete site;
+      site = next;
+      continue;
+    }
+    EventObjectAllocationProfile event(UNTIMED);
+    event.set_starttime(timestamp);
+    event.set_objectClass(site->_klass);
+    event.set_stackTrace(site->_stack_trace_id);
+    event.set_allocated(site->_bytes);
+    event.set_samples(site->_samples);
+    event.commit();
+    JfrAllocationSite* const next = site->_next;
+    delete site;
+    site = next;
+  }
+}
+
+// The sites of classes being unloaded are dropped, they would otherwise
+// refer to freed metadata when the events are sent.
+void JfrAllocationProfile::on_unloading_classes() {
+  JfrAllocationProfileLocker lock;
+  for (size_t i = 0; i < table_size; ++i) {
+    JfrAllocationSite** link = &_table[i];
+    while (*link != nullptr) {
+      JfrAllocationSite* const site = *link;
+      if (site->_klass->class_loader_data()->is_unloading()) {
+        *link = site->_next;
+        delete site;
+        --_site_count;
+      } else {
+        link = &site->_next;
+      }
+    }
+  }
+}
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef SHARE_JFR_SUPPORT_JFRALLOCATIONPROFILE_HPP
+#define SHARE_JFR_SUPPORT_JFRALLOCATIONPROFILE_HPP
+
+#include "jfr/utilities/jfrTypes.hpp"
+#include "memory/allStatic.hpp"
+#include "utilities/ticks.hpp"
+
+class Klass;
+class Thread;
+
+//
+// Aggregates allocation samples, taken when a TLAB is refilled or an object
+// is allocated outside a TLAB, by (class, stack trace). Each sample is
+// weighted with the bytes the thread allocated since its previous sample, so
+// that the totals over all sites add up to the exact allocated bytes, while
+// the split by site is statistical. The aggregates are emitted and reset as
+// one ObjectAllocationProfile event per site, instead of one event per sample.
+//
+class JfrAllocationProfile : AllStatic {
+ public:
+  static void sample(const Klass* klass, Thread* thread);
+  static void send_events(const Ticks& timestamp);
+  static void on_unloading_classes();
+};
+
+#endif // SHARE_JFR_SUPPORT_JFRALLOCATIONPROFILE_HPP
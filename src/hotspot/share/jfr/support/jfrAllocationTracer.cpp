@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "jfr/leakprofiler/leakProfiler.hpp"
+#include "jfr/support/jfrAllocationProfile.hpp"
 #include "jfr/support/jfrAllocationTracer.hpp"
 #include "jfr/support/jfrObjectAllocationSample.hpp"
 #include "runtime/javaThread.hpp"
@@ -33,4 +34,5 @@ JfrAllocationTracer::JfrAllocationTracer(const Klass* klass, HeapWord* obj, size
     LeakProfiler::sample(obj, alloc_size, thread);
   }
   JfrObjectAllocationSample::send_event(klass, alloc_size, outside_tlab, thread);
+  JfrAllocationProfile::sample(klass, thread);
 }
@@ -60,6 +60,7 @@ class JfrThreadLocal {
   traceid _stack_trace_hash;
   traceid _parent_trace_id;
   int64_t _last_allocated_bytes;
+  int64_t _last_profiled_allocated_bytes;
   jlong _user_time;
   jlong _cpu_time;
   jlong _wallclock_time;
@@ -161,6 +162,15 @@ class JfrThreadLocal {
 
   void clear_last_allocated_bytes() {
     set_last_allocated_bytes(0);
+    set_last_profiled_allocated_bytes(0);
+  }
+
+  int64_t last_profiled_allocated_bytes() const {
+    return _last_profiled_allocated_bytes;
+  }
+
+  void set_last_profiled_allocated_bytes(int64_t allocated_bytes) {
+    _last_profiled_allocated_bytes = allocated_bytes;
   }
 
   // Contextually defined thread id that is volatile,
@@ -102,7 +102,7 @@ static bool setup_event_writer_offsets(TRAPS) {
   assert(valid_offset != invalid_offset, "invariant");
 
   const char pin_name[] = "pinVirtualThread";
-  Symbol* const pin_sym = SymbolTable::new_symbol(valid_name);
+  Symbol* const pin_sym = SymbolTable::new_symbol(pin_name);
   assert(pin_sym != nullptr, "invariant");
   assert(invalid_offset == pin_offset, "invariant");
   JfrJavaSupport::compute_field_offset(pin_offset, klass, pin_sym, vmSymbols::bool_signature());
@@ -148,6 +148,10 @@ void JfrJavaEventWriter::flush(jobject writer, jint used, jint requested, JavaTh
   }
 }
 
+// Commits all events written between the current position of the buffer and
+// next_position. A writer may write several events before committing them in
+// one call, which amortizes the notification and lease checks over the batch.
+// If the writer was notified of an epoch shift, the whole batch is discarded.
 jlong JfrJavaEventWriter::commit(jlong next_position) {
   assert(next_position != 0, "invariant");
   JavaThread* const jt = JavaThread::current();
@@ -264,6 +268,8 @@ jobject JfrJavaEventWriter::event_writer(JavaThread* jt) {
     const jlong event_writer_tid = writer->long_field(thread_id_offset);
     const jlong current_tid = static_cast<jlong>(JfrThreadLocal::thread_id(jt));
     if (event_writer_tid != current_tid) {
+      // The writer and its buffer stay bound to the carrier thread. Only the
+      // thread identity is patched when a different (virtual) thread is mounted.
       writer->long_field_put(thread_id_offset, current_tid);
       const bool excluded = tl->is_excluded();
       writer->bool_field_put(excluded_offset, excluded);
@@ -31,6 +31,7 @@
 #include "memory/resourceArea.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/os.inline.hpp"
+#include "utilities/vmError.hpp"
 
 class AsyncLogWriter::AsyncLogLocker : public StackObj {
  public:
@@ -74,7 +75,9 @@ void AsyncLogWriter::enqueue_locked(LogFileStreamOutput* output, const LogDecora
   // client should use "" instead.
   assert(msg != nullptr, "enqueuing a null message!");
 
-  if (!_buffer->push_back(output, decorations, msg)) {
+  const bool sampled_out = output->async_mode() == LogFileStreamOutput::AsyncSample &&
+                           _buffer->is_half_full() && !output->sample_async_message();
+  if (sampled_out || !_buffer->push_back(output, decorations, msg)) {
     bool p_created;
     uint32_t* counter = _stats.put_if_absent(output, 0, &p_created);
     *counter = *counter + 1;
@@ -82,11 +85,28 @@ void AsyncLogWriter::enqueue_locked(LogFileStreamOutput* output, const LogDecora
   }
 
   _data_available = true;
-  _lock.notify();
+  // Wakes up the AsyncLog thread, and other logging threads only wait for it
+  _lock.notify_all();
+}
+
+// For outputs in AsyncBlock mode, waits until messages of the given total size fit into the buffer.
+void AsyncLogWriter::wait_for_space_locked(LogFileStreamOutput* output, size_t size) {
+  if (output->async_mode() != LogFileStreamOutput::AsyncBlock ||
+      Thread::current_or_null() == this ||
+      VMError::is_error_reported() ||
+      !_buffer->can_ever_fit(size)) {
+    return;
+  }
+  while (!_buffer->has_space(size)) {
+    _data_available = true;
+    _lock.notify_all();
+    _lock.wait(0 /* no timeout */);
+  }
 }
 
 void AsyncLogWriter::enqueue(LogFileStreamOutput& output, const LogDecorations& decorations, const char* msg) {
   AsyncLogLocker locker;
+  wait_for_space_locked(&output, Message::calc_size(strlen(msg)));
   enqueue_locked(&output, decorations, msg);
 }
 
@@ -95,6 +115,14 @@ void AsyncLogWriter::enqueue(LogFileStreamOutput& output, const LogDecorations&
 void AsyncLogWriter::enqueue(LogFileStreamOutput& output, LogMessageBuffer::Iterator msg_iterator) {
   AsyncLogLocker locker;
 
+  if (output.async_mode() == LogFileStreamOutput::AsyncBlock) {
+    size_t size = 0;
+    for (LogMessageBuffer::Iterator it = msg_iterator; !it.is_at_end(); it++) {
+      size += Message::calc_size(strlen(it.message()));
+    }
+    wait_for_space_locked(&output, size);
+  }
+
   for (; !msg_iterator.is_at_end(); msg_iterator++) {
     enqueue_locked(&output, msg_iterator.decorations(), msg_iterator.message());
   }
@@ -119,16 +147,20 @@ AsyncLogWriter::AsyncLogWriter()
 void AsyncLogWriter::write(AsyncLogMap<AnyObj::RESOURCE_AREA>& snapshot) {
   int req = 0;
   auto it = _buffer_staging->iterator();
-  while (it.hasNext()) {
-    const Message* e = it.next();
+  const Message* e = it.hasNext() ? it.next() : nullptr;
+  while (e != nullptr) {
+    const Message* const next = it.hasNext() ? it.next() : nullptr;
 
     if (!e->is_token()){
-      e->output()->write_blocking(e->decorations(), e->message());
+      // Flush once the run of messages to this output ends.
+      const bool do_flush = next == nullptr || next->output() != e->output();
+      e->output()->write_blocking(e->decorations(), e->message(), do_flush);
     } else {
       // This is a flush token. Record that we found it and then
       // signal the flushing thread after the loop.
       req++;
     }
+    e = next;
   }
 
   LogDecorations decorations(LogLevel::Warning, LogTagSetMapping<LogTag::__NO_TAG>::tagset(),
@@ -162,6 +194,8 @@ void AsyncLogWriter::run() {
       // guarantee that I/O jobs don't block logsites.
       _buffer_staging->reset();
       swap(_buffer, _buffer_staging);
+      // Logging threads blocked on a full buffer can continue
+      _lock.notify_all();
 
       // move counters to snapshot and reset them.
       _stats.iterate([&] (LogFileStreamOutput* output, uint32_t& counter) {
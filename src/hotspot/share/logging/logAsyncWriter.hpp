@@ -50,8 +50,14 @@ class LogFileStreamOutput;
 // successfully initialized. Clients can use its return value to determine async logging is established or not.
 //
 // enqueue() is the basic operation of AsyncLogWriter. Two overloading versions of it are provided to match LogOutput::write().
-// They are both MT-safe and non-blocking. Derived classes of LogOutput can invoke the corresponding enqueue() in write() and
-// return 0. AsyncLogWriter is responsible of copying necessary data.
+// They are both MT-safe. Derived classes of LogOutput can invoke the corresponding enqueue() in write() and return 0.
+// AsyncLogWriter is responsible of copying necessary data. What happens when the buffer is full depends on the AsyncMode
+// of the output: messages are dropped (the default), sampled once the buffer is half full, or the logging thread blocks
+// until the AsyncLog thread has taken the buffer. Blocking keeps the parts of a LogMessageBuffer together, and is never
+// done by the AsyncLog thread itself or while a fatal error is reported.
+//
+// The AsyncLog thread writes the messages of a buffer to their outputs, flushing each output once per run of consecutive
+// messages to it rather than once per message.
 //
 // flush() ensures that all pending messages have been written out before it returns. It is not MT-safe in itself. When users
 // change the logging configuration via jcmd, LogConfiguration::configure_output() calls flush() under the protection of the
@@ -127,6 +133,17 @@ class AsyncLogWriter : public NonJavaThread {
     void push_flush_token();
     bool push_back(LogFileStreamOutput* output, const LogDecorations& decorations, const char* msg);
 
+    // Whether messages of the given total size (see Message::calc_size) fit now, or would fit in an empty buffer
+    bool has_space(size_t size) const {
+      return _pos + size <= _capacity - Message::calc_size(0);
+    }
+    bool can_ever_fit(size_t size) const {
+      return align_up(_buf, alignof(Message)) - _buf + size <= _capacity - Message::calc_size(0);
+    }
+    bool is_half_full() const {
+      return _pos >= _capacity / 2;
+    }
+
     void reset() {
       // Ensure _pos is Message-aligned
       _pos = align_up(_buf, alignof(Message)) - _buf;
@@ -172,6 +189,7 @@ class AsyncLogWriter : public NonJavaThread {
 
   AsyncLogWriter();
   void enqueue_locked(LogFileStreamOutput* output, const LogDecorations& decorations, const char* msg);
+  void wait_for_space_locked(LogFileStreamOutput* output, size_t size);
   void write(AsyncLogMap<AnyObj::RESOURCE_AREA>& snapshot);
   void run() override;
   void pre_run() override {
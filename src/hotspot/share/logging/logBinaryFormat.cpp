@@ -0,0 +1,789 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "logging/logBinaryFormat.hpp"
+#include "logging/logDecorations.hpp"
+#include "logging/logLevel.hpp"
+#include "logging/logTagSet.hpp"
+#include "memory/allocation.inline.hpp"
+#include "runtime/os.hpp"
+#include "utilities/growableArray.hpp"
+#include "utilities/ostream.hpp"
+#include "utilities/powerOfTwo.hpp"
+
+const char LogBinaryFormat::Magic[8] = { 'H', 'S', 'L', 'O', 'G', 'B', 'I', 'N' };
+
+static bool is_digit(char c) {
+  return c >= '0' && c <= '9';
+}
+
+void LogBinaryFormat::parse_conversion(const char* p, Conversion* conv) {
+  assert(*p == '%', "must start a conversion");
+  const char* q = p + 1;
+  conv->_start = p;
+  conv->_width_star = false;
+  conv->_precision_star = false;
+  conv->_length[0] = '\0';
+  if (*q == '%') {
+    conv->_end = q + 1;
+    conv->_kind = NoArg;
+    return;
+  }
+  while (*q == '-' || *q == '+' || *q == ' ' || *q == '#' || *q == '0' || *q == '\'') {
+    q++;
+  }
+  if (*q == '*') {
+    conv->_width_star = true;
+    q++;
+  } else {
+    while (is_digit(*q)) {
+      q++;
+    }
+  }
+  if (*q == '.') {
+    q++;
+    if (*q == '*') {
+      conv->_precision_star = true;
+      q++;
+    } else {
+      while (is_digit(*q)) {
+        q++;
+      }
+    }
+  }
+  size_t n = 0;
+  while (n < 2 && (*q == 'h' || *q == 'l' || *q == 'j' || *q == 'z' || *q == 't' || *q == 'L' || *q == 'q')) {
+    conv->_length[n++] = *q++;
+  }
+  conv->_length[n] = '\0';
+
+  const char c = *q;
+  conv->_end = (c == '\0') ? q : q + 1;
+  switch (c) {
+    case 'd': case 'i': case 'u': case 'o': case 'x': case 'X':
+      conv->_kind = (conv->_length[0] == 'L') ? UnsupportedArg : IntArg;
+      break;
+    case 'c':
+      conv->_kind = (n == 0) ? IntArg : UnsupportedArg;
+      break;
+    case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+      conv->_kind = (n == 0 || strcmp(conv->_length, "l") == 0) ? DoubleArg : UnsupportedArg;
+      break;
+    case 's':
+      conv->_kind = (n == 0) ? StringArg : UnsupportedArg;
+      break;
+    case 'p':
+      conv->_kind = (n == 0) ? PointerArg : UnsupportedArg;
+      break;
+    default:
+      // Includes %n, which must not be replayed, and truncated specifications.
+      conv->_kind = UnsupportedArg;
+      break;
+  }
+  if ((size_t)(conv->_end - conv->_start) > MaxConversionLength) {
+    conv->_kind = UnsupportedArg;
+  }
+}
+
+// Since logging is a very basic function, conceivably used within NMT itself,
+// the buffers used while writing use malloc/free rather than os::malloc/free.
+char* LogBinaryFormat::format_text(const char* prefix, const char* fmt, va_list args) {
+  va_list saved_args;
+  va_copy(saved_args, args);
+  const size_t prefix_len = strlen(prefix);
+  const int ret = os::vsnprintf(nullptr, 0, fmt, saved_args);
+  va_end(saved_args);
+  if (ret < 0) {
+    return nullptr;
+  }
+  const size_t len = prefix_len + (size_t)ret + 1;
+  ALLOW_C_FUNCTION(::malloc, char* text = (char*)::malloc(len);)
+  if (text != nullptr) {
+    memcpy(text, prefix, prefix_len);
+    va_copy(saved_args, args);
+    os::vsnprintf(text + prefix_len, len - prefix_len, fmt, saved_args);
+    va_end(saved_args);
+  }
+  return text;
+}
+
+void LogBinaryFormat::free_text(char* text) {
+  ALLOW_C_FUNCTION(::free, ::free(text);)
+}
+
+static size_t definition_index(const void* key, size_t table_size) {
+  const uintptr_t k = (uintptr_t)key >> 3;
+  return (size_t)((k ^ (k >> 16)) * 2654435761u) & (table_size - 1);
+}
+
+LogBinaryWriter::LogBinaryWriter() :
+    _formats(nullptr), _tagsets(nullptr),
+    _tagset_table_size(round_up_power_of_2(MAX2(LogTagSet::ntagsets() * 2, (size_t)64))),
+    _format_count(0), _tagset_count(0), _buf(nullptr), _buf_capacity(0), _pos(0),
+    _written(0), _error(false) {
+  ALLOW_C_FUNCTION(::calloc, _formats = (Definition*)::calloc(FormatTableSize, sizeof(Definition));)
+  ALLOW_C_FUNCTION(::calloc, _tagsets = (Definition*)::calloc(_tagset_table_size, sizeof(Definition));)
+}
+
+LogBinaryWriter::~LogBinaryWriter() {
+  clear_definitions();
+  ALLOW_C_FUNCTION(::free, ::free(_formats);)
+  ALLOW_C_FUNCTION(::free, ::free(_tagsets);)
+  ALLOW_C_FUNCTION(::free, ::free(_buf);)
+}
+
+void LogBinaryWriter::clear_definitions() {
+  if (_formats != nullptr) {
+    for (size_t i = 0; i < FormatTableSize; i++) {
+      ALLOW_C_FUNCTION(::free, ::free(_formats[i]._text);)
+    }
+    memset(_formats, 0, FormatTableSize * sizeof(Definition));
+  }
+  if (_tagsets != nullptr) {
+    memset(_tagsets, 0, _tagset_table_size * sizeof(Definition));
+  }
+  _format_count = 0;
+  _tagset_count = 0;
+}
+
+bool LogBinaryWriter::append(const void* data, size_t size) {
+  if (_pos + size > _buf_capacity) {
+    const size_t new_capacity = round_up_power_of_2(MAX2(_pos + size, (size_t)256));
+    ALLOW_C_FUNCTION(::realloc, char* new_buf = (char*)::realloc(_buf, new_capacity);)
+    if (new_buf == nullptr) {
+      return false;
+    }
+    _buf = new_buf;
+    _buf_capacity = new_capacity;
+  }
+  memcpy(_buf + _pos, data, size);
+  _pos += size;
+  return true;
+}
+
+bool LogBinaryWriter::append_string(const char* s) {
+  if (s == nullptr) {
+    return append_value<u4>(LogBinaryFormat::NullString);
+  }
+  const size_t len = strlen(s);
+  return len < LogBinaryFormat::NullString && append_value<u4>((u4)len) && append(s, len);
+}
+
+void LogBinaryWriter::flush_record(FILE* stream) {
+  if (_error) {
+    return;
+  }
+  if (fwrite(_buf, 1, _pos, stream) != _pos) {
+    _error = true;
+    return;
+  }
+  _written += (int)_pos;
+}
+
+// Returns the id of the definition of key, writing the definition record first
+// if it is new, or 0 if the table is full. The formats are also compared by
+// content, since a buffer can be reused for different format strings.
+u4 LogBinaryWriter::define(FILE* stream, Definition* table, size_t table_size, u4* count,
+                           LogBinaryFormat::RecordKind kind, const void* key, const char* text,
+                           bool compare_text) {
+  if (table == nullptr) {
+    return 0;
+  }
+  size_t idx = definition_index(key, table_size);
+  for (size_t i = 0; i < table_size; i++, idx = (idx + 1) & (table_size - 1)) {
+    Definition* d = &table[idx];
+    if (d->_key == key && (!compare_text || strcmp(d->_text, text) == 0)) {
+      return d->_id;
+    }
+    if (d->_key != nullptr && d->_key != key) {
+      continue;
+    }
+    if (d->_key == nullptr && *count >= table_size / 4 * 3) {
+      return 0;
+    }
+    // New, or redefined, entry
+    if (compare_text) {
+      ALLOW_C_FUNCTION(::free, ::free(d->_text);)
+      ALLOW_C_FUNCTION(::strdup, d->_text = ::strdup(text);)
+      if (d->_text == nullptr) {
+        d->_key = nullptr;
+        return 0;
+      }
+    }
+    const size_t len = strlen(text);
+    const u4 id = ++(*count);
+    _pos = 0;
+    bool ok = append_value<u1>((u1)kind) && append_value<u4>(id);
+    if (kind == LogBinaryFormat::TagSetRecord) {
+      ok = ok && append_value<u2>((u2)MIN2(len, (size_t)max_jushort)) && append(text, MIN2(len, (size_t)max_jushort));
+    } else {
+      ok = ok && append_value<u4>((u4)len) && append(text, len);
+    }
+    if (!ok) {
+      _error = true;
+      return 0;
+    }
+    flush_record(stream);
+    d->_key = key;
+    d->_id = id;
+    return id;
+  }
+  return 0;
+}
+
+u4 LogBinaryWriter::define_tagset(FILE* stream, const LogDecorations& decorations) {
+  char label[256];
+  const LogTagSet* tagset = &decorations.tagset();
+  tagset->label(label, sizeof(label));
+  return define(stream, _tagsets, _tagset_table_size, &_tagset_count,
+                LogBinaryFormat::TagSetRecord, tagset, label, false);
+}
+
+void LogBinaryWriter::begin_message(u4 tagset_id, const LogDecorations& decorations,
+                                    const LogDecorators& decorators, u4 format_id, const char* prefix) {
+  u4 decorator_mask = 0;
+  for (uint i = 0; i < LogDecorators::Count; i++) {
+    if (decorators.is_decorator(static_cast<LogDecorators::Decorator>(i))) {
+      decorator_mask |= (u4)1 << i;
+    }
+  }
+  const size_t prefix_len = MIN2(strlen(prefix), (size_t)max_jushort);
+  _pos = 0;
+  bool ok = append_value<u1>((u1)LogBinaryFormat::MessageRecord) &&
+            append_value<u4>(tagset_id) &&
+            append_value<u1>((u1)decorations.level()) &&
+            append_value<u4>(decorator_mask) &&
+            append_value<jlong>(decorations.millis()) &&
+            append_value<jlong>(decorations.nanos()) &&
+            append_value<double>(decorations.elapsed_seconds()) &&
+            append_value<jlong>((jlong)decorations.tid()) &&
+            append_value<u4>(format_id) &&
+            append_value<u2>((u2)prefix_len) &&
+            append(prefix, prefix_len) &&
+            append_value<u4>(0); // payload length, patched by finish_message
+  if (!ok) {
+    _error = true;
+  }
+}
+
+void LogBinaryWriter::finish_message(FILE* stream, size_t payload_start) {
+  const u4 payload_len = (u4)(_pos - payload_start);
+  memcpy(_buf + payload_start - sizeof(u4), &payload_len, sizeof(u4));
+  flush_record(stream);
+}
+
+bool LogBinaryWriter::append_arguments(const char* fmt, va_list args) {
+  va_list ap;
+  va_copy(ap, args);
+  bool ok = true;
+  for (const char* p = strchr(fmt, '%'); ok && p != nullptr; ) {
+    LogBinaryFormat::Conversion conv;
+    LogBinaryFormat::parse_conversion(p, &conv);
+    if (conv._kind == LogBinaryFormat::UnsupportedArg) {
+      ok = false;
+      break;
+    }
+    if (conv._width_star) {
+      ok = ok && append_value<jlong>(va_arg(ap, int));
+    }
+    if (conv._precision_star) {
+      ok = ok && append_value<jlong>(va_arg(ap, int));
+    }
+    const char* len = conv._length;
+    switch (conv._kind) {
+      case LogBinaryFormat::IntArg: {
+        jlong v;
+        if (strcmp(len, "ll") == 0 || strcmp(len, "q") == 0) {
+          v = (jlong)va_arg(ap, long long);
+        } else if (strcmp(len, "l") == 0) {
+          v = (jlong)va_arg(ap, long);
+        } else if (strcmp(len, "j") == 0) {
+          v = (jlong)va_arg(ap, intmax_t);
+        } else if (strcmp(len, "z") == 0) {
+          v = (jlong)va_arg(ap, size_t);
+        } else if (strcmp(len, "t") == 0) {
+          v = (jlong)va_arg(ap, ptrdiff_t);
+        } else {
+          v = (jlong)va_arg(ap, int);
+        }
+        ok = ok && append_value<jlong>(v);
+        break;
+      }
+      case LogBinaryFormat::DoubleArg:
+        ok = ok && append_value<double>(va_arg(ap, double));
+        break;
+      case LogBinaryFormat::StringArg:
+        ok = ok && append_string(va_arg(ap, const char*));
+        break;
+      case LogBinaryFormat::PointerArg:
+        ok = ok && append_value<u8>((u8)(uintptr_t)va_arg(ap, void*));
+        break;
+      default:
+        break;
+    }
+    p = strchr(conv._end, '%');
+  }
+  va_end(ap);
+  return ok;
+}
+
+int LogBinaryWriter::write_header(FILE* stream) {
+  clear_definitions();
+  _written = 0;
+  _error = false;
+
+  char host_name[256];
+  if (!os::get_host_name(host_name, sizeof(host_name))) {
+    strcpy(host_name, "unknown-host");
+  }
+  const size_t host_len = strlen(host_name);
+  _pos = 0;
+  if (!(append(LogBinaryFormat::Magic, sizeof(LogBinaryFormat::Magic)) &&
+        append_value<u4>(LogBinaryFormat::Version) &&
+        append_value<u4>(LogBinaryFormat::ByteOrderMark) &&
+        append_value<jint>(LogDecorations::pid()) &&
+        append_value<u2>((u2)host_len) &&
+        append(host_name, host_len))) {
+    return -1;
+  }
+  flush_record(stream);
+  return result();
+}
+
+int LogBinaryWriter::write_text(FILE* stream, const LogDecorations& decorations,
+                                const LogDecorators& decorators, const char* msg) {
+  _written = 0;
+  _error = false;
+  const u4 tagset_id = define_tagset(stream, decorations);
+  begin_message(tagset_id, decorations, decorators, 0, "");
+  const size_t payload_start = _pos;
+  if (!append(msg, strlen(msg))) {
+    _error = true;
+  }
+  finish_message(stream, payload_start);
+  return result();
+}
+
+int LogBinaryWriter::write_message(FILE* stream, const LogDecorations& decorations,
+                                   const LogDecorators& decorators, const char* prefix,
+                                   const char* fmt, va_list args) {
+  _written = 0;
+  _error = false;
+  const u4 tagset_id = define_tagset(stream, decorations);
+  const u4 format_id = define(stream, _formats, FormatTableSize, &_format_count,
+                              LogBinaryFormat::FormatRecord, fmt, fmt, true);
+  if (format_id != 0) {
+    begin_message(tagset_id, decorations, decorators, format_id, prefix);
+    const size_t payload_start = _pos;
+    if (append_arguments(fmt, args)) {
+      finish_message(stream, payload_start);
+      return result();
+    }
+  }
+
+  // The arguments can not be recorded, write the formatted message instead.
+  const int definitions_written = _written;
+  char* text = LogBinaryFormat::format_text(prefix, fmt, args);
+  int ret = write_text(stream, decorations, decorators, text != nullptr ? text : fmt);
+  LogBinaryFormat::free_text(text);
+  return ret < 0 ? ret : ret + definitions_written;
+}
+
+// Reading side. Rendering happens outside of the log sites, so it uses the
+// regular allocation functions.
+
+class LogBinaryInput : public StackObj {
+  FILE* _stream;
+  bool  _eof;
+
+ public:
+  LogBinaryInput(FILE* stream) : _stream(stream), _eof(false) {}
+
+  bool at_eof() const { return _eof; }
+
+  bool read(void* dest, size_t size) {
+    if (size > 0 && fread(dest, 1, size, _stream) != size) {
+      _eof = true;
+      return false;
+    }
+    return true;
+  }
+
+  template <typename T> bool read_value(T* value) {
+    return read(value, sizeof(T));
+  }
+
+  // Reads len characters into a new C heap string.
+  char* read_string(size_t len) {
+    char* s = NEW_C_HEAP_ARRAY(char, len + 1, mtLogging);
+    if (!read(s, len)) {
+      FREE_C_HEAP_ARRAY(char, s);
+      return nullptr;
+    }
+    s[len] = '\0';
+    return s;
+  }
+};
+
+class LogBinaryPayload : public StackObj {
+  const char* _data;
+  size_t      _len;
+  size_t      _pos;
+
+ public:
+  LogBinaryPayload(const char* data, size_t len) : _data(data), _len(len), _pos(0) {}
+
+  template <typename T> bool read_value(T* value) {
+    if (_len - _pos < sizeof(T)) {
+      return false;
+    }
+    memcpy(value, _data + _pos, sizeof(T));
+    _pos += sizeof(T);
+    return true;
+  }
+
+  const char* read_chars(size_t len) {
+    if (_len - _pos < len) {
+      return nullptr;
+    }
+    const char* chars = _data + _pos;
+    _pos += len;
+    return chars;
+  }
+};
+
+PRAGMA_DIAG_PUSH
+PRAGMA_FORMAT_NONLITERAL_IGNORED
+
+static int format_int(char* buf, size_t len, const char* spec, const char* length, jlong v) {
+  if (strcmp(length, "ll") == 0 || strcmp(length, "q") == 0) {
+    return os::snprintf(buf, len, spec, (long long)v);
+  } else if (strcmp(length, "l") == 0) {
+    return os::snprintf(buf, len, spec, (long)v);
+  } else if (strcmp(length, "j") == 0) {
+    return os::snprintf(buf, len, spec, (intmax_t)v);
+  } else if (strcmp(length, "z") == 0) {
+    return os::snprintf(buf, len, spec, (size_t)v);
+  } else if (strcmp(length, "t") == 0) {
+    return os::snprintf(buf, len, spec, (ptrdiff_t)v);
+  } else {
+    return os::snprintf(buf, len, spec, (int)v);
+  }
+}
+
+// Formats a single conversion with its recorded argument.
+static int format_conversion(char* buf, size_t len, const char* spec, const LogBinaryFormat::Conversion& conv,
+                             jlong int_value, double double_value, const char* string_value) {
+  switch (conv._kind) {
+    case LogBinaryFormat::IntArg:
+      return format_int(buf, len, spec, conv._length, int_value);
+    case LogBinaryFormat::DoubleArg:
+      return os::snprintf(buf, len, spec, double_value);
+    case LogBinaryFormat::StringArg:
+      return os::snprintf(buf, len, spec, string_value);
+    case LogBinaryFormat::PointerArg:
+      return os::snprintf(buf, len, spec, (void*)(uintptr_t)int_value);
+    default:
+      ShouldNotReachHere();
+      return -1;
+  }
+}
+
+PRAGMA_DIAG_POP
+
+// Copies the conversion specification, replacing '*' by the recorded width and precision.
+static void build_spec(char* spec, size_t len, const LogBinaryFormat::Conversion& conv,
+                       jlong width, jlong precision) {
+  stringStream ss(spec, len);
+  bool seen_precision = false;
+  for (const char* p = conv._start; p < conv._end; p++) {
+    if (*p == '.') {
+      seen_precision = true;
+      if (conv._precision_star && precision < 0) {
+        // A negative precision is taken as if the precision were omitted.
+        p++;
+        continue;
+      }
+    }
+    if (*p == '*') {
+      ss.print(JLONG_FORMAT, seen_precision ? precision : width);
+    } else {
+      ss.put(*p);
+    }
+  }
+}
+
+static bool render_message(outputStream* out, const char* fmt, const char* payload, size_t payload_len) {
+  LogBinaryPayload args(payload, payload_len);
+  const char* p = fmt;
+  while (*p != '\0') {
+    const char* pct = strchr(p, '%');
+    if (pct == nullptr) {
+      out->print_raw(p);
+      break;
+    }
+    out->write(p, pct - p);
+
+    LogBinaryFormat::Conversion conv;
+    LogBinaryFormat::parse_conversion(pct, &conv);
+    p = conv._end;
+    if (conv._kind == LogBinaryFormat::NoArg) {
+      out->put('%');
+      continue;
+    }
+    if (conv._kind == LogBinaryFormat::UnsupportedArg) {
+      return false;
+    }
+
+    jlong width = 0;
+    jlong precision = 0;
+    jlong int_value = 0;
+    double double_value = 0;
+    const char* string_value = nullptr;
+    char* string_copy = nullptr;
+    if ((conv._width_star && !args.read_value(&width)) ||
+        (conv._precision_star && !args.read_value(&precision))) {
+      return false;
+    }
+    switch (conv._kind) {
+      case LogBinaryFormat::IntArg:
+      case LogBinaryFormat::PointerArg:
+        if (!args.read_value(&int_value)) {
+          return false;
+        }
+        break;
+      case LogBinaryFormat::DoubleArg:
+        if (!args.read_value(&double_value)) {
+          return false;
+        }
+        break;
+      case LogBinaryFormat::StringArg: {
+        u4 len;
+        if (!args.read_value(&len)) {
+          return false;
+        }
+        if (len == LogBinaryFormat::NullString) {
+          string_value = "(null)";
+        } else {
+          const char* chars = args.read_chars(len);
+          if (chars == nullptr) {
+            return false;
+          }
+          string_copy = NEW_C_HEAP_ARRAY(char, len + 1, mtLogging);
+          memcpy(string_copy, chars, len);
+          string_copy[len] = '\0';
+          string_value = string_copy;
+        }
+        break;
+      }
+      default:
+        ShouldNotReachHere();
+    }
+
+    char spec[LogBinaryFormat::MaxConversionLength + 2 * 24];
+    build_spec(spec, sizeof(spec), conv, width, precision);
+    char buf[256];
+    int n = format_conversion(buf, sizeof(buf), spec, conv, int_value, double_value, string_value);
+    if (n >= (int)sizeof(buf)) {
+      char* large_buf = NEW_C_HEAP_ARRAY(char, n + 1, mtLogging);
+      format_conversion(large_buf, n + 1, spec, conv, int_value, double_value, string_value);
+      out->write(large_buf, n);
+      FREE_C_HEAP_ARRAY(char, large_buf);
+    } else if (n > 0) {
+      out->write(buf, n);
+    }
+    FREE_C_HEAP_ARRAY(char, string_copy);
+  }
+  return true;
+}
+
+static void render_decorations(outputStream* out, u4 decorator_mask, LogLevelType level, const char* tags,
+                               jlong millis, jlong nanos, double uptime, jlong tid,
+                               jint pid, const char* host_name) {
+  char buf[os::iso8601_timestamp_size];
+  for (uint i = 0; i < LogDecorators::Count; i++) {
+    if ((decorator_mask & ((u4)1 << i)) == 0) {
+      continue;
+    }
+    out->put('[');
+    switch (static_cast<LogDecorators::Decorator>(i)) {
+      case LogDecorators::time_decorator:
+        out->print_raw(os::iso8601_time(millis, buf, sizeof(buf), false));
+        break;
+      case LogDecorators::utctime_decorator:
+        out->print_raw(os::iso8601_time(millis, buf, sizeof(buf), true));
+        break;
+      case LogDecorators::uptime_decorator:
+        out->print("%.3fs", uptime);
+        break;
+      case LogDecorators::timemillis_decorator:
+        out->print(INT64_FORMAT "ms", (int64_t)millis);
+        break;
+      case LogDecorators::uptimemillis_decorator:
+        out->print(INT64_FORMAT "ms", (int64_t)(uptime * MILLIUNITS));
+        break;
+      case LogDecorators::timenanos_decorator:
+        out->print(INT64_FORMAT "ns", (int64_t)nanos);
+        break;
+      case LogDecorators::uptimenanos_decorator:
+        out->print(INT64_FORMAT "ns", (int64_t)(uptime * NANOUNITS));
+        break;
+      case LogDecorators::hostname_decorator:
+        out->print_raw(host_name);
+        break;
+      case LogDecorators::pid_decorator:
+        out->print("%d", pid);
+        break;
+      case LogDecorators::tid_decorator:
+        out->print(INT64_FORMAT, (int64_t)tid);
+        break;
+      case LogDecorators::level_decorator:
+        out->print_raw(LogLevel::name(level));
+        break;
+      case LogDecorators::tags_decorator:
+        out->print_raw(tags);
+        break;
+      default:
+        break;
+    }
+    out->put(']');
+  }
+  if (decorator_mask != 0) {
+    out->put(' ');
+  }
+}
+
+static void free_definitions(GrowableArrayCHeap<char*, mtLogging>& definitions) {
+  for (int i = 0; i < definitions.length(); i++) {
+    FREE_C_HEAP_ARRAY(char, definitions.at(i));
+  }
+}
+
+static const char* definition(GrowableArrayCHeap<char*, mtLogging>& definitions, u4 id) {
+  return (id < (u4)definitions.length()) ? definitions.at(id) : nullptr;
+}
+
+bool LogBinaryReader::render(const char* file_name, outputStream* out, outputStream* errstream) {
+  FILE* stream = os::fopen(file_name, "rb");
+  if (stream == nullptr) {
+    errstream->print_cr("Error opening binary log file '%s': %s", file_name, os::strerror(errno));
+    return false;
+  }
+  LogBinaryInput in(stream);
+
+  char magic[sizeof(LogBinaryFormat::Magic)];
+  u4 version = 0;
+  u4 bom = 0;
+  jint pid = 0;
+  u2 host_len = 0;
+  if (!in.read(magic, sizeof(magic)) || memcmp(magic, LogBinaryFormat::Magic, sizeof(magic)) != 0 ||
+      !in.read_value(&version) || !in.read_value(&bom) || !in.read_value(&pid) || !in.read_value(&host_len)) {
+    errstream->print_cr("'%s' is not a binary log file", file_name);
+    fclose(stream);
+    return false;
+  }
+  if (version != LogBinaryFormat::Version || bom != LogBinaryFormat::ByteOrderMark) {
+    errstream->print_cr("Unsupported binary log file '%s' (version %u, byte order %x)", file_name, version, bom);
+    fclose(stream);
+    return false;
+  }
+  char* host_name = in.read_string(host_len);
+
+  GrowableArrayCHeap<char*, mtLogging> tagsets;
+  GrowableArrayCHeap<char*, mtLogging> formats;
+  GrowableArrayCHeap<char, mtLogging> payload;
+  bool success = host_name != nullptr;
+
+  while (success) {
+    u1 kind;
+    if (!in.read_value(&kind)) {
+      break; // end of file
+    }
+    if (kind == LogBinaryFormat::TagSetRecord || kind == LogBinaryFormat::FormatRecord) {
+      u4 id;
+      u4 len = 0;
+      if (kind == LogBinaryFormat::TagSetRecord) {
+        u2 label_len;
+        success = in.read_value(&id) && in.read_value(&label_len);
+        len = label_len;
+      } else {
+        success = in.read_value(&id) && in.read_value(&len);
+      }
+      char* text = (success && id != 0) ? in.read_string(len) : nullptr;
+      if (text == nullptr) {
+        success = false;
+        break;
+      }
+      GrowableArrayCHeap<char*, mtLogging>& definitions = (kind == LogBinaryFormat::TagSetRecord) ? tagsets : formats;
+      if ((int)id < definitions.length() && definitions.at(id) != nullptr) {
+        FREE_C_HEAP_ARRAY(char, definitions.at(id));
+      }
+      definitions.at_put_grow(id, text, nullptr);
+    } else if (kind == LogBinaryFormat::MessageRecord) {
+      u4 tagset_id, decorator_mask, format_id, payload_len;
+      u1 level;
+      jlong millis, nanos, tid;
+      double uptime;
+      u2 prefix_len;
+      success = in.read_value(&tagset_id) && in.read_value(&level) && in.read_value(&decorator_mask) &&
+                in.read_value(&millis) && in.read_value(&nanos) && in.read_value(&uptime) &&
+                in.read_value(&tid) && in.read_value(&format_id) && in.read_value(&prefix_len) &&
+                level < LogLevel::Count;
+      char* prefix = success ? in.read_string(prefix_len) : nullptr;
+      success = prefix != nullptr && in.read_value(&payload_len);
+      if (success) {
+        payload.at_grow(payload_len, '\0');
+        success = in.read(payload.adr_at(0), payload_len);
+      }
+      const char* tags = definition(tagsets, tagset_id);
+      const char* fmt = (format_id == 0) ? "" : definition(formats, format_id);
+      if (success && (tags == nullptr || fmt == nullptr)) {
+        success = false;
+      }
+      if (success) {
+        render_decorations(out, decorator_mask, static_cast<LogLevelType>(level), tags,
+                           millis, nanos, uptime, tid, pid, host_name);
+        out->print_raw(prefix);
+        if (format_id == 0) {
+          out->write(payload.adr_at(0), payload_len);
+        } else {
+          success = render_message(out, fmt, payload.adr_at(0), payload_len);
+        }
+        out->cr();
+      }
+      FREE_C_HEAP_ARRAY(char, prefix);
+    } else {
+      success = false;
+    }
+  }
+
+  if (!success) {
+    errstream->print_cr("%s binary log file '%s'", in.at_eof() ? "Truncated" : "Corrupt", file_name);
+  }
+  free_definitions(tagsets);
+  free_definitions(formats);
+  FREE_C_HEAP_ARRAY(char, host_name);
+  fclose(stream);
+  return success;
+}
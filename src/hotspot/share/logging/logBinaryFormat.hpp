@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef SHARE_LOGGING_LOGBINARYFORMAT_HPP
+#define SHARE_LOGGING_LOGBINARYFORMAT_HPP
+
+#include "logging/logDecorators.hpp"
+#include "memory/allocation.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+#include <stdarg.h>
+#include <stdio.h>
+
+class LogDecorations;
+class outputStream;
+
+// The binary log file format, used by file outputs configured with format=binary.
+//
+// Instead of formatting each message at the log site, a binary output records
+// every format string (and tagset label) once, in a definition record, and then
+// only the raw decoration values and printf arguments of each message. Messages
+// are turned back into text when the file is rendered, see LogBinaryReader.
+//
+// A file starts with a header (magic, version, byte order mark, pid and host
+// name), followed by records:
+//   'T' u4 id, u2 length, tagset label
+//   'F' u4 id, u4 length, format string
+//   'M' u4 tagset id, u1 level, u4 decorators, i8 millis, i8 nanos, f8 uptime,
+//       i8 tid, u4 format id, u2 prefix length, prefix, u4 payload length, payload
+// A message with format id 0 carries its formatted text as payload. Otherwise the
+// payload holds the arguments: integers and pointers as 8 bytes, floating point
+// values as doubles, and strings as u4 length followed by the characters.
+// Values are stored in the byte order of the writing VM.
+class LogBinaryFormat : AllStatic {
+ public:
+  static const char Magic[8];
+  static const u4 Version = 1;
+  static const u4 ByteOrderMark = 0x01020304;
+  static const u4 NullString = 0xFFFFFFFF;
+
+  enum RecordKind {
+    TagSetRecord = 'T',
+    FormatRecord = 'F',
+    MessageRecord = 'M'
+  };
+
+  enum ArgKind {
+    NoArg,       // "%%"
+    IntArg,
+    DoubleArg,
+    StringArg,
+    PointerArg,
+    UnsupportedArg
+  };
+
+  // A single printf conversion specification, from its '%' up to and including
+  // the conversion character.
+  struct Conversion {
+    const char* _start;
+    const char* _end;
+    bool        _width_star;
+    bool        _precision_star;
+    char        _length[3];
+    ArgKind     _kind;
+  };
+
+  // Longest conversion specification that is recorded, longer ones fall back to text.
+  static const size_t MaxConversionLength = 24;
+
+  // Parses the conversion starting at the '%' pointed to by p.
+  static void parse_conversion(const char* p, Conversion* conv);
+
+  // Formats prefix and message into a buffer allocated with malloc, or returns
+  // nullptr on native OOM. Free the result with free_text().
+  static char* format_text(const char* prefix, const char* fmt, va_list args) ATTRIBUTE_PRINTF(2, 0);
+  static void free_text(char* text);
+};
+
+// Writes the records of one binary log file. Callers serialize access (the
+// owning LogFileOutput holds its rotation lock).
+class LogBinaryWriter : public CHeapObj<mtLogging> {
+ private:
+  struct Definition {
+    const void* _key;
+    char*       _text;
+    u4          _id;
+  };
+  // Fixed size open addressing tables, keyed by the address of the format string
+  // or tagset. The tagset table has room for all tagsets; messages with formats
+  // that no longer fit in the format table fall back to text.
+  static const size_t FormatTableSize = 4096;
+
+  Definition* _formats;
+  Definition* _tagsets;
+  size_t      _tagset_table_size;
+  u4          _format_count;
+  u4          _tagset_count;
+
+  // Record being built
+  char*  _buf;
+  size_t _buf_capacity;
+  size_t _pos;
+  // Bytes written by the current write operation, including definitions.
+  int    _written;
+  bool   _error;
+
+  bool append(const void* data, size_t size);
+  template <typename T> bool append_value(T value) {
+    return append(&value, sizeof(value));
+  }
+  bool append_string(const char* s);
+
+  void clear_definitions();
+  u4 define(FILE* stream, Definition* table, size_t table_size, u4* count,
+            LogBinaryFormat::RecordKind kind, const void* key, const char* text, bool compare_text);
+  u4 define_tagset(FILE* stream, const LogDecorations& decorations);
+  bool append_arguments(const char* fmt, va_list args);
+  void begin_message(u4 tagset_id, const LogDecorations& decorations, const LogDecorators& decorators,
+                     u4 format_id, const char* prefix);
+  void finish_message(FILE* stream, size_t payload_start);
+  void flush_record(FILE* stream);
+  int result() const { return _error ? -1 : _written; }
+
+ public:
+  LogBinaryWriter();
+  ~LogBinaryWriter();
+
+  // Starts a new file, forgetting all definitions written to the previous one.
+  // Returns the number of bytes written, or -1 on error.
+  int write_header(FILE* stream);
+
+  // Writes a message that is already formatted.
+  int write_text(FILE* stream, const LogDecorations& decorations, const LogDecorators& decorators,
+                 const char* msg);
+
+  // Writes a message as the id of its format string and its arguments. Falls
+  // back to writing the formatted text if an argument can not be recorded.
+  int write_message(FILE* stream, const LogDecorations& decorations, const LogDecorators& decorators,
+                    const char* prefix, const char* fmt, va_list args) ATTRIBUTE_PRINTF(6, 0);
+};
+
+// Renders a binary log file as text, with the decorators recorded for each message.
+class LogBinaryReader : public StackObj {
+ public:
+  static bool render(const char* file_name, outputStream* out, outputStream* errstream);
+};
+
+#endif // SHARE_LOGGING_LOGBINARYFORMAT_HPP
@@ -625,6 +625,10 @@ void LogConfiguration::print_command_line_help(outputStream* out) {
                                        " with a sequence of two backslashes so that the conversion can be reversed."
                                        " This option is safe to use with UTF-8 character encodings,"
                                        " but other encodings may not work.");
+  out->print_cr(" asyncmode=..      - What asynchronous logging does when its buffer is full:"
+                                       " 'drop' messages (default), 'block' the logging thread until"
+                                       " the buffer has been written out, or 'sample' one in %u messages"
+                                       " once the buffer is half full.", LogFileStreamOutput::AsyncSampleRate);
   out->cr();
 
   out->print_cr("Additional file output options:");
@@ -634,6 +638,10 @@ void LogConfiguration::print_command_line_help(outputStream* out) {
   out->print_cr(" filecount=..      - Number of files to keep in rotation (not counting the active file)."
                                        " If set to 0, log rotation is disabled."
                                        " This will cause existing log files to be overwritten.");
+  out->print_cr(" format=..         - 'text' (default) or 'binary'. A binary log file records each format"
+                                       " string once and then only the arguments of the messages, which saves"
+                                       " formatting them at the log site. Use 'jcmd <pid> VM.log render=<file>'"
+                                       " to convert it to text.");
   out->cr();
 
   out->print_cr("Asynchronous logging (off by default):");
@@ -64,6 +64,15 @@ class LogDecorations {
     _level = level;
   }
 
+  // Raw values, for outputs that store them instead of printing them.
+  jlong millis() const                { return _millis; }
+  jlong nanos() const                 { return _nanos; }
+  double elapsed_seconds() const      { return _elapsed_seconds; }
+  intx tid() const                    { return _tid; }
+  LogLevelType level() const          { return _level; }
+  const LogTagSet& tagset() const     { return _tagset; }
+  static int pid()                    { return _pid; }
+
   void print_decoration(LogDecorators::Decorator decorator, outputStream* st) const;
   const char* decoration(LogDecorators::Decorator decorator, char* buf, size_t buflen) const;
 
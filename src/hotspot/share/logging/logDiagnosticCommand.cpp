@@ -22,6 +22,7 @@
  *
  */
 #include "precompiled.hpp"
+#include "logging/logBinaryFormat.hpp"
 #include "logging/logConfiguration.hpp"
 #include "logging/logDiagnosticCommand.hpp"
 #include "memory/resourceArea.hpp"
@@ -35,7 +36,8 @@ LogDiagnosticCommand::LogDiagnosticCommand(outputStream* output, bool heap_alloc
     _decorators("decorators", "Configures which decorators to use. Use 'none' or an empty value to remove all.", "STRING", false),
     _disable("disable", "Turns off all logging and clears the log configuration.", "BOOLEAN", false),
     _list("list", "Lists current log configuration.", "BOOLEAN", false),
-    _rotate("rotate", "Rotates all logs.", "BOOLEAN", false) {
+    _rotate("rotate", "Rotates all logs.", "BOOLEAN", false),
+    _render("render", "Prints the given binary log file (see output option format=binary) as text.", "STRING", false) {
   _dcmdparser.add_dcmd_option(&_output);
   _dcmdparser.add_dcmd_option(&_output_options);
   _dcmdparser.add_dcmd_option(&_what);
@@ -43,6 +45,7 @@ LogDiagnosticCommand::LogDiagnosticCommand(outputStream* output, bool heap_alloc
   _dcmdparser.add_dcmd_option(&_disable);
   _dcmdparser.add_dcmd_option(&_list);
   _dcmdparser.add_dcmd_option(&_rotate);
+  _dcmdparser.add_dcmd_option(&_render);
 }
 
 void LogDiagnosticCommand::registerCommand() {
@@ -78,6 +81,11 @@ void LogDiagnosticCommand::execute(DCmdSource source, TRAPS) {
     any_command = true;
   }
 
+  if (_render.has_value()) {
+    LogBinaryReader::render(_render.value(), output(), output());
+    any_command = true;
+  }
+
   if (!any_command) {
     // If no argument was provided, print usage
     print_help(LogDiagnosticCommand::name());
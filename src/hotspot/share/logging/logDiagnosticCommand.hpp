@@ -35,6 +35,7 @@
 // Specifying 'disable' will disable logging completely.
 // The remaining arguments are used to set a log output to log everything
 // with the specified tags and levels using the given decorators.
+// 'render' prints a log file written with format=binary as text.
 class LogDiagnosticCommand : public DCmdWithParser {
  protected:
   DCmdArgument<char *> _output;
@@ -44,12 +45,13 @@ class LogDiagnosticCommand : public DCmdWithParser {
   DCmdArgument<bool> _disable;
   DCmdArgument<bool> _list;
   DCmdArgument<bool> _rotate;
+  DCmdArgument<char *> _render;
 
  public:
   LogDiagnosticCommand(outputStream* output, bool heap_allocated);
   void execute(DCmdSource source, TRAPS);
   static void registerCommand();
-  static int num_arguments() { return 7; }
+  static int num_arguments() { return 8; }
 
   static const char* name() {
     return "VM.log";
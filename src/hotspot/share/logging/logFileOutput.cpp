@@ -25,6 +25,7 @@
 #include "jvm.h"
 #include "logging/log.hpp"
 #include "logging/logAsyncWriter.hpp"
+#include "logging/logBinaryFormat.hpp"
 #include "logging/logConfiguration.hpp"
 #include "logging/logFileOutput.hpp"
 #include "memory/allocation.inline.hpp"
@@ -35,12 +36,14 @@
 
 const char* const LogFileOutput::Prefix = "file=";
 const char* const LogFileOutput::FileOpenMode = "a";
+const char* const LogFileOutput::BinaryFileOpenMode = "ab";
 const char* const LogFileOutput::PidFilenamePlaceholder = "%p";
 const char* const LogFileOutput::TimestampFilenamePlaceholder = "%t";
 const char* const LogFileOutput::TimestampFormat = "%Y-%m-%d_%H-%M-%S";
 const char* const LogFileOutput::HostnameFilenamePlaceholder = "%hn";
 const char* const LogFileOutput::FileSizeOptionKey = "filesize";
 const char* const LogFileOutput::FileCountOptionKey = "filecount";
+const char* const LogFileOutput::FormatOptionKey = "format";
 char        LogFileOutput::_pid_str[PidBufferSize];
 char        LogFileOutput::_vm_start_time_str[StartTimeBufferSize];
 
@@ -48,7 +51,8 @@ LogFileOutput::LogFileOutput(const char* name)
     : LogFileStreamOutput(nullptr), _name(os::strdup_check_oom(name, mtLogging)),
       _file_name(nullptr), _archive_name(nullptr), _current_file(0),
       _file_count(DefaultFileCount), _is_default_file_count(true), _archive_name_len(0),
-      _rotate_size(DefaultFileSize), _current_size(0), _rotation_semaphore(1) {
+      _rotate_size(DefaultFileSize), _current_size(0), _rotation_semaphore(1),
+      _binary_writer(nullptr) {
   assert(strstr(name, Prefix) == name, "invalid output name '%s': missing prefix: %s", name, Prefix);
   _file_name = make_file_name(name + strlen(Prefix), _pid_str, _vm_start_time_str);
 }
@@ -79,6 +83,7 @@ LogFileOutput::~LogFileOutput() {
                   _file_name, os::strerror(errno));
     }
   }
+  delete _binary_writer;
   os::free(_archive_name);
   os::free(_file_name);
   os::free(const_cast<char*>(_name));
@@ -191,6 +196,19 @@ bool LogFileOutput::set_option(const char* key, const char* value, outputStream*
         _rotate_size = static_cast<size_t>(longval);
         success = true;
       }
+    } else if (strcmp(FormatOptionKey, key) == 0) {
+      if (strcmp(value, "text") == 0) {
+        delete _binary_writer;
+        _binary_writer = nullptr;
+        success = true;
+      } else if (strcmp(value, "binary") == 0) {
+        if (_binary_writer == nullptr) {
+          _binary_writer = new LogBinaryWriter();
+        }
+        success = true;
+      } else {
+        errstream->print_cr("Invalid option: %s must be 'text' or 'binary'", FormatOptionKey);
+      }
     }
   }
   return success;
@@ -238,7 +256,7 @@ bool LogFileOutput::initialize(const char* options, outputStream* errstream) {
     increment_file_count();
   }
 
-  _stream = os::fopen(_file_name, FileOpenMode);
+  _stream = os::fopen(_file_name, is_binary() ? BinaryFileOpenMode : FileOpenMode);
   if (_stream == nullptr) {
     errstream->print_cr("Error opening log file '%s': %s",
                         _file_name, os::strerror(errno));
@@ -250,9 +268,23 @@ bool LogFileOutput::initialize(const char* options, outputStream* errstream) {
     os::ftruncate(os::get_fileno(_stream), 0);
   }
 
+  if (is_binary()) {
+    start_binary_file();
+  }
+
   return true;
 }
 
+// Every binary log file starts with a header, and repeats the definitions
+// it needs, so that each file of a rotation can be rendered on its own.
+void LogFileOutput::start_binary_file() {
+  int written = _binary_writer->write_header(_stream);
+  if (written > 0) {
+    _current_size += written;
+  }
+  flush();
+}
+
 class RotationLocker : public StackObj {
   Semaphore& _sem;
 
@@ -266,24 +298,69 @@ class RotationLocker : public StackObj {
   }
 };
 
-int LogFileOutput::write_blocking(const LogDecorations& decorations, const char* msg) {
+int LogFileOutput::write_blocking(const LogDecorations& decorations, const char* msg, bool do_flush) {
   RotationLocker lock(_rotation_semaphore);
   if (_stream == nullptr) {
     // An error has occurred with this output, avoid writing to it.
     return 0;
   }
 
-  int written = write_internal(decorations, msg);
-  // Need to flush to the filesystem before should_rotate()
-  written = flush() ? written : -1;
+  int written = write_record(decorations, msg);
   if (written > 0) {
     _current_size += written;
+  }
+  const bool rotate_now = written > 0 && should_rotate();
+  // Need to flush to the filesystem before rotating
+  if (do_flush || rotate_now) {
+    if (!flush()) {
+      return -1;
+    }
+  }
+  if (rotate_now) {
+    rotate();
+  }
 
-    if (should_rotate()) {
-      rotate();
+  return written;
+}
+
+int LogFileOutput::write_record(const LogDecorations& decorations, const char* msg) {
+  if (is_binary()) {
+    return _binary_writer->write_text(_stream, decorations, _decorators, msg);
+  }
+  return write_internal(decorations, msg);
+}
+
+int LogFileOutput::write_binary(const LogDecorations& decorations, const char* prefix, const char* fmt, va_list args) {
+  if (_stream == nullptr) {
+    // An error has occurred with this output, avoid writing to it.
+    return 0;
+  }
+
+  AsyncLogWriter* aio_writer = AsyncLogWriter::instance();
+  if (aio_writer != nullptr) {
+    // The asynchronous log buffer only holds formatted messages.
+    char* text = LogBinaryFormat::format_text(prefix, fmt, args);
+    if (text != nullptr) {
+      aio_writer->enqueue(*this, decorations, text);
+      LogBinaryFormat::free_text(text);
     }
+    return 0;
   }
 
+  RotationLocker lock(_rotation_semaphore);
+  if (_stream == nullptr) {
+    return 0;
+  }
+  int written = _binary_writer->write_message(_stream, decorations, _decorators, prefix, fmt, args);
+  if (written > 0) {
+    _current_size += written;
+  }
+  if (!flush()) {
+    return -1;
+  }
+  if (written > 0 && should_rotate()) {
+    rotate();
+  }
   return written;
 }
 
@@ -315,7 +392,20 @@ int LogFileOutput::write(LogMessageBuffer::Iterator msg_iterator) {
   }
 
   RotationLocker lock(_rotation_semaphore);
-  int written = LogFileStreamOutput::write(msg_iterator);
+  int written = 0;
+  if (is_binary()) {
+    for (; !msg_iterator.is_at_end(); msg_iterator++) {
+      int ret = write_record(msg_iterator.decorations(), msg_iterator.message());
+      if (ret > 0) {
+        written += ret;
+      }
+    }
+    if (!flush()) {
+      written = -1;
+    }
+  } else {
+    written = LogFileStreamOutput::write(msg_iterator);
+  }
   if (written > 0) {
     _current_size += written;
 
@@ -364,7 +454,7 @@ void LogFileOutput::rotate() {
   archive();
 
   // Open the active log file using the same stream as before
-  _stream = os::fopen(_file_name, FileOpenMode);
+  _stream = os::fopen(_file_name, is_binary() ? BinaryFileOpenMode : FileOpenMode);
   if (_stream == nullptr) {
     jio_fprintf(defaultStream::error_stream(), "Could not reopen file '%s' during log rotation (%s).\n",
                 _file_name, os::strerror(errno));
@@ -374,6 +464,9 @@ void LogFileOutput::rotate() {
   // Reset accumulated size, increase current file counter, and check for file count wrap-around.
   _current_size = 0;
   increment_file_count();
+  if (is_binary()) {
+    start_binary_file();
+  }
 }
 
 char* LogFileOutput::make_file_name(const char* file_name,
@@ -465,4 +558,7 @@ void LogFileOutput::describe(outputStream *out) {
              byte_size_in_proper_unit(_rotate_size),
              proper_unit_for_byte_size(_rotate_size),
              LogConfiguration::is_async_mode() ? "true" : "false");
+  if (is_binary()) {
+    out->print(",%s=binary", FormatOptionKey);
+  }
 }
@@ -28,14 +28,17 @@
 #include "runtime/semaphore.hpp"
 #include "utilities/globalDefinitions.hpp"
 
+class LogBinaryWriter;
 class LogDecorations;
 
 // The log file output, with support for file rotation based on a target size.
 class LogFileOutput : public LogFileStreamOutput {
  private:
   static const char* const FileOpenMode;
+  static const char* const BinaryFileOpenMode;
   static const char* const FileCountOptionKey;
   static const char* const FileSizeOptionKey;
+  static const char* const FormatOptionKey;
   static const char* const PidFilenamePlaceholder;
   static const char* const TimestampFilenamePlaceholder;
   static const char* const TimestampFormat;
@@ -65,8 +68,13 @@ class LogFileOutput : public LogFileStreamOutput {
   // Semaphore used for synchronizing file rotations and writes
   Semaphore _rotation_semaphore;
 
+  // Set for format=binary, see logBinaryFormat.hpp
+  LogBinaryWriter* _binary_writer;
+
   void archive();
   void rotate();
+  void start_binary_file();
+  int write_record(const LogDecorations& decorations, const char* msg);
   char *make_file_name(const char* file_name, const char* pid_string, const char* timestamp_string);
 
   bool should_rotate() {
@@ -87,10 +95,15 @@ class LogFileOutput : public LogFileStreamOutput {
   virtual bool set_option(const char* key, const char* value, outputStream* errstream);
   virtual int write(const LogDecorations& decorations, const char* msg);
   virtual int write(LogMessageBuffer::Iterator msg_iterator);
-  virtual int write_blocking(const LogDecorations& decorations, const char* msg);
+  virtual int write_blocking(const LogDecorations& decorations, const char* msg, bool do_flush = true);
   virtual void force_rotate();
   virtual void describe(outputStream* out);
 
+  virtual bool is_binary() const {
+    return _binary_writer != nullptr;
+  }
+  virtual int write_binary(const LogDecorations& decorations, const char* prefix, const char* fmt, va_list args) ATTRIBUTE_PRINTF(4, 0);
+
   virtual const char* name() const {
     return _name;
   }
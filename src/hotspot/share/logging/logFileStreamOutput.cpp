@@ -32,6 +32,9 @@
 #include "utilities/defaultStream.hpp"
 
 const char* const LogFileStreamOutput::FoldMultilinesOptionKey = "foldmultilines";
+const char* const LogFileStreamOutput::AsyncModeOptionKey = "asyncmode";
+
+static const char* const async_mode_names[] = { "drop", "block", "sample" };
 
 bool LogFileStreamOutput::set_option(const char* key, const char* value, outputStream* errstream) {
   bool success = false;
@@ -45,6 +48,16 @@ bool LogFileStreamOutput::set_option(const char* key, const char* value, outputS
     } else {
       errstream->print_cr("Invalid option: %s must be 'true' or 'false'.", key);
     }
+  } else if (strcmp(AsyncModeOptionKey, key) == 0) {
+    for (uint i = 0; i < ARRAY_SIZE(async_mode_names); i++) {
+      if (strcmp(value, async_mode_names[i]) == 0) {
+        _async_mode = static_cast<AsyncMode>(i);
+        success = true;
+      }
+    }
+    if (!success) {
+      errstream->print_cr("Invalid option: %s must be 'drop', 'block' or 'sample'.", key);
+    }
   }
   return success;
 }
@@ -146,8 +159,11 @@ int LogFileStreamOutput::write_internal(const LogDecorations& decorations, const
   return written;
 }
 
-int LogFileStreamOutput::write_blocking(const LogDecorations& decorations, const char* msg) {
+int LogFileStreamOutput::write_blocking(const LogDecorations& decorations, const char* msg, bool do_flush) {
   int written = write_internal(decorations, msg);
+  if (!do_flush) {
+    return written;
+  }
   return flush() ? written : -1;
 }
 
@@ -185,4 +201,7 @@ void LogFileStreamOutput::describe(outputStream *out) {
   out->print(" ");
 
   out->print("foldmultilines=%s", _fold_multilines ? "true" : "false");
+  if (_async_mode != AsyncDrop) {
+    out->print(",%s=%s", AsyncModeOptionKey, async_mode_names[_async_mode]);
+  }
 }
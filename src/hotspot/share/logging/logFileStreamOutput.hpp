@@ -33,16 +33,31 @@ class LogDecorations;
 
 // Base class for all FileStream-based log outputs.
 class LogFileStreamOutput : public LogOutput {
+ public:
+  // What asynchronous logging does with messages for this output when its buffer
+  // is full: drop them, block the logging thread until the buffer is drained, or,
+  // once the buffer is half full, keep only one in AsyncSampleRate messages.
+  enum AsyncMode {
+    AsyncDrop,
+    AsyncBlock,
+    AsyncSample
+  };
+  static const uint AsyncSampleRate = 8;
+
  private:
   static const char* const FoldMultilinesOptionKey;
+  static const char* const AsyncModeOptionKey;
   bool                _fold_multilines;
   bool                _write_error_is_shown;
+  AsyncMode           _async_mode;
+  uint                _async_sample_count; // protected by the AsyncLogWriter lock
 
  protected:
   FILE*               _stream;
   size_t              _decorator_padding[LogDecorators::Count];
 
-  LogFileStreamOutput(FILE *stream) : _fold_multilines(false), _write_error_is_shown(false), _stream(stream) {
+  LogFileStreamOutput(FILE *stream) : _fold_multilines(false), _write_error_is_shown(false),
+                                      _async_mode(AsyncDrop), _async_sample_count(0), _stream(stream) {
     for (size_t i = 0; i < LogDecorators::Count; i++) {
       _decorator_padding[i] = 0;
     }
@@ -56,9 +71,14 @@ class LogFileStreamOutput : public LogOutput {
   virtual bool set_option(const char* key, const char* value, outputStream* errstream);
   virtual int write(const LogDecorations& decorations, const char* msg);
   virtual int write(LogMessageBuffer::Iterator msg_iterator);
-  // Write API used by AsyncLogWriter
-  virtual int write_blocking(const LogDecorations& decorations, const char* msg);
+  // Write API used by AsyncLogWriter. It may leave the written message in the
+  // stream buffer if do_flush is false, to flush several messages together.
+  virtual int write_blocking(const LogDecorations& decorations, const char* msg, bool do_flush = true);
   virtual void describe(outputStream* out);
+
+  AsyncMode async_mode() const { return _async_mode; }
+  // Sampling decision for AsyncSample, true for the messages to keep.
+  bool sample_async_message() { return (_async_sample_count++ % AsyncSampleRate) == 0; }
 };
 
 class LogStdoutOutput : public LogFileStreamOutput {
@@ -31,6 +31,8 @@
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/ostream.hpp"
 
+#include <stdarg.h>
+
 class LogDecorations;
 class LogMessageBuffer;
 class LogSelection;
@@ -101,6 +103,16 @@ class LogOutput : public CHeapObj<mtLogging> {
   virtual bool set_option(const char* key, const char* value, outputStream* errstream) = 0;
   virtual int write(const LogDecorations& decorations, const char* msg) = 0;
   virtual int write(LogMessageBuffer::Iterator msg_iterator) = 0;
+
+  // Binary outputs record messages as their format string and arguments, so
+  // the tagset does not need to format messages logged only to such outputs.
+  virtual bool is_binary() const {
+    return false;
+  }
+  virtual int write_binary(const LogDecorations& decorations, const char* prefix, const char* fmt, va_list args) ATTRIBUTE_PRINTF(4, 0) {
+    assert(false, "not a binary output");
+    return 0;
+  }
 };
 
 #endif // SHARE_LOGGING_LOGOUTPUT_HPP
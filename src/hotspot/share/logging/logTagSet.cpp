@@ -23,6 +23,7 @@
  */
 #include "precompiled.hpp"
 #include "jvm.h"
+#include "logging/logBinaryFormat.hpp"
 #include "logging/logDecorations.hpp"
 #include "logging/logFileStreamOutput.hpp"
 #include "logging/logLevel.hpp"
@@ -49,6 +50,9 @@ LogTagSet::LogTagSet(PrefixWriter prefix_writer, LogTagType t0, LogTagType t1, L
   _tag[4] = t4;
   for (_ntags = 0; _ntags < LogTag::MaxTags && _tag[_ntags] != LogTag::__NO_TAG; _ntags++) {
   }
+  for (size_t i = 0; i < LogLevel::Count; i++) {
+    _binary_only[i] = false;
+  }
   _list = this;
   _ntagsets++;
 }
@@ -59,6 +63,15 @@ void LogTagSet::update_decorators(const LogDecorators& decorator) {
     new_decorators.combine_with((*it)->decorators());
   }
   _decorators = new_decorators;
+
+  for (size_t i = LogLevel::First; i <= LogLevel::Last; i++) {
+    LogLevelType level = static_cast<LogLevelType>(i);
+    bool binary_only = is_level(level);
+    for (LogOutputList::Iterator it = _output_list.iterator(level); it != _output_list.end(); it++) {
+      binary_only = binary_only && (*it)->is_binary();
+    }
+    _binary_only[i] = binary_only;
+  }
 }
 
 bool LogTagSet::has_output(const LogOutput* output) {
@@ -84,6 +97,35 @@ void LogTagSet::log(LogLevelType level, const char* msg) {
   }
 }
 
+const size_t vwrite_buffer_size = 512;
+
+// Writes a message to outputs that record the format string and arguments
+// instead of the formatted message. Outputs that do not (the set of outputs
+// may change concurrently) get the message formatted on demand.
+void LogTagSet::log_binary(LogLevelType level, const char* fmt, va_list args) {
+  LogOutputList::Iterator it = _output_list.iterator(level);
+  LogDecorations decorations(level, *this, _decorators);
+  char prefix[vwrite_buffer_size];
+  size_t prefix_len = _write_prefix(prefix, sizeof(prefix));
+  prefix[MIN2(prefix_len, sizeof(prefix) - 1)] = '\0';
+  char* text = nullptr;
+
+  for (; it != _output_list.end(); it++) {
+    va_list copy;
+    va_copy(copy, args);
+    if ((*it)->is_binary()) {
+      (*it)->write_binary(decorations, prefix, fmt, copy);
+    } else {
+      if (text == nullptr) {
+        text = LogBinaryFormat::format_text(prefix, fmt, copy);
+      }
+      (*it)->write(decorations, text != nullptr ? text : "Log message buffer issue, native OOM");
+    }
+    va_end(copy);
+  }
+  LogBinaryFormat::free_text(text);
+}
+
 void LogTagSet::log(const LogMessageBuffer& msg) {
   LogOutputList::Iterator it = _output_list.iterator(msg.least_detailed_level());
   LogDecorations decorations(LogLevel::Invalid, *this, _decorators);
@@ -116,10 +158,12 @@ void LogTagSet::write(LogLevelType level, const char* fmt, ...) {
   va_end(args);
 }
 
-const size_t vwrite_buffer_size = 512;
-
 void LogTagSet::vwrite(LogLevelType level, const char* fmt, va_list args) {
   assert(level >= LogLevel::First && level <= LogLevel::Last, "Log level:%d is incorrect", level);
+  if (_binary_only[level]) {
+    log_binary(level, fmt, args);
+    return;
+  }
   char buf[vwrite_buffer_size];
   va_list saved_args;           // For re-format on buf overflow.
   va_copy(saved_args, args);
@@ -49,10 +49,14 @@ class LogTagSet {
 
   LogOutputList _output_list;
   LogDecorators _decorators;
+  // Set for the levels that only have binary outputs, see update_decorators().
+  bool _binary_only[LogLevel::Count];
 
   typedef size_t (*PrefixWriter)(char* buf, size_t size);
   PrefixWriter _write_prefix;
 
+  void log_binary(LogLevelType level, const char* fmt, va_list args) ATTRIBUTE_PRINTF(3, 0);
+
   // Keep constructor private to prevent incorrect instantiations of this class.
   // Only LogTagSetMappings can create/contain instances of this class.
   // The constructor links all tagsets together in a global list of tagsets.
@@ -117,7 +121,8 @@ class LogTagSet {
   }
 
   // Refresh the decorators for this tagset to contain the decorators for all
-  // of its current outputs combined with the given decorators.
+  // of its current outputs combined with the given decorators. Also refreshes
+  // the levels for which messages are only written to binary outputs.
   void update_decorators(const LogDecorators& decorator = LogDecorators::None);
 
   void label(outputStream* st, const char* separator = ",") const;
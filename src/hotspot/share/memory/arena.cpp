@@ -30,6 +30,7 @@
 #include "memory/arena.hpp"
 #include "memory/resourceArea.hpp"
 #include "nmt/memTracker.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/os.hpp"
 #include "runtime/task.hpp"
 #include "runtime/threadCritical.hpp"
@@ -43,6 +44,7 @@ STATIC_ASSERT(is_aligned((int)Chunk::tiny_size, ARENA_AMALLOC_ALIGNMENT));
 STATIC_ASSERT(is_aligned((int)Chunk::init_size, ARENA_AMALLOC_ALIGNMENT));
 STATIC_ASSERT(is_aligned((int)Chunk::medium_size, ARENA_AMALLOC_ALIGNMENT));
 STATIC_ASSERT(is_aligned((int)Chunk::size, ARENA_AMALLOC_ALIGNMENT));
+STATIC_ASSERT(is_aligned((int)Chunk::large_size, ARENA_AMALLOC_ALIGNMENT));
 
 
 const char* Arena::tag_name[] = {
@@ -59,16 +61,44 @@ const char* Arena::tag_desc[] = {
 
 // MT-safe pool of same-sized chunks to reduce malloc/free thrashing
 // NB: not using Mutex because pools are used before Threads are initialized
+//
+// With ArenaThreadChunkCacheSize, each thread also keeps a few free chunks of
+// each pool size, so that threads allocating and freeing chunks at high rates
+// do not contend on the ThreadCritical lock. The chunk pool cleaner bumps an
+// epoch, and a thread returns its cached chunks to the pools the next time it
+// uses its cache in a new epoch. An exiting thread returns its cached chunks
+// and stops caching, since it may still free chunks after that.
 class ChunkPool {
-  // Our four static pools
-  static constexpr int _num_pools = 4;
+  // Our five static pools
+  static constexpr int _num_pools = 5;
   static ChunkPool _pools[_num_pools];
 
+  struct ThreadCache {
+    Chunk* _first[_num_pools];
+    uint   _count[_num_pools];
+    uint   _epoch;
+    bool   _disabled;
+  };
+  static THREAD_LOCAL ThreadCache _thread_cache;
+  static volatile uint _epoch;
+
   Chunk*       _first;
   const size_t _size;         // (inner payload) size of the chunks this pool serves
 
+  int index() const { return (int)(this - _pools); }
+
   // Returns null if pool is empty.
   Chunk* take_from_pool() {
+    if (ArenaThreadChunkCacheSize > 0 && !_thread_cache._disabled) {
+      flush_thread_cache_if_stale();
+      const int i = index();
+      Chunk* c = _thread_cache._first[i];
+      if (c != nullptr) {
+        _thread_cache._first[i] = c->next();
+        _thread_cache._count[i]--;
+        return c;
+      }
+    }
     ThreadCritical tc;
     Chunk* c = _first;
     if (_first != nullptr) {
@@ -78,11 +108,47 @@ class ChunkPool {
   }
   void return_to_pool(Chunk* chunk) {
     assert(chunk->length() == _size, "wrong pool for this chunk");
+    if (ArenaThreadChunkCacheSize > 0 && !_thread_cache._disabled) {
+      flush_thread_cache_if_stale();
+      const int i = index();
+      if (_thread_cache._count[i] < ArenaThreadChunkCacheSize) {
+        chunk->set_next(_thread_cache._first[i]);
+        _thread_cache._first[i] = chunk;
+        _thread_cache._count[i]++;
+        return;
+      }
+    }
     ThreadCritical tc;
     chunk->set_next(_first);
     _first = chunk;
   }
 
+  // Return all chunks of this pool cached by the current thread
+  void return_thread_cache() {
+    const int i = index();
+    Chunk* first = _thread_cache._first[i];
+    if (first == nullptr) {
+      return;
+    }
+    Chunk* last = first;
+    while (last->next() != nullptr) {
+      last = last->next();
+    }
+    _thread_cache._first[i] = nullptr;
+    _thread_cache._count[i] = 0;
+    ThreadCritical tc;
+    last->set_next(_first);
+    _first = first;
+  }
+
+  static void flush_thread_cache_if_stale() {
+    const uint epoch = Atomic::load(&_epoch);
+    if (_thread_cache._epoch != epoch) {
+      flush_thread_cache();
+      _thread_cache._epoch = epoch;
+    }
+  }
+
   // Clear this pool of all contained chunks
   void prune() {
     // Free all chunks while in ThreadCritical lock
@@ -113,11 +179,23 @@ class ChunkPool {
 
   static void clean() {
     NativeHeapTrimmer::SuspendMark sm("chunk pool cleaner");
+    // Have the thread caches returned, they are pruned by the next clean.
+    Atomic::inc(&_epoch);
     for (int i = 0; i < _num_pools; i++) {
       _pools[i].prune();
     }
   }
 
+  static void flush_thread_cache() {
+    for (int i = 0; i < _num_pools; i++) {
+      _pools[i].return_thread_cache();
+    }
+  }
+
+  static void set_thread_cache_disabled(bool disabled) {
+    _thread_cache._disabled = disabled;
+  }
+
   // Returns an initialized and null-terminated Chunk of requested size
   static Chunk* allocate_chunk(size_t length, AllocFailType alloc_failmode);
   static void deallocate_chunk(Chunk* p);
@@ -180,7 +258,9 @@ void ChunkPool::deallocate_chunk(Chunk* c) {
   }
 }
 
-ChunkPool ChunkPool::_pools[] = { Chunk::size, Chunk::medium_size, Chunk::init_size, Chunk::tiny_size };
+ChunkPool ChunkPool::_pools[] = { Chunk::large_size, Chunk::size, Chunk::medium_size, Chunk::init_size, Chunk::tiny_size };
+THREAD_LOCAL ChunkPool::ThreadCache ChunkPool::_thread_cache;
+volatile uint ChunkPool::_epoch = 0;
 
 class ChunkPoolCleaner : public PeriodicTask {
   static const int cleaning_interval = 5000; // cleaning interval in ms
@@ -202,6 +282,19 @@ void Arena::start_chunk_pool_cleaner_task() {
   cleaner->enroll();
 }
 
+void Arena::flush_thread_chunk_cache() {
+  if (ArenaThreadChunkCacheSize > 0) {
+    ChunkPool::set_thread_cache_disabled(true);
+    ChunkPool::flush_thread_cache();
+  }
+}
+
+void Arena::enable_thread_chunk_cache() {
+  if (ArenaThreadChunkCacheSize > 0) {
+    ChunkPool::set_thread_cache_disabled(false);
+  }
+}
+
 Chunk::Chunk(size_t length) : _len(length) {
   _next = nullptr;         // Chain on the linked list
 }
@@ -285,6 +378,11 @@ void* Arena::grow(size_t x, AllocFailType alloc_failmode) {
   // Get minimal required size.  Either real big, or even bigger for giant objs
   // (Note: all chunk sizes have to be 64-bit aligned)
   size_t len = MAX2(ARENA_ALIGN(x), (size_t) Chunk::size);
+  // Arenas that have already grown by several default sized chunks are likely
+  // to grow a lot more, as for large compilations. Grow them in larger steps.
+  if (ArenaGrowLargeChunks && size_in_bytes() >= 8 * Chunk::size) {
+    len = MAX2(len, (size_t) Chunk::large_size);
+  }
 
   if (MemTracker::check_exceeds_limit(x, _mem_tag)) {
     return nullptr;
@@ -66,7 +66,8 @@ class Chunk {
     tiny_size  =  256  - slack, // Size of first chunk (tiny)
     init_size  =  1*K  - slack, // Size of first chunk (normal aka small)
     medium_size= 10*K  - slack, // Size of medium-sized chunk
-    size       = 32*K  - slack  // Default size of an Arena chunk (following the first)
+    size       = 32*K  - slack, // Default size of an Arena chunk (following the first)
+    large_size = 256*K - slack  // Size of the chunks large arenas grow by, see ArenaGrowLargeChunks
   };
 
   static void chop(Chunk* chunk);                  // Chop this chunk
@@ -138,6 +139,11 @@ class Arena : public CHeapObjBase {
  public:
   // Start the chunk_pool cleaner task
   static void start_chunk_pool_cleaner_task();
+  // Return the chunks cached by the current thread to the chunk pools, and
+  // stop caching chunks for it. Called when the thread exits or detaches.
+  static void flush_thread_chunk_cache();
+  // Let the current thread cache chunks again, after it (re)attaches.
+  static void enable_thread_chunk_cache();
   Arena(MemTag mem_tag, Tag tag = Tag::tag_other, size_t init_size = Chunk::init_size);
   ~Arena();
   void  destruct_contents();
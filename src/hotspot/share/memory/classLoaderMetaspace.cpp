@@ -36,6 +36,7 @@
 #include "memory/metaspace/metaspaceStatistics.hpp"
 #include "memory/metaspace/runningCounters.hpp"
 #include "memory/metaspaceTracer.hpp"
+#include "runtime/globals.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "utilities/debug.hpp"
 
@@ -48,14 +49,24 @@ using metaspace::InternalStats;
 #define LOGFMT         "CLMS @" PTR_FORMAT " "
 #define LOGFMT_ARGS    p2i(this)
 
+// The small arenas of hidden class and reflection loaders come and go in large
+// numbers. With -XX:+MetaspaceMicroArenas they take their chunks from separate
+// chunk managers, see MetaspaceContext.
+static bool use_micro_arena(Metaspace::MetaspaceType space_type) {
+  return MetaspaceMicroArenas &&
+         (space_type == Metaspace::ClassMirrorHolderMetaspaceType ||
+          space_type == Metaspace::ReflectionMetaspaceType);
+}
+
 ClassLoaderMetaspace::ClassLoaderMetaspace(Mutex* lock, Metaspace::MetaspaceType space_type) :
   _lock(lock),
   _space_type(space_type),
   _non_class_space_arena(nullptr),
   _class_space_arena(nullptr)
 {
+  const bool micro = use_micro_arena(space_type);
   ChunkManager* const non_class_cm =
-          ChunkManager::chunkmanager_nonclass();
+          micro ? ChunkManager::chunkmanager_micro_nonclass() : ChunkManager::chunkmanager_nonclass();
 
   // Initialize non-class Arena
   _non_class_space_arena = new MetaspaceArena(
@@ -67,7 +78,7 @@ ClassLoaderMetaspace::ClassLoaderMetaspace(Mutex* lock, Metaspace::MetaspaceType
   // If needed, initialize class arena
   if (Metaspace::using_class_space()) {
     ChunkManager* const class_cm =
-            ChunkManager::chunkmanager_class();
+            micro ? ChunkManager::chunkmanager_micro_class() : ChunkManager::chunkmanager_class();
     _class_space_arena = new MetaspaceArena(
         class_cm,
         ArenaGrowthPolicy::policy_for_space_type(space_type, true),
@@ -650,7 +650,8 @@ void CodeHeap::add_to_freelist(HeapBlock* a) {
 }
 
 /**
- * Search freelist for an entry on the list with the best fit.
+ * Search freelist for an entry on the list with the best fit, or with
+ * CodeCacheFirstFitAllocation, the first (lowest-addressed) fitting entry.
  * @return null, if no one was found
  */
 HeapBlock* CodeHeap::search_freelist(size_t length) {
@@ -678,6 +679,13 @@ HeapBlock* CodeHeap::search_freelist(size_t length) {
       found_block  = cur;
       found_prev   = prev;
       found_length = cur_length;
+      if (CodeCacheFirstFitAllocation) {
+        // The freelist is sorted by address, so this is the lowest block that
+        // fits. Reusing holes at low addresses keeps the code compact and
+        // slows the growth of the heap top, reducing the number of pages
+        // (and iTLB entries) the live code is spread across.
+        break;
+      }
     }
     // Next element in list
     prev = cur;
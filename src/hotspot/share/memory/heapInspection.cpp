@@ -138,6 +138,15 @@ KlassInfoEntry* KlassInfoBucket::lookup(Klass* const k) {
   return elt;
 }
 
+KlassInfoEntry* KlassInfoBucket::find(const Klass* k) const {
+  for (KlassInfoEntry* elt = _list; elt != nullptr; elt = elt->next()) {
+    if (elt->is_equal(k)) {
+      return elt;
+    }
+  }
+  return nullptr;
+}
+
 void KlassInfoBucket::iterate(KlassInfoClosure* cic) {
   KlassInfoEntry* elt = _list;
   while (elt != nullptr) {
@@ -273,6 +282,40 @@ bool KlassInfoTable::merge(KlassInfoTable* table) {
   return closure.success();
 }
 
+// Return false if the klass of the entry is not in this table. The klass
+// is only compared, it may have been unloaded since the entry was created.
+bool KlassInfoTable::merge_known_entry(const KlassInfoEntry* cie) {
+  Klass* k = cie->klass();
+  KlassInfoEntry* elt = _buckets[hash(k) % _num_buckets].find(k);
+  if (elt != nullptr) {
+    elt->set_count(elt->count() + cie->count());
+    elt->set_words(elt->words() + cie->words());
+    _size_of_instances_in_words += cie->words();
+    return true;
+  }
+  return false;
+}
+
+class KlassInfoTableMergeKnownClosure : public KlassInfoClosure {
+private:
+  KlassInfoTable* _dest;
+  uint64_t _unknown_count;
+public:
+  KlassInfoTableMergeKnownClosure(KlassInfoTable* table) : _dest(table), _unknown_count(0) {}
+  void do_cinfo(KlassInfoEntry* cie) {
+    if (!_dest->merge_known_entry(cie)) {
+      _unknown_count += cie->count();
+    }
+  }
+  uint64_t unknown_count() const { return _unknown_count; }
+};
+
+uint64_t KlassInfoTable::merge_known(KlassInfoTable* table) {
+  KlassInfoTableMergeKnownClosure closure(this);
+  table->iterate(&closure);
+  return closure.unknown_count();
+}
+
 int KlassInfoHisto::sort_helper(KlassInfoEntry** e1, KlassInfoEntry** e2) {
   return (*e1)->compare(*e1,*e2);
 }
@@ -611,6 +654,156 @@ void HeapInspection::heap_inspection(outputStream* st, WorkerThreads* workers) {
   st->flush();
 }
 
+IncrementalHeapInspection::IncrementalHeapInspection() :
+  _cit(false),
+  _next_part(0),
+  _num_parts(Universe::heap()->object_iterate_parts()),
+  _missed_count(0),
+  _start_gc_count(Universe::heap()->total_collections()),
+  _steps(0),
+  _failed(_cit.allocation_failed()) {}
+
+bool IncrementalHeapInspection::is_supported() {
+  return Universe::heap()->object_iterate_parts() > 0;
+}
+
+// Walks heap parts for one step of an incremental inspection. Workers claim
+// parts until all are claimed or the deadline has passed.
+class IncrementalHeapInspectTask : public WorkerTask {
+ private:
+  KlassInfoTable* _shared_cit;
+  volatile uint _next_part;
+  const uint _num_parts;
+  const jlong _deadline;
+  uintx _missed_count;
+  bool _success;
+  Mutex _mutex;
+
+ public:
+  IncrementalHeapInspectTask(KlassInfoTable* shared_cit, uint next_part, uint num_parts, jlong deadline) :
+      WorkerTask("Iterating heap parts"),
+      _shared_cit(shared_cit),
+      _next_part(next_part),
+      _num_parts(num_parts),
+      _deadline(deadline),
+      _missed_count(0),
+      _success(true),
+      _mutex(Mutex::nosafepoint, "IncrementalHeapInspectTask_lock") {}
+
+  uintx missed_count() const {
+    return _missed_count;
+  }
+
+  bool success() const {
+    return _success;
+  }
+
+  // All claimed parts have been walked when the task is done.
+  uint next_part() const {
+    return MIN2(Atomic::load(&_next_part), _num_parts);
+  }
+
+  virtual void work(uint worker_id) {
+    KlassInfoTable cit(false);
+    if (cit.allocation_failed()) {
+      Atomic::store(&_success, false);
+      return;
+    }
+    RecordInstanceClosure ric(&cit, nullptr);
+    CollectedHeap* heap = Universe::heap();
+    while (Atomic::load(&_success) && os::javaTimeNanos() < _deadline) {
+      uint part = Atomic::fetch_then_add(&_next_part, 1u);
+      if (part >= _num_parts) {
+        break;
+      }
+      heap->object_iterate_part(&ric, part);
+    }
+    bool merge_success;
+    {
+      MutexLocker x(&_mutex, Mutex::_no_safepoint_check_flag);
+      merge_success = _shared_cit->merge(&cit);
+    }
+    if (merge_success) {
+      Atomic::add(&_missed_count, ric.missed_count());
+    } else {
+      Atomic::store(&_success, false);
+    }
+  }
+};
+
+class NonEmptyHistoClosure : public KlassInfoClosure {
+ private:
+  KlassInfoHisto* _cih;
+ public:
+  NonEmptyHistoClosure(KlassInfoHisto* cih) : _cih(cih) {}
+
+  void do_cinfo(KlassInfoEntry* cie) {
+    if (cie->count() > 0) {
+      _cih->add(cie);
+    }
+  }
+};
+
+void HeapInspection::incremental_step(IncrementalHeapInspection* inspection, outputStream* st,
+                                      WorkerThreads* workers, jlong max_pause_millis) {
+  assert(SafepointSynchronize::is_at_safepoint(), "all threads are stopped");
+  if (inspection->is_done()) {
+    return;
+  }
+
+  const jlong deadline = os::javaTimeNanos() + max_pause_millis * NANOSECS_PER_MILLISEC;
+  IncrementalHeapInspectTask task(&inspection->_cit, inspection->_next_part, inspection->_num_parts, deadline);
+  if (workers != nullptr) {
+    workers->run_task(&task);
+  } else {
+    task.work(0);
+  }
+  inspection->_steps++;
+  inspection->_next_part = task.next_part();
+  inspection->_missed_count += task.missed_count();
+  if (!task.success()) {
+    inspection->_failed = true;
+    st->print_cr("ERROR: Ran out of C-heap; histogram not generated");
+    st->flush();
+    return;
+  }
+  if (!inspection->is_done()) {
+    return;
+  }
+
+  // Classes may have been unloaded between the steps, only report the
+  // classes that are still loaded.
+  ResourceMark rm;
+  KlassInfoTable cit(true);
+  if (cit.allocation_failed()) {
+    st->print_cr("ERROR: Ran out of C-heap; histogram not generated");
+    st->flush();
+    return;
+  }
+  uint64_t unloaded_count = cit.merge_known(&inspection->_cit);
+  if (inspection->_missed_count != 0) {
+    log_info(gc, classhisto)("WARNING: Ran out of C-heap; undercounted " UINTX_FORMAT
+                             " total instances in data below",
+                             inspection->_missed_count);
+  }
+
+  KlassInfoHisto histo(&cit);
+  NonEmptyHistoClosure hc(&histo);
+  cit.iterate(&hc);
+  histo.sort();
+  histo.print_histo_on(st);
+
+  const uint gc_count = Universe::heap()->total_collections() - inspection->_start_gc_count;
+  st->print_cr("Incremental inspection in %u steps", inspection->_steps);
+  if (gc_count > 0) {
+    st->print_cr("%u GCs during the inspection; objects moved by them may be missed or counted twice", gc_count);
+  }
+  if (unloaded_count > 0) {
+    st->print_cr(UINT64_FORMAT " instances of classes unloaded during the inspection are not shown", unloaded_count);
+  }
+  st->flush();
+}
+
 class FindInstanceClosure : public ObjectClosure {
  private:
   Klass* _klass;
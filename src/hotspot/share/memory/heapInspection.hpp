@@ -97,6 +97,7 @@ class KlassInfoBucket: public CHeapObj<mtInternal> {
   void set_list(KlassInfoEntry* l) { _list = l; }
  public:
   KlassInfoEntry* lookup(Klass* k);
+  KlassInfoEntry* find(const Klass* k) const; // does not allocate or dereference k
   void initialize() { _list = nullptr; }
   void empty();
   void iterate(KlassInfoClosure* cic);
@@ -126,6 +127,10 @@ class KlassInfoTable: public StackObj {
   size_t size_of_instances_in_words() const;
   bool merge(KlassInfoTable* table);
   bool merge_entry(const KlassInfoEntry* cie);
+  // Merges the entries for the classes already in this table, returns the
+  // number of instances of the other classes, which might have been unloaded.
+  uint64_t merge_known(KlassInfoTable* table);
+  bool merge_known_entry(const KlassInfoEntry* cie);
 
   friend class KlassInfoHisto;
   friend class KlassHierarchy;
@@ -190,18 +195,48 @@ class KlassInfoHisto : public StackObj {
   void sort();
 };
 
+// State of an incremental heap inspection, kept by the requesting thread
+// between the safepoints of HeapInspection::incremental_step().
+class IncrementalHeapInspection : public StackObj {
+  friend class HeapInspection;
+
+  KlassInfoTable _cit;
+  uint  _next_part;
+  const uint _num_parts;
+  uintx _missed_count;
+  uint  _start_gc_count;
+  uint  _steps;
+  bool  _failed;
+
+ public:
+  IncrementalHeapInspection();
+
+  // Whether the heap can be inspected incrementally.
+  static bool is_supported();
+
+  bool is_done() const {
+    return _failed || _next_part >= _num_parts;
+  }
+};
+
 #endif // INCLUDE_SERVICES
 
 // These declarations are needed since the declaration of KlassInfoTable and
 // KlassInfoClosure are guarded by #if INLCUDE_SERVICES
 class KlassInfoTable;
 class KlassInfoClosure;
+class IncrementalHeapInspection;
 
 class HeapInspection : public StackObj {
  public:
   void heap_inspection(outputStream* st, WorkerThreads* workers) NOT_SERVICES_RETURN;
   uintx populate_table(KlassInfoTable* cit, BoolObjectClosure* filter, WorkerThreads* workers) NOT_SERVICES_RETURN_(0);
   static void find_instances_at_safepoint(Klass* k, GrowableArray<oop>* result) NOT_SERVICES_RETURN;
+  // Walks the next parts of the heap for an incremental inspection (see
+  // CollectedHeap::object_iterate_parts()) for about max_pause_millis, and
+  // prints the histogram once all parts have been walked. At a safepoint.
+  static void incremental_step(IncrementalHeapInspection* inspection, outputStream* st,
+                               WorkerThreads* workers, jlong max_pause_millis) NOT_SERVICES_RETURN;
 };
 
 // Parallel heap inspection task. Parallel inspection can fail due to
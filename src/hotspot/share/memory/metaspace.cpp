@@ -238,18 +238,24 @@ void MetaspaceUtils::print_on(outputStream* out) {
 void MetaspaceUtils::verify() {
   if (Metaspace::initialized()) {
 
-    // Verify non-class chunkmanager...
+    // Verify non-class chunkmanager(s)...
     ChunkManager* cm = ChunkManager::chunkmanager_nonclass();
     cm->verify();
+    if (ChunkManager::chunkmanager_micro_nonclass() != nullptr) {
+      ChunkManager::chunkmanager_micro_nonclass()->verify();
+    }
 
     // ... and space list.
     VirtualSpaceList* vsl = VirtualSpaceList::vslist_nonclass();
     vsl->verify();
 
     if (Metaspace::using_class_space()) {
-      // If we use compressed class pointers, verify class chunkmanager...
+      // If we use compressed class pointers, verify class chunkmanager(s)...
       cm = ChunkManager::chunkmanager_class();
       cm->verify();
+      if (ChunkManager::chunkmanager_micro_class() != nullptr) {
+        ChunkManager::chunkmanager_micro_class()->verify();
+      }
 
       // ... and class spacelist.
       vsl = VirtualSpaceList::vslist_class();
@@ -967,11 +973,19 @@ void Metaspace::purge(bool classes_unloaded) {
     if (cm != nullptr) {
       cm->purge();
     }
+    cm = ChunkManager::chunkmanager_micro_nonclass();
+    if (cm != nullptr) {
+      cm->purge();
+    }
     if (using_class_space()) {
       cm = ChunkManager::chunkmanager_class();
       if (cm != nullptr) {
         cm->purge();
       }
+      cm = ChunkManager::chunkmanager_micro_class();
+      if (cm != nullptr) {
+        cm->purge();
+      }
     }
   }
 
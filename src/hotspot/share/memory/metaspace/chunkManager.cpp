@@ -387,6 +387,14 @@ ChunkManager* ChunkManager::chunkmanager_nonclass() {
   return MetaspaceContext::context_nonclass() == nullptr ? nullptr : MetaspaceContext::context_nonclass()->cm();
 }
 
+ChunkManager* ChunkManager::chunkmanager_micro_class() {
+  return MetaspaceContext::context_class() == nullptr ? nullptr : MetaspaceContext::context_class()->micro_cm();
+}
+
+ChunkManager* ChunkManager::chunkmanager_micro_nonclass() {
+  return MetaspaceContext::context_nonclass() == nullptr ? nullptr : MetaspaceContext::context_nonclass()->micro_cm();
+}
+
 // Calculates the total number of committed words over all chunks. Walks chunks.
 size_t ChunkManager::calc_committed_word_size() const {
   MutexLocker fcl(Metaspace_lock, Mutex::_no_safepoint_check_flag);
@@ -177,6 +177,11 @@ class ChunkManager : public CHeapObj<mtMetaspace> {
   static ChunkManager* chunkmanager_class();
   static ChunkManager* chunkmanager_nonclass();
 
+  // Same for the chunkmanagers of micro arenas (see MetaspaceContext);
+  //  null unless -XX:+MetaspaceMicroArenas.
+  static ChunkManager* chunkmanager_micro_class();
+  static ChunkManager* chunkmanager_micro_nonclass();
+
 };
 
 } // namespace metaspace
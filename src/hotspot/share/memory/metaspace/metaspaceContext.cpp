@@ -28,6 +28,7 @@
 #include "memory/metaspace/commitLimiter.hpp"
 #include "memory/metaspace/metaspaceContext.hpp"
 #include "memory/metaspace/virtualSpaceList.hpp"
+#include "runtime/globals.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/ostream.hpp"
@@ -44,22 +45,27 @@ MetaspaceContext* MetaspaceContext::_nonclass_space_context = nullptr;
 //  never deleted. This code only exists for the sake of tests and for future reuse
 //  of metaspace contexts in different scenarios.
 MetaspaceContext::~MetaspaceContext() {
+  delete _micro_cm;
   delete _cm;
   delete _vslist;
 }
 
+ChunkManager* MetaspaceContext::create_micro_chunk_manager(VirtualSpaceList* vslist) {
+  return MetaspaceMicroArenas ? new ChunkManager("micro arenas", vslist) : nullptr;
+}
+
 // Create a new, empty, expandable metaspace context.
 MetaspaceContext* MetaspaceContext::create_expandable_context(const char* name, CommitLimiter* commit_limiter) {
   VirtualSpaceList* vsl = new VirtualSpaceList(name, commit_limiter);
   ChunkManager* cm = new ChunkManager(name, vsl);
-  return new MetaspaceContext(name, vsl, cm);
+  return new MetaspaceContext(name, vsl, cm, create_micro_chunk_manager(vsl));
 }
 
 // Create a new, empty, non-expandable metaspace context atop of an externally provided space.
 MetaspaceContext* MetaspaceContext::create_nonexpandable_context(const char* name, ReservedSpace rs, CommitLimiter* commit_limiter) {
   VirtualSpaceList* vsl = new VirtualSpaceList(name, rs, commit_limiter);
   ChunkManager* cm = new ChunkManager(name, vsl);
-  return new MetaspaceContext(name, vsl, cm);
+  return new MetaspaceContext(name, vsl, cm, create_micro_chunk_manager(vsl));
 }
 
 void MetaspaceContext::initialize_class_space_context(ReservedSpace rs) {
@@ -73,12 +79,18 @@ void MetaspaceContext::initialize_nonclass_space_context() {
 void MetaspaceContext::print_on(outputStream* st) const {
   _vslist->print_on(st);
   _cm->print_on(st);
+  if (_micro_cm != nullptr) {
+    _micro_cm->print_on(st);
+  }
 }
 
 #ifdef ASSERT
 void MetaspaceContext::verify() const {
   _vslist->verify();
   _cm->verify();
+  if (_micro_cm != nullptr) {
+    _micro_cm->verify();
+  }
 }
 #endif // ASSERT
 
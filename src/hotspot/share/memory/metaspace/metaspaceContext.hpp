@@ -42,6 +42,11 @@ class CommitLimiter;
 //
 // - a VirtualSpaceList managing a memory area used for Metaspace
 // - a ChunkManager sitting atop of that which manages chunk freelists
+// - optionally (-XX:+MetaspaceMicroArenas), a second ChunkManager atop of the same
+//   VirtualSpaceList for the small, short-lived arenas of hidden class and reflection
+//   loaders. Since every root chunk belongs to one ChunkManager, the chunks of these
+//   "micro arenas" are never interleaved with those of long-lived loaders and merge
+//   back into whole, uncommittable chunks once the micro arenas are gone.
 //
 // In a normal VM only one or two of these contexts ever exist: one for the metaspace, and
 //  optionally another one for the compressed class space.
@@ -61,13 +66,17 @@ class MetaspaceContext : public CHeapObj<mtMetaspace> {
   const char* const _name;
   VirtualSpaceList* const _vslist;
   ChunkManager* const _cm;
+  ChunkManager* const _micro_cm;
 
-  MetaspaceContext(const char* name, VirtualSpaceList* vslist, ChunkManager* cm) :
+  MetaspaceContext(const char* name, VirtualSpaceList* vslist, ChunkManager* cm, ChunkManager* micro_cm) :
     _name(name),
     _vslist(vslist),
-    _cm(cm)
+    _cm(cm),
+    _micro_cm(micro_cm)
   {}
 
+  static ChunkManager* create_micro_chunk_manager(VirtualSpaceList* vslist);
+
   static MetaspaceContext* _nonclass_space_context;
   static MetaspaceContext* _class_space_context;
 
@@ -81,6 +90,9 @@ class MetaspaceContext : public CHeapObj<mtMetaspace> {
   VirtualSpaceList* vslist() { return _vslist; }
   ChunkManager* cm() { return _cm; }
 
+  // The ChunkManager for micro arenas; null unless -XX:+MetaspaceMicroArenas.
+  ChunkManager* micro_cm() { return _micro_cm; }
+
   // Create a new, empty, expandable metaspace context.
   static MetaspaceContext* create_expandable_context(const char* name, CommitLimiter* commit_limiter);
 
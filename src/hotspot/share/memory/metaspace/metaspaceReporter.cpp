@@ -162,15 +162,14 @@ void MetaspaceReporter::print_basic_report(outputStream* out, size_t scale) {
   if (Metaspace::using_class_space()) {
     out->print("   Non-Class:  ");
   }
-  print_scaled_words(out, ChunkManager::chunkmanager_nonclass()->total_word_size(), scale);
+  print_scaled_words(out, RunningCounters::free_chunks_words_nonclass(), scale);
   out->cr();
   if (Metaspace::using_class_space()) {
     out->print("       Class:  ");
-    print_scaled_words(out, ChunkManager::chunkmanager_class()->total_word_size(), scale);
+    print_scaled_words(out, RunningCounters::free_chunks_words_class(), scale);
     out->cr();
     out->print("        Both:  ");
-    print_scaled_words(out, ChunkManager::chunkmanager_nonclass()->total_word_size() +
-                            ChunkManager::chunkmanager_class()->total_word_size(), scale);
+    print_scaled_words(out, RunningCounters::free_chunks_words(), scale);
     out->cr();
   }
   out->cr();
@@ -278,7 +277,6 @@ void MetaspaceReporter::print_report(outputStream* out, size_t scale, int flags)
   ChunkManagerStats class_cm_stat;
   ChunkManagerStats total_cm_stat;
 
-  ChunkManager::chunkmanager_nonclass()->add_to_statistics(&non_class_cm_stat);
   if (Metaspace::using_class_space()) {
     ChunkManager::chunkmanager_nonclass()->add_to_statistics(&non_class_cm_stat);
     ChunkManager::chunkmanager_class()->add_to_statistics(&class_cm_stat);
@@ -296,10 +294,34 @@ void MetaspaceReporter::print_report(outputStream* out, size_t scale, int flags)
     out->cr();
   } else {
     ChunkManager::chunkmanager_nonclass()->add_to_statistics(&non_class_cm_stat);
+    total_cm_stat.add(non_class_cm_stat);
     non_class_cm_stat.print_on(out, scale);
     out->cr();
   }
 
+  // -- Print the freelists of micro arenas, which are kept apart from the ones above.
+  if (ChunkManager::chunkmanager_micro_nonclass() != nullptr) {
+    out->cr();
+    out->print_cr("Chunk freelist%s of micro arenas:", Metaspace::using_class_space() ? "s" : "");
+    ChunkManagerStats non_class_micro_stat;
+    ChunkManager::chunkmanager_micro_nonclass()->add_to_statistics(&non_class_micro_stat);
+    total_cm_stat.add(non_class_micro_stat);
+    if (Metaspace::using_class_space()) {
+      ChunkManagerStats class_micro_stat;
+      ChunkManager::chunkmanager_micro_class()->add_to_statistics(&class_micro_stat);
+      total_cm_stat.add(class_micro_stat);
+      out->print_cr("   Non-Class:");
+      non_class_micro_stat.print_on(out, scale);
+      out->cr();
+      out->print_cr("       Class:");
+      class_micro_stat.print_on(out, scale);
+      out->cr();
+    } else {
+      non_class_micro_stat.print_on(out, scale);
+      out->cr();
+    }
+  }
+
   // -- Print Chunkmanager details.
   if ((flags & (int)Option::ShowChunkFreeList) > 0) {
     out->cr();
@@ -308,10 +330,16 @@ void MetaspaceReporter::print_report(outputStream* out, size_t scale, int flags)
       out->print_cr("   Non-Class:");
     }
     ChunkManager::chunkmanager_nonclass()->print_on(out);
+    if (ChunkManager::chunkmanager_micro_nonclass() != nullptr) {
+      ChunkManager::chunkmanager_micro_nonclass()->print_on(out);
+    }
     out->cr();
     if (Metaspace::using_class_space()) {
       out->print_cr("       Class:");
       ChunkManager::chunkmanager_class()->print_on(out);
+      if (ChunkManager::chunkmanager_micro_class() != nullptr) {
+        ChunkManager::chunkmanager_micro_class()->print_on(out);
+      }
       out->cr();
     }
   }
@@ -348,6 +376,12 @@ void MetaspaceReporter::print_report(outputStream* out, size_t scale, int flags)
   print_scaled_words_and_percentage(out, committed_in_free_chunks, committed_words, scale, 6);
   out->cr();
 
+  // Of that, the part purging cannot give back because it sits in free chunks smaller
+  // than a commit granule: a measure of the fragmentation of the freelists.
+  out->print("  (fragmented, in free chunks < granule: ");
+  print_scaled_words_and_percentage(out, total_cm_stat.committed_word_size_below_granule(), committed_words, scale, 6);
+  out->print_cr(")");
+
   // Print waste in deallocated blocks.
   const uintx free_blocks_num =
       cl._stats_total._arena_stats_nonclass._free_blocks_num +
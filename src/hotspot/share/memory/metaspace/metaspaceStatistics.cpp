@@ -25,6 +25,7 @@
 
 #include "precompiled.hpp"
 #include "memory/metaspace/metaspaceCommon.hpp"
+#include "memory/metaspace/metaspaceSettings.hpp"
 #include "memory/metaspace/metaspaceStatistics.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
@@ -58,6 +59,15 @@ size_t ChunkManagerStats::total_committed_word_size() const {
   return s;
 }
 
+size_t ChunkManagerStats::committed_word_size_below_granule() const {
+  const chunklevel_t granule_level = chunklevel::level_fitting_word_size(Settings::commit_granule_words());
+  size_t s = 0;
+  for (chunklevel_t l = granule_level + 1; l <= chunklevel::HIGHEST_CHUNK_LEVEL; l++) {
+    s += _committed_word_size[l];
+  }
+  return s;
+}
+
 void ChunkManagerStats::print_on(outputStream* st, size_t scale) const {
   // Note: used as part of MetaspaceReport so formatting matters.
   size_t total_size = 0;
@@ -60,6 +60,10 @@ struct ChunkManagerStats {
   // Returns total committed word size of all chunks in this manager.
   size_t total_committed_word_size() const;
 
+  // Returns the committed word size of all chunks smaller than a commit granule.
+  // Purging cannot uncommit these, so they measure the fragmentation of the freelists.
+  size_t committed_word_size_below_granule() const;
+
   void print_on(outputStream* st, size_t scale) const;
 
   DEBUG_ONLY(void verify() const;)
@@ -88,12 +88,16 @@ size_t RunningCounters::free_chunks_words() {
 
 size_t RunningCounters::free_chunks_words_class() {
   ChunkManager* cm = ChunkManager::chunkmanager_class();
-  return cm != nullptr ? cm->total_word_size() : 0;
+  ChunkManager* micro_cm = ChunkManager::chunkmanager_micro_class();
+  return (cm != nullptr ? cm->total_word_size() : 0) +
+         (micro_cm != nullptr ? micro_cm->total_word_size() : 0);
 }
 
 size_t RunningCounters::free_chunks_words_nonclass() {
   assert(ChunkManager::chunkmanager_nonclass() != nullptr, "Metaspace not yet initialized");
-  return ChunkManager::chunkmanager_nonclass()->total_word_size();
+  ChunkManager* micro_cm = ChunkManager::chunkmanager_micro_nonclass();
+  return ChunkManager::chunkmanager_nonclass()->total_word_size() +
+         (micro_cm != nullptr ? micro_cm->total_word_size() : 0);
 }
 
 } // namespace metaspace
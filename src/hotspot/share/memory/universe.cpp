@@ -30,6 +30,7 @@
 #include "cds/metaspaceShared.hpp"
 #include "classfile/classLoader.hpp"
 #include "classfile/classLoaderDataGraph.hpp"
+#include "classfile/fieldLayoutBuilder.hpp"
 #include "classfile/javaClasses.hpp"
 #include "classfile/stringTable.hpp"
 #include "classfile/symbolTable.hpp"
@@ -911,6 +912,9 @@ jint universe_init() {
 
   ResolvedMethodTable::create_table();
 
+  // Needs the symbol table, and must precede the loading of the first class.
+  FieldLayoutBuilder::initialize_layout_hints();
+
   return JNI_OK;
 }
 
@@ -63,7 +63,7 @@ class outputStream;
  *
  *           8        9        10       11       12       13       14       15          16 ++
  *       +--------+--------+--------+--------+--------+--------+--------+--------+  ------------------------
- *  ...  |   malloc site table marker        | flags  | unused |     canary      |  ... User payload ....
+ *  ...  |   malloc site table marker        | flags  | sampled|     canary      |  ... User payload ....
  *       +--------+--------+--------+--------+--------+--------+--------+--------+  ------------------------
  *
  * Layout on 32-bit:
@@ -75,7 +75,7 @@ class outputStream;
  *
  *           8        9        10       11       12       13       14       15          16 ++
  *       +--------+--------+--------+--------+--------+--------+--------+--------+  ------------------------
- *  ...  |   malloc site table marker        | flags  | unused |     canary      |  ... User payload ....
+ *  ...  |   malloc site table marker        | flags  | sampled|     canary      |  ... User payload ....
  *       +--------+--------+--------+--------+--------+--------+--------+--------+  ------------------------
  *
  * Notes:
@@ -85,6 +85,8 @@ class outputStream;
  *   canary at the very start of the malloc header (generously sized 32 bits).
  * - The footer canary consists of two bytes. Since the footer location may be unaligned to 16 bits,
  *   the bytes are stored individually.
+ * - The sampled byte is set if the allocation was recorded by the malloc sampler in summary mode,
+ *   in which case the malloc site table marker is valid and the free is accounted to that site.
  */
 
 class MallocHeader {
@@ -93,7 +95,7 @@ class MallocHeader {
   const size_t _size;
   const uint32_t _mst_marker;
   const MemTag _mem_tag;
-  const uint8_t _unused;
+  const uint8_t _sampled;
   uint16_t _canary;
 
   static const uint16_t _header_canary_live_mark = 0xE99E;
@@ -123,17 +125,19 @@ class MallocHeader {
     const size_t size;
     const MemTag mem_tag;
     const uint32_t mst_marker;
+    const bool sampled;
   };
 
-  inline MallocHeader(size_t size, MemTag mem_tag, uint32_t mst_marker);
+  inline MallocHeader(size_t size, MemTag mem_tag, uint32_t mst_marker, bool sampled = false);
 
   inline size_t size()  const { return _size; }
   inline MemTag mem_tag() const { return _mem_tag; }
   inline uint32_t mst_marker() const { return _mst_marker; }
+  inline bool sampled() const { return _sampled != 0; }
 
   // Return the necessary data to deaccount the block with NMT.
   FreeInfo free_info() {
-    return FreeInfo{this->size(), this->mem_tag(), this->mst_marker()};
+    return FreeInfo{this->size(), this->mem_tag(), this->mst_marker(), this->sampled()};
   }
   inline void mark_block_as_dead();
   inline void revive();
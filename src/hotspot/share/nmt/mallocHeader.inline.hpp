@@ -34,9 +34,9 @@
 #include "utilities/macros.hpp"
 #include "utilities/nativeCallStack.hpp"
 
-inline MallocHeader::MallocHeader(size_t size, MemTag mem_tag, uint32_t mst_marker)
+inline MallocHeader::MallocHeader(size_t size, MemTag mem_tag, uint32_t mst_marker, bool sampled)
   : _size(size), _mst_marker(mst_marker), _mem_tag(mem_tag),
-    _unused(0), _canary(_header_canary_live_mark)
+    _sampled(sampled ? 1 : 0), _canary(_header_canary_live_mark)
 {
   assert(size < max_reasonable_malloc_size, "Too large allocation size?");
   // On 32-bit we have some bits more, use them for a second canary
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "nmt/mallocSampler.hpp"
+#include "utilities/debug.hpp"
+
+#include <math.h>
+
+THREAD_LOCAL size_t   MallocSampler::_bytes_until_sample = 0;
+THREAD_LOCAL uint64_t MallocSampler::_rnd = 0;
+
+void MallocSampler::pick_next_sample() {
+  if (_rnd == 0) {
+    // Seed from the address of the thread local, which differs between threads.
+    _rnd = (uint64_t)(uintptr_t)&_rnd;
+  }
+  // Same 48-bit linear congruential generator as ThreadHeapSampler.
+  const uint64_t PrngMult = 0x5DEECE66DLL;
+  const uint64_t PrngAdd = 0xB;
+  const uint64_t PrngModPower = 48;
+  const uint64_t PrngModMask = ((uint64_t)1 << PrngModPower) - 1;
+  _rnd = (PrngMult * _rnd + PrngAdd) & PrngModMask;
+
+  // Take the top 26 bits as a uniform value in (0, 1] and put it through the
+  // inverse CDF of the exponential distribution with mean interval.
+  const double q = (static_cast<uint32_t>(_rnd >> (PrngModPower - 26)) + 1.0) / (double)(1 << 26);
+  const double result = -log(q) * (double)NativeMemorySamplingInterval + 1;
+  assert(result > 0 && result < static_cast<double>(SIZE_MAX), "Result is not in an acceptable range.");
+  _bytes_until_sample = static_cast<size_t>(result);
+}
+
+size_t MallocSampler::weighted_size(size_t size) {
+  assert(enabled(), "sampling not enabled");
+  if (size == 0) {
+    return 0;
+  }
+  const double p = -expm1(-(double)size / (double)NativeMemorySamplingInterval);
+  return static_cast<size_t>((double)size / p);
+}
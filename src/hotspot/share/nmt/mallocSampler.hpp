@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef SHARE_NMT_MALLOCSAMPLER_HPP
+#define SHARE_NMT_MALLOCSAMPLER_HPP
+
+#include "memory/allStatic.hpp"
+#include "runtime/globals.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+// In summary mode, NMT does not know where memory is malloc'ed from. Recording the
+// call stack of every allocation (detail mode) is too expensive to leave on in
+// production, so with NativeMemorySamplingInterval set, we record the call stack of
+// one in NativeMemorySamplingInterval bytes on average instead.
+//
+// Like ThreadHeapSampler, each thread counts down a geometrically distributed number
+// of bytes and samples the allocation that crosses zero. An allocation of size s is
+// then picked with probability p(s) = 1 - exp(-s / interval), and is accounted to its
+// site in the MallocSiteTable with the weight s / p(s). Summed over a site, these are
+// unbiased estimates of the bytes malloc'ed from it. The weight is recomputed from the
+// size in the malloc header on free, so the estimates also follow deallocations.
+class MallocSampler : AllStatic {
+  static THREAD_LOCAL size_t   _bytes_until_sample;
+  static THREAD_LOCAL uint64_t _rnd;
+
+  static void pick_next_sample();
+
+public:
+  static bool enabled() {
+    return NativeMemorySamplingInterval > 0;
+  }
+
+  // Returns true if the allocation of this size is to be sampled.
+  static inline bool should_sample(size_t size) {
+    if (_rnd == 0) {
+      // First allocation of this thread
+      pick_next_sample();
+    }
+    if (size < _bytes_until_sample) {
+      _bytes_until_sample -= size;
+      return false;
+    }
+    pick_next_sample();
+    return true;
+  }
+
+  // The estimated number of bytes that a sampled allocation of this size stands for.
+  static size_t weighted_size(size_t size);
+};
+
+#endif // SHARE_NMT_MALLOCSAMPLER_HPP
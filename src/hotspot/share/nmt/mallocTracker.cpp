@@ -31,6 +31,7 @@
 #include "logging/logStream.hpp"
 #include "nmt/mallocHeader.inline.hpp"
 #include "nmt/mallocLimit.hpp"
+#include "nmt/mallocSampler.hpp"
 #include "nmt/mallocSiteTable.hpp"
 #include "nmt/mallocTracker.hpp"
 #include "nmt/memTracker.hpp"
@@ -160,7 +161,8 @@ bool MallocTracker::initialize(NMT_TrackingLevel level) {
     MallocMemorySummary::initialize();
   }
 
-  if (level == NMT_detail) {
+  if (level == NMT_detail ||
+      (level == NMT_summary && MallocSampler::enabled())) {
     return MallocSiteTable::initialize();
   }
   return true;
@@ -175,12 +177,19 @@ void* MallocTracker::record_malloc(void* malloc_base, size_t size, MemTag mem_ta
 
   MallocMemorySummary::record_malloc(size, mem_tag);
   uint32_t mst_marker = 0;
+  bool sampled = false;
   if (MemTracker::tracking_level() == NMT_detail) {
     MallocSiteTable::allocation_at(stack, size, &mst_marker, mem_tag);
+  } else if (MallocSampler::enabled() && MallocSampler::should_sample(size)) {
+    // The stack passed in is fake in summary mode, capture the real one.
+    // Skip this frame and os::malloc.
+    NativeCallStack sampled_stack(2);
+    sampled = MallocSiteTable::allocation_at(sampled_stack, MallocSampler::weighted_size(size),
+                                             &mst_marker, mem_tag);
   }
 
   // Uses placement global new operator to initialize malloc header
-  MallocHeader* const header = ::new (malloc_base)MallocHeader(size, mem_tag, mst_marker);
+  MallocHeader* const header = ::new (malloc_base)MallocHeader(size, mem_tag, mst_marker, sampled);
   void* const memblock = (void*)((char*)malloc_base + sizeof(MallocHeader));
 
   // The alignment check: 8 bytes alignment for 32 bit systems.
@@ -216,6 +225,8 @@ void MallocTracker::deaccount(MallocHeader::FreeInfo free_info) {
   MallocMemorySummary::record_free(free_info.size, free_info.mem_tag);
   if (MemTracker::tracking_level() == NMT_detail) {
     MallocSiteTable::deallocation_at(free_info.size, free_info.mst_marker);
+  } else if (free_info.sampled) {
+    MallocSiteTable::deallocation_at(MallocSampler::weighted_size(free_info.size), free_info.mst_marker);
   }
 }
 
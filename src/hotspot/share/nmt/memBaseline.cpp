@@ -26,6 +26,7 @@
 #include "classfile/classLoaderDataGraph.inline.hpp"
 #include "memory/allocation.hpp"
 #include "memory/metaspaceUtils.hpp"
+#include "nmt/mallocSampler.hpp"
 #include "nmt/memBaseline.hpp"
 #include "nmt/memTracker.hpp"
 #include "runtime/javaThread.hpp"
@@ -148,8 +149,7 @@ void MemBaseline::baseline_summary() {
   _metaspace_stats = MetaspaceUtils::get_combined_statistics();
 }
 
-bool MemBaseline::baseline_allocation_sites() {
-  // Malloc allocation sites
+bool MemBaseline::baseline_malloc_sites() {
   MallocAllocationSiteWalker malloc_walker;
   if (!MallocSiteTable::walk_malloc_site(&malloc_walker)) {
     return false;
@@ -158,6 +158,14 @@ bool MemBaseline::baseline_allocation_sites() {
   _malloc_sites.move(malloc_walker.malloc_sites());
   // The malloc sites are collected in size order
   _malloc_sites_order = by_size;
+  return true;
+}
+
+bool MemBaseline::baseline_allocation_sites() {
+  // Malloc allocation sites
+  if (!baseline_malloc_sites()) {
+    return false;
+  }
 
   // Virtual memory allocation sites
   VirtualMemoryAllocationWalker virtual_memory_walker;
@@ -192,6 +200,9 @@ void MemBaseline::baseline(bool summaryOnly) {
       MemTracker::tracking_level() == NMT_detail) {
     baseline_allocation_sites();
     _baseline_type = Detail_baselined;
+  } else if (!summaryOnly && MallocSampler::enabled()) {
+    // Only the sampled malloc sites are known in summary mode
+    baseline_malloc_sites();
   }
 }
 
@@ -105,6 +105,7 @@ class MemBaseline {
     return _metaspace_stats;
   }
 
+  bool has_malloc_sites() const { return !_malloc_sites.is_empty(); }
   MallocSiteIterator malloc_sites(SortingOrder order);
   VirtualMemorySiteIterator virtual_memory_sites(SortingOrder order);
 
@@ -194,6 +195,8 @@ class MemBaseline {
 
   // Baseline allocation sites (detail tracking only)
   bool baseline_allocation_sites();
+  // Collect the malloc sites only
+  bool baseline_malloc_sites();
 
   // Aggregate virtual memory allocation by allocation sites
   bool aggregate_virtual_memory_allocation_sites();
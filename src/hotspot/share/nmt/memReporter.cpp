@@ -31,6 +31,7 @@
 #include "nmt/memoryFileTracker.hpp"
 #include "nmt/threadStackTracker.hpp"
 #include "nmt/virtualMemoryTracker.hpp"
+#include "runtime/globals.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/ostream.hpp"
@@ -351,6 +352,42 @@ int MemDetailReporter::report_malloc_sites() {
   return num_omitted;
 }
 
+void MemSampleReporter::report() {
+  outputStream* out = output();
+  out->print_cr("Sampled malloc sites (one sample per " SIZE_FORMAT " bytes on average, sizes are estimates):",
+                NativeMemorySamplingInterval);
+  out->cr();
+  if (!_baseline.has_malloc_sites()) {
+    out->print_cr("No samples");
+    return;
+  }
+
+  MallocSiteIterator malloc_itr = _baseline.malloc_sites(MemBaseline::by_size);
+  const MallocSite* malloc_site;
+  int num_omitted = 0;
+  while ((malloc_site = malloc_itr.next()) != nullptr) {
+    if (amount_in_current_scale(MAX2(malloc_site->size(), malloc_site->peak_size())) == 0) {
+      num_omitted ++;
+      continue;
+    }
+    _stackprinter.print_stack(malloc_site->call_stack());
+    MemTag mem_tag = malloc_site->mem_tag();
+    assert(NMTUtil::tag_is_valid(mem_tag) && mem_tag != mtNone,
+      "Must have a valid memory tag");
+    INDENT_BY(29,
+      out->print_cr("(estimated malloc=" SIZE_FORMAT "%s type=%s #" SIZE_FORMAT " samples)",
+                    amount_in_current_scale(malloc_site->size()), current_scale(),
+                    NMTUtil::tag_to_name(mem_tag), malloc_site->count());
+    )
+    out->cr();
+  }
+  if (num_omitted > 0) {
+    out->print_cr("(%d call sites weighting less than 1%s each omitted.)",
+                   num_omitted, current_scale());
+    out->cr();
+  }
+}
+
 int MemDetailReporter::report_virtual_memory_allocation_sites()  {
   VirtualMemorySiteIterator  virtual_memory_itr =
     _baseline.virtual_memory_sites(MemBaseline::by_size);
@@ -182,6 +182,22 @@ class MemDetailReporter : public MemSummaryReporter {
   void report_virtual_memory_region(const ReservedMemoryRegion* rgn);
 };
 
+/*
+ * The class is for generating the report of the call sites sampled by
+ * MallocSampler in summary tracking mode.
+ */
+class MemSampleReporter : public MemReporterBase {
+ private:
+  MemBaseline&   _baseline;
+  NativeCallStackPrinter _stackprinter;
+ public:
+  MemSampleReporter(MemBaseline& baseline, outputStream* output, size_t scale = default_scale) :
+    MemReporterBase(output, scale), _baseline(baseline), _stackprinter(output) { }
+
+  // Report the sampled malloc sites with their estimated sizes, by size.
+  void report();
+};
+
 /*
  * The class is for generating summary comparison report.
  * It compares current memory baseline against an early baseline.
@@ -23,6 +23,7 @@
  */
 #include "precompiled.hpp"
 #include "memory/resourceArea.hpp"
+#include "nmt/mallocSampler.hpp"
 #include "nmt/memReporter.hpp"
 #include "nmt/memTracker.hpp"
 #include "nmt/nmtDCmd.hpp"
@@ -52,6 +53,10 @@ NMTDCmd::NMTDCmd(outputStream* output,
             "BOOLEAN", false, "false"),
   _statistics("statistics", "print tracker statistics for tuning purpose.", \
             "BOOLEAN", false, "false"),
+  _samples("samples", "request runtime to report the malloc call sites " \
+            "sampled in summary mode with NativeMemorySamplingInterval, " \
+            "with their estimated sizes.",
+            "BOOLEAN", false, "false"),
   _scale("scale", "Memory usage in which scale, KB, MB or GB",
        "STRING", false, "KB") {
   _dcmdparser.add_dcmd_option(&_summary);
@@ -60,6 +65,7 @@ NMTDCmd::NMTDCmd(outputStream* output,
   _dcmdparser.add_dcmd_option(&_summary_diff);
   _dcmdparser.add_dcmd_option(&_detail_diff);
   _dcmdparser.add_dcmd_option(&_statistics);
+  _dcmdparser.add_dcmd_option(&_samples);
   _dcmdparser.add_dcmd_option(&_scale);
 }
 
@@ -91,10 +97,11 @@ void NMTDCmd::execute(DCmdSource source, TRAPS) {
   if (_summary_diff.is_set() && _summary_diff.value()) { ++nopt; }
   if (_detail_diff.is_set() && _detail_diff.value()) { ++nopt; }
   if (_statistics.is_set() && _statistics.value()) { ++nopt; }
+  if (_samples.is_set() && _samples.value()) { ++nopt; }
 
   if (nopt > 1) {
       output()->print_cr("At most one of the following option can be specified: " \
-        "summary, detail, metadata, baseline, summary.diff, detail.diff");
+        "summary, detail, metadata, baseline, summary.diff, detail.diff, samples");
       return;
   } else if (nopt == 0) {
     if (_summary.is_set()) {
@@ -142,6 +149,13 @@ void NMTDCmd::execute(DCmdSource source, TRAPS) {
     } else {
       output()->print_cr("Native memory tracking is not enabled");
     }
+  } else if (_samples.value()) {
+    if (MemTracker::tracking_level() != NMT_summary || !MallocSampler::enabled()) {
+      output()->print_cr("Malloc sampling is not enabled, it requires summary tracking "
+                         "and NativeMemorySamplingInterval");
+      return;
+    }
+    report_samples(scale_unit);
   } else {
     ShouldNotReachHere();
     output()->print_cr("Unknown command");
@@ -178,6 +192,13 @@ void NMTDCmd::report_diff(bool summaryOnly, size_t scale_unit) {
   }
 }
 
+void NMTDCmd::report_samples(size_t scale_unit) {
+  MemBaseline baseline;
+  baseline.baseline(false);
+  MemSampleReporter rpt(baseline, output(), scale_unit);
+  rpt.report();
+}
+
 bool NMTDCmd::check_detail_tracking_level(outputStream* out) {
   if (MemTracker::tracking_level() != NMT_detail) {
     out->print_cr("Detail tracking is not enabled");
@@ -41,10 +41,11 @@ class NMTDCmd: public DCmdWithParser {
   DCmdArgument<bool>  _summary_diff;
   DCmdArgument<bool>  _detail_diff;
   DCmdArgument<bool>  _statistics;
+  DCmdArgument<bool>  _samples;
   DCmdArgument<char*> _scale;
 
  public:
-  static int num_arguments() { return 7; }
+  static int num_arguments() { return 8; }
   NMTDCmd(outputStream* output, bool heap);
   static const char* name() { return "VM.native_memory"; }
   static const char* description() {
@@ -63,6 +64,7 @@ class NMTDCmd: public DCmdWithParser {
  private:
   void report(bool summaryOnly, size_t scale);
   void report_diff(bool summaryOnly, size_t scale);
+  void report_samples(size_t scale);
 
   size_t get_scale(const char* scale) const;
 
@@ -27,6 +27,7 @@
 #include "cds/cdsConfig.hpp"
 #include "cds/classPrelinker.hpp"
 #include "cds/heapShared.hpp"
+#include "cds/metaspaceShared.hpp"
 #include "classfile/resolutionErrors.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "classfile/systemDictionaryShared.hpp"
@@ -464,6 +465,11 @@ void ConstantPoolCache::remove_resolved_method_entries_if_non_deterministic() {
                   rme->is_resolved(Bytecodes::_invokestatic));
 
     if (resolved && can_archive_resolved_method(rme)) {
+      if (CDSConfig::is_dumping_dynamic_archive() && rme->method() == nullptr) {
+        // Vtable call: the vtable of the resolved class may have been re-laid out
+        // after the methods were sorted, see DynamicArchiveBuilder::sort_methods().
+        rme->set_table_index(checked_cast<u2>(dynamic_archive_vtable_index(rme)));
+      }
       rme->mark_and_relocate(src_cp);
       archived = true;
     } else {
@@ -504,9 +510,10 @@ bool ConstantPoolCache::can_archive_resolved_method(ResolvedMethodEntry* method_
     return false;
   }
 
-  if (CDSConfig::is_dumping_dynamic_archive()) {
-    // InstanceKlass::methods() has been resorted. We need to
-    // update the vtable_index in method_entry (not implemented)
+  if (CDSConfig::is_dumping_dynamic_archive() && method_entry->method() == nullptr &&
+      dynamic_archive_vtable_index(method_entry) < 0) {
+    // InstanceKlass::methods() has been resorted, and we cannot find the
+    // updated vtable_index of the resolved method.
     return false;
   }
 
@@ -537,6 +544,40 @@ bool ConstantPoolCache::can_archive_resolved_method(ResolvedMethodEntry* method_
   }
 
 }
+
+// Returns the vtable index of a resolved vtable call after the methods of the
+// classes in the dynamic archive have been sorted, or -1 if the resolved method
+// cannot be identified.
+int ConstantPoolCache::dynamic_archive_vtable_index(ResolvedMethodEntry* method_entry) {
+  assert(CDSConfig::is_dumping_dynamic_archive(), "only methods of the dynamic archive are resorted");
+  assert(method_entry->is_resolved(Bytecodes::_invokevirtual) && method_entry->method() == nullptr, "vtable call");
+
+  int cp_index = method_entry->constant_pool_index();
+  ConstantPool* src_cp = ArchiveBuilder::current()->get_source_addr(constant_pool());
+  int klass_cp_index = src_cp->uncached_klass_ref_index_at(cp_index);
+  if (!src_cp->tag_at(klass_cp_index).is_klass()) {
+    return -1;
+  }
+  Klass* k = src_cp->resolved_klass_at(klass_cp_index);
+  if (k == nullptr || !k->is_instance_klass()) {
+    return -1;
+  }
+
+  // Find the method again the way LinkResolver::linktime_resolve_virtual_method() does,
+  // and make sure it is the one whose vtable index is recorded in the entry.
+  Method* m = InstanceKlass::cast(k)->uncached_lookup_method(src_cp->uncached_name_ref_at(cp_index),
+                                                             src_cp->uncached_signature_ref_at(cp_index),
+                                                             Klass::OverpassLookupMode::find);
+  if (m == nullptr || !m->has_vtable_index() || m->vtable_index() != method_entry->table_index()) {
+    return -1;
+  }
+  if (MetaspaceShared::is_in_shared_metaspace(m)) {
+    // The methods of the classes in the base archive keep their order.
+    return m->vtable_index();
+  }
+  Method* buffered_m = ArchiveBuilder::current()->get_buffered_addr(m);
+  return buffered_m->has_vtable_index() ? buffered_m->vtable_index() : -1;
+}
 #endif // INCLUDE_CDS
 
 void ConstantPoolCache::deallocate_contents(ClassLoaderData* data) {
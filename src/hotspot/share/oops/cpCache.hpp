@@ -226,6 +226,7 @@ class ConstantPoolCache: public MetaspaceObj {
   void remove_resolved_field_entries_if_non_deterministic();
   void remove_resolved_method_entries_if_non_deterministic();
   bool can_archive_resolved_method(ResolvedMethodEntry* method_entry);
+  int dynamic_archive_vtable_index(ResolvedMethodEntry* method_entry);
 #endif
 
   // RedefineClasses support
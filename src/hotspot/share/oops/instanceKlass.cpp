@@ -522,7 +522,8 @@ InstanceKlass::InstanceKlass(const ClassFileParser& parser, KlassKind kind, Refe
   _nest_host_index(0),
   _init_state(allocated),
   _reference_type(reference_type),
-  _init_thread(nullptr)
+  _init_thread(nullptr),
+  _exception_fill_count(0)
 {
   set_vtable_length(parser.vtable_size());
   set_access_flags(parser.access_flags());
@@ -2575,6 +2576,7 @@ void InstanceKlass::remove_unshareable_info() {
 #endif
 
   _init_thread = nullptr;
+  _exception_fill_count = 0;
   _methods_jmethod_ids = nullptr;
   _jni_ids = nullptr;
   _oop_map_cache = nullptr;
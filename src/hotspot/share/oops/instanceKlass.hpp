@@ -240,6 +240,11 @@ class InstanceKlass: public Klass {
 
   JavaThread* volatile _init_thread;        // Pointer to current thread doing initialization (to handle recursive initialization)
 
+  // Number of times a stack trace was filled in for an exception of exactly
+  // this type, or -1 once such a stack trace has been inspected.
+  // See HotExceptionStackTraceDepth.
+  volatile int    _exception_fill_count;
+
   OopMapCache*    volatile _oop_map_cache;   // OopMapCache for all methods in the klass (allocated lazily)
   JNIid*          _jni_ids;                  // First JNI identifier for static fields in this class
   jmethodID* volatile _methods_jmethod_ids;  // jmethodIDs corresponding to method_idnum, or null if none
@@ -515,6 +520,18 @@ class InstanceKlass: public Klass {
   bool is_in_error_state() const           { return _init_state == initialization_error; }
   bool is_reentrant_initialization(Thread *thread)  { return thread == _init_thread; }
   ClassState  init_state() const           { return _init_state; }
+
+  // exception stack trace statistics (see HotExceptionStackTraceDepth)
+  int record_exception_fill() {
+    int count = Atomic::load(&_exception_fill_count);
+    if (count >= 0 && count < max_jint) {
+      // Lost updates are harmless, this is only a heuristic.
+      Atomic::store(&_exception_fill_count, ++count);
+    }
+    return count;
+  }
+  bool exception_trace_inspected() const   { return Atomic::load(&_exception_fill_count) < 0; }
+  void set_exception_trace_inspected()     { Atomic::store(&_exception_fill_count, -1); }
   const char* init_state_name() const;
   bool is_rewritten() const                { return _misc_flags.rewritten(); }
 
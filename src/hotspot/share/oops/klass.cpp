@@ -170,6 +170,12 @@ bool Klass::search_secondary_supers(Klass* k) const {
   // This is necessary, since I am never in my own secondary_super list.
   if (this == k)
     return true;
+
+  if (UseSecondarySupersTable) {
+    // The hashed lookup is cheap enough that the shared cache is not updated.
+    return lookup_secondary_supers_table(k);
+  }
+
   // Scan the array-of-objects for a match
   int cnt = secondary_supers()->length();
   for (int i = 0; i < cnt; i++) {
@@ -181,6 +187,39 @@ bool Klass::search_secondary_supers(Klass* k) const {
   return false;
 }
 
+// Probe the hashed secondary supers for k, see hash_secondary_supers().
+// The bitmap has one bit per occupied slot of the 64-entry table, and the
+// array holds the occupied slots in slot order. An element sits in the run
+// of occupied slots starting at its home slot, so a clear home bit or the
+// end of that run proves that k is absent.
+bool Klass::lookup_secondary_supers_table(Klass* k) const {
+  const uintx bitmap = _bitmap;
+  Array<Klass*>* secondaries = secondary_supers();
+  if (bitmap == SECONDARY_SUPERS_BITMAP_FULL) {
+    // Not hashed, fall back to a linear search.
+    return secondaries->contains(k);
+  }
+
+  int slot = k->hash_slot();
+  if (((bitmap >> slot) & 1) == 0) {
+    return false;
+  }
+  const int length = secondaries->length();
+  // Index of the home slot: number of occupied slots at or below it, minus 1.
+  int index = population_count(bitmap << (SECONDARY_SUPERS_TABLE_MASK - slot)) - 1;
+  for (int probes = 0; probes < length; probes++) {
+    if (secondaries->at(index) == k) {
+      return true;
+    }
+    slot = (slot + 1) & SECONDARY_SUPERS_TABLE_MASK;
+    if (((bitmap >> slot) & 1) == 0) {
+      return false;
+    }
+    index = (slot == 0) ? 0 : index + 1;
+  }
+  return false;
+}
+
 // Return self, except for abstract classes with exactly 1
 // implementor.  Then return the 1 concrete implementation.
 Klass *Klass::up_cast_abstract() {
@@ -546,6 +546,7 @@ class Klass : public Metadata {
   }
 
   bool search_secondary_supers(Klass* k) const;
+  bool lookup_secondary_supers_table(Klass* k) const;
 
   // Find LCA in class hierarchy
   Klass *LCA( Klass *k );
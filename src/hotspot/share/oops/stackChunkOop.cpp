@@ -337,18 +337,25 @@ class TransformStackChunkClosure {
     DerivedPointersSupport::RelativizeClosure derived_cl;
     f.iterate_derived_pointers(&derived_cl, map);
 
-    BarrierSetStackChunk* bs_chunk = BarrierSet::barrier_set()->barrier_set_stack_chunk();
-    frame fr = f.to_frame();
-    FrameOopIterator<RegisterMapT> iterator(fr, map);
-    bs_chunk->encode_gc_mode(_chunk, &iterator);
+    // Transformation is only done by GCs using the shared BarrierSetStackChunk,
+    // whose encoding only compresses oops and records them in the bitmap. Without
+    // a bitmap the oops are left as they are and found through the oop maps.
+    if (_chunk->has_bitmap()) {
+      BarrierSetStackChunk* bs_chunk = BarrierSet::barrier_set()->barrier_set_stack_chunk();
+      frame fr = f.to_frame();
+      FrameOopIterator<RegisterMapT> iterator(fr, map);
+      bs_chunk->encode_gc_mode(_chunk, &iterator);
+    }
 
     return true;
   }
 
   bool do_lockstack() {
-    BarrierSetStackChunk* bs_chunk = BarrierSet::barrier_set()->barrier_set_stack_chunk();
-    LockStackOopIterator iterator(_chunk);
-    bs_chunk->encode_gc_mode(_chunk, &iterator);
+    if (_chunk->has_bitmap()) {
+      BarrierSetStackChunk* bs_chunk = BarrierSet::barrier_set()->barrier_set_stack_chunk();
+      LockStackOopIterator iterator(_chunk);
+      bs_chunk->encode_gc_mode(_chunk, &iterator);
+    }
 
     return true;
   }
@@ -359,8 +366,13 @@ void stackChunkOopDesc::transform() {
   set_gc_mode(true);
 
   assert(!has_bitmap(), "Should only be set once");
-  set_has_bitmap(true);
-  bitmap().clear();
+  // A bitmap makes every later scan of the chunk a linear walk over the used
+  // stack, but costs a pass over all frames up front. Chunks with few used words
+  // are cheap to walk through their oop maps, so they are left without one.
+  if (bottom() - sp() >= StackChunkBitmapMinWords) {
+    set_has_bitmap(true);
+    bitmap().clear();
+  }
 
   TransformStackChunkClosure closure(this);
   iterate_stack(&closure);
@@ -233,6 +233,8 @@ class stackChunkOopDesc : public instanceOopDesc {
   template <ChunkFrames frames, class StackChunkFrameClosureType>
   inline void iterate_stack(StackChunkFrameClosureType* closure);
 
+  static inline void copy_words(intptr_t* from, intptr_t* to, int size);
+
   inline intptr_t* relative_base() const;
 
   inline intptr_t* derelativize_address(int offset) const;
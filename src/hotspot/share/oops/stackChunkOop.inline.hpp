@@ -40,8 +40,10 @@
 #include "runtime/globals.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/objectMonitor.hpp"
+#include "runtime/prefetch.inline.hpp"
 #include "runtime/registerMap.hpp"
 #include "runtime/smallRegisterMap.inline.hpp"
+#include "runtime/stubRoutines.hpp"
 #include "utilities/macros.hpp"
 #include CPU_HEADER_INLINE(stackChunkOop)
 
@@ -377,6 +379,34 @@ inline intptr_t* stackChunkOopDesc::interpreter_frame_local_at(const frame& fr,
   return heap_frame.interpreter_frame_local_at(index);
 }
 
+// The stack and the chunk never overlap. No GC barriers are applied here; when the chunk
+// requires them, the callers apply them to the copied frames separately.
+// Large copies can use the platform's vectorized disjoint jlong arraycopy stub
+// (AVX2/AVX-512 on x86_64, SIMD ldp/stp on aarch64) instead of libc memcpy, optionally
+// prefetching the destination first.
+inline void stackChunkOopDesc::copy_words(intptr_t* from, intptr_t* to, int size) {
+#if !(defined(AMD64) || defined(AARCH64) || defined(RISCV64) || defined(PPC64)) || defined(ZERO)
+  // Suppress compilation warning-as-error on unimplemented architectures
+  // that stub out arch-specific methods. Some compilers are smart enough
+  // to figure out the argument is always null and then warn about it.
+  if (to == nullptr) return;
+#endif
+#if (defined(AMD64) || defined(AARCH64)) && !defined(ZERO) && !defined(__APPLE__)
+  if (ContinuationCopyStubThreshold > 0 && size >= ContinuationCopyStubThreshold) {
+    if (ContinuationCopyPrefetchDestination) {
+      const int bytes = size << LogBytesPerWord;
+      for (int offset = 0; offset < bytes; offset += (int)DEFAULT_CACHE_LINE_SIZE) {
+        Prefetch::write(to, offset);
+      }
+    }
+    typedef void (*WordCopyStub)(const void* src, void* dst, size_t count);
+    CAST_TO_FN_PTR(WordCopyStub, StubRoutines::arrayof_jlong_disjoint_arraycopy())(from, to, (size_t)size);
+    return;
+  }
+#endif
+  memcpy(to, from, size << LogBytesPerWord);
+}
+
 inline void stackChunkOopDesc::copy_from_stack_to_chunk(intptr_t* from, intptr_t* to, int size) {
   log_develop_trace(continuations)("Copying from v: " PTR_FORMAT " - " PTR_FORMAT " (%d words, %d bytes)",
     p2i(from), p2i(from + size), size, size << LogBytesPerWord);
@@ -387,13 +417,7 @@ inline void stackChunkOopDesc::copy_from_stack_to_chunk(intptr_t* from, intptr_t
   assert(to >= start_address(), "Chunk underflow");
   assert(to + size <= end_address(), "Chunk overflow");
 
-#if !(defined(AMD64) || defined(AARCH64) || defined(RISCV64) || defined(PPC64)) || defined(ZERO)
-  // Suppress compilation warning-as-error on unimplemented architectures
-  // that stub out arch-specific methods. Some compilers are smart enough
-  // to figure out the argument is always null and then warn about it.
-  if (to != nullptr)
-#endif
-  memcpy(to, from, size << LogBytesPerWord);
+  copy_words(from, to, size);
 }
 
 inline void stackChunkOopDesc::copy_from_chunk_to_stack(intptr_t* from, intptr_t* to, int size) {
@@ -406,13 +430,7 @@ inline void stackChunkOopDesc::copy_from_chunk_to_stack(intptr_t* from, intptr_t
   assert(from >= start_address(), "");
   assert(from + size <= end_address(), "");
 
-#if !(defined(AMD64) || defined(AARCH64) || defined(RISCV64) || defined(PPC64)) || defined(ZERO)
-  // Suppress compilation warning-as-error on unimplemented architectures
-  // that stub out arch-specific methods. Some compilers are smart enough
-  // to figure out the argument is always null and then warn about it.
-  if (to != nullptr)
-#endif
-  memcpy(to, from, size << LogBytesPerWord);
+  copy_words(from, to, size);
 }
 
 template <typename OopT>
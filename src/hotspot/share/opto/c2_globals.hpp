@@ -485,6 +485,13 @@
   product(bool, DoEscapeAnalysis, true,                                     \
           "Perform escape analysis")                                        \
                                                                             \
+  product(double, RareBranchProbability, 0.0, EXPERIMENTAL,                 \
+          "Compile branches with a lower profiled probability as uncommon " \
+          "traps, like never taken branches. Objects escaping only on "     \
+          "such branches can then be scalar replaced and are reallocated "  \
+          "on deoptimization. 0.0 means only never taken branches")         \
+          range(0.0, 0.01)                                                  \
+                                                                            \
   product(double, EscapeAnalysisTimeout, 20. DEBUG_ONLY(+40.),              \
           "Abort EA when it reaches time limit (in sec)")                   \
           range(0, DBL_MAX)                                                 \
@@ -607,6 +614,12 @@
           "% of major receiver type to all profiled receivers")             \
           range(0, 100)                                                     \
                                                                             \
+  product(intx, TypeProfileTwoMajorReceiversPercent, 0, EXPERIMENTAL,       \
+          "At polymorphic call sites where the two most frequent receiver " \
+          "types make up at least this % of all profiled receivers, "       \
+          "inline both with a virtual call for the others. 0 disables it")  \
+          range(0, 100)                                                     \
+                                                                            \
   product(bool, PrintIntrinsics, false, DIAGNOSTIC,                         \
           "prints attempted and successful inlining of intrinsics")         \
                                                                             \
@@ -737,6 +750,10 @@
           "Carry inline depth of profile point with speculative type "      \
           "and give priority to profiling from lower inline depth")         \
                                                                             \
+  product(bool, OptimizeSealedSubtypeChecks, false, EXPERIMENTAL,          \
+          "Use the permitted subclasses of sealed classes and interfaces "  \
+          "to fold type checks that can never succeed")                     \
+                                                                            \
   product_pd(bool, TrapBasedRangeChecks,                                    \
           "Generate code for range checks that uses a cmp and trap "        \
           "instruction raising SIGTRAP. Used on PPC64.")                    \
@@ -746,6 +763,12 @@
           "loads/stores")                                                   \
           range(0, max_intx)                                                \
                                                                             \
+  product(intx, UnsafeCopyMemoryInlineLimit, 0, EXPERIMENTAL,              \
+          "Expand Unsafe.copyMemory and Unsafe.setMemory calls with a "     \
+          "constant size up to this many bytes into loads and stores "      \
+          "instead of calling the stub; 0 disables")                        \
+          range(0, 64)                                                      \
+                                                                            \
   develop(bool, StressArrayCopyMacroNode, false,                            \
           "Perform ArrayCopy load/store replacement during IGVN only")      \
                                                                             \
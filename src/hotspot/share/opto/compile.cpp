@@ -4383,11 +4383,45 @@ Compile::TracePhase::~TracePhase() {
   }
 }
 
+// Does one of the sealed classes or interfaces the subklass is limited to
+// permit no subtype of the superklass? Each of them must hold for the object,
+// so one sealed hierarchy that excludes one part of the superklass is enough.
+static bool sealed_hierarchy_excludes(const TypeKlassPtr* superk, const TypeKlassPtr* subk) {
+  if (!superk->isa_instklassptr() || !subk->isa_instklassptr() ||
+      !superk->is_loaded() || !subk->is_loaded()) {
+    return false;
+  }
+  GrowableArray<ciInstanceKlass*> sealed;
+  ciInstanceKlass* sub_ik = subk->is_instklassptr()->instance_klass();
+  if (!sub_ik->is_java_lang_Object()) {
+    sealed.append(sub_ik);
+  }
+  sealed.appendAll(subk->interfaces()->list());
+
+  GrowableArray<ciInstanceKlass*> supers;
+  ciInstanceKlass* super_ik = superk->is_instklassptr()->instance_klass();
+  if (!super_ik->is_java_lang_Object()) {
+    supers.append(super_ik);
+  }
+  supers.appendAll(superk->interfaces()->list());
+
+  for (int i = 0; i < sealed.length(); i++) {
+    for (int j = 0; j < supers.length(); j++) {
+      if (sealed.at(i)->sealed_hierarchy_excludes(supers.at(j))) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
 //----------------------------static_subtype_check-----------------------------
 // Shortcut important common cases when superklass is exact:
 // (0) superklass is java.lang.Object (can occur in reflective code)
 // (1) subklass is already limited to a subtype of superklass => always ok
 // (2) subklass does not overlap with superklass => always fail
+//     or, with OptimizeSealedSubtypeChecks, subklass is in a sealed hierarchy
+//     that permits no subtype of superklass => always fail
 // (3) superklass has NO subtypes and we can check with a simple compare.
 Compile::SubTypeCheckResult Compile::static_subtype_check(const TypeKlassPtr* superk, const TypeKlassPtr* subk, bool skip) {
   if (skip) {
@@ -4402,6 +4436,10 @@ Compile::SubTypeCheckResult Compile::static_subtype_check(const TypeKlassPtr* su
     return SSC_always_false; // (2) true path dead; no dynamic test needed
   }
 
+  if (OptimizeSealedSubtypeChecks && sealed_hierarchy_excludes(superk, subk)) {
+    return SSC_always_false; // (2) sealed hierarchy has no such subtype
+  }
+
   const Type* superelem = superk;
   if (superk->isa_aryklassptr()) {
     int ignored;
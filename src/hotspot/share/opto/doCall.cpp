@@ -245,8 +245,14 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
           speculative_receiver_type = nullptr;
         }
       }
+      // At a polymorphic call site, the first two receivers together may
+      // still outweigh the others by far.
+      bool have_two_major_receivers = receiver_method == nullptr && !have_major_receiver &&
+          morphism != 1 && morphism != 2 && UseBimorphicInlining &&
+          TypeProfileTwoMajorReceiversPercent > 0 && profile.has_receiver(1) &&
+          (100.*(profile.receiver_prob(0) + profile.receiver_prob(1)) >= (float)TypeProfileTwoMajorReceiversPercent);
       if (receiver_method == nullptr &&
-          (have_major_receiver || morphism == 1 ||
+          (have_major_receiver || have_two_major_receivers || morphism == 1 ||
            (morphism == 2 && UseBimorphicInlining))) {
         // receiver_method = profile.method();
         // Profiles do not suggest methods now.  Look it up in the major receiver.
@@ -261,7 +267,7 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
           // Look up second receiver.
           CallGenerator* next_hit_cg = nullptr;
           ciMethod* next_receiver_method = nullptr;
-          if (morphism == 2 && UseBimorphicInlining) {
+          if ((morphism == 2 && UseBimorphicInlining) || have_two_major_receivers) {
             next_receiver_method = callee->resolve_invoke(jvms->method()->holder(),
                                                                profile.receiver(1));
             if (next_receiver_method != nullptr) {
@@ -269,7 +275,7 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
                                   vtable_index, !call_does_dispatch, jvms,
                                   allow_inline, prof_factor);
               if (next_hit_cg != nullptr && !next_hit_cg->is_inline() &&
-                  have_major_receiver && UseOnlyInlinedBimorphic) {
+                  (have_major_receiver || have_two_major_receivers) && UseOnlyInlinedBimorphic) {
                   // Skip if we can't inline second receiver's method
                   next_hit_cg = nullptr;
               }
@@ -298,7 +304,11 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
               trace_type_profile(C, jvms->method(), jvms->depth() - 1, jvms->bci(), next_receiver_method, profile.receiver(1), site_count, profile.receiver_count(1));
               // We don't need to record dependency on a receiver here and below.
               // Whenever we inline, the dependency is added by Parse::Parse().
-              miss_cg = CallGenerator::for_predicted_call(profile.receiver(1), miss_cg, next_hit_cg, PROB_MAX);
+              // The second check is only reached if the first one failed.
+              float next_hit_prob = have_two_major_receivers
+                                  ? MIN2((float)PROB_MAX, profile.receiver_prob(1) / (1.0f - profile.receiver_prob(0)))
+                                  : PROB_MAX;
+              miss_cg = CallGenerator::for_predicted_call(profile.receiver(1), miss_cg, next_hit_cg, next_hit_prob);
             }
             if (miss_cg != nullptr) {
               ciKlass* k = speculative_receiver_type != nullptr ? speculative_receiver_type : profile.receiver(0);
@@ -26,9 +26,11 @@
 #include "asm/macroAssembler.hpp"
 #include "ci/ciUtilities.inline.hpp"
 #include "classfile/vmIntrinsics.hpp"
+#include "classfile/vmSymbols.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/compileLog.hpp"
 #include "gc/shared/barrierSet.hpp"
+#include "jfr/jfrEvents.hpp"
 #include "jfr/support/jfrIntrinsics.hpp"
 #include "memory/resourceArea.hpp"
 #include "oops/klass.inline.hpp"
@@ -137,6 +139,18 @@ JVMState* LibraryIntrinsic::generate(JVMState* jvms) {
 
   // The intrinsic bailed out
   assert(ctrl == kit.control(), "Control flow was added although the intrinsic bailed out");
+  if (jvms->has_method() &&
+      vmIntrinsics::class_for(intrinsic_id()) == VM_SYMBOL_ENUM_NAME(jdk_internal_vm_vector_VectorSupport)) {
+    EventVectorIntrinsicFallback event;
+    if (event.should_commit()) {
+      event.set_compileId(C->compile_id());
+      event.set_caller(kit.caller()->get_Method());
+      event.set_bci(bci);
+      event.set_intrinsic(vmIntrinsics::name_at(intrinsic_id()));
+      event.set_reason(kit.vector_rejection() != nullptr ? kit.vector_rejection() : "unknown");
+      event.commit();
+    }
+  }
   if (jvms->has_method()) {
     // Not a root compile.
     const char* msg;
@@ -5075,6 +5089,12 @@ bool LibraryCallKit::inline_unsafe_copyMemory() {
   Node* src_addr = make_unsafe_address(src_base, src_off);
   Node* dst_addr = make_unsafe_address(dst_base, dst_off);
 
+  const TypeLong* size_type = _gvn.type(argument(7))->isa_long();
+  if (size_type != nullptr && size_type->is_con() &&
+      inline_small_unsafe_copy(src_base, src_addr, dst_base, dst_addr, size_type->get_con())) {
+    return true;
+  }
+
   Node* thread = _gvn.transform(new ThreadLocalNode());
   Node* doing_unsafe_access_addr = basic_plus_adr(top(), thread, in_bytes(JavaThread::doing_unsafe_access_offset()));
   BasicType doing_unsafe_access_bt = T_BYTE;
@@ -5130,6 +5150,13 @@ bool LibraryCallKit::inline_unsafe_setMemory() {
 
   Node* dst_addr = make_unsafe_address(dst_base, dst_off);
 
+  const TypeLong* size_type = _gvn.type(argument(4))->isa_long();
+  const TypeInt* byte_t = _gvn.type(byte)->isa_int();
+  if (size_type != nullptr && size_type->is_con() && byte_t != nullptr && byte_t->is_con() &&
+      inline_small_unsafe_fill(dst_base, dst_addr, size_type->get_con(), byte_t->get_con())) {
+    return true;
+  }
+
   Node* thread = _gvn.transform(new ThreadLocalNode());
   Node* doing_unsafe_access_addr = basic_plus_adr(top(), thread, in_bytes(JavaThread::doing_unsafe_access_offset()));
   BasicType doing_unsafe_access_bt = T_BYTE;
@@ -5162,6 +5189,89 @@ bool LibraryCallKit::inline_unsafe_setMemory() {
   return true;
 }
 
+// Split a small constant size into the widest power-of-two accesses,
+// widest first. Returns the number of accesses.
+static int small_unsafe_access_chunks(jlong size, int offsets[], BasicType types[]) {
+  static const BasicType chunk_types[] = { T_LONG, T_INT, T_SHORT, T_BYTE };
+  int n = 0;
+  int offset = 0;
+  for (int i = 0; i < 4; i++) {
+    int chunk = type2aelembytes(chunk_types[i]);
+    while (size - offset >= chunk) {
+      offsets[n] = offset;
+      types[n] = chunk_types[i];
+      offset += chunk;
+      n++;
+    }
+  }
+  return n;
+}
+
+static bool can_inline_small_unsafe_access(PhaseGVN& gvn, Node* addr, Node* base, jlong size) {
+  return size > 0 && size <= UnsafeCopyMemoryInlineLimit && !has_wide_mem(gvn, addr, base);
+}
+
+static bool is_mismatched_unsafe_access(PhaseGVN& gvn, Node* addr, BasicType bt) {
+  const TypeAryPtr* ary_t = gvn.type(addr)->isa_aryptr();
+  return ary_t != nullptr && ary_t->elem()->array_element_basic_type() != bt;
+}
+
+// Expand Unsafe.copyMemory with a small constant size into loads and stores.
+// All loads are done before the first store, which gives the memmove
+// semantics of copyMemory for overlapping ranges. Only done when source and
+// destination are each known to be off-heap or in a primitive array, so that
+// the accesses have a precise memory slice.
+bool LibraryCallKit::inline_small_unsafe_copy(Node* src_base, Node* src_addr,
+                                              Node* dst_base, Node* dst_addr, jlong size) {
+  if (!can_inline_small_unsafe_access(_gvn, src_addr, src_base, size) ||
+      !can_inline_small_unsafe_access(_gvn, dst_addr, dst_base, size)) {
+    return false;
+  }
+  int offsets[16];
+  BasicType types[16];
+  Node* values[16];
+  int n = small_unsafe_access_chunks(size, offsets, types);
+  bool src_raw = _gvn.type(src_addr)->isa_rawptr() != nullptr;
+  bool dst_raw = _gvn.type(dst_addr)->isa_rawptr() != nullptr;
+
+  for (int i = 0; i < n; i++) {
+    Node* adr = basic_plus_adr(src_raw ? top() : src_base, src_addr, offsets[i]);
+    values[i] = make_load(control(), adr, Type::get_const_basic_type(types[i]), types[i],
+                          MemNode::unordered, LoadNode::Pinned,
+                          false /* require_atomic_access */, true /* unaligned */,
+                          is_mismatched_unsafe_access(_gvn, adr, types[i]), true /* unsafe */);
+  }
+  for (int i = 0; i < n; i++) {
+    Node* adr = basic_plus_adr(dst_raw ? top() : dst_base, dst_addr, offsets[i]);
+    store_to_memory(control(), adr, values[i], types[i], _gvn.type(adr)->is_ptr(),
+                    MemNode::unordered, false /* require_atomic_access */, true /* unaligned */,
+                    is_mismatched_unsafe_access(_gvn, adr, types[i]), true /* unsafe */);
+  }
+  return true;
+}
+
+// Expand Unsafe.setMemory with a small constant size and fill value into stores.
+bool LibraryCallKit::inline_small_unsafe_fill(Node* dst_base, Node* dst_addr, jlong size, jint value) {
+  if (!can_inline_small_unsafe_access(_gvn, dst_addr, dst_base, size)) {
+    return false;
+  }
+  int offsets[16];
+  BasicType types[16];
+  int n = small_unsafe_access_chunks(size, offsets, types);
+  bool dst_raw = _gvn.type(dst_addr)->isa_rawptr() != nullptr;
+  julong pattern = (julong)(value & 0xff) * CONST64(0x0101010101010101);
+
+  for (int i = 0; i < n; i++) {
+    Node* adr = basic_plus_adr(dst_raw ? top() : dst_base, dst_addr, offsets[i]);
+    Node* val = (types[i] == T_LONG) ? longcon((jlong)pattern)
+                                     : intcon((jint)(pattern & right_n_bits(type2aelembytes(types[i]) * BitsPerByte)));
+    store_to_memory(control(), adr, val, types[i], _gvn.type(adr)->is_ptr(),
+                    MemNode::unordered, false /* require_atomic_access */, true /* unaligned */,
+                    is_mismatched_unsafe_access(_gvn, adr, types[i]), true /* unsafe */);
+  }
+  return true;
+}
+
 #undef XTOP
 
 //------------------------clone_coping-----------------------------------
@@ -68,6 +68,7 @@ class LibraryCallKit : public GraphKit {
   LibraryIntrinsic* _intrinsic;     // the library intrinsic being called
   Node*             _result;        // the result node, if any
   int               _reexecute_sp;  // the stack pointer when bytecode needs to be reexecuted
+  const char*       _vector_rejection; // why a vector intrinsic was rejected, for the JFR event
 
   const TypeOopPtr* sharpen_unsafe_type(Compile::AliasType* alias_type, const TypePtr *adr_type);
 
@@ -75,7 +76,8 @@ class LibraryCallKit : public GraphKit {
   LibraryCallKit(JVMState* jvms, LibraryIntrinsic* intrinsic)
     : GraphKit(jvms),
       _intrinsic(intrinsic),
-      _result(nullptr)
+      _result(nullptr),
+      _vector_rejection(nullptr)
   {
     // Check if this is a root compile.  In that case we don't have a caller.
     if (!jvms->has_method()) {
@@ -100,6 +102,9 @@ class LibraryCallKit : public GraphKit {
   vmIntrinsics::ID  intrinsic_id() const { return _intrinsic->intrinsic_id(); }
   ciMethod*         callee()    const    { return _intrinsic->method(); }
 
+  const char* vector_rejection() const  { return _vector_rejection; }
+  void note_vector_rejection(const char* format, ...) ATTRIBUTE_PRINTF(2, 3);
+
   bool  try_to_inline(int predicate);
   Node* try_to_predicate(int predicate);
 
@@ -234,6 +239,8 @@ class LibraryCallKit : public GraphKit {
   bool inline_unsafe_writebackSync0(bool is_pre);
   bool inline_unsafe_copyMemory();
   bool inline_unsafe_setMemory();
+  bool inline_small_unsafe_copy(Node* src_base, Node* src_addr, Node* dst_base, Node* dst_addr, jlong size);
+  bool inline_small_unsafe_fill(Node* dst_base, Node* dst_addr, jlong size, jint value);
 
   bool inline_native_currentCarrierThread();
   bool inline_native_currentThread();
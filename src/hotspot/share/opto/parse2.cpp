@@ -1557,7 +1557,9 @@ bool Parse::path_is_suitable_for_uncommon_trap(float prob) const {
   if (!UseInterpreter) {
     return false;
   }
-  return seems_never_taken(prob) &&
+  // With RareBranchProbability, also trap on branches that are taken, but
+  // rarely. If that speculation fails too often, too_many_traps() stops it.
+  return (seems_never_taken(prob) || prob < RareBranchProbability) &&
          !C->too_many_traps(method(), bci(), Deoptimization::Reason_unstable_if);
 }
 
@@ -36,6 +36,7 @@
   flags(BODY,                 "Trace VLoopBody") \
   flags(TYPES,                "Trace VLoopTypes") \
   flags(POINTERS,             "Trace VLoopPointers") \
+  flags(POINTER_REJECTIONS,   "Trace memory accesses whose address VPointer can not parse") \
   flags(DEPENDENCY_GRAPH,     "Trace VLoopDependencyGraph") \
   flags(SW_ADJACENT_MEMOPS,   "Trace SuperWord::find_adjacent_memop_pairs") \
   flags(SW_REJECTIONS,        "Trace SuperWord rejections (non vectorizations)") \
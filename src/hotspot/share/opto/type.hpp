@@ -905,6 +905,7 @@ class TypeInterfaces : public Type {
     return intersection_with(other)->eq(other);
   }
   bool empty() const { return _list.length() == 0; }
+  const GrowableArray<ciInstanceKlass*>* list() const { return &_list; }
 
   ciInstanceKlass* exact_klass() const;
   void verify_is_loaded() const NOT_DEBUG_RETURN;
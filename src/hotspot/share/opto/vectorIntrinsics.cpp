@@ -25,6 +25,7 @@
 #include "precompiled.hpp"
 #include "ci/ciSymbols.hpp"
 #include "classfile/vmSymbols.hpp"
+#include "jfr/jfrEvents.hpp"
 #include "opto/library_call.hpp"
 #include "opto/runtime.hpp"
 #include "opto/vectornode.hpp"
@@ -62,14 +63,34 @@ static bool check_vbox(const TypeInstPtr* vbox_type) {
 #define log_if_needed(...)        \
   if (C->print_intrinsics()) {    \
     tty->print_cr(__VA_ARGS__);   \
-  }
+  }                               \
+  note_vector_rejection(__VA_ARGS__);
 
 #ifndef PRODUCT
 #define non_product_log_if_needed(...) log_if_needed(__VA_ARGS__)
 #else
-#define non_product_log_if_needed(...)
+// Product builds do not print, but still record the rejection for JFR
+#define non_product_log_if_needed(...) note_vector_rejection(__VA_ARGS__);
 #endif
 
+// Keep the reason for rejecting a vector intrinsic, so that the
+// VectorIntrinsicFallback event can name the shape that was not supported.
+void LibraryCallKit::note_vector_rejection(const char* format, ...) {
+  if (!EventVectorIntrinsicFallback::is_enabled()) {
+    return;
+  }
+  stringStream ss;
+  va_list ap;
+  va_start(ap, format);
+  ss.vprint(format, ap);
+  va_end(ap);
+  const char* msg = ss.as_string();
+  while (*msg == ' ' || *msg == '*') {
+    msg++;
+  }
+  _vector_rejection = msg;
+}
+
 static bool is_vector_mask(ciKlass* klass) {
   return klass->is_subclass_of(ciEnv::current()->vector_VectorMask_klass());
 }
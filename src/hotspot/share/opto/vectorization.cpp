@@ -204,6 +204,14 @@ void VLoopVPointers::compute_and_cache_vpointers() {
   _body.for_each_mem([&] (MemNode* const mem, int bb_idx) {
     // Placement new: construct directly into the array.
     ::new (&_vpointers[pointers_idx]) VPointer(mem, _vloop);
+#ifndef PRODUCT
+    if (_vloop.is_trace_pointer_rejections() && !_vpointers[pointers_idx].valid()) {
+      // Such accesses can not be packed, which often prevents vectorization of the loop.
+      tty->print("VLoopVPointers: rejected ");
+      _vpointers[pointers_idx].print();
+      mem->in(MemNode::Address)->dump_bfs(3);
+    }
+#endif
     _bb_idx_to_vpointer.at_put(bb_idx, pointers_idx);
     pointers_idx++;
   });
@@ -418,26 +426,26 @@ VPointer::VPointer(MemNode* const mem, const VLoop& vloop,
 #endif
   _nstack(nstack), _analyze_only(analyze_only), _stack_idx(0)
 #ifndef PRODUCT
-  , _tracer(vloop.is_trace_pointer_analysis())
+  , _invalid_reason(nullptr), _tracer(vloop.is_trace_pointer_analysis())
 #endif
 {
   NOT_PRODUCT(_tracer.ctor_1(mem);)
 
   Node* adr = mem->in(MemNode::Address);
   if (!adr->is_AddP()) {
-    assert(!valid(), "too complex");
+    set_invalid("too complex");
     return;
   }
   // Match AddP(base, AddP(ptr, k*iv [+ invariant]), constant)
   Node* base = adr->in(AddPNode::Base);
   // The base address should be loop invariant
   if (is_loop_member(base)) {
-    assert(!valid(), "base address is loop variant");
+    set_invalid("base address is loop variant");
     return;
   }
   // unsafe references require misaligned vector access support
   if (base->is_top() && !Matcher::misaligned_vectors_ok()) {
-    assert(!valid(), "unsafe access");
+    set_invalid("unsafe access");
     return;
   }
 
@@ -449,7 +457,7 @@ VPointer::VPointer(MemNode* const mem, const VLoop& vloop,
     NOT_PRODUCT(_tracer.ctor_3(adr, i);)
 
     if (!scaled_iv_plus_offset(adr->in(AddPNode::Offset))) {
-      assert(!valid(), "too complex");
+      set_invalid("too complex");
       return;
     }
     adr = adr->in(AddPNode::Address);
@@ -464,12 +472,12 @@ VPointer::VPointer(MemNode* const mem, const VLoop& vloop,
     // The address must be invariant for the current loop. But if we are in a main-loop,
     // it must also be invariant of the pre-loop, otherwise we cannot use this address
     // for the pre-loop limit adjustment required for main-loop alignment.
-    assert(!valid(), "adr is loop variant");
+    set_invalid("adr is loop variant");
     return;
   }
 
   if (!base->is_top() && adr != base) {
-    assert(!valid(), "adr and base differ");
+    set_invalid("adr and base differ");
     return;
   }
 
@@ -491,7 +499,7 @@ VPointer::VPointer(MemNode* const mem, const VLoop& vloop,
   if (abs(long_scale) >= max_val ||
       abs(long_stride) >= max_val ||
       abs(long_scale * long_stride) >= max_val) {
-    assert(!valid(), "adr stride*scale is too large");
+    set_invalid("adr stride*scale is too large");
     return;
   }
 
@@ -510,7 +518,7 @@ VPointer::VPointer(VPointer* p) :
 #endif
   _nstack(p->_nstack), _analyze_only(p->_analyze_only), _stack_idx(p->_stack_idx)
 #ifndef PRODUCT
-  , _tracer(p->_tracer._is_trace_alignment)
+  , _invalid_reason(nullptr), _tracer(p->_tracer._is_trace_alignment)
 #endif
 {}
 
@@ -571,7 +579,9 @@ bool VPointer::scaled_iv_plus_offset(Node* n) {
   }
 
   int opc = n->Opcode();
-  if (opc == Op_AddI) {
+  if (opc == Op_AddI || opc == Op_AddL) {
+    // Op_AddL: long index computations, e.g. MemorySegment accesses in the
+    // int inner loop of a long counted loop nest: outer_iv + ConvI2L(iv).
     if (offset_plus_k(n->in(2)) && scaled_iv_plus_offset(n->in(1))) {
       NOT_PRODUCT(_tracer.scaled_iv_plus_offset_4(n);)
       return true;
@@ -847,7 +857,7 @@ void VPointer::print() const {
   tty->print("VPointer[mem: %4d %10s, ", _mem->_idx, _mem->Name());
 
   if (!valid()) {
-    tty->print_cr("invalid]");
+    tty->print_cr("invalid: %s]", _invalid_reason != nullptr ? _invalid_reason : "unknown");
     return;
   }
 
@@ -944,7 +954,7 @@ void VPointer::Tracer::scaled_iv_plus_offset_3(Node* n) {
 
 void VPointer::Tracer::scaled_iv_plus_offset_4(Node* n) {
   if (_is_trace_alignment) {
-    print_depth(); tty->print_cr(" %d VPointer::scaled_iv_plus_offset: Op_AddI PASSED", n->_idx);
+    print_depth(); tty->print_cr(" %d VPointer::scaled_iv_plus_offset: Op_%s PASSED", n->_idx, n->Name());
     print_depth(); tty->print("  \\ %d VPointer::scaled_iv_plus_offset: in(1) is scaled_iv: ", n->in(1)->_idx); n->in(1)->dump();
     print_depth(); tty->print("  \\ %d VPointer::scaled_iv_plus_offset: in(2) is offset_plus_k: ", n->in(2)->_idx); n->in(2)->dump();
   }
@@ -952,7 +962,7 @@ void VPointer::Tracer::scaled_iv_plus_offset_4(Node* n) {
 
 void VPointer::Tracer::scaled_iv_plus_offset_5(Node* n) {
   if (_is_trace_alignment) {
-    print_depth(); tty->print_cr(" %d VPointer::scaled_iv_plus_offset: Op_AddI PASSED", n->_idx);
+    print_depth(); tty->print_cr(" %d VPointer::scaled_iv_plus_offset: Op_%s PASSED", n->_idx, n->Name());
     print_depth(); tty->print("  \\ %d VPointer::scaled_iv_plus_offset: in(2) is scaled_iv: ", n->in(2)->_idx); n->in(2)->dump();
     print_depth(); tty->print("  \\ %d VPointer::scaled_iv_plus_offset: in(1) is offset_plus_k: ", n->in(1)->_idx); n->in(1)->dump();
   }
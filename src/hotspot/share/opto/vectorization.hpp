@@ -163,6 +163,10 @@ class VLoop : public StackObj {
     return _vtrace.is_trace(TraceAutoVectorizationTag::POINTERS);
   }
 
+  bool is_trace_pointer_rejections() const {
+    return _vtrace.is_trace(TraceAutoVectorizationTag::POINTER_REJECTIONS);
+  }
+
   bool is_trace_pointer_analysis() const {
     return _vtrace.is_trace(TraceAutoVectorizationTag::POINTER_ANALYSIS);
   }
@@ -691,6 +695,13 @@ class VPointer : public ArenaObj {
   bool        _analyze_only; // Used in loop unrolling only for vpointer trace
   uint        _stack_idx;    // Used in loop unrolling only for vpointer trace
 
+  NOT_PRODUCT(const char* _invalid_reason;) // why the address could not be parsed
+
+  void set_invalid(const char* reason) {
+    assert(!valid(), "%s", reason);
+    NOT_PRODUCT(_invalid_reason = reason;)
+  }
+
   PhaseIdealLoop* phase() const { return _vloop.phase(); }
   IdealLoopTree*  lpt() const   { return _vloop.lpt(); }
   PhiNode*        iv() const    { return _vloop.iv(); }
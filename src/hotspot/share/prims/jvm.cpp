@@ -45,6 +45,7 @@
 #include "classfile/vmClasses.hpp"
 #include "classfile/vmSymbols.hpp"
 #include "gc/shared/collectedHeap.inline.hpp"
+#include "gc/shared/tlab_globals.hpp"
 #include "interpreter/bytecode.hpp"
 #include "interpreter/bytecodeUtils.hpp"
 #include "jfr/jfrEvents.hpp"
@@ -61,6 +62,7 @@
 #include "oops/klass.inline.hpp"
 #include "oops/method.hpp"
 #include "oops/recordComponent.hpp"
+#include "oops/typeArrayKlass.hpp"
 #include "oops/objArrayKlass.hpp"
 #include "oops/objArrayOop.inline.hpp"
 #include "oops/oop.inline.hpp"
@@ -80,7 +82,7 @@
 #include "runtime/handshake.hpp"
 #include "runtime/java.hpp"
 #include "runtime/javaCalls.hpp"
-#include "runtime/javaThread.hpp"
+#include "runtime/javaThread.inline.hpp"
 #include "runtime/jfieldIDWorkaround.hpp"
 #include "runtime/jniHandles.inline.hpp"
 #include "runtime/os.inline.hpp"
@@ -307,6 +309,27 @@ JVM_ENTRY(void, JVM_ArrayCopy(JNIEnv *env, jclass ignored, jobject src, jint src
   s->klass()->copy_array(s, src_pos, d, dst_pos, length, thread);
 JVM_END
 
+JVM_ENTRY(void*, JVM_PinArray(JNIEnv *env, jarray array))
+  if (array == nullptr) {
+    THROW_NULL(vmSymbols::java_lang_NullPointerException());
+  }
+  oop a = JNIHandles::resolve_non_null(array);
+  if (!a->is_typeArray()) {
+    THROW_MSG_NULL(vmSymbols::java_lang_IllegalArgumentException(), "not a primitive array");
+  }
+  if (!Universe::heap()->pin_object_detached(a)) {
+    return nullptr;
+  }
+  BasicType type = TypeArrayKlass::cast(a->klass())->element_type();
+  return arrayOop(a)->base(type);
+JVM_END
+
+JVM_ENTRY(void, JVM_UnpinArray(JNIEnv *env, jarray array))
+  oop a = JNIHandles::resolve_non_null(array);
+  assert(a->is_typeArray(), "only primitive arrays are pinned");
+  Universe::heap()->unpin_object_detached(a);
+JVM_END
+
 
 static void set_property(Handle props, const char* key, const char* value, TRAPS) {
   JavaValue r(T_OBJECT);
@@ -630,6 +653,22 @@ JVM_ENTRY(void, JVM_SetStackWalkContinuation(JNIEnv *env, jobject stackStream, j
   StackWalk::setContinuation(stackStream_h, anchor, frames_array_h, cont_h, THREAD);
 JVM_END
 
+JVM_ENTRY(jint, JVM_FillCallerLocations(JNIEnv *env, jint mode, jint skip_frames, jobject contScope,
+                                        jobjectArray classes, jlongArray locations))
+  Handle contScope_h(THREAD, JNIHandles::resolve(contScope));
+  objArrayHandle classes_h(THREAD, objArrayOop(JNIHandles::resolve(classes)));
+  typeArrayHandle locations_h(THREAD, typeArrayOop(JNIHandles::resolve(locations)));
+
+  return StackWalk::fill_caller_locations(mode, skip_frames, contScope_h, classes_h, locations_h, THREAD);
+JVM_END
+
+JVM_ENTRY(void, JVM_InitCallerFrameInfo(JNIEnv *env, jobject frameInfo, jclass holder, jlong location))
+  Handle stack_frame_info(THREAD, JNIHandles::resolve_non_null(frameInfo));
+  Klass* k = java_lang_Class::as_Klass(JNIHandles::resolve_non_null(holder));
+
+  StackWalk::init_caller_frame_info(stack_frame_info, k, location, THREAD);
+JVM_END
+
 // java.lang.Object ///////////////////////////////////////////////
 
 
@@ -3086,6 +3125,27 @@ JVM_END
 JVM_ENTRY(void, JVM_SetCurrentThread(JNIEnv* env, jobject thisThread,
                                      jobject theThread))
   oop threadObj = JNIHandles::resolve(theThread);
+  if (VirtualThreadTLABSizeHints && UseTLAB && ResizeTLAB) {
+    thread->update_vthread_tlab_size_hint(threadObj);
+  }
+  if (VirtualThreadCPUTime) {
+    const oop old_vthread = thread->vthread();
+    const jlong used = thread->update_vthread_cpu_time(threadObj);
+#if INCLUDE_JFR
+    if (used >= 0) {
+      // Still attributed to the virtual thread that unmounts.
+      EventVirtualThreadCPUTime e;
+      if (e.should_commit()) {
+        e.set_cpuTime(used);
+        e.set_totalCpuTime(java_lang_Thread::cpu_time(old_vthread));
+        e.commit();
+      }
+    }
+#else
+    (void)used;
+    (void)old_vthread;
+#endif
+  }
   thread->set_vthread(threadObj);
 
   // Set lock id of new current Thread
@@ -4010,6 +4070,40 @@ JVM_ENTRY(jobject, JVM_TakeVirtualThreadListToUnblock(JNIEnv* env, jclass ignore
     parkEvent->park();
   }
 JVM_END
+
+// For each carrier thread, store the os::javaTimeNanos() at which it blocked with
+// its virtual thread pinned, -1 if it is running native code with a virtual thread
+// mounted, or 0 otherwise. Returns the number of carriers that are blocked or in
+// native. Carriers that are null or not alive are reported as 0.
+JVM_ENTRY(jint, JVM_GetCarrierThreadStates(JNIEnv* env, jclass ignored, jobjectArray carriers, jlongArray states))
+  objArrayHandle carriers_h(THREAD, objArrayOop(JNIHandles::resolve_non_null(carriers)));
+  typeArrayHandle states_h(THREAD, typeArrayOop(JNIHandles::resolve_non_null(states)));
+  const int length = carriers_h->length();
+  if (states_h->length() < length) {
+    THROW_(vmSymbols::java_lang_IllegalArgumentException(), 0);
+  }
+
+  ThreadsListHandle tlh(THREAD);
+  jint blocked = 0;
+  for (int i = 0; i < length; i++) {
+    jlong state = 0;
+    oop carrier = carriers_h->obj_at(i);
+    JavaThread* jt = carrier != nullptr ? java_lang_Thread::thread_acquire(carrier) : nullptr;
+    if (jt != nullptr && tlh.includes(jt)) {
+      const jlong since = jt->pinned_blocked_since();
+      if (since != 0) {
+        state = since;
+      } else if (jt->thread_state() == _thread_in_native && jt->last_continuation() != nullptr) {
+        state = -1;
+      }
+    }
+    if (state != 0) {
+      blocked++;
+    }
+    states_h->long_at_put(i, state);
+  }
+  return blocked;
+JVM_END
 /*
  * Return the current class's class file version.  The low order 16 bits of the
  * returned jint contain the class's major version.  The high order 16 bits
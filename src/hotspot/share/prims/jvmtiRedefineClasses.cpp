@@ -26,7 +26,7 @@
 #include "cds/cdsConfig.hpp"
 #include "cds/metaspaceShared.hpp"
 #include "classfile/classFileStream.hpp"
-#include "classfile/classLoaderDataGraph.hpp"
+#include "classfile/classLoaderDataGraph.inline.hpp"
 #include "classfile/classLoadInfo.hpp"
 #include "classfile/javaClasses.inline.hpp"
 #include "classfile/metadataOnStackMark.hpp"
@@ -277,8 +277,7 @@ void VM_RedefineClasses::doit() {
   // that reference methods of the evolved classes.
   // Have to do this after all classes are redefined and all methods that
   // are redefined are marked as old.
-  AdjustAndCleanMetadata adjust_and_clean_metadata(current);
-  ClassLoaderDataGraph::classes_do(&adjust_and_clean_metadata);
+  adjust_and_clean_metadata(current);
 
   // JSR-292 support
   if (_any_class_has_resolved_methods) {
@@ -3708,6 +3707,44 @@ void VM_RedefineClasses::set_new_constant_pool(
 // must be cleaned.
 
 // Adjust cpools and vtables closure
+class CollectKlassesClosure : public KlassClosure {
+  GrowableArray<Klass*>* _klasses;
+ public:
+  CollectKlassesClosure(GrowableArray<Klass*>* klasses) : _klasses(klasses) {}
+  void do_klass(Klass* k) { _klasses->append(k); }
+};
+
+void VM_RedefineClasses::ParallelAdjustAndCleanMetadata::work(uint worker_id) {
+  // Claim classes in small chunks; the work per class varies greatly.
+  const int chunk = 32;
+  AdjustAndCleanMetadata cl(Thread::current());
+  for (;;) {
+    int start = Atomic::fetch_then_add(&_claimed, chunk);
+    if (start >= _klasses->length()) {
+      return;
+    }
+    int end = MIN2(start + chunk, _klasses->length());
+    for (int i = start; i < end; i++) {
+      cl.do_klass(_klasses->at(i));
+    }
+  }
+}
+
+void VM_RedefineClasses::adjust_and_clean_metadata(Thread* current) {
+  WorkerThreads* workers = Universe::heap()->safepoint_workers();
+  if (JvmtiParallelRedefineAdjust && workers != nullptr && workers->active_workers() > 1) {
+    ResourceMark rm(current);
+    GrowableArray<Klass*> klasses(checked_cast<int>(ClassLoaderDataGraph::num_instance_classes()));
+    CollectKlassesClosure collect(&klasses);
+    ClassLoaderDataGraph::classes_do(&collect);
+    ParallelAdjustAndCleanMetadata task(&klasses);
+    workers->run_task(&task);
+  } else {
+    AdjustAndCleanMetadata adjust_and_clean_metadata(current);
+    ClassLoaderDataGraph::classes_do(&adjust_and_clean_metadata);
+  }
+}
+
 void VM_RedefineClasses::AdjustAndCleanMetadata::do_klass(Klass* k) {
 
   // This is a very busy routine. We don't want too much tracing
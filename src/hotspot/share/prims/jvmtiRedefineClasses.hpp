@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2003, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2003, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,7 @@
 #ifndef SHARE_PRIMS_JVMTIREDEFINECLASSES_HPP
 #define SHARE_PRIMS_JVMTIREDEFINECLASSES_HPP
 
+#include "gc/shared/workerThread.hpp"
 #include "jvmtifiles/jvmtiEnv.hpp"
 #include "memory/oopFactory.hpp"
 #include "memory/resourceArea.hpp"
@@ -520,6 +521,20 @@ class VM_RedefineClasses: public VM_Operation {
     void do_klass(Klass* k);
   };
 
+  // Applies AdjustAndCleanMetadata to a snapshot of all classes, using the
+  // GC safepoint workers. Each class is only touched by the worker that
+  // claimed it.
+  class ParallelAdjustAndCleanMetadata : public WorkerTask {
+    GrowableArray<Klass*>* _klasses;
+    volatile int _claimed;
+   public:
+    ParallelAdjustAndCleanMetadata(GrowableArray<Klass*>* klasses) :
+      WorkerTask("Adjust and Clean Metadata"), _klasses(klasses), _claimed(0) {}
+    void work(uint worker_id);
+  };
+
+  void adjust_and_clean_metadata(Thread* current);
+
  public:
   VM_RedefineClasses(jint class_count,
                      const jvmtiClassDefinition *class_defs,
@@ -29,6 +29,7 @@
 #include "classfile/vmClasses.hpp"
 #include "classfile/vmSymbols.hpp"
 #include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/workerThread.hpp"
 #include "jvmtifiles/jvmtiEnv.hpp"
 #include "logging/log.hpp"
 #include "memory/allocation.inline.hpp"
@@ -873,13 +874,70 @@ static jint invoke_primitive_field_callback_for_instance_fields(
 
 // VM operation to iterate over all objects in the heap (both reachable
 // and unreachable)
+// Collects the objects accepted by a filter, in parallel. The filter must be
+// safe to apply from several GC workers at a time.
+class FilterHeapObjectsTask : public WorkerTask {
+ private:
+  ParallelObjectIterator* _poi;
+  BoolObjectClosure* _filter;
+  GrowableArrayCHeap<oop, mtServiceability>* _objects;
+  Mutex _lock;
+
+  class CollectClosure : public ObjectClosure {
+    BoolObjectClosure* _filter;
+    GrowableArrayCHeap<oop, mtServiceability> _objects;
+   public:
+    CollectClosure(BoolObjectClosure* filter) : _filter(filter), _objects() {}
+    GrowableArrayCHeap<oop, mtServiceability>* objects() { return &_objects; }
+    void do_object(oop obj) {
+      if (_filter->do_object_b(obj)) {
+        _objects.append(obj);
+      }
+    }
+  };
+
+ public:
+  FilterHeapObjectsTask(ParallelObjectIterator* poi,
+                        BoolObjectClosure* filter,
+                        GrowableArrayCHeap<oop, mtServiceability>* objects) :
+    WorkerTask("JVMTI Filter Heap Objects"),
+    _poi(poi),
+    _filter(filter),
+    _objects(objects),
+    _lock(Mutex::nosafepoint, "FilterHeapObjectsTask_lock") {}
+
+  void work(uint worker_id) {
+    CollectClosure cl(_filter);
+    _poi->object_iterate(&cl, worker_id);
+    MutexLocker ml(&_lock, Mutex::_no_safepoint_check_flag);
+    _objects->appendAll(cl.objects());
+  }
+};
+
 class VM_HeapIterateOperation: public VM_Operation {
  private:
   ObjectClosure* _blk;
   GrowableArray<jlong>* const _dead_objects;
+  // Optional filter that can be applied by GC workers before _blk, which is
+  // then only applied to the accepted objects.
+  BoolObjectClosure* const _prefilter;
+
+  void iterate_prefiltered(WorkerThreads* workers) {
+    GrowableArrayCHeap<oop, mtServiceability> objects;
+    {
+      ParallelObjectIterator poi(workers->active_workers());
+      FilterHeapObjectsTask task(&poi, _prefilter, &objects);
+      workers->run_task(&task);
+    }
+    for (int i = 0; i < objects.length(); i++) {
+      _blk->do_object(objects.at(i));
+    }
+  }
+
  public:
-  VM_HeapIterateOperation(ObjectClosure* blk, GrowableArray<jlong>* objects) :
-    _blk(blk), _dead_objects(objects) { }
+  VM_HeapIterateOperation(ObjectClosure* blk, GrowableArray<jlong>* objects,
+                          BoolObjectClosure* prefilter = nullptr) :
+    _blk(blk), _dead_objects(objects), _prefilter(prefilter) { }
 
   VMOp_Type type() const { return VMOp_HeapIterateOperation; }
   void doit() {
@@ -898,7 +956,13 @@ class VM_HeapIterateOperation: public VM_Operation {
     }
 
     // do the iteration
-    Universe::heap()->object_iterate(_blk);
+    WorkerThreads* workers = Universe::heap()->safepoint_workers();
+    if (_prefilter != nullptr && JvmtiParallelHeapIteration &&
+        workers != nullptr && workers->active_workers() > 1) {
+      iterate_prefiltered(workers);
+    } else {
+      Universe::heap()->object_iterate(_blk);
+    }
   }
 };
 
@@ -1113,6 +1177,51 @@ void IterateThroughHeapObjectClosure::do_object(oop obj) {
 };
 
 
+// A conservative version of the class and heap filters of IterateThroughHeap,
+// applied by several GC workers at a time. Objects are only rejected when the
+// filters reject them for sure; tags are only looked up if that does not need
+// to install an identity hash, otherwise the object is passed on to
+// IterateThroughHeapObjectClosure, which decides in the VM thread.
+class IterateThroughHeapPrefilter : public BoolObjectClosure {
+ private:
+  JvmtiTagMap* _tag_map;
+  Klass* _klass;
+  int _heap_filter;
+
+  bool known_tag(oop obj, jlong* tag) const {
+    if (!obj->mark().is_unlocked()) {
+      return false;
+    }
+    *tag = _tag_map->hashmap()->find(obj);
+    return true;
+  }
+
+ public:
+  IterateThroughHeapPrefilter(JvmtiTagMap* tag_map, Klass* klass, int heap_filter) :
+    _tag_map(tag_map), _klass(klass), _heap_filter(heap_filter) {}
+
+  // Without a klass or tag filter all objects are accepted, and parallel
+  // filtering would only collect the whole heap.
+  static bool is_selective(Klass* klass, int heap_filter) {
+    return klass != nullptr ||
+           (heap_filter & (JVMTI_HEAP_FILTER_TAGGED | JVMTI_HEAP_FILTER_UNTAGGED |
+                           JVMTI_HEAP_FILTER_CLASS_TAGGED | JVMTI_HEAP_FILTER_CLASS_UNTAGGED)) != 0;
+  }
+
+  bool do_object_b(oop obj) {
+    if (is_filtered_by_klass_filter(obj, _klass)) {
+      return false;
+    }
+    jlong obj_tag;
+    jlong klass_tag;
+    oop mirror = obj->klass()->java_mirror_no_keepalive();
+    if (mirror == nullptr || !known_tag(obj, &obj_tag) || !known_tag(mirror, &klass_tag)) {
+      return true;
+    }
+    return !is_filtered_by_heap_filter(obj_tag, klass_tag, _heap_filter);
+  }
+};
+
 // Deprecated function to iterate over all objects in the heap
 void JvmtiTagMap::iterate_over_heap(jvmtiHeapObjectFilter object_filter,
                                     Klass* klass,
@@ -1160,7 +1269,9 @@ void JvmtiTagMap::iterate_through_heap(jint heap_filter,
                                         heap_filter,
                                         callbacks,
                                         user_data);
-    VM_HeapIterateOperation op(&blk, &dead_objects);
+    IterateThroughHeapPrefilter prefilter(this, klass, heap_filter);
+    VM_HeapIterateOperation op(&blk, &dead_objects,
+                               IterateThroughHeapPrefilter::is_selective(klass, heap_filter) ? &prefilter : nullptr);
     VMThread::execute(&op);
   }
   // Post events outside of Heap_lock
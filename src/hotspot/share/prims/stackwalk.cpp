@@ -564,6 +564,86 @@ jint StackWalk::fetchNextBatch(Handle stackStream, jint mode, jlong magic,
   return 0;
 }
 
+// Walks the current thread's stack once, without a StackStream callback,
+// and records the holder mirror and the caller location of each frame.
+// This is the fast path for callers such as logging frameworks that only
+// need a few frames and cache StackFrameInfo per location on the Java side.
+//
+// Parameters:
+//   mode           Stack walking mode, only JVM_STACKWALK_SHOW_HIDDEN_FRAMES is honored.
+//   skip_frames    Number of frames to skip after the StackWalker frames.
+//   cont_scope     Continuation scope to walk (if not in this scope, we'll walk all the way).
+//   classes        Class[] buffer receiving the holder of each frame.
+//   locations      long[] buffer receiving the caller location of each frame.
+//
+// Returns the number of frames filled in the buffers.
+//
+int StackWalk::fill_caller_locations(jint mode, int skip_frames, Handle cont_scope,
+                                     objArrayHandle classes, typeArrayHandle locations,
+                                     TRAPS) {
+  JavaThread* jt = THREAD;
+  if (!jt->has_last_Java_frame()) {
+    THROW_MSG_0(vmSymbols::java_lang_InternalError(), "fill_caller_locations: no stack trace");
+  }
+  if (classes.is_null() || locations.is_null()) {
+    THROW_MSG_0(vmSymbols::java_lang_NullPointerException(), "buffer is null");
+  }
+  int limit = MIN2(classes->length(), locations->length());
+
+  ResourceMark rm(THREAD);
+  HandleMark hm(THREAD);
+  JavaFrameStream stream(jt, JVM_STACKWALK_CLASS_INFO_ONLY, cont_scope, Handle());
+
+  Klass* stackWalker_klass = vmClasses::StackWalker_klass();
+  Klass* abstractStackWalker_klass = vmClasses::AbstractStackWalker_klass();
+  while (!stream.at_end()) {
+    InstanceKlass* ik = stream.method()->method_holder();
+    if (ik != stackWalker_klass &&
+          ik != abstractStackWalker_klass && ik->super() != abstractStackWalker_klass &&
+          ik->name() != vmSymbols::java_lang_StackStreamFactory()) {
+      break;
+    }
+    stream.next();
+  }
+
+  int count = 0;
+  for (; count < limit && !stream.at_end(); stream.next()) {
+    Method* method = stream.method();
+    if (method == nullptr) continue;
+    if (!ShowHiddenFrames && skip_hidden_frames(mode) && method->is_hidden()) continue;
+    if (skip_frames > 0) {
+      skip_frames--;
+      continue;
+    }
+    classes->obj_at_put(count, method->method_holder()->java_mirror());
+    locations->long_at_put(count, caller_location(method, stream.bci()));
+    count++;
+  }
+  log_debug(stackwalk)("fill_caller_locations returns %d", count);
+  return count;
+}
+
+// Fill in a StackFrameInfo from a caller location recorded by
+// fill_caller_locations. The method is looked up by its original idnum and
+// the recorded constant pool version, so a frame captured before the class
+// was redefined resolves to the method version it was executing, as in
+// Backtrace::get_method. If that version is gone, the bci cannot be trusted
+// against the current method and the location is rejected.
+void StackWalk::init_caller_frame_info(Handle stackFrame, Klass* holder, jlong location, TRAPS) {
+  if (holder == nullptr || !holder->is_instance_klass()) {
+    THROW_MSG(vmSymbols::java_lang_IllegalArgumentException(), "invalid caller class");
+  }
+  InstanceKlass* ik = InstanceKlass::cast(holder);
+  int idnum = caller_location_idnum(location);
+  int version = caller_location_version(location);
+  Method* m = ik->method_with_orig_idnum(idnum, version);
+  if (m == nullptr) {
+    THROW_MSG(vmSymbols::java_lang_IllegalArgumentException(), "invalid caller location");
+  }
+  methodHandle method(THREAD, m);
+  java_lang_StackFrameInfo::set_method_and_bci(stackFrame, method, caller_location_bci(location), nullptr, THREAD);
+}
+
 void StackWalk::setContinuation(Handle stackStream, jlong magic, objArrayHandle frames_array, Handle cont, TRAPS) {
   JavaThread* jt = JavaThread::cast(THREAD);
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2015, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -173,5 +173,33 @@ class StackWalk : public AllStatic {
 
   static void setContinuation(Handle stackStream, jlong magic, objArrayHandle frames_array,
                               Handle cont, TRAPS);
+
+  // Caller locations are (mirror, location) pairs where the location packs
+  // the original method idnum, the constant pool version and the bci of the
+  // frame. The version tells a redefined method apart from its current one.
+  static inline jlong caller_location(Method* method, int bci) {
+    // see BacktraceBuilder::push
+    if (bci == SynchronizationEntryBCI) bci = 0;
+    int version = method->constants()->version();
+    assert((jushort)version == version, "version should be short");
+    return (jlong)(((julong)method->orig_method_idnum() << 32) |
+                   ((julong)(version & 0xFFFF) << 16) |
+                   (julong)(bci & 0xFFFF));
+  }
+  static inline int caller_location_idnum(jlong location) {
+    return (int)(((julong)location >> 32) & 0xFFFF);
+  }
+  static inline int caller_location_version(jlong location) {
+    return (int)(((julong)location >> 16) & 0xFFFF);
+  }
+  static inline int caller_location_bci(jlong location) {
+    return (int)(location & 0xFFFF);
+  }
+
+  static int fill_caller_locations(jint mode, int skip_frames, Handle cont_scope,
+                                   objArrayHandle classes, typeArrayHandle locations,
+                                   TRAPS);
+
+  static void init_caller_frame_info(Handle stackFrame, Klass* holder, jlong location, TRAPS);
 };
 #endif // SHARE_PRIMS_STACKWALK_HPP
@@ -776,6 +776,8 @@ UNSAFE_ENTRY(void, Unsafe_Park(JNIEnv *env, jobject unsafe, jboolean isAbsolute,
   EventThreadPark event;
 
   JavaThreadParkedState jtps(thread, time != 0);
+  // A carrier only parks with a virtual thread mounted if the virtual thread is pinned
+  PinnedBlockMark pbm(thread);
   thread->parker()->park(isAbsolute != 0, time);
   if (event.should_commit()) {
     const oop obj = thread->current_park_blocker();
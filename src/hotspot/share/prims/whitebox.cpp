@@ -87,7 +87,7 @@
 #include "runtime/javaCalls.hpp"
 #include "runtime/javaThread.inline.hpp"
 #include "runtime/jniHandles.inline.hpp"
-#include "runtime/lockStack.hpp"
+#include "runtime/lockStack.inline.hpp"
 #include "runtime/os.hpp"
 #include "runtime/stackFrameStream.inline.hpp"
 #include "runtime/synchronizer.hpp"
@@ -1868,7 +1868,7 @@ WB_ENTRY(jlong, WB_getInUseMonitorCount(JNIEnv* env, jobject wb))
 WB_END
 
 WB_ENTRY(jint, WB_getLockStackCapacity(JNIEnv* env))
-  return (jint) LockStack::CAPACITY;
+  return (jint) LockStack::capacity();
 WB_END
 
 WB_ENTRY(jboolean, WB_supportsRecursiveLightweightLocking(JNIEnv* env))
@@ -32,6 +32,7 @@
 #include "runtime/continuationEntry.inline.hpp"
 #include "runtime/continuationHelper.inline.hpp"
 #include "runtime/continuationJavaClasses.inline.hpp"
+#include "runtime/continuationStatistics.hpp"
 #include "runtime/continuationWrapper.inline.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/javaThread.inline.hpp"
@@ -532,6 +533,7 @@ void continuations_init() { Continuations::init(); }
 
 void Continuations::init() {
   Continuation::init();
+  ContinuationStatistics::init();
 }
 
 bool Continuations::enabled() {
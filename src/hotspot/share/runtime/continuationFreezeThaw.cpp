@@ -28,6 +28,7 @@
 #include "code/codeCache.inline.hpp"
 #include "code/nmethod.inline.hpp"
 #include "code/vmreg.inline.hpp"
+#include "compiler/compilationPolicy.hpp"
 #include "compiler/oopMap.inline.hpp"
 #include "gc/shared/continuationGCSupport.inline.hpp"
 #include "gc/shared/gc_globals.hpp"
@@ -49,6 +50,7 @@
 #include "runtime/continuationEntry.inline.hpp"
 #include "runtime/continuationHelper.inline.hpp"
 #include "runtime/continuationJavaClasses.inline.hpp"
+#include "runtime/continuationStatistics.hpp"
 #include "runtime/continuationWrapper.inline.hpp"
 #include "runtime/frame.inline.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
@@ -57,9 +59,11 @@
 #include "runtime/keepStackGCProcessed.hpp"
 #include "runtime/objectMonitor.inline.hpp"
 #include "runtime/orderAccess.hpp"
+#include "runtime/perfHistograms.hpp"
 #include "runtime/prefetch.inline.hpp"
 #include "runtime/smallRegisterMap.inline.hpp"
 #include "runtime/sharedRuntime.hpp"
+#include "runtime/stackChunkCache.inline.hpp"
 #include "runtime/stackChunkFrameStream.inline.hpp"
 #include "runtime/stackFrameStream.inline.hpp"
 #include "runtime/stackOverflow.hpp"
@@ -389,11 +393,12 @@ class FreezeBase : public StackObj {
   intptr_t* _orig_chunk_sp;
   int _fast_freeze_size;
   bool _empty;
+  int _allocated_stack_size; // stack size of the chunk last returned by allocate_chunk
 #endif
 
   JvmtiSampledObjectAllocEventCollector* _jvmti_event_collector;
 
-  NOT_PRODUCT(int _frames;)
+  int _frames;
   DEBUG_ONLY(intptr_t* _last_write;)
 
   inline FreezeBase(JavaThread* thread, ContinuationWrapper& cont, intptr_t* sp, bool preempt);
@@ -416,6 +421,7 @@ class FreezeBase : public StackObj {
 protected:
   inline void init_rest();
   void throw_stack_overflow_on_humongous_chunk();
+  void reinitialize_cached_chunk(stackChunkOop chunk, int argsize_md);
 
   // fast path
   inline void copy_to_chunk(intptr_t* from, intptr_t* to, int size);
@@ -443,6 +449,7 @@ class FreezeBase : public StackObj {
   freeze_result recurse_freeze_compiled_frame(frame& f, frame& caller, int callee_argsize, bool callee_interpreted);
   NOINLINE freeze_result recurse_freeze_stub_frame(frame& f, frame& caller);
   NOINLINE freeze_result recurse_freeze_native_frame(frame& f, frame& caller);
+  NOINLINE freeze_result pinned_native(const frame& f);
   NOINLINE void finish_freeze(const frame& f, const frame& top);
 
   void freeze_lockstack();
@@ -537,7 +544,7 @@ FreezeBase::FreezeBase(JavaThread* thread, ContinuationWrapper& cont, intptr_t*
 void FreezeBase::init_rest() { // we want to postpone some initialization after chunk handling
   _freeze_size = 0;
   _total_align_size = 0;
-  NOT_PRODUCT(_frames = 0;)
+  _frames = 0;
 }
 
 void FreezeBase::freeze_lockstack() {
@@ -694,9 +701,12 @@ bool FreezeBase::freeze_fast_new_chunk(stackChunkOop chunk) {
   chunk->set_max_thawing_size(cont_size());
 
   // in a fresh chunk, we freeze *with* the bottom-most frame's stack arguments.
-  // They'll then be stored twice: in the chunk and in the parent chunk's top frame
-  const int chunk_start_sp = cont_size() + frame::metadata_words + _monitors_in_lockstack;
-  assert(chunk_start_sp == chunk->stack_size(), "");
+  // They'll then be stored twice: in the chunk and in the parent chunk's top frame.
+  // A chunk reused from the StackChunkCache or presized (PresizeStackChunks)
+  // might be larger than what we need.
+  const int chunk_start_sp = chunk->stack_size();
+  assert(chunk_start_sp == _allocated_stack_size, "chunk_start_sp: %d allocated: %d", chunk_start_sp, _allocated_stack_size);
+  assert(chunk_start_sp >= cont_size() + frame::metadata_words + _monitors_in_lockstack, "");
 
   DEBUG_ONLY(_orig_chunk_sp = chunk->start_address() + chunk_start_sp;)
 
@@ -781,6 +791,7 @@ void FreezeBase::freeze_fast_copy(stackChunkOop chunk, int chunk_start_sp CONT_J
   }
 
   _cont.write();
+  _thread->cont_counters().record_fast_freeze(cont_size());
 
   log_develop_trace(continuations)("FREEZE CHUNK #" INTPTR_FORMAT " (young)", _cont.hash());
   LogTarget(Trace, continuations) lt;
@@ -838,6 +849,7 @@ NOINLINE freeze_result FreezeBase::freeze_slow() {
   if (res == freeze_ok) {
     finish_freeze(f, caller);
     _cont.write();
+    _thread->cont_counters().record_slow_freeze(_freeze_size, _frames);
   }
 
   return res;
@@ -878,7 +890,7 @@ NOINLINE freeze_result FreezeBase::recurse_freeze(frame& f, frame& caller, int c
   if (f.is_compiled_frame()) {
     if (UNLIKELY(f.oop_map() == nullptr)) {
       // special native frame
-      return freeze_pinned_native;
+      return pinned_native(f);
     }
     return recurse_freeze_compiled_frame(f, caller, callee_argsize, callee_interpreted);
   } else if (f.is_interpreted_frame()) {
@@ -888,8 +900,22 @@ NOINLINE freeze_result FreezeBase::recurse_freeze(frame& f, frame& caller, int c
     assert(f.is_native_frame() || f.is_runtime_frame(), "");
     return f.is_native_frame() ? recurse_freeze_native_frame(f, caller) : recurse_freeze_stub_frame(f, caller);
   } else {
-    return freeze_pinned_native;
+    return pinned_native(f);
+  }
+}
+
+// Frames that are not Java frames cannot be moved off the carrier's stack. The most common such
+// frames in a continuation are the entry frames of upcalls from native code, through JNI into a
+// call stub or through an FFM upcall stub, and these are counted separately so that pinning by
+// native callbacks can be told apart from other native frames.
+NOINLINE freeze_result FreezeBase::pinned_native(const frame& f) {
+  const bool upcall = f.is_entry_frame() || f.is_upcall_stub_frame();
+  if (upcall) {
+    _thread->cont_counters().inc(ContinuationCounters::pinned_upcall);
   }
+  log_debug(continuations)("PINNED by %s frame %s at " INTPTR_FORMAT,
+                           upcall ? "upcall" : "native", f.cb() != nullptr ? f.cb()->name() : "<unknown>", p2i(f.pc()));
+  return freeze_pinned_native;
 }
 
 // The parameter callee_argsize includes metadata that has to be part of caller/callee overlap.
@@ -901,7 +927,7 @@ inline freeze_result FreezeBase::recurse_freeze_java_frame(const frame& f, frame
   assert(fsize > 0, "");
   assert(argsize >= 0, "");
   _freeze_size += fsize;
-  NOT_PRODUCT(_frames++;)
+  _frames++;
 
   assert(FKind::frame_bottom(f) <= _bottom_address, "");
 
@@ -1504,6 +1530,24 @@ stackChunkOop Freeze<ConfigT>::allocate_chunk(size_t stack_size, int argsize_md)
   JavaThread* current = _preempt ? JavaThread::current() : _thread;
   assert(current == JavaThread::current(), "should be current");
 
+  if (UseStackChunkCache) {
+    stackChunkOop chunk = current->stack_chunk_cache().take((int)stack_size);
+    if (chunk != nullptr) {
+      reinitialize_cached_chunk(chunk, argsize_md);
+      DEBUG_ONLY(_allocated_stack_size = chunk->stack_size();)
+      return chunk;
+    }
+  }
+
+  if (PresizeStackChunks) {
+    size_t presized_stack_size = (size_t)current->stack_chunk_cache().presize((int)stack_size);
+    size_t presized_size_in_words = klass->instance_size(presized_stack_size);
+    if (CollectedHeap::stack_chunk_max_size() == 0 || presized_size_in_words < CollectedHeap::stack_chunk_max_size()) {
+      stack_size = presized_stack_size;
+      size_in_words = presized_size_in_words;
+    }
+  }
+
   // Allocate the chunk.
   //
   // This might safepoint while allocating, but all safepointing due to
@@ -1516,6 +1560,8 @@ stackChunkOop Freeze<ConfigT>::allocate_chunk(size_t stack_size, int argsize_md)
   if (chunk == nullptr) {
     return nullptr; // OOME
   }
+  _thread->cont_counters().inc(ContinuationCounters::chunks_allocated);
+  DEBUG_ONLY(_allocated_stack_size = (int)stack_size;)
 
   // assert that chunk is properly initialized
   assert(chunk->stack_size() == (int)stack_size, "");
@@ -1569,6 +1615,34 @@ stackChunkOop Freeze<ConfigT>::allocate_chunk(size_t stack_size, int argsize_md)
   return chunk;
 }
 
+// Prepares an empty chunk taken from the StackChunkCache for use by this continuation,
+// establishing the same state StackChunkAllocator::initialize and allocate_chunk give
+// a newly allocated chunk, except that the stack may be larger than requested.
+void FreezeBase::reinitialize_cached_chunk(stackChunkOop chunk, int argsize_md) {
+  log_develop_trace(continuations)("allocate_chunk reusing cached chunk");
+  assert(chunk->is_empty(), "");
+  assert(!chunk->requires_barriers(), "cached chunks must be reusable on the fast path");
+
+  int bottom = chunk->stack_size() - argsize_md;
+  chunk->set_bottom(bottom);
+  chunk->set_sp(bottom);
+  chunk->set_pc(nullptr);
+  chunk->set_flags(0);
+  chunk->set_max_thawing_size(0);
+  chunk->set_lockstack_size(0);
+  chunk->set_object_waiter(nullptr);
+
+  chunk->set_parent(_cont.last_nonempty_chunk());
+  chunk->set_cont(_cont.continuation());
+
+#if INCLUDE_ZGC
+  if (UseZGC && ZGenerational) {
+    ZStackChunkGCData::initialize(chunk);
+  }
+#endif
+  _barriers = false;
+}
+
 void FreezeBase::throw_stack_overflow_on_humongous_chunk() {
   ContinuationWrapper::SafepointOp so(_thread, _cont); // could also call _cont.done() instead
   Exceptions::_throw_msg(_thread, __FILE__, __LINE__, vmSymbols::java_lang_StackOverflowError(), "Humongous stack chunk");
@@ -1744,11 +1818,12 @@ static inline int freeze_internal(JavaThread* current, intptr_t* const sp, int f
   LOOM_MONITOR_SUPPORT_ONLY(assert(LockingMode == LM_LEGACY || (current->held_monitor_count() == 0 && current->jni_monitor_count() == 0),
          "Held monitor count should only be used for LM_LEGACY: " INT64_FORMAT " JNI: " INT64_FORMAT, (int64_t)current->held_monitor_count(), (int64_t)current->jni_monitor_count());)
 
-  if (entry->is_pinned() || current->held_monitor_count() > 0) {
+  if (UNLIKELY(entry->is_pinned() || current->held_monitor_count() > 0)) {
     log_develop_debug(continuations)("PINNED due to critical section/hold monitor");
     verify_continuation(cont.continuation());
     freeze_result res = entry->is_pinned() ? freeze_pinned_cs : freeze_pinned_monitor;
     log_develop_trace(continuations)("=== end of freeze (fail %d)", res);
+    current->cont_counters().record_freeze_failure(res);
     // Avoid Thread.yield() loops without safepoint polls.
     if (SafepointMechanism::should_process(current) && !preempt) {
       cont.done(); // allow safepoint
@@ -1761,7 +1836,9 @@ static inline int freeze_internal(JavaThread* current, intptr_t* const sp, int f
 
   assert(!current->cont_fastpath() || freeze.check_valid_fast_path(), "");
   bool fast = UseContinuationFastPath && current->cont_fastpath();
-  if (fast && freeze.size_if_fast_freeze_available() > 0) {
+  // The common case: only compiled frames above the entry, and they fit into the
+  // existing tail chunk. No allocation and no transition to the VM are needed.
+  if (LIKELY(fast && freeze.size_if_fast_freeze_available() > 0)) {
     freeze.freeze_fast_existing_chunk();
     CONT_JFR_ONLY(freeze.jfr_info().post_jfr_event(&event, oopCont, current);)
     return !preempt ? freeze_epilog(cont) : preempt_epilog(cont, freeze_ok, freeze.last_frame(), freeze_kind);
@@ -1772,6 +1849,9 @@ static inline int freeze_internal(JavaThread* current, intptr_t* const sp, int f
     freeze.set_jvmti_event_collector(&jsoaec);
 
     freeze_result res = fast ? freeze.try_freeze_fast() : freeze.freeze_slow();
+    if (UNLIKELY(res != freeze_ok)) {
+      current->cont_counters().record_freeze_failure(res);
+    }
 
     CONT_JFR_ONLY(freeze.jfr_info().post_jfr_event(&event, oopCont, current);)
     preempt_epilog(cont, res, freeze.last_frame(), freeze_kind);
@@ -1786,6 +1866,9 @@ static inline int freeze_internal(JavaThread* current, intptr_t* const sp, int f
     freeze.set_jvmti_event_collector(&jsoaec);
 
     freeze_result res = fast ? freeze.try_freeze_fast() : freeze.freeze_slow();
+    if (UNLIKELY(res != freeze_ok)) {
+      current->cont_counters().record_freeze_failure(res);
+    }
 
     CONT_JFR_ONLY(freeze.jfr_info().post_jfr_event(&event, oopCont, current);)
     freeze_epilog(current, cont, res);
@@ -1933,7 +2016,8 @@ class ThawBase : public StackObj {
   }
 
   void clear_chunk(stackChunkOop chunk);
-  int remove_top_compiled_frame_from_chunk(stackChunkOop chunk, int &argsize);
+  static int count_frames(stackChunkOop chunk);
+  int remove_top_compiled_frames_from_chunk(stackChunkOop chunk, int &argsize, int max_frames, int &num_frames);
   void copy_from_chunk(intptr_t* from, intptr_t* to, int size);
 
   // fast path
@@ -1980,6 +2064,42 @@ class ThawBase : public StackObj {
   CONT_JFR_ONLY(FreezeThawJfrInfo& jfr_info() { return _jfr_info; })
 };
 
+// Adaptive lazy thaw (ContinuationAdaptiveThaw).
+//
+// Thawing a small chunk in full only pays off if the continuation returns into its older
+// frames before it yields again. If it doesn't, as in ping-pong workloads that park and
+// unpark at the same depth, those frames are copied back unchanged by the next freeze,
+// whereas frames left in the chunk by a lazy thaw are not copied at all: the next freeze
+// only copies the frames that ran since the mount on top of them.
+//
+// Each carrier keeps a score of whether lazily thawed mounts go on to hit the return
+// barrier. Mounts are thawed lazily while the score is not positive. A mount that hits the
+// return barrier raises the score more than one that doesn't lowers it, and the score
+// decays on every full thaw so that lazy thawing is periodically retried.
+static const int lazy_thaw_score_max   = 8;
+static const int lazy_thaw_score_min   = -8;
+static const int lazy_thaw_score_raise = 4;
+
+static inline bool should_thaw_lazily(JavaThread* thread) {
+  return thread->cont_lazy_thaw_score() <= 0;
+}
+
+static void update_lazy_thaw_score(JavaThread* thread, Continuation::thaw_kind kind) {
+  if (!thread->cont_lazy_thaw_pending()) {
+    return;
+  }
+  int score = thread->cont_lazy_thaw_score();
+  if (Continuation::is_thaw_return_barrier(kind)) {
+    // the previous lazy thaw didn't copy enough
+    score = MIN2(score + lazy_thaw_score_raise, lazy_thaw_score_max);
+  } else {
+    // remounted without returning into the frames left in the chunk
+    score = MAX2(score - 1, lazy_thaw_score_min);
+  }
+  thread->set_cont_lazy_thaw_score(score);
+  thread->set_cont_lazy_thaw_pending(false);
+}
+
 template <typename ConfigT>
 class Thaw : public ThawBase {
 public:
@@ -1993,7 +2113,7 @@ class Thaw : public ThawBase {
   }
 
   inline intptr_t* thaw(Continuation::thaw_kind kind);
-  NOINLINE intptr_t* thaw_fast(stackChunkOop chunk);
+  NOINLINE intptr_t* thaw_fast(stackChunkOop chunk, Continuation::thaw_kind kind);
   NOINLINE intptr_t* thaw_slow(stackChunkOop chunk, Continuation::thaw_kind kind);
   inline void patch_caller_links(intptr_t* sp, intptr_t* bottom);
 };
@@ -2009,7 +2129,13 @@ inline intptr_t* Thaw<ConfigT>::thaw(Continuation::thaw_kind kind) {
   assert(!chunk->is_empty(), "guaranteed by prepare_thaw");
 
   _barriers = chunk->requires_barriers();
-  return (LIKELY(can_thaw_fast(chunk))) ? thaw_fast(chunk)
+  if (kind != Continuation::thaw_top) {
+    _thread->cont_counters().inc(ContinuationCounters::return_barrier_thaws);
+  }
+  if (ContinuationAdaptiveThaw) {
+    update_lazy_thaw_score(_thread, kind);
+  }
+  return (LIKELY(can_thaw_fast(chunk))) ? thaw_fast(chunk, kind)
                                         : thaw_slow(chunk, kind);
 }
 
@@ -2038,38 +2164,60 @@ class ReconstructedStack : public StackObj {
   int total_size() const { return _thaw_size + frame::metadata_words_at_bottom; }
 };
 
+int ThawBase::count_frames(stackChunkOop chunk) {
+  int num_frames = 0;
+  for (StackChunkFrameStream<ChunkFrames::CompiledOnly> f(chunk); !f.is_done(); f.next(SmallRegisterMap::instance())) {
+    num_frames++;
+  }
+  return num_frames;
+}
+
 inline void ThawBase::clear_chunk(stackChunkOop chunk) {
   chunk->set_sp(chunk->bottom());
   chunk->set_max_thawing_size(0);
 }
 
-int ThawBase::remove_top_compiled_frame_from_chunk(stackChunkOop chunk, int &argsize) {
+int ThawBase::remove_top_compiled_frames_from_chunk(stackChunkOop chunk, int &argsize, int max_frames, int &num_frames) {
+  assert(max_frames > 0, "");
   bool empty = false;
   StackChunkFrameStream<ChunkFrames::CompiledOnly> f(chunk);
   DEBUG_ONLY(intptr_t* const chunk_sp = chunk->start_address() + chunk->sp();)
   assert(chunk_sp == f.sp(), "");
   assert(chunk_sp == f.unextended_sp(), "");
 
-  int frame_size = f.cb()->frame_size();
-  argsize = f.stack_argsize();
-  bool is_stub = f.is_stub();
-
-  f.next(SmallRegisterMap::instance(), true /* stop */);
-  empty = f.is_done();
-  assert(!empty || argsize == chunk->argsize(), "");
-
-  assert(!is_stub || !empty, "runtime stub should have caller frame");
-  if (is_stub) {
-    // If we don't thaw the top compiled frame too, after restoring the saved
-    // registers back in Java, we would hit the return barrier to thaw one more
-    // frame effectively overwritting the restored registers during that call.
-    f.get_cb();
+  // Frames are removed from the top of the chunk. Since they are contiguous, the arguments
+  // of each removed callee live in its caller's frame, so only the stack arguments of the
+  // bottom-most removed frame need to be accounted for separately.
+  int frame_size = 0;
+  num_frames = 0;
+  do {
     frame_size += f.cb()->frame_size();
     argsize = f.stack_argsize();
-    f.next(SmallRegisterMap::instance, true /* stop */);
+    bool is_stub = f.is_stub();
+    num_frames++;
+
+    f.next(SmallRegisterMap::instance(), true /* stop */);
     empty = f.is_done();
     assert(!empty || argsize == chunk->argsize(), "");
-  }
+
+    assert(!is_stub || !empty, "runtime stub should have caller frame");
+    if (is_stub) {
+      // If we don't thaw the top compiled frame too, after restoring the saved
+      // registers back in Java, we would hit the return barrier to thaw one more
+      // frame effectively overwritting the restored registers during that call.
+      f.get_cb();
+      frame_size += f.cb()->frame_size();
+      argsize = f.stack_argsize();
+      num_frames++;
+      f.next(SmallRegisterMap::instance(), true /* stop */);
+      empty = f.is_done();
+      assert(!empty || argsize == chunk->argsize(), "");
+    }
+    if (empty || num_frames >= max_frames) {
+      break;
+    }
+    f.get_cb();
+  } while (true);
 
   if (empty) {
     clear_chunk(chunk);
@@ -2089,8 +2237,8 @@ int ThawBase::remove_top_compiled_frame_from_chunk(stackChunkOop chunk, int &arg
 #endif
   }
   assert(empty == chunk->is_empty(), "");
-  // returns the size required to store the frame on stack, and because it is a
-  // compiled frame, it must include a copy of the arguments passed by the caller
+  // returns the size required to store the frames on stack, and because they are
+  // compiled frames, it must include a copy of the arguments passed by the caller
   return frame_size + argsize + frame::metadata_words_at_top;
 }
 
@@ -2112,7 +2260,7 @@ void ThawBase::patch_return(intptr_t* sp, bool is_last) {
 }
 
 template <typename ConfigT>
-NOINLINE intptr_t* Thaw<ConfigT>::thaw_fast(stackChunkOop chunk) {
+NOINLINE intptr_t* Thaw<ConfigT>::thaw_fast(stackChunkOop chunk, Continuation::thaw_kind kind) {
   assert(chunk == _cont.tail(), "");
   assert(!chunk->has_mixed_frames(), "");
   assert(!chunk->requires_barriers(), "");
@@ -2126,27 +2274,44 @@ NOINLINE intptr_t* Thaw<ConfigT>::thaw_fast(stackChunkOop chunk) {
     chunk->print_on(true, &ls);
   }
 
-  // Below this heuristic, we thaw the whole chunk, above it we thaw just one frame.
-  static const int threshold = 500; // words
+  // Below this heuristic, we thaw the whole chunk, above it we thaw a bounded batch of
+  // frames from the top and leave the rest to be thawed lazily by the return barrier.
+  const int threshold = ContinuationFullThawThreshold; // words
 
   const int full_chunk_size = chunk->stack_size() - chunk->sp(); // this initial size could be reduced if it's a partial thaw
   int argsize, thaw_size;
+  int num_frames = 0;
 
   intptr_t* const chunk_sp = chunk->start_address() + chunk->sp();
 
+  bool lazy = false;
+  if (ContinuationAdaptiveThaw && kind == Continuation::thaw_top && full_chunk_size < threshold) {
+    lazy = should_thaw_lazily(_thread);
+    if (!lazy) {
+      _thread->set_cont_lazy_thaw_score(_thread->cont_lazy_thaw_score() - 1);
+    }
+  }
+
   bool partial, empty;
-  if (LIKELY(!TEST_THAW_ONE_CHUNK_FRAME && (full_chunk_size < threshold))) {
+  if (LIKELY(!TEST_THAW_ONE_CHUNK_FRAME && (full_chunk_size < threshold) && !lazy)) {
     prefetch_chunk_pd(chunk->start_address(), full_chunk_size); // prefetch anticipating memcpy starting at highest address
 
     partial = false;
     argsize = chunk->argsize(); // must be called *before* clearing the chunk
+    if (UNLIKELY(EventContinuationThawFrames::is_enabled())) {
+      num_frames = count_frames(chunk);
+    }
     clear_chunk(chunk);
     thaw_size = full_chunk_size;
     empty = true;
-  } else { // thaw a single frame
+  } else { // thaw a batch of frames
     partial = true;
-    thaw_size = remove_top_compiled_frame_from_chunk(chunk, argsize);
+    const int max_frames = TEST_THAW_ONE_CHUNK_FRAME ? 1 : ContinuationLazyThawBatchFrames;
+    thaw_size = remove_top_compiled_frames_from_chunk(chunk, argsize, max_frames, num_frames);
     empty = chunk->is_empty();
+    if (lazy && !empty) {
+      _thread->set_cont_lazy_thaw_pending(true);
+    }
   }
 
   // Are we thawing the last frame(s) in the continuation
@@ -2169,12 +2334,21 @@ NOINLINE intptr_t* Thaw<ConfigT>::thaw_fast(stackChunkOop chunk) {
   // install the return barrier if not last frame, or the entry's pc if last
   patch_return(rs.bottom_sp(), is_last);
 
+  // The last chunk is empty now; let another continuation frozen on this carrier reuse it.
+  if (UseStackChunkCache && is_last && _thread->stack_chunk_cache().release(chunk)) {
+    _cont.set_tail(nullptr);
+    _cont.write();
+  }
+
   // insert the back links from callee to caller frames
   patch_caller_links(rs.top(), rs.top() + rs.total_size());
 
   assert(is_last == _cont.is_empty(), "");
   assert(_cont.chunk_invariant(), "");
 
+  _thread->cont_counters().inc(ContinuationCounters::fast_thaws);
+  _thread->cont_counters().add(ContinuationCounters::words_thawed, thaw_size);
+
 #if CONT_JFR
   EventContinuationThawFast e;
   if (e.should_commit()) {
@@ -2185,6 +2359,15 @@ NOINLINE intptr_t* Thaw<ConfigT>::thaw_fast(stackChunkOop chunk) {
   }
 #endif
 
+  EventContinuationThawFrames ef;
+  if (ef.should_commit()) {
+    ef.set_frames(num_frames);
+    ef.set_size(thaw_size << LogBytesPerWord);
+    ef.set_partial(partial);
+    ef.set_remainingSize(chunk->max_thawing_size() << LogBytesPerWord);
+    ef.commit();
+  }
+
 #ifdef ASSERT
   set_anchor(_thread, rs.sp());
   log_frames(_thread);
@@ -2244,7 +2427,7 @@ NOINLINE intptr_t* Thaw<ConfigT>::thaw_slow(stackChunkOop chunk, Continuation::t
     int lockStackSize = chunk->lockstack_size();
     assert(lockStackSize > 0, "should be");
 
-    oop tmp_lockstack[8];
+    oop tmp_lockstack[LockStack::CAPACITY];
     chunk->copy_lockstack(tmp_lockstack);
     _thread->lock_stack().move_from_address(tmp_lockstack, lockStackSize);
 
@@ -2256,7 +2439,7 @@ NOINLINE intptr_t* Thaw<ConfigT>::thaw_slow(stackChunkOop chunk, Continuation::t
   // Retry the fast path now that we possibly cleared the FLAG_HAS_LOCKSTACK
   // and FLAGS_PREEMPTED flags from the stackChunk.
   if (retry_fast_path && can_thaw_fast(chunk)) {
-    intptr_t* sp = thaw_fast(chunk);
+    intptr_t* sp = thaw_fast(chunk, kind);
     if (preempted_case) {
       return handle_preempted_continuation(sp, preempt_kind, true /* fast_case */);
     }
@@ -2307,6 +2490,9 @@ NOINLINE intptr_t* Thaw<ConfigT>::thaw_slow(stackChunkOop chunk, Continuation::t
 
   intptr_t* sp = caller.sp();
 
+  _thread->cont_counters().inc(ContinuationCounters::slow_thaws);
+  _thread->cont_counters().add(ContinuationCounters::words_thawed, _cont.entrySP() - sp);
+
   if (preempted_case) {
     return handle_preempted_continuation(sp, preempt_kind, false /* fast_case */);
   }
@@ -2544,6 +2730,10 @@ NOINLINE void ThawBase::recurse_thaw_interpreted_frame(const frame& hf, frame& c
   // For native frames we need to count parameters, possible alignment, plus the 2 extra words (temp oop/result handler).
   const int locals = !m->is_native() ? m->max_locals() : m->size_of_parameters() + frame::align_wiggle + 2;
 
+  if (Tier0ThawWeight > 0 && !m->is_native()) {
+    CompilationPolicy::thaw_event(m, CompLevel_none);
+  }
+
   if (!is_bottom_frame) {
     // can only fix caller once this frame is thawed (due to callee saved regs)
     _cont.tail()->fix_thawed_frame(caller, SmallRegisterMap::instance());
@@ -2583,6 +2773,13 @@ void ThawBase::recurse_thaw_compiled_frame(const frame& hf, frame& caller, int n
   intptr_t* const stack_frame_top = f.sp();
   intptr_t* const heap_frame_top = hf.unextended_sp();
 
+  if (Tier0ThawWeight > 0) {
+    nmethod* nm = hf.cb()->as_nmethod();
+    if (nm->is_compiled_by_c1() && !nm->method()->is_continuation_native_intrinsic()) {
+      CompilationPolicy::thaw_event(nm->method(), (CompLevel)nm->comp_level());
+    }
+  }
+
   const int added_argsize = (is_bottom_frame || caller.is_interpreted_frame()) ? hf.compiled_frame_stack_argsize() : 0;
   int fsize = ContinuationHelper::CompiledFrame::size(hf) + added_argsize;
   assert(fsize <= (int)(caller.unextended_sp() - f.unextended_sp()), "");
@@ -2835,7 +3032,13 @@ static inline intptr_t* thaw_internal(JavaThread* thread, const Continuation::th
 
   DEBUG_ONLY(bool preempted = cont.is_preempted();)
   Thaw<ConfigT> thw(thread, cont);
+  // Only a thaw of the top frames is a mount, return barriers thaw more frames of a mounted thread
+  const bool timed_mount = PerfHistograms::is_enabled() && kind == Continuation::thaw_top && entry->is_virtual_thread();
+  const jlong start_ns = timed_mount ? os::javaTimeNanos() : 0;
   intptr_t* const sp = thw.thaw(kind);
+  if (timed_mount) {
+    PerfHistograms::record_vthread_mount(os::javaTimeNanos() - start_ns);
+  }
   assert(is_aligned(sp, frame::frame_alignment), "");
 
   DEBUG_ONLY(log_frames_after_thaw(thread, cont, sp, preempted);)
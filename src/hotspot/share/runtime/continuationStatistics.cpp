@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "memory/resourceArea.hpp"
+#include "runtime/continuation.hpp"
+#include "runtime/continuationStatistics.hpp"
+#include "runtime/javaThread.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
+#include "runtime/perfData.hpp"
+#include "runtime/threadSMR.hpp"
+#include "utilities/ostream.hpp"
+#include "utilities/powerOfTwo.hpp"
+
+ContinuationCounters ContinuationStatistics::_exited;
+
+ContinuationCounters::ContinuationCounters() {
+  for (int i = 0; i < num_counters; i++) {
+    _counters[i] = 0;
+  }
+  for (int i = 0; i < NumBuckets; i++) {
+    _frames_per_slow_freeze[i] = 0;
+    _words_per_freeze[i] = 0;
+  }
+}
+
+int ContinuationCounters::bucket(int value) {
+  if (value <= 1) {
+    return 0;
+  }
+  return MIN2(log2i(value), NumBuckets - 1);
+}
+
+void ContinuationCounters::record_freeze_failure(int res) {
+  switch (res) {
+    case freeze_pinned_native:  inc(pinned_native);           break;
+    case freeze_pinned_monitor: inc(pinned_monitor);          break;
+    case freeze_pinned_cs:      inc(pinned_critical_section); break;
+    default:                    inc(failed_freezes);          break;
+  }
+}
+
+void ContinuationCounters::accumulate(const ContinuationCounters& other) {
+  for (int i = 0; i < num_counters; i++) {
+    _counters[i] += other._counters[i];
+  }
+  for (int i = 0; i < NumBuckets; i++) {
+    _frames_per_slow_freeze[i] += other._frames_per_slow_freeze[i];
+    _words_per_freeze[i] += other._words_per_freeze[i];
+  }
+}
+
+const char* ContinuationCounters::name(Counter c) {
+  switch (c) {
+    case fast_freezes:            return "fastFreezes";
+    case slow_freezes:            return "slowFreezes";
+    case pinned_native:           return "pinnedNative";
+    case pinned_upcall:           return "pinnedUpcall";
+    case pinned_monitor:          return "pinnedMonitor";
+    case pinned_critical_section: return "pinnedCriticalSection";
+    case failed_freezes:          return "failedFreezes";
+    case fast_thaws:              return "fastThaws";
+    case slow_thaws:              return "slowThaws";
+    case return_barrier_thaws:    return "returnBarrierThaws";
+    case words_frozen:            return "wordsFrozen";
+    case words_thawed:            return "wordsThawed";
+    case chunks_allocated:        return "chunksAllocated";
+    default: ShouldNotReachHere(); return nullptr;
+  }
+}
+
+void ContinuationStatistics::thread_exiting(JavaThread* thread) {
+  assert(Threads_lock->owned_by_self(), "must have threads lock");
+  _exited.accumulate(thread->cont_counters());
+}
+
+// Holding the Threads_lock keeps an exiting thread from being counted both
+// in _exited and in the thread list, or in neither.
+void ContinuationStatistics::collect_locked(ContinuationCounters* result) {
+  assert(Threads_lock->owned_by_self(), "must have threads lock");
+  result->accumulate(_exited);
+  for (JavaThreadIteratorWithHandle jtiwh; JavaThread* thread = jtiwh.next(); ) {
+    result->accumulate(thread->cont_counters());
+  }
+}
+
+void ContinuationStatistics::collect(ContinuationCounters* result) {
+  MutexLocker ml(Threads_lock);
+  collect_locked(result);
+}
+
+// The samplers of all the counters run one after the other in the same
+// StatSampler tick, so they share one snapshot, taken by the first of them.
+// A snapshot younger than half the sampling interval belongs to the current
+// tick. The snapshot is only used by the StatSampler.
+ContinuationCounters ContinuationStatistics::_snapshot;
+jlong ContinuationStatistics::_snapshot_nanos = 0;
+
+uint64_t ContinuationStatistics::sample(ContinuationCounters::Counter c) {
+  jlong now = os::javaTimeNanos();
+  if (_snapshot_nanos == 0 || now - _snapshot_nanos >= (jlong)PerfDataSamplingInterval * NANOSECS_PER_MILLISEC / 2) {
+    // Do not hold up the sampler behind a safepoint; keep the previous
+    // snapshot if the Threads_lock is busy.
+    if (Threads_lock->try_lock()) {
+      ContinuationCounters counters;
+      collect_locked(&counters);
+      Threads_lock->unlock();
+      _snapshot = counters;
+      _snapshot_nanos = now;
+    }
+  }
+  return _snapshot.get(c);
+}
+
+// Samples one counter, summed over all threads, for the StatSampler.
+class ContinuationCounterSampler : public PerfLongSampleHelper {
+  ContinuationCounters::Counter _counter;
+ public:
+  ContinuationCounterSampler(ContinuationCounters::Counter c) : _counter(c) {}
+  jlong take_sample() {
+    return (jlong)ContinuationStatistics::sample(_counter);
+  }
+};
+
+void ContinuationStatistics::init() {
+  if (!UsePerfData) {
+    return;
+  }
+  EXCEPTION_MARK;
+  for (int i = 0; i < ContinuationCounters::num_counters; i++) {
+    ContinuationCounters::Counter c = (ContinuationCounters::Counter)i;
+    ResourceMark rm;
+    const char* cname = PerfDataManager::counter_name("continuations", ContinuationCounters::name(c));
+    bool words = c == ContinuationCounters::words_frozen || c == ContinuationCounters::words_thawed;
+    PerfDataManager::create_counter(SUN_RT, cname, words ? PerfData::U_None : PerfData::U_Events,
+                                    new ContinuationCounterSampler(c), CHECK);
+  }
+}
+
+static void print_histogram(outputStream* st, const char* title, const char* unit, const ContinuationCounters& counters,
+                            uint64_t (ContinuationCounters::*bucket)(int) const) {
+  st->print_cr("%s:", title);
+  for (int i = 0; i < ContinuationCounters::NumBuckets; i++) {
+    uint64_t n = (counters.*bucket)(i);
+    if (n == 0) {
+      continue;
+    }
+    if (i == ContinuationCounters::NumBuckets - 1) {
+      st->print_cr("  >= %7d %s: " UINT64_FORMAT, 1 << i, unit, n);
+    } else {
+      st->print_cr("  %7d-%-7d %s: " UINT64_FORMAT, i == 0 ? 0 : 1 << i, (2 << i) - 1, unit, n);
+    }
+  }
+}
+
+void ContinuationStatistics::print_on(outputStream* st) {
+  ContinuationCounters counters;
+  collect(&counters);
+
+  for (int i = 0; i < ContinuationCounters::num_counters; i++) {
+    ContinuationCounters::Counter c = (ContinuationCounters::Counter)i;
+    st->print_cr("%-28s " UINT64_FORMAT, ContinuationCounters::name(c), counters.get(c));
+  }
+  st->cr();
+  print_histogram(st, "Words per freeze", "words", counters, &ContinuationCounters::words_per_freeze);
+  print_histogram(st, "Frames per slow freeze", "frames", counters, &ContinuationCounters::frames_per_slow_freeze);
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_RUNTIME_CONTINUATIONSTATISTICS_HPP
+#define SHARE_RUNTIME_CONTINUATIONSTATISTICS_HPP
+
+#include "memory/allStatic.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class JavaThread;
+class outputStream;
+
+// Counters of the freeze and thaw operations performed on a JavaThread.
+//
+// Every JavaThread updates its own counters without synchronization, so that
+// counting never adds contention to a yield. ContinuationStatistics sums the
+// counters of all live threads and the totals of the threads that have exited;
+// as with other sampled statistics, the sum is approximate while threads run.
+class ContinuationCounters {
+ public:
+  enum Counter {
+    fast_freezes,             // frozen on the fast path
+    slow_freezes,             // frozen on the slow path
+    pinned_native,            // freeze failed: a native frame was on the stack
+    pinned_upcall,            // ... of which the native frame was the entry of an upcall (JNI or FFM)
+    pinned_monitor,           // freeze failed: a monitor was held
+    pinned_critical_section,  // freeze failed: in a critical section
+    failed_freezes,           // freeze failed for another reason (OOM, exception)
+    fast_thaws,               // thawed on the fast path
+    slow_thaws,               // thawed on the slow path
+    return_barrier_thaws,     // thaws initiated by returning into a frozen frame
+    words_frozen,             // stack words copied into chunks
+    words_thawed,             // stack words copied out of chunks
+    chunks_allocated,         // stack chunks allocated by freeze
+    num_counters
+  };
+
+  // Histograms use power-of-two buckets: bucket i counts values in [2^i, 2^(i+1)),
+  // except that bucket 0 also counts 0 and the last bucket counts everything above.
+  static const int NumBuckets = 16;
+
+ private:
+  uint64_t _counters[num_counters];
+  uint64_t _frames_per_slow_freeze[NumBuckets];
+  uint64_t _words_per_freeze[NumBuckets];
+
+  static int bucket(int value);
+
+ public:
+  ContinuationCounters();
+
+  void inc(Counter c)              { _counters[c]++; }
+  void add(Counter c, uint64_t n)  { _counters[c] += n; }
+
+  void record_fast_freeze(int words) {
+    inc(fast_freezes);
+    add(words_frozen, words);
+    _words_per_freeze[bucket(words)]++;
+  }
+  void record_slow_freeze(int words, int frames) {
+    inc(slow_freezes);
+    add(words_frozen, words);
+    _words_per_freeze[bucket(words)]++;
+    _frames_per_slow_freeze[bucket(frames)]++;
+  }
+  void record_freeze_failure(int res);
+
+  uint64_t get(Counter c) const                   { return _counters[c]; }
+  uint64_t frames_per_slow_freeze(int i) const    { return _frames_per_slow_freeze[i]; }
+  uint64_t words_per_freeze(int i) const          { return _words_per_freeze[i]; }
+
+  void accumulate(const ContinuationCounters& other);
+
+  static const char* name(Counter c);
+};
+
+class ContinuationStatistics : AllStatic {
+ private:
+  static ContinuationCounters _exited; // totals of threads that have exited, updated under the Threads_lock
+  static ContinuationCounters _snapshot; // last totals taken for the StatSampler
+  static jlong _snapshot_nanos;          // when _snapshot was taken
+
+  static void collect_locked(ContinuationCounters* result);
+
+ public:
+  static void init();
+
+  // Adds the counters of an exiting thread to the totals.
+  static void thread_exiting(JavaThread* thread);
+
+  // Sums the counters of all threads into result. Takes the Threads_lock.
+  static void collect(ContinuationCounters* result);
+
+  // Returns one counter from a snapshot shared by all the counters sampled
+  // in a StatSampler tick.
+  static uint64_t sample(ContinuationCounters::Counter c);
+
+  static void print_on(outputStream* st);
+};
+
+#endif // SHARE_RUNTIME_CONTINUATIONSTATISTICS_HPP
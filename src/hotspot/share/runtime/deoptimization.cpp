@@ -1045,7 +1045,8 @@ void Deoptimization::deoptimize_all_marked() {
   ResourceMark rm;
 
   // Make the dependent methods not entrant
-  CodeCache::make_marked_nmethods_deoptimized();
+  uint count = CodeCache::make_marked_nmethods_deoptimized();
+  DeoptimizationStorm::record_invalidations(count);
 
   DeoptimizeMarkedClosure deopt;
   if (SafepointSynchronize::is_at_safepoint()) {
@@ -1999,6 +2000,104 @@ static void post_deoptimization_event(nmethod* nm,
 
 #endif // INCLUDE_JFR
 
+static volatile jlong _storm_window_start = 0; // in milliseconds
+static volatile uint  _storm_window_count = 0;
+static volatile bool  _storm_active = false;
+static jlong          _storm_start = 0;        // in milliseconds
+JFR_ONLY(static Ticks _storm_start_ticks;)
+// Deoptimizations in the current window, or since the storm started.
+static volatile uint  _storm_traps[Deoptimization::Reason_LIMIT];
+static volatile uint  _storm_invalidations = 0;
+
+void DeoptimizationStorm::record_trap(int reason) {
+  if (DeoptimizationStormThreshold == 0) {
+    return;
+  }
+  assert(reason >= 0 && reason < Deoptimization::Reason_LIMIT, "invalid reason");
+  roll_window(os::javaTimeMillis());
+  Atomic::inc(&_storm_traps[reason]);
+  count_deoptimizations(1);
+}
+
+void DeoptimizationStorm::record_invalidations(uint count) {
+  if (DeoptimizationStormThreshold == 0 || count == 0) {
+    return;
+  }
+  roll_window(os::javaTimeMillis());
+  Atomic::add(&_storm_invalidations, count);
+  count_deoptimizations(count);
+}
+
+void DeoptimizationStorm::count_deoptimizations(uint count) {
+  uint window_count = Atomic::add(&_storm_window_count, count);
+  if (window_count >= DeoptimizationStormThreshold && !Atomic::load(&_storm_active) &&
+      !Atomic::cmpxchg(&_storm_active, false, true)) {
+    _storm_start = os::javaTimeMillis();
+    JFR_ONLY(_storm_start_ticks = Ticks::now();)
+    log_info(deoptimization)("Deoptimization storm started: %u methods deoptimized within a second", window_count);
+  }
+}
+
+bool DeoptimizationStorm::is_active() {
+  if (!Atomic::load(&_storm_active)) {
+    return false;
+  }
+  roll_window(os::javaTimeMillis());
+  return Atomic::load(&_storm_active);
+}
+
+void DeoptimizationStorm::roll_window(jlong now) {
+  jlong start = Atomic::load(&_storm_window_start);
+  if (now - start < MILLIUNITS ||
+      Atomic::cmpxchg(&_storm_window_start, start, now) != start) {
+    // Window not over yet, or another thread is rolling it.
+    return;
+  }
+  uint count = Atomic::xchg(&_storm_window_count, 0u);
+  if (!Atomic::load(&_storm_active)) {
+    // Not in a storm: only count the deoptimizations of the new window.
+    for (int reason = 0; reason < Deoptimization::Reason_LIMIT; reason++) {
+      Atomic::store(&_storm_traps[reason], 0u);
+    }
+    Atomic::store(&_storm_invalidations, 0u);
+  } else if (count < DeoptimizationStormThreshold) {
+    end_storm();
+  }
+}
+
+void DeoptimizationStorm::end_storm() {
+  uint invalidations = Atomic::xchg(&_storm_invalidations, 0u);
+  uint total = invalidations;
+  int top_reason = Deoptimization::Reason_none;
+  uint top_count = 0;
+  for (int reason = 0; reason < Deoptimization::Reason_LIMIT; reason++) {
+    uint count = Atomic::xchg(&_storm_traps[reason], 0u);
+    total += count;
+    if (count > top_count) {
+      top_reason = reason;
+      top_count = count;
+    }
+  }
+  log_info(deoptimization)("Deoptimization storm ended after " JLONG_FORMAT " ms: %u methods deoptimized, "
+                           "%u by dependency changes, %u by traps with reason %s",
+                           os::javaTimeMillis() - _storm_start, total, invalidations, top_count,
+                           Deoptimization::trap_reason_name(top_reason));
+#if INCLUDE_JFR
+  EventDeoptimizationStorm event(UNTIMED);
+  if (event.should_commit()) {
+    register_serializers();
+    event.set_starttime(_storm_start_ticks);
+    event.set_endtime(Ticks::now());
+    event.set_deoptimizedMethods(total);
+    event.set_invalidations(invalidations);
+    event.set_reason(top_reason);
+    event.set_reasonCount(top_count);
+    event.commit();
+  }
+#endif
+  Atomic::release_store(&_storm_active, false);
+}
+
 static void log_deopt(nmethod* nm, Method* tm, intptr_t pc, frame& fr, int trap_bci,
                               const char* reason_name, const char* reason_action) {
   LogTarget(Debug, deoptimization) lt;
@@ -2437,6 +2536,7 @@ JRT_ENTRY(void, Deoptimization::uncommon_trap_inner(JavaThread* current, jint tr
       if (!nm->make_not_entrant()) {
         return; // the call did not change nmethod's state
       }
+      DeoptimizationStorm::record_trap(reason);
 
       if (pdata != nullptr) {
         // Record the recompilation event, if any.
@@ -490,4 +490,25 @@ class Deoptimization : AllStatic {
   static void update_method_data_from_interpreter(MethodData* trap_mdo, int trap_bci, int reason);
 };
 
+// Tracks the global rate of deoptimizations to detect storms: many compiled
+// methods deoptimized in a short time, e.g. after a class hierarchy change.
+// Recompiling all of them right away floods the compile queues, so while a
+// storm lasts, C2 recompilations are postponed (see CompilationPolicy::compile).
+// They are triggered again by the invocation counters once the storm is over.
+// The rate is measured in windows of one second, and the storm ends with the
+// first window with fewer than DeoptimizationStormThreshold deoptimizations.
+class DeoptimizationStorm : AllStatic {
+  static void count_deoptimizations(uint count);
+  static void roll_window(jlong now);
+  static void end_storm();
+
+ public:
+  // An uncommon trap made a compiled method not entrant.
+  static void record_trap(int reason);
+  // Dependency changes made the given number of compiled methods not entrant.
+  static void record_invalidations(uint count);
+
+  static bool is_active();
+};
+
 #endif // SHARE_RUNTIME_DEOPTIMIZATION_HPP
@@ -570,9 +570,20 @@ const int ObjectAlignmentInBytes = 8;
           "compression. Otherwise the level must be between 1 and 9.")      \
           range(0, 9)                                                       \
                                                                             \
+  product(bool, HeapDumpMergeSegments, true, MANAGEABLE,                    \
+          "Merge the segment files written by the heap dump threads into "  \
+          "the dump file. If disabled, the segments are left next to it "   \
+          "as <file>.p<n>, and the dump is their concatenation in order "   \
+          "after the dump file.")                                           \
+                                                                            \
   product(ccstr, NativeMemoryTracking, DEBUG_ONLY("summary") NOT_DEBUG("off"), \
           "Native memory tracking options")                                 \
                                                                             \
+  product(size_t, NativeMemorySamplingInterval, 0, EXPERIMENTAL,         \
+          "With NativeMemoryTracking=summary, record the call stack of "    \
+          "one in this many bytes malloc'ed on average and keep estimated " \
+          "per call site sizes. 0 disables sampling.")                      \
+                                                                            \
   product(bool, PrintNMTStatistics, false, DIAGNOSTIC,                      \
           "Print native memory tracking summary data if it is on")          \
                                                                             \
@@ -699,6 +710,15 @@ const int ObjectAlignmentInBytes = 8;
           "Allow parallel defineClass requests for class loaders "          \
           "registering as parallel capable")                                \
                                                                             \
+  product(ccstr, PreloadClassList, nullptr, EXPERIMENTAL,                   \
+          "Class list, in the format of a CDS class list, of classes to "   \
+          "load and link with the system class loader in the background "   \
+          "during startup")                                                 \
+                                                                            \
+  product(uint, PreloadClassListThreads, 2, EXPERIMENTAL,                   \
+          "Number of threads preloading the classes of PreloadClassList")   \
+          range(1, 64)                                                      \
+                                                                            \
   product_pd(bool, DontYieldALot,                                           \
              "(Deprecated) Throw away obvious excess yield calls")          \
                                                                             \
@@ -740,6 +760,13 @@ const int ObjectAlignmentInBytes = 8;
           "The maximum number of monitors to unlink in one batch. ")        \
           range(1, max_jint)                                                \
                                                                             \
+  product(uint, MonitorInUseListPartitions, 1, EXPERIMENTAL,                \
+          "Number of lists the in-use monitors are partitioned into by "    \
+          "the inflating thread. Inflating threads contend less on the "    \
+          "list heads, and each deflation cycle starts with the partition " \
+          "after the one the previous cycle ended with.")                   \
+          range(1, 64)                                                      \
+                                                                            \
   product(int, MonitorUsedDeflationThreshold, 90, DIAGNOSTIC,               \
           "Percentage of used monitors before triggering deflation (0 is "  \
           "off). The check is performed on AsyncDeflationInterval or "      \
@@ -781,6 +808,12 @@ const int ObjectAlignmentInBytes = 8;
   product(bool, CheckJNICalls, false,                                       \
           "Verify all arguments to JNI calls")                              \
                                                                             \
+  product(int, JNIGlobalHandleCacheSize, 0, EXPERIMENTAL,                   \
+          "Number of JNI global and weak global handle entries each "       \
+          "thread keeps for reuse instead of returning them to the "        \
+          "shared storage (0 means no caching)")                            \
+          range(0, 64)                                                      \
+                                                                            \
   product(bool, UseFastJNIAccessors, true,                                  \
           "Use optimized versions of Get<Primitive>Field")                  \
                                                                             \
@@ -804,6 +837,10 @@ const int ObjectAlignmentInBytes = 8;
   develop(bool, PrintFieldLayout, false,                                    \
           "Print field layout for each class")                              \
                                                                             \
+  product(ccstr, FieldLayoutHintsFile, nullptr, EXPERIMENTAL,               \
+          "File listing, for each class, the non-static fields to allocate "\
+          "before the other fields of the class")                           \
+                                                                            \
   /* Need to limit the extent of the padding to reasonable size.          */\
   /* 8K is well beyond the reasonable HW cache line size, even with       */\
   /* aggressive prefetching, while still leaving the room for segregating */\
@@ -883,6 +920,11 @@ const int ObjectAlignmentInBytes = 8;
   develop(bool, TimeOopMap2, false,                                         \
           "Time calls to GenerateOopMap::compute_map() individually")       \
                                                                             \
+  product(int, InterpreterOopMapCacheSize, 32, EXPERIMENTAL,                \
+          "Number of entries in the oop map cache of each class, used for " \
+          "interpreted frames")                                             \
+          range(8, 4096)                                                    \
+                                                                            \
   develop(bool, TraceOopMapRewrites, false,                                 \
           "Trace rewriting of methods during oop map generation")           \
                                                                             \
@@ -908,6 +950,15 @@ const int ObjectAlignmentInBytes = 8;
   product(bool, VerifyBeforeIteration, false, DIAGNOSTIC,                   \
           "Verify memory system before JVMTI iteration")                    \
                                                                             \
+  product(bool, JvmtiParallelHeapIteration, false, EXPERIMENTAL,            \
+          "Use the GC workers to apply the class and tag filters of "       \
+          "IterateThroughHeap in parallel; the callbacks are still "        \
+          "invoked from a single thread")                                   \
+                                                                            \
+  product(bool, JvmtiParallelRedefineAdjust, false, EXPERIMENTAL,           \
+          "Use the GC workers to adjust the constant pool caches, vtables " \
+          "and itables of all classes after a class redefinition")          \
+                                                                            \
   /* compiler */                                                            \
                                                                             \
   /* notice: the max range value here is max_jint, not max_intx  */         \
@@ -952,6 +1003,12 @@ const int ObjectAlignmentInBytes = 8;
   product(bool, EnableThreadSMRStatistics, trueInDebug, DIAGNOSTIC,         \
              "Enable Thread SMR Statistics")                                \
                                                                             \
+  product(uint, ThreadsSMRFreeListBatch, 1, EXPERIMENTAL,                   \
+          "Number of ThreadsLists retired by thread starts and exits "      \
+          "before the hazard pointers of all threads are scanned to free "  \
+          "the ones no longer in use")                                      \
+          range(1, 1024)                                                    \
+                                                                            \
   product(bool, Inline, true,                                               \
           "Enable inlining")                                                \
                                                                             \
@@ -1119,6 +1176,10 @@ const int ObjectAlignmentInBytes = 8;
   product_pd(bool, RewriteFrequentPairs,                                    \
           "Rewrite frequently used bytecode pairs into a single bytecode")  \
                                                                             \
+  product(bool, RewriteFrequentPairsAtLink, false, EXPERIMENTAL,            \
+          "Apply the iload pair rewrites of RewriteFrequentPairs when a "   \
+          "class is linked rather than on first execution")                 \
+                                                                            \
   product(bool, PrintInterpreter, false, DIAGNOSTIC,                        \
           "Print the generated interpreter code")                           \
                                                                             \
@@ -1256,6 +1317,17 @@ const int ObjectAlignmentInBytes = 8;
           "exceptions (0 means all)")                                       \
           range(0, max_jint/2)                                              \
                                                                             \
+  product(int, HotExceptionStackTraceDepth, 0, EXPERIMENTAL,                \
+          "Maximum number of stack trace lines recorded for exception "     \
+          "types that are thrown often and whose stack traces have never "  \
+          "been inspected (0 means no special limit)")                      \
+          range(0, max_jint/2)                                              \
+                                                                            \
+  product(int, HotExceptionThreshold, 10000, EXPERIMENTAL,                  \
+          "Number of stack trace fills after which an exception type is "   \
+          "considered hot for HotExceptionStackTraceDepth")                 \
+          range(0, max_jint/2)                                              \
+                                                                            \
   /* notice: the max range value here is max_jint, not max_intx  */         \
   /* because of overflow issue                                   */         \
   product(intx, GuaranteedSafepointInterval, 0, DIAGNOSTIC,                 \
@@ -1353,6 +1425,12 @@ const int ObjectAlignmentInBytes = 8;
           "Limit on traps (of one kind) in a method (includes inlines)")    \
           range(0, max_jint)                                                \
                                                                             \
+  product(uint, DeoptimizationStormThreshold, 0, EXPERIMENTAL,              \
+          "Number of compiled methods deoptimized within a second that "    \
+          "starts a deoptimization storm, during which C2 recompilations "  \
+          "are postponed. 0 disables storm detection")                      \
+          range(0, max_juint)                                               \
+                                                                            \
   product(intx, PerMethodSpecTrapLimit,  5000, EXPERIMENTAL,                \
           "Limit on speculative traps (of one kind) in a method "           \
           "(includes inlines)")                                             \
@@ -1404,6 +1482,12 @@ const int ObjectAlignmentInBytes = 8;
   product(bool, PrintMetaspaceStatisticsAtExit, false, DIAGNOSTIC,          \
           "Print metaspace statistics upon VM exit.")                       \
                                                                             \
+  product(bool, MetaspaceMicroArenas, false, EXPERIMENTAL,                  \
+          "Serve the metaspace of hidden class and reflection loaders "     \
+          "from root chunks kept apart from those of other loaders, so "   \
+          "that their chunks merge back and can be uncommitted in bulk "    \
+          "after the loaders have been unloaded")                           \
+                                                                            \
   product(uintx, MinHeapFreeRatio, 40, MANAGEABLE,                          \
           "The minimum percentage of heap free after GC to avoid expansion."\
           " For most GCs this applies to the old generation. In G1 and"     \
@@ -1539,6 +1623,11 @@ const int ObjectAlignmentInBytes = 8;
           "Minimum number of segments in a code cache block")               \
           range(1, 100)                                                     \
                                                                             \
+  product(bool, CodeCacheFirstFitAllocation, false, EXPERIMENTAL,          \
+          "Allocate code blobs from the lowest-addressed free block that "  \
+          "fits instead of the best-fitting one, keeping live code "        \
+          "packed at the start of each code heap")                          \
+                                                                            \
   develop(bool, ExitOnFullCodeCache, false,                                 \
           "Exit the VM if we fill the code cache")                          \
                                                                             \
@@ -1556,6 +1645,11 @@ const int ObjectAlignmentInBytes = 8;
           "Non-segmented code cache: X[%] of the total code cache")         \
           range(0, 100)                                                     \
                                                                             \
+  product(bool, ColdNMethodResetsCounters, false, EXPERIMENTAL,             \
+          "Reset the invocation and backedge counters of methods whose "    \
+          "compiled code is found cold, so that they are not recompiled "   \
+          "right after the code is unloaded")                               \
+                                                                            \
   /* interpreter debugging */                                               \
   develop(intx, BinarySwitchThreshold, 5,                                   \
           "Minimal number of lookupswitch entries for rewriting to binary " \
@@ -1708,6 +1802,11 @@ const int ObjectAlignmentInBytes = 8;
           "Flag to disable jvmstat instrumentation for performance testing "\
           "and problem isolation purposes")                                 \
                                                                             \
+  product(bool, UsePerfDataHistograms, false, EXPERIMENTAL,                 \
+          "Export histograms of safepoint, GC pause, allocation rate, "     \
+          "virtual thread mount and compile queue metrics as PerfData "     \
+          "counters. Requires UsePerfData")                                 \
+                                                                            \
   product(bool, PerfDataSaveToFile, false,                                  \
           "Save PerfData memory to hsperfdata_<pid> file on exit")          \
                                                                             \
@@ -1901,6 +2000,10 @@ const int ObjectAlignmentInBytes = 8;
   product_pd(bool, VMContinuations, EXPERIMENTAL,                           \
           "Enable VM continuations support")                                \
                                                                             \
+  product(bool, VirtualThreadCPUTime, false, EXPERIMENTAL,                  \
+          "Account the CPU time of each virtual thread by reading the "     \
+          "CPU clock of the carrier when it is mounted and unmounted")      \
+                                                                            \
   develop(bool, LoomDeoptAfterThaw, false,                                  \
           "Deopt stack after thaw")                                         \
                                                                             \
@@ -1913,6 +2016,60 @@ const int ObjectAlignmentInBytes = 8;
   develop(bool, UseContinuationFastPath, true,                              \
           "Use fast-path frame walking in continuations")                   \
                                                                             \
+  product(int, ContinuationFullThawThreshold, 500, EXPERIMENTAL,            \
+          "Stack chunks smaller than this many words are thawed in full "   \
+          "on the fast path. Larger chunks are thawed lazily, in batches "  \
+          "of frames, with the rest thawed on return through the return "   \
+          "barrier")                                                        \
+          range(0, max_jint)                                                \
+                                                                            \
+  product(int, ContinuationLazyThawBatchFrames, 1, EXPERIMENTAL,            \
+          "Maximum number of compiled frames thawed at once when a stack "  \
+          "chunk is thawed lazily on the fast path")                        \
+          range(1, 1024)                                                    \
+                                                                            \
+  product(bool, ContinuationAdaptiveThaw, false, EXPERIMENTAL,              \
+          "Thaw small stack chunks lazily when mounted continuations tend " \
+          "to yield again without returning into their older frames, so "  \
+          "that the next freeze only copies the frames that ran since the " \
+          "mount")                                                          \
+                                                                            \
+  product(int, ContinuationCopyStubThreshold, 0, EXPERIMENTAL,              \
+          "Copy frames of at least this many words between the thread "     \
+          "stack and stack chunks with the platform arraycopy stub rather " \
+          "than memcpy. 0 means never")                                     \
+          range(0, max_jint)                                                \
+                                                                            \
+  product(bool, ContinuationCopyPrefetchDestination, false, EXPERIMENTAL,   \
+          "Prefetch the destination for writing before copying frames "     \
+          "with the arraycopy stub (see ContinuationCopyStubThreshold)")    \
+                                                                            \
+  product(bool, UseStackChunkCache, false, EXPERIMENTAL,                    \
+          "Cache empty stack chunks per carrier thread when a continuation "\
+          "is fully thawed, and reuse them on freeze instead of "           \
+          "allocating a new chunk")                                         \
+                                                                            \
+  product(bool, PresizeStackChunks, false, EXPERIMENTAL,                    \
+          "Allocate new stack chunks with at least the stack size recently "\
+          "needed by continuations on the same carrier thread, so that "    \
+          "later, deeper freezes fit in the first chunk")                   \
+                                                                            \
+  product(bool, TrimStackChunks, false, EXPERIMENTAL,                       \
+          "Drop the unused part of a stack chunk's stack when the GC "      \
+          "copies a chunk it has not seen before. Only G1 evacuation "      \
+          "trims chunks")                                                   \
+                                                                            \
+  product(int, TrimStackChunksMinWords, 256, EXPERIMENTAL,                  \
+          "The minimum number of unused words for a stack chunk to be "     \
+          "trimmed (see TrimStackChunks)")                                  \
+          range(2, max_jint)                                                \
+                                                                            \
+  product(int, StackChunkBitmapMinWords, 0, EXPERIMENTAL,                   \
+          "The minimum number of used stack words for a stack chunk to "    \
+          "get an oop bitmap when the GC first transforms it. Smaller "     \
+          "chunks are scanned by walking their frames")                     \
+          range(0, max_jint)                                                \
+                                                                            \
   develop(int, VerifyMetaspaceInterval, DEBUG_ONLY(500) NOT_DEBUG(0),       \
                "Run periodic metaspace verifications (0 - none, "           \
                "1 - always, >1 every nth interval)")                        \
@@ -1935,9 +2092,24 @@ const int ObjectAlignmentInBytes = 8;
   JFR_ONLY(product(ccstr, StartFlightRecording, nullptr,                    \
           "Start flight recording with options"))                           \
                                                                             \
+  JFR_ONLY(product(uint, FlightRecorderSamplingBudget, 0, EXPERIMENTAL,     \
+          "Maximum time in microseconds one round of thread sampling may "  \
+          "take. The next round continues with the next thread. 0 means "   \
+          "no limit."))                                                     \
+                                                                            \
+  JFR_ONLY(product(bool, LeakProfilerParallelBFS, false, EXPERIMENTAL,      \
+          "Use the safepoint worker threads of the GC to search paths to "  \
+          "GC roots for old object samples"))                               \
+                                                                            \
   product(bool, UseFastUnorderedTimeStamps, false, EXPERIMENTAL,            \
           "Use platform unstable time where supported for timestamps only") \
                                                                             \
+  product(bool, UseTSCForNanoTime, false, EXPERIMENTAL,                     \
+          "Compute System.nanoTime from the invariant tsc, calibrated "     \
+          "against CLOCK_MONOTONIC at startup and every second. Only used " \
+          "on Linux/x86_64 while the kernel itself uses the tsc as its "    \
+          "clock source")                                                   \
+                                                                            \
   product(bool, DeoptimizeNMethodBarriersALot, false, DIAGNOSTIC,           \
                 "Make nmethod barriers deoptimise a lot.")                  \
                                                                             \
@@ -1964,6 +2136,23 @@ const int ObjectAlignmentInBytes = 8;
           "a total number of spins on the order of O(2^value)")             \
           range(1, 30)                                                      \
                                                                             \
+  product(int, LockStackCapacity, 8, EXPERIMENTAL,                          \
+          "With Lightweight Locking mode, the number of locks a thread "    \
+          "can hold on its lock-stack before the oldest ones are "          \
+          "inflated. JVMCI-compiled code assumes the default, so the "      \
+          "capacity cannot be lower")                                       \
+          range(8, 32)                                                      \
+                                                                            \
+  product(bool, VThreadAdaptiveSpin, false, EXPERIMENTAL,                   \
+          "Spin on a contended monitor for a virtual thread only as long "  \
+          "as recent spins on that monitor paid off and the spin is "       \
+          "cheaper than freezing the thread's stack")                       \
+                                                                            \
+  product(int, ParkSpinIterations, 0, EXPERIMENTAL,                         \
+          "Number of iterations a thread spins waiting for a permit in "    \
+          "LockSupport.park before blocking in the operating system")       \
+          range(0, max_jint)                                                \
+                                                                            \
   product(uint, TrimNativeHeapInterval, 0,                                  \
           "Interval, in ms, at which the JVM will trim the native heap if " \
           "the platform supports that. Lower values will reclaim memory "   \
@@ -1971,6 +2160,25 @@ const int ObjectAlignmentInBytes = 8;
           "(default) disables native heap trimming.")                       \
           range(0, UINT_MAX)                                                \
                                                                             \
+  product(bool, UseSizeClassMalloc, false, EXPERIMENTAL,                    \
+          "Serve small GC, compiler and internal C-heap allocations from a "\
+          "JVM internal size-class allocator with thread-local caches "     \
+          "instead of the C library")                                       \
+                                                                            \
+  product(size_t, SizeClassMallocReserveSize, 1*G, EXPERIMENTAL,            \
+          "Size of the address space reserved for UseSizeClassMalloc. "     \
+          "Allocations fall back to the C library once it is used up.")     \
+          range(64*K, max_uintx)                                            \
+                                                                            \
+  product(uint, ArenaThreadChunkCacheSize, 0, EXPERIMENTAL,                 \
+          "Number of free arena chunks of each standard size a thread "     \
+          "keeps for reuse before returning them to the global chunk "      \
+          "pools. 0 disables the thread caches.")                           \
+          range(0, 64)                                                      \
+                                                                            \
+  product(bool, ArenaGrowLargeChunks, false, EXPERIMENTAL,                  \
+          "Grow arenas that already hold many chunks with larger chunks")   \
+                                                                            \
   develop(bool, SimulateFullAddressSpace, false,                            \
           "Simulates a very populated, fragmented address space; no "       \
           "targeted reservations will succeed.")                            \
@@ -417,6 +417,76 @@ void Handshake::execute(HandshakeClosure* hs_cl, ThreadsListHandle* tlh, JavaThr
   log_handshake_info(start_time_ns, op.name(), 1, emitted_handshakes_executed);
 }
 
+void Handshake::execute(HandshakeClosure* hs_cl, ThreadsListHandle* tlh, JavaThread* const* targets, int count) {
+  JavaThread* self = JavaThread::current();
+  // The operation has no single target, like the one of VM_HandshakeAllThreads.
+  HandshakeOperation op(hs_cl, nullptr, self);
+
+  jlong start_time_ns = os::javaTimeNanos();
+
+  guarantee(tlh != nullptr, "must be");
+  ResourceMark rm(self);
+  GrowableArray<JavaThread*> issued(count);
+  for (int i = 0; i < count; i++) {
+    JavaThread* target = targets[i];
+    guarantee(target != nullptr && target != self, "must be");
+    if (tlh->includes(target)) {
+      issued.append(target);
+    }
+  }
+  if (issued.is_empty()) {
+    log_handshake_info(start_time_ns, op.name(), 0, 0, "no threads alive");
+    return;
+  }
+
+  // op was created with a count == 1 so don't double count. Set the count
+  // before the first target can complete its operation.
+  op.add_target_count(issued.length() - 1);
+  for (int i = 0; i < issued.length(); i++) {
+    issued.at(i)->handshake_state()->add_operation(&op);
+  }
+
+  // A single barrier separates the arming of all polls from the reads of
+  // the JavaThread states in try_process().
+  if (UseSystemMemoryBarrier) {
+    SystemMemoryBarrier::emit();
+  }
+
+  int emitted_handshakes_executed = 0;
+  HandshakeSpinYield hsy(start_time_ns);
+  while (!op.is_completed()) {
+    for (int i = 0; i < issued.length(); i++) {
+      HandshakeState::ProcessResult pr = issued.at(i)->handshake_state()->try_process(&op);
+      hsy.add_result(pr);
+      if (pr == HandshakeState::_succeeded) {
+        emitted_handshakes_executed++;
+      }
+    }
+    if (op.is_completed()) {
+      break;
+    }
+
+    // Check if handshake operation has timed out
+    check_handshake_timeout(start_time_ns, &op);
+
+    // Check for pending handshakes to avoid possible deadlocks where one of
+    // our targets is trying to handshake us.
+    if (SafepointMechanism::should_process(self)) {
+      // Will not suspend here.
+      ThreadBlockInVM tbivm(self);
+    }
+    hsy.process();
+  }
+
+  // This pairs up with the release store in do_handshake(). It prevents future
+  // loads from floating above the load of _pending_threads in is_completed()
+  // and thus prevents reading stale data modified in the handshake closure
+  // by the Handshakee.
+  OrderAccess::acquire();
+
+  log_handshake_info(start_time_ns, op.name(), issued.length(), emitted_handshakes_executed);
+}
+
 void Handshake::execute(AsyncHandshakeClosure* hs_cl, JavaThread* target) {
   jlong start_time_ns = os::javaTimeNanos();
   AsyncHandshakeOperation* op = new AsyncHandshakeOperation(hs_cl, target, start_time_ns);
@@ -76,6 +76,12 @@ class Handshake : public AllStatic {
   // sanity check for a ThreadListHandle somewhere in the caller's context
   // to verify that target is protected.
   static void execute(HandshakeClosure*       hs_cl, ThreadsListHandle* tlh, JavaThread* target);
+  // Execute the closure for each of the count threads in targets, as one
+  // operation: all targets are armed before any is processed, and blocked
+  // targets are processed by the requesting thread while the others execute
+  // the closure themselves. The closure must thus be safe to run for several
+  // threads at once. Targets that are not protected by tlh are skipped.
+  static void execute(HandshakeClosure*       hs_cl, ThreadsListHandle* tlh, JavaThread* const* targets, int count);
   // This version of execute() relies on a ThreadListHandle somewhere in
   // the caller's context to protect target (and we sanity check for that).
   static void execute(AsyncHandshakeClosure*  hs_cl, JavaThread* target);
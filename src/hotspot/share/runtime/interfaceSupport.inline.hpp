@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1997, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1997, 2024, Oracle and/or its affiliates. All rights reserved.
  * Copyright (c) 2021, Azul Systems, Inc. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
@@ -211,7 +211,13 @@ class ThreadBlockInVMPreprocess : public ThreadStateTransition {
   ~ThreadBlockInVMPreprocess() {
     assert(_thread->thread_state() == _thread_blocked, "coming from wrong thread state");
     // Change back to _thread_in_vm and ensure it is seen by the VM thread.
-    _thread->set_thread_state_fence(_thread_in_vm);
+    // With UseSystemMemoryBarrier the VM thread and handshakers issue the
+    // barrier before inspecting thread states, as for native transitions.
+    if (!UseSystemMemoryBarrier) {
+      _thread->set_thread_state_fence(_thread_in_vm);
+    } else {
+      _thread->set_thread_state(_thread_in_vm);
+    }
 
     if (SafepointMechanism::should_process(_thread, _allow_suspend)) {
       _pr(_thread);
@@ -45,6 +45,7 @@
 #include "logging/logAsyncWriter.hpp"
 #include "logging/logStream.hpp"
 #include "memory/allocation.inline.hpp"
+#include "memory/arena.hpp"
 #include "memory/iterator.hpp"
 #include "memory/universe.hpp"
 #include "oops/access.inline.hpp"
@@ -79,6 +80,7 @@
 #include "runtime/safepointMechanism.inline.hpp"
 #include "runtime/safepointVerifiers.hpp"
 #include "runtime/serviceThread.hpp"
+#include "runtime/sizeClassMalloc.hpp"
 #include "runtime/stackFrameStream.inline.hpp"
 #include "runtime/stackWatermarkSet.hpp"
 #include "runtime/synchronizer.hpp"
@@ -181,6 +183,58 @@ void JavaThread::set_vthread(oop p) {
   _vthread.replace(p);
 }
 
+// Virtual threads share the TLAB of their carrier, whose size follows the
+// blended allocation of everything that ran on it. Keep the average
+// allocation per mount of each virtual thread in its thread object, and
+// size the TLAB after it while the virtual thread is mounted.
+void JavaThread::update_vthread_tlab_size_hint(oop new_vthread) {
+  assert(VirtualThreadTLABSizeHints && UseTLAB && ResizeTLAB, "must be");
+  const oop carrier = threadObj();
+  const oop old_vthread = vthread();
+  const jlong allocated = cooked_allocated_bytes();
+
+  if (old_vthread != nullptr && old_vthread != carrier) {
+    const jlong per_mount = allocated - _vthread_mount_allocated_bytes;
+    const jlong average = java_lang_Thread::tlab_size_hint(old_vthread);
+    const jlong new_average = average == 0
+        ? per_mount
+        : (average * (jlong)(100 - TLABAllocationWeight) + per_mount * (jlong)TLABAllocationWeight) / 100;
+    java_lang_Thread::set_tlab_size_hint(old_vthread, new_average);
+  }
+
+  _vthread_mount_allocated_bytes = allocated;
+
+  const jlong hint = (new_vthread != carrier) ? java_lang_Thread::tlab_size_hint(new_vthread) : 0;
+  tlab().set_desired_size_hint((size_t)hint / HeapWordSize);
+}
+
+// clock_gettime(CLOCK_THREAD_CPUTIME_ID) at the mount boundaries splits the CPU
+// time of the carrier between the virtual threads it runs. The time spent by the
+// carrier between mounts is not attributed to any virtual thread.
+jlong JavaThread::update_vthread_cpu_time(oop new_vthread) {
+  assert(VirtualThreadCPUTime, "must be");
+  assert(this == Thread::current(), "must be");
+  const oop carrier = threadObj();
+  const oop old_vthread = vthread();
+  const jlong now = os::current_thread_cpu_time();
+  jlong used = -1;
+
+  if (old_vthread != nullptr && old_vthread != carrier) {
+    used = now - _vthread_mount_cpu_time;
+    java_lang_Thread::set_cpu_time(old_vthread, java_lang_Thread::cpu_time(old_vthread) + used);
+  }
+
+  _vthread_mount_cpu_time = now;
+  return used;
+}
+
+jlong JavaThread::mounted_vthread_cpu_time() const {
+  assert(VirtualThreadCPUTime, "must be");
+  assert(this == Thread::current(), "must be");
+  assert(is_vthread_mounted(), "must be");
+  return java_lang_Thread::cpu_time(vthread()) + (os::current_thread_cpu_time() - _vthread_mount_cpu_time);
+}
+
 oop JavaThread::jvmti_vthread() const {
   return _jvmti_vthread.resolve();
 }
@@ -435,7 +489,11 @@ JavaThread::JavaThread(MemTag mem_tag) :
   _current_waiting_monitor(nullptr),
   _active_handles(nullptr),
   _free_handle_block(nullptr),
+  _jni_handle_cache(nullptr),
+  _pinned_blocked_since(0),
   _lock_id(0),
+  _vthread_mount_allocated_bytes(0),
+  _vthread_mount_cpu_time(0),
   _on_monitorenter(false),
 
   _suspend_flags(0),
@@ -496,6 +554,8 @@ JavaThread::JavaThread(MemTag mem_tag) :
   _cont_entry(nullptr),
   _cont_fastpath(nullptr),
   _cont_fastpath_thread_state(1),
+  _cont_lazy_thaw_score(0),
+  _cont_lazy_thaw_pending(false),
   _held_monitor_count(0),
   _jni_monitor_count(0),
   _preempting(false),
@@ -698,6 +758,10 @@ JavaThread::~JavaThread() {
     set_deferred_updates(nullptr);
   }
 
+  // Return cached JNI handle entries of threads that are deleted without
+  // going through exit. This is a no-op for threads that did.
+  JNIHandles::release_thread_cache(this);
+
   // All Java related clean up happens in exit
   ThreadSafepointState::destroy(this);
   if (_thread_stat != nullptr) delete _thread_stat;
@@ -967,6 +1031,8 @@ void JavaThread::exit(bool destroy_vm, ExitType exit_type) {
     JNIHandleBlock::release_block(block);
   }
 
+  JNIHandles::release_thread_cache(this);
+
   // These have to be removed while this is still a valid thread.
   _stack_overflow_state.remove_stack_guard_pages();
 
@@ -1026,6 +1092,12 @@ void JavaThread::exit(bool destroy_vm, ExitType exit_type) {
                                  _timer_exit_phase4.milliseconds());
     os::free(thread_name);
   }
+
+  // Threads that detach or destroy the VM do not return through
+  // Thread::call_run, so return their cached arena chunks and C-heap
+  // blocks here.
+  Arena::flush_thread_chunk_cache();
+  SizeClassMalloc::thread_exit();
 }
 
 void JavaThread::cleanup_failed_attach_current_thread(bool is_daemon) {
@@ -1041,6 +1113,8 @@ void JavaThread::cleanup_failed_attach_current_thread(bool is_daemon) {
     JNIHandleBlock::release_block(block);
   }
 
+  JNIHandles::release_thread_cache(this);
+
   // These have to be removed while this is still a valid thread.
   _stack_overflow_state.remove_stack_guard_pages();
 
@@ -1050,6 +1124,9 @@ void JavaThread::cleanup_failed_attach_current_thread(bool is_daemon) {
 
   Threads::remove(this, is_daemon);
   this->smr_delete();
+
+  Arena::flush_thread_chunk_cache();
+  SizeClassMalloc::thread_exit();
 }
 
 JavaThread* JavaThread::active() {
@@ -1443,6 +1520,8 @@ void JavaThread::oops_do_no_frames(OopClosure* f, NMethodClosure* cf) {
   if (LockingMode == LM_LIGHTWEIGHT) {
     lock_stack().oops_do(f);
   }
+
+  _stack_chunk_cache.oops_do(f);
 }
 
 void JavaThread::oops_do_frames(OopClosure* f, NMethodClosure* cf) {
@@ -2332,3 +2411,18 @@ void JavaThread::add_oop_handles_for_release() {
   _oop_handle_list = new_head;
   Service_lock->notify_all();
 }
+
+PinnedBlockMark::PinnedBlockMark(JavaThread* thread)
+  : _thread(thread),
+    _marked(thread->is_vthread_mounted() && thread->pinned_blocked_since() == 0) {
+  if (_marked) {
+    // 0 means not blocked
+    _thread->set_pinned_blocked_since(MAX2(os::javaTimeNanos(), (jlong)1));
+  }
+}
+
+PinnedBlockMark::~PinnedBlockMark() {
+  if (_marked) {
+    _thread->set_pinned_blocked_since(0);
+  }
+}
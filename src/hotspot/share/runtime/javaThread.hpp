@@ -30,6 +30,7 @@
 #include "memory/allocation.hpp"
 #include "oops/oop.hpp"
 #include "oops/oopHandle.hpp"
+#include "runtime/continuationStatistics.hpp"
 #include "runtime/frame.hpp"
 #include "runtime/globals.hpp"
 #include "runtime/handshake.hpp"
@@ -37,6 +38,7 @@
 #include "runtime/lockStack.hpp"
 #include "runtime/park.hpp"
 #include "runtime/safepointMechanism.hpp"
+#include "runtime/stackChunkCache.hpp"
 #include "runtime/stackWatermarkSet.hpp"
 #include "runtime/stackOverflow.hpp"
 #include "runtime/thread.hpp"
@@ -55,6 +57,7 @@ class ContinuationEntry;
 class DeoptResourceMark;
 class InternalOOMEMark;
 class JNIHandleBlock;
+class JNIHandleCache;
 class JVMCIRuntime;
 
 class JvmtiDeferredUpdates;
@@ -160,11 +163,23 @@ class JavaThread: public Thread {
   // One-element thread local free list
   JNIHandleBlock* _free_handle_block;
 
+  // Thread local cache of global and weak global handle entries (see JNIGlobalHandleCacheSize)
+  JNIHandleCache* _jni_handle_cache;
+
+  // os::javaTimeNanos() at which this carrier blocked with its virtual thread
+  // pinned, or 0 (see PinnedBlockMark)
+  volatile jlong _pinned_blocked_since;
+
   // ID used as owner for inflated monitors. Same as the tid field of the current
   // _vthread object, except during creation of the primordial and JNI attached
   // thread cases where this field can have a temporal value.
   int64_t _lock_id;
 
+  // Allocated bytes when the current virtual thread was mounted.
+  jlong _vthread_mount_allocated_bytes;
+  // CPU time of this carrier when the current virtual thread was mounted.
+  jlong _vthread_mount_cpu_time;
+
  public:
   bool _on_monitorenter;
 
@@ -206,6 +221,11 @@ class JavaThread: public Thread {
   void set_active_handles(JNIHandleBlock* block) { _active_handles = block; }
   JNIHandleBlock* free_handle_block() const      { return _free_handle_block; }
   void set_free_handle_block(JNIHandleBlock* block) { _free_handle_block = block; }
+  JNIHandleCache* jni_handle_cache() const       { return _jni_handle_cache; }
+  void set_jni_handle_cache(JNIHandleCache* cache) { _jni_handle_cache = cache; }
+
+  jlong pinned_blocked_since() const             { return Atomic::load(&_pinned_blocked_since); }
+  void set_pinned_blocked_since(jlong nanos)     { Atomic::store(&_pinned_blocked_since, nanos); }
 
   void push_jni_handle_block();
   void pop_jni_handle_block();
@@ -480,6 +500,8 @@ class JavaThread: public Thread {
   intptr_t* _cont_fastpath; // the sp of the oldest known interpreted/call_stub frame inside the
                             // continuation that we know about
   int _cont_fastpath_thread_state; // whether global thread state allows continuation fastpath (JVMTI)
+  int _cont_lazy_thaw_score;       // > 0 if mounted continuations tend to return into their older frames
+  bool _cont_lazy_thaw_pending;    // the current mount was thawed lazily and hasn't returned into older frames yet
 
   // It's signed for error detection.
   intx _held_monitor_count;  // used by continuations for fast lock detection
@@ -568,6 +590,15 @@ class JavaThread: public Thread {
   void set_threadOopHandles(oop p);
   oop vthread() const;
   void set_vthread(oop p);
+  // Called when new_vthread is about to become the current thread, see
+  // VirtualThreadTLABSizeHints.
+  void update_vthread_tlab_size_hint(oop new_vthread);
+  // Called when new_vthread is about to become the current thread, see
+  // VirtualThreadCPUTime. Returns the CPU time used by the unmounted virtual
+  // thread during the mount that ends, or -1 if no virtual thread was mounted.
+  jlong update_vthread_cpu_time(oop new_vthread);
+  // CPU time used by the mounted virtual thread, including the current mount.
+  jlong mounted_vthread_cpu_time() const;
   oop scopedValueCache() const;
   void set_scopedValueCache(oop p);
   void clear_scopedValueBindings();
@@ -646,6 +677,10 @@ class JavaThread: public Thread {
   intptr_t* raw_cont_fastpath() const          { return _cont_fastpath; }
   bool cont_fastpath() const                   { return _cont_fastpath == nullptr && _cont_fastpath_thread_state != 0; }
   bool cont_fastpath_thread_state() const      { return _cont_fastpath_thread_state != 0; }
+  int cont_lazy_thaw_score() const             { return _cont_lazy_thaw_score; }
+  void set_cont_lazy_thaw_score(int x)         { _cont_lazy_thaw_score = x; }
+  bool cont_lazy_thaw_pending() const          { return _cont_lazy_thaw_pending; }
+  void set_cont_lazy_thaw_pending(bool x)      { _cont_lazy_thaw_pending = x; }
 
   void inc_held_monitor_count(intx i = 1, bool jni = false);
   void dec_held_monitor_count(intx i = 1, bool jni = false);
@@ -1250,6 +1285,15 @@ class JavaThread: public Thread {
   void om_clear_monitor_cache();
   ObjectMonitor* om_get_from_monitor_cache(oop obj);
 
+private:
+  StackChunkCache _stack_chunk_cache;
+  ContinuationCounters _cont_counters;
+
+public:
+  StackChunkCache& stack_chunk_cache() { return _stack_chunk_cache; }
+  ContinuationCounters& cont_counters() { return _cont_counters; }
+  const ContinuationCounters& cont_counters() const { return _cont_counters; }
+
   static OopStorage* thread_oop_storage();
 
   static void verify_cross_modify_fence_failure(JavaThread *thread) PRODUCT_RETURN;
@@ -1312,6 +1356,17 @@ class JNIHandleMark : public StackObj {
   ~JNIHandleMark() { _thread->pop_jni_handle_block(); }
 };
 
+// Publishes that the current thread blocks with a virtual thread pinned to it,
+// so that the scheduler can compensate for the carrier (see JVM_GetCarrierThreadStates).
+// Does nothing if no virtual thread is mounted or the thread is already marked.
+class PinnedBlockMark : public StackObj {
+  JavaThread* _thread;
+  bool _marked;
+ public:
+  PinnedBlockMark(JavaThread* thread);
+  ~PinnedBlockMark();
+};
+
 class ThreadOnMonitorEnter {
   JavaThread* _thread;
  public:
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1998, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1998, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -82,6 +82,88 @@ static void report_handle_allocation_failure(AllocFailType alloc_failmode,
   }
 }
 
+// Per-thread cache of OopStorage entries for global and weak global handles.
+// Making and deleting global handles at a high rate otherwise takes the
+// storage's allocation lock for every handle. Entries are refilled with one
+// bulk allocation and deleted handles are kept for reuse, up to
+// JNIGlobalHandleCacheSize entries per kind. Cached entries are allocated in
+// the storage but hold null, which iteration already has to tolerate.
+class JNIHandleCache : public CHeapObj<mtInternal> {
+  class Entries {
+    oop*   _ptrs[OopStorage::bulk_allocate_limit];
+    size_t _count;
+
+    // _ptrs holds at most bulk_allocate_limit entries, which is smaller than
+    // the flag's maximum on 32-bit platforms.
+    static size_t limit() {
+      return MIN2((size_t)JNIGlobalHandleCacheSize, OopStorage::bulk_allocate_limit);
+    }
+
+  public:
+    Entries() : _count(0) {}
+
+    oop* allocate(OopStorage* storage) {
+      if (_count == 0) {
+        _count = storage->allocate(_ptrs, limit());
+        if (_count == 0) {
+          return nullptr;
+        }
+      }
+      return _ptrs[--_count];
+    }
+
+    void release(OopStorage* storage, oop* ptr) {
+      if (_count < limit()) {
+        _ptrs[_count++] = ptr;
+      } else {
+        storage->release(ptr);
+      }
+    }
+
+    void flush(OopStorage* storage) {
+      if (_count > 0) {
+        storage->release(_ptrs, _count);
+        _count = 0;
+      }
+    }
+  };
+
+  Entries _global;
+  Entries _weak_global;
+
+public:
+  Entries* global()      { return &_global; }
+  Entries* weak_global() { return &_weak_global; }
+
+  static JNIHandleCache* current() {
+    if (JNIGlobalHandleCacheSize == 0 || CheckJNICalls) {
+      // Keep deleted handles detectable for -Xcheck:jni.
+      return nullptr;
+    }
+    Thread* thread = Thread::current();
+    if (!thread->is_Java_thread()) {
+      return nullptr;
+    }
+    JavaThread* jt = JavaThread::cast(thread);
+    JNIHandleCache* cache = jt->jni_handle_cache();
+    if (cache == nullptr) {
+      cache = new JNIHandleCache();
+      jt->set_jni_handle_cache(cache);
+    }
+    return cache;
+  }
+};
+
+void JNIHandles::release_thread_cache(JavaThread* thread) {
+  JNIHandleCache* cache = thread->jni_handle_cache();
+  if (cache != nullptr) {
+    thread->set_jni_handle_cache(nullptr);
+    cache->global()->flush(global_handles());
+    cache->weak_global()->flush(weak_global_handles());
+    delete cache;
+  }
+}
+
 jobject JNIHandles::make_global(Handle obj, AllocFailType alloc_failmode) {
   assert(!Universe::heap()->is_stw_gc_active(), "can't extend the root set during GC pause");
   assert(!current_thread_in_native(), "must not be in native");
@@ -89,7 +171,9 @@ jobject JNIHandles::make_global(Handle obj, AllocFailType alloc_failmode) {
   if (!obj.is_null()) {
     // ignore null handles
     assert(oopDesc::is_oop(obj()), "not an oop");
-    oop* ptr = global_handles()->allocate();
+    JNIHandleCache* cache = JNIHandleCache::current();
+    oop* ptr = cache != nullptr ? cache->global()->allocate(global_handles())
+                                : global_handles()->allocate();
     // Return null on allocation failure.
     if (ptr != nullptr) {
       assert(NativeAccess<AS_NO_KEEPALIVE>::oop_load(ptr) == oop(nullptr), "invariant");
@@ -111,7 +195,9 @@ jweak JNIHandles::make_weak_global(Handle obj, AllocFailType alloc_failmode) {
   if (!obj.is_null()) {
     // ignore null handles
     assert(oopDesc::is_oop(obj()), "not an oop");
-    oop* ptr = weak_global_handles()->allocate();
+    JNIHandleCache* cache = JNIHandleCache::current();
+    oop* ptr = cache != nullptr ? cache->weak_global()->allocate(weak_global_handles())
+                                : weak_global_handles()->allocate();
     // Return nullptr on allocation failure.
     if (ptr != nullptr) {
       assert(NativeAccess<AS_NO_KEEPALIVE>::oop_load(ptr) == oop(nullptr), "invariant");
@@ -148,7 +234,12 @@ void JNIHandles::destroy_global(jobject handle) {
   if (handle != nullptr) {
     oop* oop_ptr = global_ptr(handle);
     NativeAccess<>::oop_store(oop_ptr, (oop)nullptr);
-    global_handles()->release(oop_ptr);
+    JNIHandleCache* cache = JNIHandleCache::current();
+    if (cache != nullptr) {
+      cache->global()->release(global_handles(), oop_ptr);
+    } else {
+      global_handles()->release(oop_ptr);
+    }
   }
 }
 
@@ -157,7 +248,12 @@ void JNIHandles::destroy_weak_global(jweak handle) {
   if (handle != nullptr) {
     oop* oop_ptr = weak_global_ptr(handle);
     NativeAccess<ON_PHANTOM_OOP_REF>::oop_store(oop_ptr, (oop)nullptr);
-    weak_global_handles()->release(oop_ptr);
+    JNIHandleCache* cache = JNIHandleCache::current();
+    if (cache != nullptr) {
+      cache->weak_global()->release(weak_global_handles(), oop_ptr);
+    } else {
+      weak_global_handles()->release(oop_ptr);
+    }
   }
 }
 
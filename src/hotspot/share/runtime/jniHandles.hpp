@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1998, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1998, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -128,6 +128,9 @@ class JNIHandles : AllStatic {
   static void weak_oops_do(OopClosure* f);
 
   static bool is_global_storage(const OopStorage* storage);
+
+  // Returns the handle entries cached by the thread to the shared storage.
+  static void release_thread_cache(JavaThread* thread);
 };
 
 
@@ -395,7 +395,7 @@ ObjectMonitor* LightweightSynchronizer::get_or_insert_monitor(oop object, JavaTh
     }
 
     // The monitor has an anonymous owner so it is safe from async deflation.
-    ObjectSynchronizer::_in_use_list.add(monitor);
+    ObjectSynchronizer::add_to_in_use_list(current, monitor);
   }
 
   return monitor;
@@ -871,7 +871,7 @@ ObjectMonitor* LightweightSynchronizer::inflate_into_object_header(oop object, O
         }
         // Once the ObjectMonitor is configured and object is associated
         // with the ObjectMonitor, it is safe to allow async deflation:
-        ObjectSynchronizer::_in_use_list.add(monitor);
+        ObjectSynchronizer::add_to_in_use_list(current, monitor);
 
         // Hopefully the performance counters are allocated on distinct
         // cache lines to avoid false sharing on MP systems ...
@@ -912,7 +912,7 @@ ObjectMonitor* LightweightSynchronizer::inflate_into_object_header(oop object, O
 
     // Once the ObjectMonitor is configured and object is associated
     // with the ObjectMonitor, it is safe to allow async deflation:
-    ObjectSynchronizer::_in_use_list.add(m);
+    ObjectSynchronizer::add_to_in_use_list(current, m);
 
     // Hopefully the performance counters are allocated on distinct
     // cache lines to avoid false sharing on MP systems ...
@@ -71,7 +71,7 @@ uint32_t LockStack::start_offset() {
 }
 
 uint32_t LockStack::end_offset() {
-  int offset = lock_stack_base_offset + CAPACITY * oopSize;
+  int offset = lock_stack_base_offset + capacity() * oopSize;
   assert(offset > 0, "must be positive offset");
   return static_cast<uint32_t>(offset);
 }
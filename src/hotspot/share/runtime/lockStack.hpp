@@ -44,7 +44,16 @@ class LockStack {
   friend class VMStructs;
   JVMCI_ONLY(friend class JVMCIVMStructs;)
  public:
-  static const int CAPACITY = 8;
+  // The number of entries reserved in every thread, whatever capacity() is.
+  // Every JavaThread embeds all of them, i.e. 256 bytes on 64-bit platforms,
+  // 192 more than the 8 entries it had before LockStackCapacity. Only the
+  // first capacity() entries are used.
+  static const int CAPACITY = 32;
+
+  // The number of entries in use, i.e. LockStackCapacity. JVMCI exports
+  // end_offset() during static initialization, before flags are parsed, so
+  // JVMCI-compiled code uses the default capacity and the flag cannot go below it.
+  static inline int capacity();
  private:
 
   // TODO: It would be very useful if JavaThread::lock_stack_offset() and friends were constexpr,
@@ -51,8 +51,13 @@ JavaThread* LockStack::get_thread() const {
   return reinterpret_cast<JavaThread*>(addr - lock_stack_offset);
 }
 
+inline int LockStack::capacity() {
+  assert(LockStackCapacity <= CAPACITY, "invariant");
+  return LockStackCapacity;
+}
+
 inline bool LockStack::is_full() const {
-  return to_index(_top) == CAPACITY;
+  return to_index(_top) >= capacity();
 }
 
 inline bool LockStack::is_owning_thread() const {
@@ -217,7 +222,7 @@ inline bool LockStack::contains(oop o) const {
 
 inline int LockStack::monitor_count() const {
   int end = to_index(_top);
-  assert(end <= CAPACITY, "invariant");
+  assert(end <= capacity(), "invariant");
   return end;
 }
 
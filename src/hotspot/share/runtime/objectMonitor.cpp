@@ -39,6 +39,7 @@
 #include "prims/jvmtiDeferredUpdates.hpp"
 #include "prims/jvmtiExport.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/continuationStatistics.hpp"
 #include "runtime/continuationWrapper.inline.hpp"
 #include "runtime/globals.hpp"
 #include "runtime/handles.inline.hpp"
@@ -274,6 +275,7 @@ ObjectMonitor::ObjectMonitor(oop object) :
   _succ(nullptr),
   _Responsible(nullptr),
   _SpinDuration(ObjectMonitor::Knob_SpinLimit),
+  _VThreadSpinDuration(ObjectMonitor::Knob_SpinLimit),
   _contentions(0),
   _WaitSet(nullptr),
   _waiters(0),
@@ -519,6 +521,7 @@ void ObjectMonitor::enter_with_contention_mark(JavaThread *current, ObjectMonito
     }
 
     OSThreadContendState osts(current->osthread());
+    PinnedBlockMark pbm(current);
 
     assert(current->thread_state() == _thread_in_vm, "invariant");
 
@@ -1642,6 +1645,9 @@ void ObjectMonitor::ExitEpilog(JavaThread* current, ObjectWaiter* Wakee) {
     // Platform thread case
     Trigger->unpark();
   } else if (java_lang_VirtualThread::set_onWaitingList(vthread, _vthread_cxq_head)) {
+    // Only the push onto an empty list wakes the unblocker. Later pushes join the
+    // batch it takes with JVM_TakeVirtualThreadListToUnblock, so under monitor churn
+    // it unblocks many virtual threads per wakeup rather than spinning on unpark.
     Trigger->unpark();
   }
 
@@ -1810,6 +1816,8 @@ void ObjectMonitor::wait(jlong millis, bool interruptible, TRAPS) {
     }
   }
 
+  PinnedBlockMark pbm(current);
+
   // create a node to be put into the queue
   // Critically, after we reset() the event but prior to park(), we must check
   // for a pending interrupt.
@@ -2270,6 +2278,7 @@ static int Knob_Penalty             = 200;     // spin failure penalty
 static int Knob_Poverty             = 1000;
 static int Knob_FixedSpin           = 0;
 static int Knob_PreSpin             = 10;      // 20-100 likely better, but it's not better in my testing.
+static int Knob_VThreadSpinBase     = 1000;    // spins a freeze and thaw of an empty stack is worth
 
 inline static int adjust_up(int spin_duration) {
   int x = spin_duration;
@@ -2298,12 +2307,34 @@ inline static int adjust_down(int spin_duration) {
   }
 }
 
+// With VThreadAdaptiveSpin, virtual threads learn their own spin duration per
+// monitor. A virtual thread that stops spinning is frozen and its carrier is
+// released, so the trade-off is different from that of a platform thread,
+// which parks.
+volatile int& ObjectMonitor::spin_duration_for(JavaThread* current) {
+  if (VThreadAdaptiveSpin && current->is_vthread_mounted()) {
+    return _VThreadSpinDuration;
+  }
+  return _SpinDuration;
+}
+
+// The number of spins that park-by-freezing is worth to this carrier: a fixed
+// cost plus the copying of the stack on freeze and thaw, estimated from the
+// average size of the carrier's recent freezes.
+static int vthread_spin_budget(JavaThread* current) {
+  const ContinuationCounters& counters = current->cont_counters();
+  uint64_t freezes = counters.get(ContinuationCounters::fast_freezes) + counters.get(ContinuationCounters::slow_freezes);
+  uint64_t avg_words = freezes == 0 ? 0 : counters.get(ContinuationCounters::words_frozen) / freezes;
+  return (int)MIN2((uint64_t)Knob_VThreadSpinBase + avg_words, (uint64_t)ObjectMonitor::Knob_SpinLimit);
+}
+
 bool ObjectMonitor::short_fixed_spin(JavaThread* current, int spin_count, bool adapt) {
   for (int ctr = 0; ctr < spin_count; ctr++) {
     TryLockResult status = TryLock(current);
     if (status == TryLockResult::Success) {
       if (adapt) {
-        _SpinDuration = adjust_up(_SpinDuration);
+        volatile int& spin_duration = spin_duration_for(current);
+        spin_duration = adjust_up(spin_duration);
       }
       return true;
     } else if (status == TryLockResult::Interference) {
@@ -2343,7 +2374,11 @@ bool ObjectMonitor::TrySpin(JavaThread* current) {
   // This takes us into the realm of 1-out-of-N spinning, where we
   // hold the duration constant but vary the frequency.
 
-  int ctr = _SpinDuration;
+  volatile int& spin_duration = spin_duration_for(current);
+  int ctr = spin_duration;
+  if (&spin_duration == &_VThreadSpinDuration) {
+    ctr = MIN2(ctr, vthread_spin_budget(current));
+  }
   if (ctr <= 0) return false;
 
   // We're good to spin ... spin ingress.
@@ -2408,7 +2443,7 @@ bool ObjectMonitor::TrySpin(JavaThread* current) {
         // If we acquired the lock early in the spin cycle it
         // makes sense to increase _SpinDuration proportionally.
         // Note that we don't clamp SpinDuration precisely at SpinLimit.
-        _SpinDuration = adjust_up(_SpinDuration);
+        spin_duration = adjust_up(spin_duration);
         return true;
       }
 
@@ -2433,7 +2468,7 @@ bool ObjectMonitor::TrySpin(JavaThread* current) {
 
   // Spin failed with prejudice -- reduce _SpinDuration.
   if (ctr < 0) {
-    _SpinDuration = adjust_down(_SpinDuration);
+    spin_duration = adjust_down(spin_duration);
   }
 
   if (_succ == current) {
@@ -2670,6 +2705,7 @@ void ObjectMonitor::print_debug_style_on(outputStream* st) const {
   st->print_cr("  _succ = " INTPTR_FORMAT, p2i(_succ));
   st->print_cr("  _Responsible = " INTPTR_FORMAT, p2i(_Responsible));
   st->print_cr("  _SpinDuration = %d", _SpinDuration);
+  st->print_cr("  _VThreadSpinDuration = %d", _VThreadSpinDuration);
   st->print_cr("  _contentions = %d", contentions());
   st->print_cr("  _WaitSet = " INTPTR_FORMAT, p2i(_WaitSet));
   st->print_cr("  _waiters = %d", _waiters);
@@ -206,6 +206,7 @@ class ObjectMonitor : public CHeapObj<mtObjectMonitor> {
   JavaThread* volatile _Responsible;
 
   volatile int _SpinDuration;
+  volatile int _VThreadSpinDuration; // _SpinDuration for virtual threads, see VThreadAdaptiveSpin
 
   int _contentions;                 // Number of active contentions in enter(). It is used by is_busy()
                                     // along with other fields to determine if an ObjectMonitor can be
@@ -420,6 +421,7 @@ class ObjectMonitor : public CHeapObj<mtObjectMonitor> {
   TryLockResult  TryLock(JavaThread* current);
 
   bool      TrySpin(JavaThread* current);
+  volatile int& spin_duration_for(JavaThread* current);
   bool      short_fixed_spin(JavaThread* current, int spin_count, bool adapt);
   void      ExitEpilog(JavaThread* current, ObjectWaiter* Wakee);
 
@@ -62,6 +62,7 @@
 #include "runtime/osThread.hpp"
 #include "runtime/safefetch.hpp"
 #include "runtime/sharedRuntime.hpp"
+#include "runtime/sizeClassMalloc.hpp"
 #include "runtime/threadCrashProtection.hpp"
 #include "runtime/threadSMR.hpp"
 #include "runtime/vmOperations.hpp"
@@ -662,9 +663,15 @@ void* os::malloc(size_t size, MemTag mem_tag, const NativeCallStack& stack) {
     return nullptr;
   }
 
-  ALLOW_C_FUNCTION(::malloc, void* const outer_ptr = ::malloc(outer_size);)
+  void* outer_ptr = nullptr;
+  if (SizeClassMalloc::is_enabled_for(mem_tag)) {
+    outer_ptr = SizeClassMalloc::allocate(outer_size);
+  }
   if (outer_ptr == nullptr) {
-    return nullptr;
+    ALLOW_C_FUNCTION(::malloc, outer_ptr = ::malloc(outer_size);)
+    if (outer_ptr == nullptr) {
+      return nullptr;
+    }
   }
 
   void* const inner_ptr = MemTracker::record_malloc((address)outer_ptr, size, mem_tag, stack);
@@ -702,6 +709,22 @@ void* os::realloc(void *memblock, size_t size, MemTag mem_tag, const NativeCallS
   // we chose the latter.
   size = MAX2((size_t)1, size);
 
+  if (SizeClassMalloc::enabled()) {
+    void* const old_outer_ptr = MemTracker::enabled() ? (void*)MallocTracker::malloc_header(memblock) : memblock;
+    if (SizeClassMalloc::contains(old_outer_ptr)) {
+      // There is no realloc(3) for these blocks, allocate a new one and copy.
+      const size_t old_size = MemTracker::enabled() ? MallocTracker::malloc_header(memblock)->size()
+                                                    : SizeClassMalloc::block_size(old_outer_ptr);
+      void* const new_memblock = os::malloc(size, mem_tag, stack);
+      if (new_memblock == nullptr) {
+        return nullptr;
+      }
+      ::memcpy(new_memblock, memblock, MIN2(old_size, size));
+      os::free(memblock);
+      return new_memblock;
+    }
+  }
+
   if (MemTracker::enabled()) {
     // NMT realloc handling
 
@@ -785,6 +808,10 @@ void  os::free(void *memblock) {
   // When NMT is enabled this checks for heap overwrites, then deaccounts the old block.
   void* const old_outer_ptr = MemTracker::record_free(memblock);
 
+  if (SizeClassMalloc::contains(old_outer_ptr)) {
+    SizeClassMalloc::free(old_outer_ptr);
+    return;
+  }
   ALLOW_C_FUNCTION(::free, ::free(old_outer_ptr);)
 }
 
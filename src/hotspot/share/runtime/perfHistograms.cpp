@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/os.hpp"
+#include "runtime/perfHistograms.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/powerOfTwo.hpp"
+
+PerfHistogram::PerfHistogram() : _count(nullptr), _sum(nullptr), _max(nullptr) {
+  for (int i = 0; i < NumBuckets; i++) {
+    _buckets[i] = nullptr;
+  }
+}
+
+PerfHistogram* PerfHistogram::create(const char* name, TRAPS) {
+  PerfHistogram* h = new PerfHistogram();
+  char counter[64];
+
+  os::snprintf_checked(counter, sizeof(counter), "histogram.%s.buckets", name);
+  PerfDataManager::create_constant(SUN_RT, counter, PerfData::U_None, NumBuckets, CHECK_NULL);
+  os::snprintf_checked(counter, sizeof(counter), "histogram.%s.count", name);
+  h->_count = PerfDataManager::create_counter(SUN_RT, counter, PerfData::U_Events, CHECK_NULL);
+  os::snprintf_checked(counter, sizeof(counter), "histogram.%s.sum", name);
+  h->_sum = PerfDataManager::create_counter(SUN_RT, counter, PerfData::U_None, CHECK_NULL);
+  os::snprintf_checked(counter, sizeof(counter), "histogram.%s.max", name);
+  h->_max = PerfDataManager::create_variable(SUN_RT, counter, PerfData::U_None, CHECK_NULL);
+  for (int i = 0; i < NumBuckets; i++) {
+    os::snprintf_checked(counter, sizeof(counter), "histogram.%s.%d", name, i);
+    h->_buckets[i] = PerfDataManager::create_counter(SUN_RT, counter, PerfData::U_Events, CHECK_NULL);
+  }
+  return h;
+}
+
+int PerfHistogram::bucket(jlong value) {
+  if (value <= 0) {
+    return 0;
+  }
+  return MIN2(log2i((julong)value) + 1, NumBuckets - 1);
+}
+
+void PerfHistogram::record(jlong value) {
+  Atomic::inc((volatile jlong*)_buckets[bucket(value)]->get_address(), memory_order_relaxed);
+  Atomic::add((volatile jlong*)_sum->get_address(), value, memory_order_relaxed);
+  Atomic::inc((volatile jlong*)_count->get_address(), memory_order_relaxed);
+
+  volatile jlong* max = (volatile jlong*)_max->get_address();
+  jlong cur = Atomic::load(max);
+  while (value > cur) {
+    jlong prev = Atomic::cmpxchg(max, cur, value, memory_order_relaxed);
+    if (prev == cur) {
+      break;
+    }
+    cur = prev;
+  }
+}
+
+volatile bool  PerfHistograms::_enabled = false;
+PerfHistogram* PerfHistograms::_safepoint_sync_time = nullptr;
+PerfHistogram* PerfHistograms::_safepoint_time = nullptr;
+PerfHistogram* PerfHistograms::_gc_pause_time = nullptr;
+PerfHistogram* PerfHistograms::_allocation_rate = nullptr;
+PerfHistogram* PerfHistograms::_vthread_mount_time = nullptr;
+PerfHistogram* PerfHistograms::_compile_queue_length = nullptr;
+jlong          PerfHistograms::_last_gc_end_ns = 0;
+size_t         PerfHistograms::_last_gc_end_used = 0;
+
+void PerfHistograms::init() {
+  if (!UsePerfData || !UsePerfDataHistograms) {
+    return;
+  }
+  EXCEPTION_MARK;
+
+  PerfDataManager::create_constant(SUN_RT, "histogram.version", PerfData::U_None, Version, CHECK);
+  _safepoint_sync_time  = PerfHistogram::create("safepointSyncTime", CHECK);
+  _safepoint_time       = PerfHistogram::create("safepointTime", CHECK);
+  _gc_pause_time        = PerfHistogram::create("gcPauseTime", CHECK);
+  _allocation_rate      = PerfHistogram::create("allocationRate", CHECK);
+  _vthread_mount_time   = PerfHistogram::create("vthreadMountTime", CHECK);
+  _compile_queue_length = PerfHistogram::create("compileQueueLength", CHECK);
+
+  _last_gc_end_ns = os::javaTimeNanos();
+  Atomic::release_store(&_enabled, true);
+}
+
+void PerfHistograms::record_safepoint_synchronized(jlong sync_ns) {
+  if (is_enabled()) {
+    _safepoint_sync_time->record(sync_ns / (NANOUNITS / MICROUNITS));
+  }
+}
+
+void PerfHistograms::record_safepoint_end(jlong safepoint_ns) {
+  if (is_enabled()) {
+    _safepoint_time->record(safepoint_ns / (NANOUNITS / MICROUNITS));
+  }
+}
+
+void PerfHistograms::record_gc_pause(jlong pause_ns) {
+  if (is_enabled()) {
+    _gc_pause_time->record(pause_ns / (NANOUNITS / MICROUNITS));
+  }
+}
+
+// The allocation rate is sampled once per GC, from the heap usage at the end
+// of the previous GC to the usage at the start of this one. Both are called
+// at a safepoint, so the state needs no synchronization.
+void PerfHistograms::record_heap_before_gc(size_t used) {
+  if (is_enabled()) {
+    jlong now = os::javaTimeNanos();
+    jlong elapsed_ns = now - _last_gc_end_ns;
+    if (elapsed_ns > 0 && used > _last_gc_end_used) {
+      double kb_per_sec = (double)(used - _last_gc_end_used) / K * NANOSECS_PER_SEC / elapsed_ns;
+      _allocation_rate->record((jlong)kb_per_sec);
+    }
+  }
+}
+
+void PerfHistograms::record_heap_after_gc(size_t used) {
+  if (is_enabled()) {
+    _last_gc_end_ns = os::javaTimeNanos();
+    _last_gc_end_used = used;
+  }
+}
+
+void PerfHistograms::record_vthread_mount(jlong thaw_ns) {
+  if (is_enabled()) {
+    _vthread_mount_time->record(thaw_ns);
+  }
+}
+
+void PerfHistograms::record_compile_queue_length(int length) {
+  if (is_enabled()) {
+    _compile_queue_length->record(length);
+  }
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef SHARE_RUNTIME_PERFHISTOGRAMS_HPP
+#define SHARE_RUNTIME_PERFHISTOGRAMS_HPP
+
+#include "memory/allocation.hpp"
+#include "runtime/perfData.hpp"
+#include "utilities/exceptions.hpp"
+
+// A histogram of jlong samples kept in PerfData memory, so that it can be
+// read from the hsperfdata file without any cooperation from the VM.
+//
+// For a histogram <name> the following counters are created in the sun.rt
+// name space:
+//
+//   histogram.<name>.buckets    constant, the number of buckets
+//   histogram.<name>.count      number of samples
+//   histogram.<name>.sum        sum of the samples
+//   histogram.<name>.max        largest sample
+//   histogram.<name>.<i>        samples in bucket i
+//
+// Bucket 0 counts samples <= 0 and bucket i > 0 counts samples in
+// [2^(i-1), 2^i), except that the last bucket also counts everything above.
+// The unit of the samples is given by the histogram, see PerfHistograms.
+// Counters are updated in place with relaxed atomics, so a reader may see
+// a count that is slightly out of step with the buckets.
+class PerfHistogram : public CHeapObj<mtInternal> {
+ public:
+  static const int NumBuckets = 32;
+
+ private:
+  PerfCounter*  _count;
+  PerfCounter*  _sum;
+  PerfVariable* _max;
+  PerfCounter*  _buckets[NumBuckets];
+
+  PerfHistogram();
+
+  static int bucket(jlong value);
+
+ public:
+  static PerfHistogram* create(const char* name, TRAPS);
+
+  void record(jlong value);
+};
+
+// The histograms of GC and runtime events exported when
+// UsePerfDataHistograms is enabled.
+class PerfHistograms : AllStatic {
+ public:
+  // Version of the set and layout of the histograms, exported as
+  // sun.rt.histogram.version. Incremented on incompatible changes.
+  static const jlong Version = 1;
+
+ private:
+  static volatile bool  _enabled;
+  static PerfHistogram* _safepoint_sync_time;   // time to safepoint, in microseconds
+  static PerfHistogram* _safepoint_time;        // time at safepoint, in microseconds
+  static PerfHistogram* _gc_pause_time;         // GC pause, in microseconds
+  static PerfHistogram* _allocation_rate;       // between GCs, in KB per second
+  static PerfHistogram* _vthread_mount_time;    // thawing a virtual thread on mount, in nanoseconds
+  static PerfHistogram* _compile_queue_length;  // length of a compile queue after each add
+
+  static jlong _last_gc_end_ns;
+  static size_t _last_gc_end_used;
+
+ public:
+  static void init();
+
+  static bool is_enabled() { return _enabled; }
+
+  static void record_safepoint_synchronized(jlong sync_ns);
+  static void record_safepoint_end(jlong safepoint_ns);
+  static void record_gc_pause(jlong pause_ns);
+  static void record_heap_before_gc(size_t used);
+  static void record_heap_after_gc(size_t used);
+  static void record_vthread_mount(jlong thaw_ns);
+  static void record_compile_queue_length(int length);
+};
+
+#endif // SHARE_RUNTIME_PERFHISTOGRAMS_HPP
@@ -52,6 +52,7 @@
 #include "runtime/mutexLocker.hpp"
 #include "runtime/orderAccess.hpp"
 #include "runtime/osThread.hpp"
+#include "runtime/perfHistograms.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/safepointMechanism.inline.hpp"
 #include "runtime/signature.hpp"
@@ -129,6 +130,63 @@ static bool timeout_error_printed = false;
 static jlong _safepoint_begin_time = 0;
 static volatile int _nof_threads_hit_polling_page = 0;
 
+// The last threads to reach the safepoint. Threads are recorded in the order
+// in which the VM thread sees them stop, so these are the slowest ones.
+static const int _max_slow_threads = 3;
+static JavaThread* _slow_threads[_max_slow_threads];
+static jlong _slow_thread_times[_max_slow_threads];
+static int _nof_slow_threads = 0;
+
+static bool should_record_slow_threads() {
+  return EventSafepointSlowThread::is_enabled() || log_is_enabled(Debug, safepoint);
+}
+
+static void record_slow_thread(JavaThread* thread, jlong time_to_safepoint) {
+  int index = _nof_slow_threads++ % _max_slow_threads;
+  _slow_threads[index] = thread;
+  _slow_thread_times[index] = time_to_safepoint;
+}
+
+// Report where the slowest threads stopped. Called once all threads are safe,
+// so their last Java frames can be inspected.
+static void report_slow_threads(uint64_t safepoint_id) {
+  int count = MIN2(_nof_slow_threads, _max_slow_threads);
+  for (int i = 0; i < count; i++) {
+    // Slowest first.
+    int index = (_nof_slow_threads - 1 - i) % _max_slow_threads;
+    JavaThread* thread = _slow_threads[index];
+    address pc = nullptr;
+    Method* method = nullptr;
+    if (thread->has_last_Java_frame()) {
+      frame fr = thread->last_frame();
+      pc = fr.pc();
+      if (fr.is_interpreted_frame()) {
+        method = fr.interpreter_frame_method();
+      } else if (fr.cb() != nullptr && fr.cb()->is_nmethod()) {
+        method = fr.cb()->as_nmethod()->method();
+      }
+    }
+
+    EventSafepointSlowThread event;
+    if (event.should_commit()) {
+      event.set_safepointId(safepoint_id);
+      event.set_thread(JFR_THREAD_ID(thread));
+      event.set_timeToSafepoint(_slow_thread_times[index]);
+      event.set_method(method);
+      event.set_pc((u8)pc);
+      event.commit();
+    }
+
+    if (log_is_enabled(Debug, safepoint)) {
+      ResourceMark rm;
+      log_debug(safepoint)("Slow thread %s reached safepoint after " JLONG_FORMAT " ns at " PTR_FORMAT " in %s",
+                           thread->name(), _slow_thread_times[index], p2i(pc),
+                           method != nullptr ? method->external_name() : "<no Java frame>");
+    }
+  }
+  _nof_slow_threads = 0;
+}
+
 void SafepointSynchronize::init(Thread* vmthread) {
   // WaitBarrier should never be destroyed since we will have
   // threads waiting on it while exiting.
@@ -234,6 +292,7 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
 
   int iterations = 1; // The first iteration is above.
   int64_t start_time = os::javaTimeNanos();
+  const bool record_slow = should_record_slow_threads();
 
   do {
     // Check if this has taken too long:
@@ -241,12 +300,18 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
       print_safepoint_timeout();
     }
 
+    // Threads that stop in this iteration took at least this long.
+    jlong time_to_safepoint = record_slow ? os::javaTimeNanos() - SafepointTracing::start_of_safepoint() : 0;
+
     p_prev = &tss_head;
     ThreadSafepointState *cur_tss = tss_head;
     while (cur_tss != nullptr) {
       assert(cur_tss->is_running(), "Illegal initial state");
       if (thread_not_running(cur_tss)) {
         --still_running;
+        if (record_slow) {
+          record_slow_thread(cur_tss->thread(), time_to_safepoint);
+        }
         *p_prev = nullptr;
         ThreadSafepointState *tmp = cur_tss;
         cur_tss = cur_tss->get_next();
@@ -417,6 +482,10 @@ void SafepointSynchronize::begin() {
                                    initial_running,
                                    _waiting_to_block, iterations);
 
+  if (_nof_slow_threads > 0) {
+    report_slow_threads(_safepoint_id);
+  }
+
   SafepointTracing::synchronized(nof_threads, initial_running, _nof_threads_hit_polling_page);
 
   post_safepoint_begin_event(begin_event, _safepoint_id, nof_threads, _current_jni_active_count);
@@ -965,6 +1034,7 @@ void SafepointTracing::synchronized(int nof_threads, int nof_running, int traps)
   _nof_running = nof_running;
   _page_trap   = traps;
   RuntimeService::record_safepoint_synchronized(_last_safepoint_sync_time_ns - _last_safepoint_begin_time_ns);
+  PerfHistograms::record_safepoint_synchronized(_last_safepoint_sync_time_ns - _last_safepoint_begin_time_ns);
 }
 
 void SafepointTracing::end() {
@@ -994,4 +1064,5 @@ void SafepointTracing::end() {
      );
 
   RuntimeService::record_safepoint_end(_last_safepoint_end_time_ns - _last_safepoint_sync_time_ns);
+  PerfHistograms::record_safepoint_end(_last_safepoint_end_time_ns - _last_safepoint_sync_time_ns);
 }
@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "logging/log.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/globals_extension.hpp"
+#include "runtime/os.hpp"
+#include "runtime/sizeClassMalloc.hpp"
+#include "runtime/thread.hpp"
+#include "utilities/align.hpp"
+#include "utilities/debug.hpp"
+#include "utilities/ostream.hpp"
+
+const size_t SizeClassMalloc::_size_class_sizes[SizeClassMalloc::num_size_classes] = {
+  16, 32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024, 1536, 2048
+};
+
+char*           SizeClassMalloc::_base = nullptr;
+char*           SizeClassMalloc::_end = nullptr;
+volatile size_t SizeClassMalloc::_num_slabs = 0;
+size_t          SizeClassMalloc::_max_slabs = 0;
+uint8_t*        SizeClassMalloc::_slab_size_classes = nullptr;
+SizeClassMalloc::CentralFreeList SizeClassMalloc::_central[SizeClassMalloc::num_size_classes];
+
+THREAD_LOCAL SizeClassMalloc::Block* SizeClassMalloc::_cache[SizeClassMalloc::num_size_classes];
+THREAD_LOCAL uint                    SizeClassMalloc::_cache_length[SizeClassMalloc::num_size_classes];
+THREAD_LOCAL bool                    SizeClassMalloc::_cache_disabled = false;
+
+void SizeClassMalloc::initialize() {
+  if (!UseSizeClassMalloc) {
+    return;
+  }
+  assert(_base == nullptr, "Only once");
+  STATIC_ASSERT(max_block_size <= slab_size);
+
+  const size_t reserve_size = align_up(SizeClassMallocReserveSize, slab_size);
+  char* const base = os::reserve_memory(reserve_size, !ExecMem, mtInternal);
+  if (base == nullptr) {
+    log_warning(malloc)("Could not reserve " SIZE_FORMAT " bytes for UseSizeClassMalloc, disabling it", reserve_size);
+    FLAG_SET_ERGO(UseSizeClassMalloc, false);
+    return;
+  }
+  _max_slabs = reserve_size / slab_size;
+  _slab_size_classes = NEW_C_HEAP_ARRAY(uint8_t, _max_slabs, mtInternal);
+  for (int sc = 0; sc < num_size_classes; sc++) {
+    _central[sc]._lock = 0;
+    _central[sc]._head = nullptr;
+    _central[sc]._length = 0;
+    _central[sc]._slabs = 0;
+  }
+  _end = base + reserve_size;
+  // Publish last, os::malloc() starts using the allocator from here on.
+  Atomic::release_store(&_base, base);
+  log_info(malloc)("Size-class malloc: reserved " SIZE_FORMAT " bytes at " PTR_FORMAT, reserve_size, p2i(base));
+}
+
+int SizeClassMalloc::size_class(size_t size) {
+  for (int sc = 0; sc < num_size_classes; sc++) {
+    if (size <= _size_class_sizes[sc]) {
+      return sc;
+    }
+  }
+  return -1;
+}
+
+// Keep about 32K per size class in a thread cache, and at least a few blocks.
+uint SizeClassMalloc::cache_capacity(int sc) {
+  return (uint)MAX2((size_t)8, 32 * K / _size_class_sizes[sc]);
+}
+
+// Carve a new slab. Committing may allocate C-heap for NMT, so this is done
+// without holding any of the central free list locks.
+SizeClassMalloc::Block* SizeClassMalloc::allocate_slab(int sc, uint* length) {
+  if (Atomic::load(&_num_slabs) >= _max_slabs) {
+    return nullptr;
+  }
+  const size_t index = Atomic::fetch_then_add(&_num_slabs, (size_t)1);
+  if (index >= _max_slabs) {
+    return nullptr;
+  }
+  char* const slab = _base + index * slab_size;
+  if (!os::commit_memory(slab, slab_size, !ExecMem)) {
+    // The slab stays unused, later allocations may retry with the next one.
+    return nullptr;
+  }
+  _slab_size_classes[index] = (uint8_t)sc;
+
+  const size_t block_size = _size_class_sizes[sc];
+  const size_t num_blocks = slab_size / block_size;
+  Block* head = nullptr;
+  for (size_t i = num_blocks; i > 0; i--) {
+    Block* b = (Block*)(slab + (i - 1) * block_size);
+    b->_next = head;
+    head = b;
+  }
+  *length = (uint)num_blocks;
+  return head;
+}
+
+bool SizeClassMalloc::refill_cache(int sc) {
+  assert(_cache[sc] == nullptr, "only refill empty caches");
+  const uint batch = cache_capacity(sc) / 2;
+  CentralFreeList* const central = &_central[sc];
+
+  Thread::SpinAcquire(&central->_lock, "SizeClassMalloc");
+  Block* head = central->_head;
+  uint taken = 0;
+  if (head != nullptr) {
+    Block* last = head;
+    taken = 1;
+    while (taken < batch && last->_next != nullptr) {
+      last = last->_next;
+      taken++;
+    }
+    central->_head = last->_next;
+    central->_length -= taken;
+    last->_next = nullptr;
+  }
+  Thread::SpinRelease(&central->_lock);
+
+  if (head == nullptr) {
+    uint length = 0;
+    head = allocate_slab(sc, &length);
+    if (head == nullptr) {
+      return false;
+    }
+    // Keep a batch in the thread cache, the rest of the slab goes to the central list.
+    Block* last = head;
+    taken = 1;
+    while (taken < batch && last->_next != nullptr) {
+      last = last->_next;
+      taken++;
+    }
+    Block* const rest = last->_next;
+    last->_next = nullptr;
+    Thread::SpinAcquire(&central->_lock, "SizeClassMalloc");
+    central->_slabs++;
+    if (rest != nullptr) {
+      Block* rest_last = rest;
+      while (rest_last->_next != nullptr) {
+        rest_last = rest_last->_next;
+      }
+      rest_last->_next = central->_head;
+      central->_head = rest;
+      central->_length += length - taken;
+    }
+    Thread::SpinRelease(&central->_lock);
+  }
+
+  _cache[sc] = head;
+  _cache_length[sc] = taken;
+  return true;
+}
+
+void SizeClassMalloc::flush_cache(int sc, uint count) {
+  assert(count <= _cache_length[sc], "not that many cached");
+  if (count == 0) {
+    return;
+  }
+  Block* const head = _cache[sc];
+  Block* last = head;
+  for (uint i = 1; i < count; i++) {
+    last = last->_next;
+  }
+  _cache[sc] = last->_next;
+  _cache_length[sc] -= count;
+
+  CentralFreeList* const central = &_central[sc];
+  Thread::SpinAcquire(&central->_lock, "SizeClassMalloc");
+  last->_next = central->_head;
+  central->_head = head;
+  central->_length += count;
+  Thread::SpinRelease(&central->_lock);
+}
+
+void* SizeClassMalloc::allocate(size_t size) {
+  assert(enabled(), "not initialized");
+  const int sc = size_class(size);
+  if (sc < 0 || _cache_disabled) {
+    return nullptr;
+  }
+  if (_cache[sc] == nullptr && !refill_cache(sc)) {
+    return nullptr;
+  }
+  Block* const b = _cache[sc];
+  _cache[sc] = b->_next;
+  _cache_length[sc]--;
+  return b;
+}
+
+void SizeClassMalloc::free(void* p) {
+  assert(contains(p), "not a block of this allocator: " PTR_FORMAT, p2i(p));
+  const int sc = _slab_size_classes[slab_index(p)];
+  assert((pointer_delta(p, _base, 1) % slab_size) % _size_class_sizes[sc] == 0,
+         "not a block start: " PTR_FORMAT, p2i(p));
+  Block* const b = (Block*)p;
+  b->_next = _cache[sc];
+  _cache[sc] = b;
+  if (_cache_disabled) {
+    flush_cache(sc, ++_cache_length[sc]);
+  } else if (++_cache_length[sc] > cache_capacity(sc)) {
+    flush_cache(sc, _cache_length[sc] / 2);
+  }
+}
+
+size_t SizeClassMalloc::block_size(const void* p) {
+  assert(contains(p), "not a block of this allocator: " PTR_FORMAT, p2i(p));
+  return _size_class_sizes[_slab_size_classes[slab_index(p)]];
+}
+
+void SizeClassMalloc::thread_exit() {
+  if (!enabled()) {
+    return;
+  }
+  _cache_disabled = true;
+  for (int sc = 0; sc < num_size_classes; sc++) {
+    flush_cache(sc, _cache_length[sc]);
+  }
+}
+
+void SizeClassMalloc::thread_attach() {
+  _cache_disabled = false;
+}
+
+void SizeClassMalloc::print_state(outputStream* st) {
+  if (!enabled()) {
+    st->print_cr("Size-class malloc disabled");
+    return;
+  }
+  // No locking, this may run during error reporting.
+  const size_t num_slabs = MIN2(Atomic::load(&_num_slabs), _max_slabs);
+  st->print_cr("Size-class malloc enabled (reserved: " SIZE_FORMAT "K, slabs used: " SIZE_FORMAT "/" SIZE_FORMAT ")",
+               pointer_delta(_end, _base, K), num_slabs, _max_slabs);
+  for (int sc = 0; sc < num_size_classes; sc++) {
+    const CentralFreeList* central = &_central[sc];
+    if (central->_slabs > 0) {
+      st->print_cr("  " SIZE_FORMAT_W(4) " bytes: " SIZE_FORMAT " slabs, " SIZE_FORMAT " blocks in central free list",
+                   _size_class_sizes[sc], central->_slabs, central->_length);
+    }
+  }
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef SHARE_RUNTIME_SIZECLASSMALLOC_HPP
+#define SHARE_RUNTIME_SIZECLASSMALLOC_HPP
+
+#include "memory/allStatic.hpp"
+#include "memory/padded.hpp"
+#include "nmt/memTag.hpp"
+#include "runtime/globals.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class outputStream;
+
+// A size-class allocator for the small, short lived C-heap allocations of the
+// GC, the compilers and the runtime internals, enabled with UseSizeClassMalloc.
+//
+// These categories churn small blocks from many threads. With the C library
+// allocator this contends on its arenas and fragments them, so that the RSS
+// keeps growing over the lifetime of the process. Here, a contiguous range of
+// address space is reserved up front and committed in slabs on demand. Every
+// slab holds blocks of one size class only. Freed blocks go to a small cache
+// of the freeing thread, and batches of blocks are moved between the thread
+// caches and a central free list per size class. The memory committed is thus
+// bounded by the peak usage per size class, instead of growing with the
+// fragmentation.
+//
+// os::malloc() hands the outer size, including the NMT malloc header and
+// footer, to allocate(). The NMT accounting is therefore the same as with
+// the C library allocator. os::free() and os::realloc() recognize the blocks
+// of this allocator by their address.
+class SizeClassMalloc : AllStatic {
+public:
+  static const size_t slab_size = 64 * K;
+  static const size_t max_block_size = 2 * K;
+  static const int num_size_classes = 14;
+
+private:
+  struct Block {
+    Block* _next;
+  };
+
+  struct CentralFreeList {
+    volatile int _lock;
+    Block*       _head;
+    size_t       _length;
+    size_t       _slabs;
+    DEFINE_PAD_MINUS_SIZE(0, DEFAULT_PADDING_SIZE, sizeof(int) + sizeof(Block*) + 2 * sizeof(size_t));
+  };
+
+  static const size_t _size_class_sizes[num_size_classes];
+
+  static char*          _base;
+  static char*          _end;
+  static volatile size_t _num_slabs;
+  static size_t         _max_slabs;
+  static uint8_t*       _slab_size_classes;
+  static CentralFreeList _central[num_size_classes];
+
+  static THREAD_LOCAL Block* _cache[num_size_classes];
+  static THREAD_LOCAL uint   _cache_length[num_size_classes];
+  // Set once the thread's caches have been flushed on exit or detach. Blocks
+  // freed afterwards go straight to the central free lists, and allocations
+  // fall back to the C library, since nothing would flush the caches again.
+  static THREAD_LOCAL bool   _cache_disabled;
+
+  static int size_class(size_t size);
+  static uint cache_capacity(int sc);
+
+  static bool refill_cache(int sc);
+  static void flush_cache(int sc, uint count);
+  static Block* allocate_slab(int sc, uint* length);
+
+  static size_t slab_index(const void* p) {
+    return pointer_delta(p, _base, 1) / slab_size;
+  }
+
+public:
+  static void initialize();
+
+  static inline bool enabled() { return _base != nullptr; }
+
+  // Is an allocation with this tag served by this allocator?
+  static inline bool is_enabled_for(MemTag mem_tag) {
+    return enabled() && (mem_tag == mtGC || mem_tag == mtCompiler || mem_tag == mtInternal);
+  }
+
+  static inline bool contains(const void* p) {
+    return p >= _base && p < _end;
+  }
+
+  // Returns null if the size is too large, or if the reserved space is exhausted;
+  // the caller then falls back to the C library.
+  static void* allocate(size_t size);
+  static void free(void* p);
+
+  // The usable size of a block of this allocator
+  static size_t block_size(const void* p);
+
+  // Return the blocks cached by the current thread to the central free lists,
+  // and stop caching for it. Called when a thread exits or detaches from the VM.
+  static void thread_exit();
+  // Resume caching for a native thread that attaches again after detaching.
+  static void thread_attach();
+
+  static void print_state(outputStream* st);
+};
+
+#endif // SHARE_RUNTIME_SIZECLASSMALLOC_HPP
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_RUNTIME_STACKCHUNKCACHE_HPP
+#define SHARE_RUNTIME_STACKCHUNKCACHE_HPP
+
+#include "oops/oopsHierarchy.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class OopClosure;
+
+// A small per-carrier-thread cache of empty stack chunks.
+//
+// When a continuation is thawed in full on the fast path, its now empty chunk is
+// released into the cache of the carrier thread instead of being left for the GC,
+// and the next freeze on that carrier takes a chunk from the cache before
+// allocating a new one. Chunks are kept in power-of-two size classes, one entry
+// per class. The cached chunks are roots of the owning thread; a chunk that has
+// since been seen by the GC, or that would require barriers, is not reusable on
+// the fast path and is dropped when encountered.
+//
+// The cache also keeps a decaying maximum of the stack sizes recently requested
+// for new chunks on this carrier, used to presize new chunks (PresizeStackChunks).
+class StackChunkCache {
+  friend class VMStructs;
+ public:
+  static const int MinSizeClassLog = 8;  // chunks smaller than 2^8 words are not cached
+  static const int NumSizeClasses  = 8;  // nor are chunks of 2^16 words or more
+
+ private:
+  oop _chunks[NumSizeClasses];
+  int _size_hint;
+
+  static int size_class(int stack_size);
+  static inline bool is_reusable(stackChunkOop chunk);
+
+ public:
+  StackChunkCache();
+
+  // Returns an empty chunk with a stack of at least stack_size words, or null.
+  inline stackChunkOop take(int stack_size);
+  // Releases an empty chunk into the cache. Returns false if it was not cached.
+  inline bool release(stackChunkOop chunk);
+
+  // Records that a new chunk with a stack of stack_size words is needed, and returns
+  // the stack size to allocate it with, which is at least stack_size.
+  inline int presize(int stack_size);
+
+  void clear();
+  void oops_do(OopClosure* cl);
+};
+
+#endif // SHARE_RUNTIME_STACKCHUNKCACHE_HPP
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_RUNTIME_STACKCHUNKCACHE_INLINE_HPP
+#define SHARE_RUNTIME_STACKCHUNKCACHE_INLINE_HPP
+
+#include "runtime/stackChunkCache.hpp"
+
+#include "oops/stackChunkOop.inline.hpp"
+#include "utilities/powerOfTwo.hpp"
+
+inline int StackChunkCache::size_class(int stack_size) {
+  assert(stack_size > 0, "");
+  return log2i(stack_size) - MinSizeClassLog;
+}
+
+inline bool StackChunkCache::is_reusable(stackChunkOop chunk) {
+  return chunk->is_empty()
+         && !chunk->is_gc_mode()
+         && !chunk->has_bitmap()
+         && !chunk->requires_barriers();
+}
+
+inline stackChunkOop StackChunkCache::take(int stack_size) {
+  // Any chunk in a size class above that of stack_size is large enough, and those
+  // in the same class might be.
+  for (int i = MAX2(size_class(stack_size), 0); i < NumSizeClasses; i++) {
+    stackChunkOop chunk = stackChunkOopDesc::cast(_chunks[i]);
+    if (chunk == nullptr || chunk->stack_size() < stack_size) {
+      continue;
+    }
+    _chunks[i] = nullptr;
+    if (is_reusable(chunk)) {
+      return chunk;
+    }
+  }
+  return nullptr;
+}
+
+inline bool StackChunkCache::release(stackChunkOop chunk) {
+  assert(chunk->is_empty(), "only empty chunks can be released");
+  const int i = size_class(chunk->stack_size());
+  if (i < 0 || i >= NumSizeClasses || !is_reusable(chunk)) {
+    return false;
+  }
+  // Don't keep the previous owner alive through the cache
+  chunk->set_parent(nullptr);
+  chunk->set_cont(nullptr);
+  _chunks[i] = chunk;
+  return true;
+}
+
+inline int StackChunkCache::presize(int stack_size) {
+  // Only presize to sizes that can be cached, so a presized chunk remains
+  // reusable once it is empty.
+  if (size_class(stack_size) >= NumSizeClasses) {
+    return stack_size;
+  }
+  _size_hint = MAX2(stack_size, _size_hint - (_size_hint >> 3));
+  return _size_hint;
+}
+
+#endif // SHARE_RUNTIME_STACKCHUNKCACHE_INLINE_HPP
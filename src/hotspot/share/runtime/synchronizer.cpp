@@ -76,20 +76,13 @@ void MonitorList::add(ObjectMonitor* m) {
     m->set_next_om(head);
   } while (Atomic::cmpxchg(&_head, head, m) != head);
 
-  size_t count = Atomic::add(&_count, 1u);
-  if (count > max()) {
-    Atomic::inc(&_max);
-  }
+  Atomic::inc(&_count);
 }
 
 size_t MonitorList::count() const {
   return Atomic::load(&_count);
 }
 
-size_t MonitorList::max() const {
-  return Atomic::load(&_max);
-}
-
 class ObjectMonitorDeflationSafepointer : public StackObj {
   JavaThread* const                    _current;
   ObjectMonitorDeflationLogging* const _log;
@@ -284,7 +277,43 @@ void ObjectSynchronizer::initialize() {
   }
 }
 
-MonitorList ObjectSynchronizer::_in_use_list;
+PaddedEnd<MonitorList> ObjectSynchronizer::_in_use_lists[ObjectSynchronizer::max_in_use_lists];
+uint ObjectSynchronizer::_next_deflation_list = 0;
+volatile size_t ObjectSynchronizer::_in_use_max = 0;
+
+void ObjectSynchronizer::add_to_in_use_list(Thread* current, ObjectMonitor* monitor) {
+  // Spread the threads over the partitions by their address.
+  const uint i = (uint)((p2i(current) / DEFAULT_CACHE_LINE_SIZE) % num_in_use_lists());
+  in_use_list(i)->add(monitor);
+}
+
+size_t ObjectSynchronizer::in_use_count() {
+  size_t count = 0;
+  for (uint i = 0; i < num_in_use_lists(); i++) {
+    count += in_use_list(i)->count();
+  }
+  return count;
+}
+
+// The high-water mark is raised from the current total whenever it is read,
+// instead of on every inflation, which would sum the partitions and write a
+// shared word each time. The readers are the deflation thread's periodic
+// threshold check and the deflation logging, so a peak shorter than their
+// interval can be missed. Summing the maxima of the partitions instead
+// would overestimate it.
+size_t ObjectSynchronizer::in_use_max() {
+  const size_t count = in_use_count();
+  size_t max = Atomic::load(&_in_use_max);
+  while (count > max) {
+    size_t prev = Atomic::cmpxchg(&_in_use_max, max, count);
+    if (prev == max) {
+      return count;
+    }
+    max = prev;
+  }
+  return max;
+}
+
 // monitors_used_above_threshold() policy is as follows:
 //
 // The ratio of the current _in_use_list count to the ceiling is used
@@ -1212,10 +1241,12 @@ JavaThread* ObjectSynchronizer::get_lock_owner(ThreadsList * t_list, Handle h_ob
 // Iterate over all ObjectMonitors.
 template <typename Function>
 void ObjectSynchronizer::monitors_iterate(Function function) {
-  MonitorList::Iterator iter = _in_use_list.iterator();
-  while (iter.has_next()) {
-    ObjectMonitor* monitor = iter.next();
-    function(monitor);
+  for (uint i = 0; i < num_in_use_lists(); i++) {
+    MonitorList::Iterator iter = in_use_list(i)->iterator();
+    while (iter.has_next()) {
+      ObjectMonitor* monitor = iter.next();
+      function(monitor);
+    }
   }
 }
 
@@ -1251,18 +1282,19 @@ void ObjectSynchronizer::owned_monitors_iterate(MonitorClosure* closure) {
   return owned_monitors_iterate_filtered(closure, all_filter);
 }
 
-static bool monitors_used_above_threshold(MonitorList* list) {
+static bool monitors_used_above_threshold() {
   if (MonitorUsedDeflationThreshold == 0) {  // disabled case is easy
     return false;
   }
   // Start with ceiling based on a per-thread estimate:
   size_t ceiling = ObjectSynchronizer::in_use_list_ceiling();
   size_t old_ceiling = ceiling;
-  if (ceiling < list->max()) {
+  const size_t max = ObjectSynchronizer::in_use_max();
+  if (ceiling < max) {
     // The max used by the system has exceeded the ceiling so use that:
-    ceiling = list->max();
+    ceiling = max;
   }
-  size_t monitors_used = list->count();
+  size_t monitors_used = ObjectSynchronizer::in_use_count();
   if (monitors_used == 0) {  // empty list is easy
     return false;
   }
@@ -1317,7 +1349,7 @@ bool ObjectSynchronizer::is_async_deflation_needed() {
 
   if (AsyncDeflationInterval > 0 &&
       time_since_last > AsyncDeflationInterval &&
-      monitors_used_above_threshold(&_in_use_list)) {
+      monitors_used_above_threshold()) {
     // It's been longer than our specified deflate interval and there
     // are too many monitors in use. We don't deflate more frequently
     // than AsyncDeflationInterval (unless is_async_deflation_requested)
@@ -1558,7 +1590,7 @@ ObjectMonitor* ObjectSynchronizer::inflate_impl(JavaThread* inflating_thread, oo
 
       // Once ObjectMonitor is configured and the object is associated
       // with the ObjectMonitor, it is safe to allow async deflation:
-      _in_use_list.add(m);
+      add_to_in_use_list(Thread::current(), m);
 
       // Hopefully the performance counters are allocated on distinct cache lines
       // to avoid false sharing on MP systems ...
@@ -1600,7 +1632,7 @@ ObjectMonitor* ObjectSynchronizer::inflate_impl(JavaThread* inflating_thread, oo
 
     // Once the ObjectMonitor is configured and object is associated
     // with the ObjectMonitor, it is safe to allow async deflation:
-    _in_use_list.add(m);
+    add_to_in_use_list(Thread::current(), m);
 
     // Hopefully the performance counters are allocated on distinct
     // cache lines to avoid false sharing on MP systems ...
@@ -1618,16 +1650,17 @@ ObjectMonitor* ObjectSynchronizer::inflate_impl(JavaThread* inflating_thread, oo
   }
 }
 
-// Walk the in-use list and deflate (at most MonitorDeflationMax) idle
+// Walk an in-use list and deflate (at most max_count) idle
 // ObjectMonitors. Returns the number of deflated ObjectMonitors.
 //
-size_t ObjectSynchronizer::deflate_monitor_list(ObjectMonitorDeflationSafepointer* safepointer) {
-  MonitorList::Iterator iter = _in_use_list.iterator();
+size_t ObjectSynchronizer::deflate_monitor_list(MonitorList* list, size_t max_count,
+                                                ObjectMonitorDeflationSafepointer* safepointer) {
+  MonitorList::Iterator iter = list->iterator();
   size_t deflated_count = 0;
   Thread* current = Thread::current();
 
   while (iter.has_next()) {
-    if (deflated_count >= (size_t)MonitorDeflationMax) {
+    if (deflated_count >= max_count) {
       break;
     }
     ObjectMonitor* mid = iter.next();
@@ -1687,8 +1720,8 @@ class ObjectMonitorDeflationLogging: public StackObj {
   elapsedTimer                             _timer;
 
   size_t ceiling() const { return ObjectSynchronizer::in_use_list_ceiling(); }
-  size_t count() const   { return ObjectSynchronizer::_in_use_list.count(); }
-  size_t max() const     { return ObjectSynchronizer::_in_use_list.max(); }
+  size_t count() const   { return ObjectSynchronizer::in_use_count(); }
+  size_t max() const     { return ObjectSynchronizer::in_use_max(); }
 
 public:
   ObjectMonitorDeflationLogging()
@@ -1789,16 +1822,31 @@ size_t ObjectSynchronizer::deflate_idle_monitors() {
 
   log.begin();
 
-  // Deflate some idle ObjectMonitors.
-  size_t deflated_count = deflate_monitor_list(&safepointer);
+  ResourceMark rm(current);
+  GrowableArray<ObjectMonitor*> delete_list;
 
-  // Unlink the deflated ObjectMonitors from the in-use list.
+  // Deflate some idle ObjectMonitors, and unlink them from their in-use list.
+  // The partitions are processed one at a time, so that the walks are short,
+  // and across cycles in a round robin order, so that all partitions make
+  // progress when a cycle stops at MonitorDeflationMax.
+  size_t deflated_count = 0;
   size_t unlinked_count = 0;
   size_t deleted_count = 0;
+  const uint num_lists = num_in_use_lists();
+  uint i = _next_deflation_list % num_lists;
+  for (uint n = 0; n < num_lists && deflated_count < (size_t)MonitorDeflationMax; n++) {
+    MonitorList* const list = in_use_list(i);
+    const size_t list_deflated_count =
+      deflate_monitor_list(list, (size_t)MonitorDeflationMax - deflated_count, &safepointer);
+    if (list_deflated_count > 0) {
+      unlinked_count += list->unlink_deflated(list_deflated_count, &delete_list, &safepointer);
+      deflated_count += list_deflated_count;
+    }
+    i = (i + 1) % num_lists;
+  }
+  _next_deflation_list = i;
+
   if (deflated_count > 0) {
-    ResourceMark rm(current);
-    GrowableArray<ObjectMonitor*> delete_list((int)deflated_count);
-    unlinked_count = _in_use_list.unlink_deflated(deflated_count, &delete_list, &safepointer);
 
 #ifdef ASSERT
     if (UseObjectMonitorTable) {
@@ -1832,7 +1880,7 @@ size_t ObjectSynchronizer::deflate_idle_monitors() {
 
   log.end(deflated_count, unlinked_count);
 
-  OM_PERFDATA_OP(MonExtant, set_value(_in_use_list.count()));
+  OM_PERFDATA_OP(MonExtant, set_value(in_use_count()));
   OM_PERFDATA_OP(Deflations, inc(deflated_count));
 
   GVars.stw_random = os::random();
@@ -1977,18 +2025,16 @@ void ObjectSynchronizer::audit_and_print_stats(outputStream* ls, bool on_exit) {
 
 // Check the in_use_list; log the results of the checks.
 void ObjectSynchronizer::chk_in_use_list(outputStream* out, int *error_cnt_p) {
-  size_t l_in_use_count = _in_use_list.count();
-  size_t l_in_use_max = _in_use_list.max();
+  size_t l_in_use_count = in_use_count();
+  size_t l_in_use_max = in_use_max();
   out->print_cr("count=" SIZE_FORMAT ", max=" SIZE_FORMAT, l_in_use_count,
                 l_in_use_max);
 
   size_t ck_in_use_count = 0;
-  MonitorList::Iterator iter = _in_use_list.iterator();
-  while (iter.has_next()) {
-    ObjectMonitor* mid = iter.next();
+  monitors_iterate([&](ObjectMonitor* mid) {
     chk_in_use_entry(mid, out, error_cnt_p);
     ck_in_use_count++;
-  }
+  });
 
   if (l_in_use_count == ck_in_use_count) {
     out->print_cr("in_use_count=" SIZE_FORMAT " equals ck_in_use_count="
@@ -1999,7 +2045,7 @@ void ObjectSynchronizer::chk_in_use_list(outputStream* out, int *error_cnt_p) {
                   ck_in_use_count);
   }
 
-  size_t ck_in_use_max = _in_use_list.max();
+  size_t ck_in_use_max = in_use_max();
   if (l_in_use_max == ck_in_use_max) {
     out->print_cr("in_use_max=" SIZE_FORMAT " equals ck_in_use_max="
                   SIZE_FORMAT, l_in_use_max, ck_in_use_max);
@@ -2053,7 +2099,7 @@ void ObjectSynchronizer::chk_in_use_entry(ObjectMonitor* n, outputStream* out,
 // flags indicate why the entry is in-use, 'object' and 'object type'
 // indicate the associated object and its type.
 void ObjectSynchronizer::log_in_use_monitor_details(outputStream* out, bool log_all) {
-  if (_in_use_list.count() > 0) {
+  if (in_use_count() > 0) {
     stringStream ss;
     out->print_cr("In-use monitor info%s:", log_all ? "" : " (eliding idle monitors)");
     out->print_cr("(B -> is_busy, H -> has hash code, L -> lock status)");
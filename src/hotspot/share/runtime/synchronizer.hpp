@@ -44,7 +44,6 @@ class MonitorList {
 private:
   ObjectMonitor* volatile _head;
   volatile size_t _count;
-  volatile size_t _max;
 
 public:
   void add(ObjectMonitor* monitor);
@@ -52,7 +51,6 @@ class MonitorList {
                          GrowableArray<ObjectMonitor*>* unlinked_list,
                          ObjectMonitorDeflationSafepointer* safepointer);
   size_t count() const;
-  size_t max() const;
 
   class Iterator;
   Iterator iterator() const;
@@ -184,8 +182,13 @@ class ObjectSynchronizer : AllStatic {
   static size_t deflate_idle_monitors();
 
   // Deflate idle monitors:
-  static size_t deflate_monitor_list(ObjectMonitorDeflationSafepointer* safepointer);
+  static size_t deflate_monitor_list(MonitorList* list, size_t max_count,
+                                     ObjectMonitorDeflationSafepointer* safepointer);
   static size_t in_use_list_ceiling();
+  // The count is summed over all in-use list partitions. The max is the
+  // high-water mark of that sum, as sampled by the callers of in_use_max().
+  static size_t in_use_count();
+  static size_t in_use_max();
   static void dec_in_use_list_ceiling();
   static void inc_in_use_list_ceiling();
   static void set_in_use_list_ceiling(size_t new_value);
@@ -211,7 +214,16 @@ class ObjectSynchronizer : AllStatic {
   friend class SynchronizerTest;
   friend class LightweightSynchronizer;
 
-  static MonitorList _in_use_list;
+  // The in-use monitors are partitioned into MonitorInUseListPartitions
+  // lists, picked by the inflating thread.
+  static const uint max_in_use_lists = 64;
+  static PaddedEnd<MonitorList> _in_use_lists[max_in_use_lists];
+  static uint _next_deflation_list;
+  static volatile size_t _in_use_max;
+
+  static uint num_in_use_lists() { return MonitorInUseListPartitions; }
+  static MonitorList* in_use_list(uint i) { return &_in_use_lists[i]; }
+  static void add_to_in_use_list(Thread* current, ObjectMonitor* monitor);
   static volatile bool _is_async_deflation_requested;
   static volatile bool _is_final_audit;
   static jlong         _last_async_deflation_time_ns;
@@ -45,6 +45,7 @@
 #include "runtime/osThread.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/safepointMechanism.inline.hpp"
+#include "runtime/sizeClassMalloc.hpp"
 #include "runtime/thread.inline.hpp"
 #include "runtime/threadSMR.inline.hpp"
 #include "utilities/macros.hpp"
@@ -241,6 +242,10 @@ void Thread::call_run() {
   // be used to check.
 
   assert(Thread::current_or_null() == nullptr, "current thread still present");
+
+  // Return the arena chunks and C-heap blocks cached by this thread.
+  Arena::flush_thread_chunk_cache();
+  SizeClassMalloc::thread_exit();
 }
 
 Thread::~Thread() {
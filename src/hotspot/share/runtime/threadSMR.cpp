@@ -138,6 +138,10 @@ uint                  ThreadsSMRSupport::_to_delete_list_cnt = 0;
 // Impl note: See _to_delete_list_cnt note.
 uint                  ThreadsSMRSupport::_to_delete_list_max = 0;
 
+// # of ThreadsLists added to the to-delete list since the hazard ptrs
+// were last scanned, see ThreadsSMRFreeListBatch.
+uint                  ThreadsSMRSupport::_to_delete_list_unscanned = 0;
+
 // 'inline' functions first so the definitions are before first use:
 
 inline void ThreadsSMRSupport::add_deleted_thread_times(uint add_value) {
@@ -908,6 +912,16 @@ void ThreadsSMRSupport::free_list(ThreadsList* threads) {
     }
   }
 
+  // Scanning the hazard ptrs of all threads makes every thread start and
+  // exit O(threads). With ThreadsSMRFreeListBatch, the retired ThreadsLists
+  // are only reclaimed in batches, which amortizes the scan over the batch
+  // at the cost of keeping up to that many old ThreadsLists around.
+  if (++_to_delete_list_unscanned < ThreadsSMRFreeListBatch) {
+    log_debug(thread, smr)("tid=" UINTX_FORMAT ": ThreadsSMRSupport::free_list: threads=" INTPTR_FORMAT " is not freed (batched).", os::current_thread_id(), p2i(threads));
+    return;
+  }
+  _to_delete_list_unscanned = 0;
+
   // Gather a hash table of the current hazard ptrs:
   ThreadScanHashtable *scan_table = new ThreadScanHashtable();
   ScanHazardPtrGatherThreadsListClosure scan_cl(scan_table);
@@ -47,9 +47,11 @@
   template(ZombieAll)                             \
   template(Verify)                                \
   template(HeapDumper)                            \
+  template(VirtualThreadDump)                     \
   template(CollectForMetadataAllocation)          \
   template(CollectForCodeCacheAllocation)         \
   template(GC_HeapInspection)                     \
+  template(GC_IncrementalHeapInspection)          \
   template(SerialCollectForAllocation)            \
   template(SerialGCCollect)                       \
   template(ParallelCollectForAllocation)          \
@@ -33,11 +33,13 @@
 #include "classfile/vmClasses.hpp"
 #include "code/codeCache.hpp"
 #include "compiler/compilationMemoryStatistic.hpp"
+#include "compiler/compilationPolicy.hpp"
 #include "compiler/compiler_globals.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/directivesParser.hpp"
 #include "gc/shared/gcVMOperations.hpp"
 #include "jvm.h"
+#include "memory/heapInspection.hpp"
 #include "memory/metaspace/metaspaceDCmd.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
@@ -49,6 +51,7 @@
 #include "oops/oop.inline.hpp"
 #include "oops/typeArrayOop.inline.hpp"
 #include "prims/jvmtiAgentList.hpp"
+#include "runtime/continuationStatistics.hpp"
 #include "runtime/fieldDescriptor.inline.hpp"
 #include "runtime/flags/jvmFlag.hpp"
 #include "runtime/handles.inline.hpp"
@@ -63,6 +66,7 @@
 #include "services/diagnosticFramework.hpp"
 #include "services/heapDumper.hpp"
 #include "services/management.hpp"
+#include "services/virtualThreadDumper.hpp"
 #include "services/writeableFlags.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/events.hpp"
@@ -130,6 +134,8 @@ void DCmd::register_dcmds(){
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ThreadDumpDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ThreadDumpToFileDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<VThreadSummaryDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<VThreadStatsDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<VThreadDumpDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ClassLoaderStatsDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ClassLoaderHierarchyDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CompileQueueDCmd>(full_export, true, false));
@@ -150,6 +156,7 @@ void DCmd::register_dcmds(){
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CompilerDirectivesAddDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CompilerDirectivesRemoveDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CompilerDirectivesClearDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CompilerDumpHotMethodsDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CompilationMemoryStatisticDCmd>(full_export, true, false));
 
   // Enhanced JMX Agent Support
@@ -536,9 +543,17 @@ ClassHistogramDCmd::ClassHistogramDCmd(outputStream* output, bool heap) :
        "1 means use one thread (disable parallelism). "
        "For any other value the VM will try to use the specified number of "
        "threads, but might use fewer.",
+       "INT", false, "0"),
+  _incremental("-incremental",
+       "Inspect the heap in several safepoint pauses of about the given number "
+       "of milliseconds each, instead of a single long pause. Objects moved by "
+       "GCs between the pauses may be missed or counted twice. Implies -all. "
+       "0 (the default) disables incremental inspection, which is only "
+       "available with some GCs.",
        "INT", false, "0") {
   _dcmdparser.add_dcmd_option(&_all);
   _dcmdparser.add_dcmd_option(&_parallel_thread_num);
+  _dcmdparser.add_dcmd_option(&_incremental);
 }
 
 void ClassHistogramDCmd::execute(DCmdSource source, TRAPS) {
@@ -550,6 +565,22 @@ void ClassHistogramDCmd::execute(DCmdSource source, TRAPS) {
   uint parallel_thread_num = num == 0
       ? MAX2<uint>(1, (uint)os::initial_active_processor_count() * 3 / 8)
       : num;
+  jlong max_pause_millis = _incremental.value();
+  if (max_pause_millis < 0) {
+    output()->print_cr("Incremental pause out of range (>=0): " JLONG_FORMAT, max_pause_millis);
+    return;
+  }
+  if (max_pause_millis > 0) {
+    if (IncrementalHeapInspection::is_supported()) {
+      IncrementalHeapInspection inspection;
+      do {
+        VM_GC_IncrementalHeapInspection heapop(&inspection, output(), parallel_thread_num, max_pause_millis);
+        VMThread::execute(&heapop);
+      } while (!inspection.is_done());
+      return;
+    }
+    output()->print_cr("Incremental inspection is not supported by the current GC, inspecting the heap in a single pause");
+  }
   VM_GC_HeapInspection heapop(output(),
                               !_all.value(), /* request full gc if false */
                               parallel_thread_num);
@@ -936,6 +967,22 @@ void CompilerDirectivesRemoveDCmd::execute(DCmdSource source, TRAPS) {
 void CompilerDirectivesClearDCmd::execute(DCmdSource source, TRAPS) {
   DirectivesStack::clear();
 }
+
+CompilerDumpHotMethodsDCmd::CompilerDumpHotMethodsDCmd(outputStream* output, bool heap) :
+                           DCmdWithParser(output, heap),
+  _filename("filename", "Name of the file to write", "STRING", true) {
+  _dcmdparser.add_dcmd_argument(&_filename);
+}
+
+void CompilerDumpHotMethodsDCmd::execute(DCmdSource source, TRAPS) {
+  fileStream file(_filename.value());
+  if (!file.is_open()) {
+    output()->print_cr("Could not open %s", _filename.value());
+    return;
+  }
+  int count = CompilationPolicy::print_hot_methods(&file, DumpHotMethodsThresholdScaling);
+  output()->print_cr("Wrote %d methods to %s", count, _filename.value());
+}
 #if INCLUDE_SERVICES
 ClassHierarchyDCmd::ClassHierarchyDCmd(outputStream* output, bool heap) :
                                        DCmdWithParser(output, heap),
@@ -1200,6 +1247,59 @@ void VThreadSummaryDCmd::execute(DCmdSource source, TRAPS) {
   output()->print_raw((const char*)addr, ba->length());
 }
 
+void VThreadStatsDCmd::execute(DCmdSource source, TRAPS) {
+  ContinuationStatistics::print_on(output());
+}
+
+VThreadDumpDCmd::VThreadDumpDCmd(outputStream* output, bool heap) :
+                                 DCmdWithParser(output, heap),
+  _grouped("-grouped", "Group threads with identical state and stack trace, with counts", "BOOLEAN", false, "false"),
+  _state("-state", "Comma separated list of thread states to dump "
+         "(runnable, parked, blocked, waiting or all)", "STRING", false, "all"),
+  _max_depth("-maxdepth", "Maximum number of frames per stack trace (0 means no limit)", "INT", false, "0"),
+  _overwrite("-overwrite", "May overwrite existing file", "BOOLEAN", false, "false"),
+  _filepath("filepath", "The file path to the output file. If omitted, the dump is printed to the output",
+            "FILE", false) {
+  _dcmdparser.add_dcmd_option(&_grouped);
+  _dcmdparser.add_dcmd_option(&_state);
+  _dcmdparser.add_dcmd_option(&_max_depth);
+  _dcmdparser.add_dcmd_option(&_overwrite);
+  _dcmdparser.add_dcmd_argument(&_filepath);
+}
+
+void VThreadDumpDCmd::execute(DCmdSource source, TRAPS) {
+  uint state_filter = 0;
+  if (!VirtualThreadDumper::parse_state_filter(_state.value(), &state_filter)) {
+    Exceptions::fthrow(THREAD_AND_LOCATION, vmSymbols::java_lang_IllegalArgumentException(),
+                       "Invalid state filter \"%s\"", _state.value());
+    return;
+  }
+  jlong max_depth = _max_depth.value();
+  if (max_depth < 0 || max_depth > max_jint) {
+    Exceptions::fthrow(THREAD_AND_LOCATION, vmSymbols::java_lang_IllegalArgumentException(),
+                       "Invalid max depth " JLONG_FORMAT, max_depth);
+    return;
+  }
+  VirtualThreadDumper dumper(state_filter, _grouped.value(), (int)max_depth);
+
+  const char* path = _filepath.value();
+  if (path == nullptr) {
+    dumper.dump(output());
+    return;
+  }
+  if (!_overwrite.value() && os::file_exists(path)) {
+    output()->print_cr("File %s already exists", path);
+    return;
+  }
+  fileStream fs(path, "w");
+  if (!fs.is_open()) {
+    output()->print_cr("Could not open file %s: %s", path, os::strerror(errno));
+    return;
+  }
+  dumper.dump(&fs);
+  output()->print_cr("Created %s", path);
+}
+
 CompilationMemoryStatisticDCmd::CompilationMemoryStatisticDCmd(outputStream* output, bool heap) :
     DCmdWithParser(output, heap),
   _human_readable("-H", "Human readable format", "BOOLEAN", false, "false"),
@@ -348,8 +348,9 @@ class ClassHistogramDCmd : public DCmdWithParser {
 protected:
   DCmdArgument<bool> _all;
   DCmdArgument<jlong> _parallel_thread_num;
+  DCmdArgument<jlong> _incremental;
 public:
-  static int num_arguments() { return 2; }
+  static int num_arguments() { return 3; }
   ClassHistogramDCmd(outputStream* output, bool heap);
   static const char* name() {
     return "GC.class_histogram";
@@ -751,6 +752,30 @@ class CompilerDirectivesClearDCmd : public DCmd {
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class CompilerDumpHotMethodsDCmd : public DCmdWithParser {
+protected:
+  DCmdArgument<char*> _filename;
+public:
+  static int num_arguments() { return 1; }
+  CompilerDumpHotMethodsDCmd(outputStream* output, bool heap);
+  static const char* name() {
+    return "Compiler.dump_hot_methods";
+  }
+  static const char* description() {
+    return "Write a CompileThresholdScaling command for every method compiled at the highest tier to a file, "
+           "to be read with -XX:CompileCommandFile by a later run.";
+  }
+  static const char* impact() {
+    return "Medium: Depends on the number of loaded classes.";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", nullptr};
+    return p;
+  }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 ///////////////////////////////////////////////////////////////////////
 //
 // jcmd command support for symbol table, string table and system dictionary dumping:
@@ -970,6 +995,46 @@ class VThreadSummaryDCmd : public DCmd {
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class VThreadDumpDCmd : public DCmdWithParser {
+protected:
+  DCmdArgument<bool>  _grouped;
+  DCmdArgument<char*> _state;
+  DCmdArgument<jlong> _max_depth;
+  DCmdArgument<bool>  _overwrite;
+  DCmdArgument<char*> _filepath;
+public:
+  static int num_arguments() { return 5; }
+  VThreadDumpDCmd(outputStream* output, bool heap);
+  static const char* name() {
+    return "Thread.vthread_dump";
+  }
+  static const char* description() {
+    return "Dump the virtual threads in the heap, with stack traces, in JSON format. "
+           "Threads can be filtered by state and grouped by identical stack traces.";
+  }
+  static const char* impact() {
+    return "High: Depends on Java heap size and the number of virtual threads.";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission", "monitor", nullptr};
+    return p;
+  }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
+class VThreadStatsDCmd : public DCmd {
+public:
+  VThreadStatsDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+  static const char* name() {
+    return "Thread.vthread_stats";
+  }
+  static const char* description() {
+    return "Print statistics of continuation freeze and thaw operations, including pinning and stack size histograms.";
+  }
+  static const char* impact() { return "Low"; }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 class CompilationMemoryStatisticDCmd: public DCmdWithParser {
 protected:
   DCmdArgument<bool> _human_readable;
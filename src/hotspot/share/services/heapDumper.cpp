@@ -2056,6 +2056,9 @@ class DumpMerger : public StackObj {
     _dump_seq(dump_seq) {}
 
   void do_merge();
+  // Leaves the segmented heap files in place and writes the end of the dump
+  // to one more of them, so that concatenating the files gives the dump.
+  void do_finish_without_merge();
 
   // returns path for the parallel DumpWriter (resource allocated)
   static char* get_writer_path(const char* base_path, int seq);
@@ -2187,6 +2190,36 @@ void DumpMerger::do_merge() {
   merge_done();
 }
 
+void DumpMerger::do_finish_without_merge() {
+  if (_has_error) {
+    // Do not leave part of a broken dump behind.
+    for (int i = 0; i < _dump_seq; i++) {
+      ResourceMark rm;
+      remove(get_writer_path(_path, i));
+    }
+    return;
+  }
+
+  _writer->flush();
+
+  ResourceMark rm;
+  DumpWriter end_writer(get_writer_path(_path, _dump_seq), _writer->is_overwrite(), _writer->compressor());
+  if (end_writer.has_error()) {
+    set_error(end_writer.error());
+    return;
+  }
+  DumperSupport::end_of_dump(&end_writer);
+  end_writer.flush();
+  if (end_writer.has_error()) {
+    set_error(end_writer.error());
+    return;
+  }
+
+  log_info(heapdump)("Heap dump segments not merged, concatenate %s and %s.p0 to %s.p%d",
+                     _path, _path, _path, _dump_seq);
+  _dump_seq = 0; //reset
+}
+
 // The VM operation that performs the heap dump
 class VM_HeapDumper : public VM_GC_Operation, public WorkerTask, public UnmountedVThreadDumper {
  private:
@@ -2675,13 +2708,19 @@ int HeapDumper::dump(const char* path, outputStream* out, int compression, bool
   //          This is done by VM_HeapDumper, which is performed within safepoint.
   //
   // Phase 2: Merge multiple heap files into one complete heap dump file.
-  //          This is done by DumpMerger, which is performed outside safepoint
+  //          This is done by DumpMerger, which is performed outside safepoint.
+  //          With -XX:-HeapDumpMergeSegments the files are left for the
+  //          tools to concatenate.
 
   DumpMerger merger(path, &writer, dumper.dump_seq());
   // Perform heapdump file merge operation in the current thread prevents us
   // from occupying the VM Thread, which in turn affects the occurrence of
   // GC and other VM operations.
-  merger.do_merge();
+  if (HeapDumpMergeSegments) {
+    merger.do_merge();
+  } else {
+    merger.do_finish_without_merge();
+  }
   if (writer.error() != nullptr) {
     set_error(writer.error());
   }
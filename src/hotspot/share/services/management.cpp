@@ -46,6 +46,7 @@
 #include "runtime/handles.inline.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/javaCalls.hpp"
+#include "runtime/javaThread.inline.hpp"
 #include "runtime/jniHandles.inline.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/notificationThread.hpp"
@@ -1410,6 +1411,9 @@ JVM_ENTRY(jlong, jmm_GetThreadCpuTime(JNIEnv *env, jlong thread_id))
   JavaThread* java_thread = nullptr;
   if (thread_id == 0) {
     // current thread
+    if (VirtualThreadCPUTime && THREAD->is_vthread_mounted()) {
+      return THREAD->mounted_vthread_cpu_time();
+    }
     return os::current_thread_cpu_time();
   } else {
     ThreadsListHandle tlh;
@@ -2207,6 +2211,10 @@ JVM_ENTRY(jlong, jmm_GetThreadCpuTimeWithKind(JNIEnv *env, jlong thread_id, jboo
   JavaThread* java_thread = nullptr;
   if (thread_id == 0) {
     // current thread
+    if (VirtualThreadCPUTime && THREAD->is_vthread_mounted()) {
+      // Only the total CPU time is accounted per virtual thread
+      return user_sys_cpu_time ? THREAD->mounted_vthread_cpu_time() : -1;
+    }
     return os::current_thread_cpu_time(user_sys_cpu_time != 0);
   } else {
     ThreadsListHandle tlh;
@@ -2261,6 +2269,62 @@ JVM_ENTRY(void, jmm_GetThreadCpuTimesWithKind(JNIEnv *env, jlongArray ids,
   }
 JVM_END
 
+// Gets the state, CPU time, blocked count and waited count of each thread in ids,
+// for monitoring many threads cheaply. Unlike GetThreadInfo, no snapshot
+// is taken: the values are read racily from the running threads and no
+// ThreadInfo objects are allocated. Any of the result arrays can be null.
+// Entries for threads that are not alive or are virtual are set to -1.
+JVM_ENTRY(void, jmm_GetThreadStatistics(JNIEnv *env, jlongArray ids,
+                                        jintArray states,
+                                        jlongArray cpuTimes,
+                                        jlongArray blockedCounts,
+                                        jlongArray waitedCounts))
+  if (ids == nullptr) {
+    THROW(vmSymbols::java_lang_NullPointerException());
+  }
+
+  ResourceMark rm(THREAD);
+  typeArrayOop ta = typeArrayOop(JNIHandles::resolve_non_null(ids));
+  typeArrayHandle ids_ah(THREAD, ta);
+  validate_thread_id_array(ids_ah, CHECK);
+  int num_threads = ids_ah->length();
+
+  typeArrayHandle states_h(THREAD, typeArrayOop(JNIHandles::resolve(states)));
+  typeArrayHandle cpu_times_h(THREAD, typeArrayOop(JNIHandles::resolve(cpuTimes)));
+  typeArrayHandle blocked_h(THREAD, typeArrayOop(JNIHandles::resolve(blockedCounts)));
+  typeArrayHandle waited_h(THREAD, typeArrayOop(JNIHandles::resolve(waitedCounts)));
+  if ((states_h.not_null() && states_h->length() != num_threads) ||
+      (cpu_times_h.not_null() && cpu_times_h->length() != num_threads) ||
+      (blocked_h.not_null() && blocked_h->length() != num_threads) ||
+      (waited_h.not_null() && waited_h->length() != num_threads)) {
+    THROW_MSG(vmSymbols::java_lang_IllegalArgumentException(),
+              "The length of the given arrays does not match the length of "
+              "the given array of thread IDs");
+  }
+
+  ThreadsListHandle tlh;
+  for (int i = 0; i < num_threads; i++) {
+    JavaThread* java_thread = tlh.list()->find_JavaThread_from_java_tid(ids_ah->long_at(i));
+    jint state = -1;
+    jlong cpu_time = -1;
+    jlong blocked = -1;
+    jlong waited = -1;
+    if (is_platform_thread(java_thread)) {
+      state = (jint)java_lang_Thread::get_thread_status(java_thread->threadObj());
+      if (cpu_times_h.not_null()) {
+        cpu_time = os::thread_cpu_time((Thread*)java_thread, true /* user+sys */);
+      }
+      ThreadStatistics* stat = java_thread->get_thread_stat();
+      blocked = stat->contended_enter_count();
+      waited = stat->monitor_wait_count() + stat->sleep_count();
+    }
+    if (states_h.not_null())    states_h->int_at_put(i, state);
+    if (cpu_times_h.not_null()) cpu_times_h->long_at_put(i, cpu_time);
+    if (blocked_h.not_null())   blocked_h->long_at_put(i, blocked);
+    if (waited_h.not_null())    waited_h->long_at_put(i, waited);
+  }
+JVM_END
+
 const struct jmmInterface_1_ jmm_interface = {
   nullptr,
   nullptr,
@@ -2295,7 +2359,7 @@ const struct jmmInterface_1_ jmm_interface = {
   jmm_DumpHeap0,
   jmm_FindDeadlockedThreads,
   jmm_SetVMGlobal,
-  nullptr,
+  jmm_GetThreadStatistics,
   jmm_DumpThreads,
   jmm_SetGCNotificationEnabled,
   jmm_GetDiagnosticCommands,
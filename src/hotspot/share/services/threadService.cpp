@@ -41,6 +41,7 @@
 #include "oops/oopHandle.inline.hpp"
 #include "prims/jvmtiRawMonitor.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/continuationStatistics.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/init.hpp"
 #include "runtime/javaThread.inline.hpp"
@@ -163,6 +164,7 @@ void ThreadService::remove_thread(JavaThread* thread, bool daemon) {
 
   // Include hidden thread allcations in exited_allocated_bytes
   ThreadService::incr_exited_allocated_bytes(thread->cooked_allocated_bytes());
+  ContinuationStatistics::thread_exiting(thread);
 
   // Do not count hidden threads
   if (is_hidden_thread(thread)) {
@@ -0,0 +1,487 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "classfile/javaClasses.inline.hpp"
+#include "gc/shared/collectedHeap.hpp"
+#include "memory/allocation.inline.hpp"
+#include "memory/resourceArea.hpp"
+#include "memory/universe.hpp"
+#include "oops/instanceKlass.hpp"
+#include "oops/method.hpp"
+#include "oops/oop.inline.hpp"
+#include "oops/oopHandle.inline.hpp"
+#include "runtime/handles.inline.hpp"
+#include "runtime/javaThread.inline.hpp"
+#include "runtime/os.hpp"
+#include "runtime/vframe.inline.hpp"
+#include "runtime/vmOperations.hpp"
+#include "runtime/vmThread.hpp"
+#include "services/virtualThreadDumper.hpp"
+#include "utilities/growableArray.hpp"
+#include "utilities/ostream.hpp"
+#include "utilities/resizeableResourceHash.hpp"
+
+static uint state_category(int state) {
+  switch (state) {
+    case java_lang_VirtualThread::STARTED:
+    case java_lang_VirtualThread::RUNNING:
+    case java_lang_VirtualThread::YIELDING:
+    case java_lang_VirtualThread::YIELDED:
+    case java_lang_VirtualThread::UNPARKED:
+    case java_lang_VirtualThread::UNBLOCKED:
+      return VirtualThreadDumper::runnable;
+    case java_lang_VirtualThread::PARKING:
+    case java_lang_VirtualThread::PARKED:
+    case java_lang_VirtualThread::PINNED:
+    case java_lang_VirtualThread::TIMED_PARKING:
+    case java_lang_VirtualThread::TIMED_PARKED:
+    case java_lang_VirtualThread::TIMED_PINNED:
+      return VirtualThreadDumper::parked;
+    case java_lang_VirtualThread::BLOCKING:
+    case java_lang_VirtualThread::BLOCKED:
+      return VirtualThreadDumper::blocked;
+    case java_lang_VirtualThread::WAITING:
+    case java_lang_VirtualThread::WAIT:
+    case java_lang_VirtualThread::TIMED_WAITING:
+    case java_lang_VirtualThread::TIMED_WAIT:
+      return VirtualThreadDumper::waiting;
+    default:
+      // NEW and TERMINATED threads have no stack and are never dumped
+      return 0;
+  }
+}
+
+static const char* state_name(int state) {
+  switch (state) {
+    case java_lang_VirtualThread::STARTED:       return "STARTED";
+    case java_lang_VirtualThread::RUNNING:       return "RUNNING";
+    case java_lang_VirtualThread::PARKING:       return "PARKING";
+    case java_lang_VirtualThread::PARKED:        return "PARKED";
+    case java_lang_VirtualThread::PINNED:        return "PINNED";
+    case java_lang_VirtualThread::TIMED_PARKING: return "TIMED_PARKING";
+    case java_lang_VirtualThread::TIMED_PARKED:  return "TIMED_PARKED";
+    case java_lang_VirtualThread::TIMED_PINNED:  return "TIMED_PINNED";
+    case java_lang_VirtualThread::UNPARKED:      return "UNPARKED";
+    case java_lang_VirtualThread::YIELDING:      return "YIELDING";
+    case java_lang_VirtualThread::YIELDED:       return "YIELDED";
+    case java_lang_VirtualThread::BLOCKING:      return "BLOCKING";
+    case java_lang_VirtualThread::BLOCKED:       return "BLOCKED";
+    case java_lang_VirtualThread::UNBLOCKED:     return "UNBLOCKED";
+    case java_lang_VirtualThread::WAITING:       return "WAITING";
+    case java_lang_VirtualThread::WAIT:          return "WAIT";
+    case java_lang_VirtualThread::TIMED_WAITING: return "TIMED_WAITING";
+    case java_lang_VirtualThread::TIMED_WAIT:    return "TIMED_WAIT";
+    default:                                     return "UNKNOWN";
+  }
+}
+
+bool VirtualThreadDumper::parse_state_filter(const char* str, uint* filter) {
+  static const struct {
+    const char* name;
+    uint        value;
+  } categories[] = {
+    { "runnable", runnable },
+    { "parked",   parked },
+    { "blocked",  blocked },
+    { "waiting",  waiting },
+    { "all",      all }
+  };
+
+  uint result = 0;
+  const char* p = str;
+  while (*p != '\0') {
+    const char* end = strchr(p, ',');
+    size_t len = (end != nullptr) ? pointer_delta(end, p, 1) : strlen(p);
+    bool found = false;
+    for (size_t i = 0; i < ARRAY_SIZE(categories); i++) {
+      if (strlen(categories[i].name) == len && strncmp(categories[i].name, p, len) == 0) {
+        result |= categories[i].value;
+        found = true;
+        break;
+      }
+    }
+    if (!found) {
+      return false;
+    }
+    p += (end != nullptr) ? len + 1 : len;
+  }
+  if (result == 0) {
+    return false;
+  }
+  *filter = result;
+  return true;
+}
+
+static void print_json_string(outputStream* out, const char* str) {
+  out->put('"');
+  for (const char* p = str; *p != '\0'; p++) {
+    unsigned char c = (unsigned char)*p;
+    if (c == '"' || c == '\\') {
+      out->put('\\');
+      out->put((char)c);
+    } else if (c < 0x20) {
+      out->print("\\u%04x", c);
+    } else {
+      out->put((char)c);
+    }
+  }
+  out->put('"');
+}
+
+
+static int vthread_state(oop vthread) {
+  return java_lang_VirtualThread::state(vthread) & ~java_lang_VirtualThread::SUSPENDED;
+}
+
+class VThreadFrame {
+ public:
+  Method* _method;
+  int     _bci;
+
+  VThreadFrame() : _method(nullptr), _bci(0) {}
+  VThreadFrame(Method* method, int bci) : _method(method), _bci(bci) {}
+
+  void print_json_on(outputStream* out) const {
+    ResourceMark rm;
+    stringStream ss;
+    InstanceKlass* holder = _method->method_holder();
+    ss.print("%s.%s(", holder->external_name(), _method->name()->as_C_string());
+    if (_method->is_native()) {
+      ss.print("Native Method)");
+    } else {
+      Symbol* source = holder->source_file_name();
+      int line = _method->line_number_from_bci(_bci);
+      if (source == nullptr) {
+        ss.print("Unknown Source)");
+      } else if (line < 0) {
+        ss.print("%s)", source->as_C_string());
+      } else {
+        ss.print("%s:%d)", source->as_C_string(), line);
+      }
+    }
+    print_json_string(out, ss.base());
+  }
+};
+
+// The key of the table of groups: a thread state and a stack trace. The stack
+// trace is kept as its JSON text, because a group outlives the VM operation
+// that found it, and the classes of its methods may be unloaded after that.
+class VThreadStackKey {
+ public:
+  int         _state;
+  unsigned    _hash;
+  const char* _stack;
+
+  VThreadStackKey() : _state(0), _hash(0), _stack(nullptr) {}
+  VThreadStackKey(int state, const char* stack) : _state(state), _hash((unsigned)state), _stack(stack) {
+    for (const char* p = stack; *p != '\0'; p++) {
+      _hash = 31 * _hash + (unsigned char)*p;
+    }
+  }
+
+  static unsigned hash(const VThreadStackKey& k) {
+    return k._hash;
+  }
+
+  static bool equals(const VThreadStackKey& a, const VThreadStackKey& b) {
+    return a._hash == b._hash && a._state == b._state && strcmp(a._stack, b._stack) == 0;
+  }
+};
+
+class VThreadGroup {
+ public:
+  VThreadStackKey _key;
+  jlong           _count;
+
+  VThreadGroup() : _key(), _count(0) {}
+  VThreadGroup(const VThreadStackKey& key, jlong count) : _key(key), _count(count) {}
+
+  static int compare(VThreadGroup* a, VThreadGroup* b) {
+    // Most common stacks first
+    if (a->_count != b->_count) {
+      return (a->_count > b->_count) ? -1 : 1;
+    }
+    return strcmp(a->_key._stack, b->_key._stack);
+  }
+};
+
+using VThreadStackTable = ResizeableResourceHashtable<VThreadStackKey, jlong, AnyObj::C_HEAP, mtServiceability,
+                                                      VThreadStackKey::hash, VThreadStackKey::equals>;
+
+using VThreadHandles = GrowableArrayCHeap<OopHandle, mtServiceability>;
+
+// Collects handles to the virtual threads in the heap that pass the state filter.
+class VirtualThreadCollector : public ObjectClosure {
+ private:
+  uint            _state_filter;
+  VThreadHandles* _threads;
+
+ public:
+  VirtualThreadCollector(uint state_filter, VThreadHandles* threads) :
+    _state_filter(state_filter), _threads(threads) {}
+
+  void do_object(oop obj) {
+    if (!java_lang_VirtualThread::is_instance(obj)) {
+      return;
+    }
+    if ((state_category(vthread_state(obj)) & _state_filter) == 0) {
+      return;
+    }
+    _threads->append(OopHandle(Universe::vm_global(), obj));
+  }
+};
+
+// Prints virtual threads, one batch at a time. When grouping, only the table
+// of groups is kept from one batch to the next.
+class VirtualThreadPrinter : public StackObj {
+ private:
+  uint          _state_filter;
+  int           _max_depth;
+  jlong         _count;
+  outputStream* _out;    // output of the current batch
+  Handle        _scope;  // vthread scope of the current batch
+  GrowableArrayCHeap<VThreadFrame, mtServiceability> _frames;
+  VThreadStackTable* _groups;  // null unless grouping
+
+  // Collects the frames of the virtual thread into _frames and returns its
+  // carrier thread, or null if it is unmounted.
+  oop collect_frames(oop vthread) {
+    _frames.clear();
+    oop carrier = java_lang_VirtualThread::carrier_thread(vthread);
+    if (carrier != nullptr) {
+      JavaThread* jt = java_lang_Thread::thread(carrier);
+      // A thread in the middle of mounting or unmounting has no walkable
+      // stack; it is reported without frames.
+      if (jt != nullptr && jt->vthread() == vthread && jt->is_vthread_mounted()) {
+        vframeStream vfs(jt, _scope);
+        fill_frames(vfs);
+      }
+      return carrier;
+    }
+    oop cont = java_lang_VirtualThread::continuation(vthread);
+    if (cont != nullptr) {
+      vframeStream vfs(cont);
+      fill_frames(vfs);
+    }
+    return nullptr;
+  }
+
+  void fill_frames(vframeStream& vfs) {
+    for (; !vfs.at_end(); vfs.next()) {
+      if (_max_depth > 0 && _frames.length() >= _max_depth) {
+        break;
+      }
+      _frames.append(VThreadFrame(vfs.method(), vfs.bci()));
+    }
+  }
+
+  void print_stack_on(outputStream* out, const char* indent) const {
+    out->print_cr("%s\"stack\": [", indent);
+    for (int i = 0; i < _frames.length(); i++) {
+      out->print("%s  ", indent);
+      _frames.at(i).print_json_on(out);
+      out->print_cr("%s", (i + 1 < _frames.length()) ? "," : "");
+    }
+    out->print("%s]", indent);
+  }
+
+  void print_thread(oop vthread, int state, oop carrier) {
+    ResourceMark rm;
+    if (_count > 1) {
+      _out->print_cr(",");
+    }
+    _out->print_cr("      {");
+    _out->print_cr("        \"tid\": \"" INT64_FORMAT "\",", java_lang_Thread::thread_id(vthread));
+    oop name = java_lang_Thread::name(vthread);
+    _out->print("        \"name\": ");
+    print_json_string(_out, name != nullptr ? java_lang_String::as_utf8_string(name) : "");
+    _out->print_cr(",");
+    _out->print_cr("        \"state\": \"%s\",", state_name(state));
+    if (carrier != nullptr) {
+      _out->print_cr("        \"carrier\": \"" INT64_FORMAT "\",", java_lang_Thread::thread_id(carrier));
+    }
+    print_stack_on(_out, "        ");
+    _out->cr();
+    _out->print("      }");
+  }
+
+  void add_to_group(int state) {
+    stringStream stack;
+    print_stack_on(&stack, "        ");
+    VThreadStackKey key(state, stack.base());
+    jlong* count = _groups->get(key);
+    if (count != nullptr) {
+      (*count)++;
+      return;
+    }
+    // First thread with this stack, keep a copy of the text
+    key._stack = os::strdup_check_oom(stack.base(), mtServiceability);
+    _groups->put(key, 1);
+    _groups->maybe_grow();
+  }
+
+ public:
+  VirtualThreadPrinter(uint state_filter, int max_depth, bool grouped) :
+    _state_filter(state_filter), _max_depth(max_depth), _count(0), _out(nullptr), _scope(), _frames(64),
+    _groups(grouped ? new VThreadStackTable(1009, 4 * M) : nullptr) {}
+
+  ~VirtualThreadPrinter() {
+    if (_groups != nullptr) {
+      _groups->iterate_all([&](const VThreadStackKey& key, jlong count) {
+        os::free((void*)key._stack);
+      });
+      delete _groups;
+    }
+  }
+
+  jlong count() const { return _count; }
+
+  void begin_batch(outputStream* out, Handle scope) {
+    _out = out;
+    _scope = scope;
+  }
+
+  void end_batch() {
+    _out = nullptr;
+    _scope = Handle();
+  }
+
+  void do_vthread(oop vthread) {
+    // The thread may have changed state since it was collected
+    int state = vthread_state(vthread);
+    if ((state_category(state) & _state_filter) == 0) {
+      return;
+    }
+    _count++;
+    oop carrier = collect_frames(vthread);
+    if (_groups != nullptr) {
+      add_to_group(state);
+    } else {
+      print_thread(vthread, state, carrier);
+    }
+  }
+
+  void print_groups(outputStream* out) {
+    GrowableArrayCHeap<VThreadGroup, mtServiceability> groups(_groups->number_of_entries());
+    _groups->iterate_all([&](const VThreadStackKey& key, jlong count) {
+      groups.append(VThreadGroup(key, count));
+    });
+    groups.sort(VThreadGroup::compare);
+    for (int i = 0; i < groups.length(); i++) {
+      const VThreadGroup& g = groups.at(i);
+      out->print_cr("      {");
+      out->print_cr("        \"count\": \"" JLONG_FORMAT "\",", g._count);
+      out->print_cr("        \"state\": \"%s\",", state_name(g._key._state));
+      out->print_raw(g._key._stack);
+      out->cr();
+      out->print("      }");
+      out->print_cr("%s", (i + 1 < groups.length()) ? "," : "");
+    }
+  }
+};
+
+// Collects the virtual threads to dump. Only handles are kept, the stacks are
+// walked later, in batches.
+class VM_CollectVirtualThreads : public VM_Operation {
+ private:
+  uint            _state_filter;
+  VThreadHandles* _threads;
+
+ public:
+  VM_CollectVirtualThreads(uint state_filter, VThreadHandles* threads) :
+    _state_filter(state_filter), _threads(threads) {}
+
+  VMOp_Type type() const { return VMOp_VirtualThreadDump; }
+
+  void doit() {
+    VirtualThreadCollector cl(_state_filter, _threads);
+    Universe::heap()->ensure_parsability(false);  // no need to retire TLABs
+    Universe::heap()->object_iterate(&cl);
+  }
+};
+
+// Walks and prints one batch of the collected virtual threads into a buffer.
+class VM_PrintVirtualThreads : public VM_Operation {
+ private:
+  VirtualThreadPrinter* _printer;
+  outputStream*         _out;
+  VThreadHandles*       _threads;
+  int                   _from;
+  int                   _to;
+
+ public:
+  VM_PrintVirtualThreads(VirtualThreadPrinter* printer, outputStream* out, VThreadHandles* threads, int from, int to) :
+    _printer(printer), _out(out), _threads(threads), _from(from), _to(to) {}
+
+  VMOp_Type type() const { return VMOp_VirtualThreadDump; }
+
+  void doit() {
+    HandleMark hm(VMThread::vm_thread());
+    Handle scope(VMThread::vm_thread(), java_lang_VirtualThread::vthread_scope());
+    _printer->begin_batch(_out, scope);
+    for (int i = _from; i < _to; i++) {
+      _printer->do_vthread(_threads->at(i).resolve());
+    }
+    _printer->end_batch();
+  }
+};
+
+void VirtualThreadDumper::dump(outputStream* out) {
+  VThreadHandles threads(1024);
+  VM_CollectVirtualThreads collect(_state_filter, &threads);
+  VMThread::execute(&collect);
+
+  out->print_cr("{");
+  out->print_cr("  \"virtualThreadDump\": {");
+  out->print_cr("    \"processId\": \"%d\",", os::current_process_id());
+  out->print_cr("    \"%s\": [", _grouped ? "stackGroups" : "threads");
+
+  // Outside of a VM operation nothing stops an unmounted virtual thread from
+  // being mounted while its stack is walked, so each batch is walked in a
+  // short VM operation of its own. The batch is printed into a buffer, which
+  // is written to the output once the operation is done.
+  VirtualThreadPrinter printer(_state_filter, _max_depth, _grouped);
+  stringStream buffer;
+  for (int from = 0; from < threads.length(); from += BatchSize) {
+    int to = MIN2(from + BatchSize, threads.length());
+    VM_PrintVirtualThreads op(&printer, &buffer, &threads, from, to);
+    VMThread::execute(&op);
+    out->print_raw(buffer.base(), buffer.size());
+    buffer.reset();
+    for (int i = from; i < to; i++) {
+      threads.at(i).release(Universe::vm_global());
+    }
+  }
+
+  if (_grouped) {
+    printer.print_groups(out);
+  } else if (printer.count() > 0) {
+    out->cr();
+  }
+  out->print_cr("    ],");
+  out->print_cr("    \"threadCount\": \"" JLONG_FORMAT "\"", printer.count());
+  out->print_cr("  }");
+  out->print_cr("}");
+  out->flush();
+}
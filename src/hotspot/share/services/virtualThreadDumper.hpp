@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef SHARE_SERVICES_VIRTUALTHREADDUMPER_HPP
+#define SHARE_SERVICES_VIRTUALTHREADDUMPER_HPP
+
+#include "memory/allocation.hpp"
+
+class outputStream;
+
+// Dumps the virtual threads found in the heap as JSON. The heap is walked in
+// a single safepoint that only collects a handle to each virtual thread. The
+// stacks are then walked in short VM operations of BatchSize threads each,
+// and every batch is written to the stream before the next one is started.
+// Memory use is one handle per virtual thread plus the text of one batch.
+// When grouping is requested only one entry is kept per distinct (state,
+// stack trace) pair, with a count.
+//
+// The heap walk also finds virtual threads that are no longer reachable but
+// have not been collected yet. Their handles keep them alive until they are
+// dumped.
+class VirtualThreadDumper : public StackObj {
+ public:
+  // State categories accepted by the state filter.
+  enum StateFilter {
+    runnable = 1 << 0,  // started, running, yielding or unparked
+    parked   = 1 << 1,  // parked, with or without timeout
+    blocked  = 1 << 2,  // blocked entering a monitor
+    waiting  = 1 << 3,  // in Object.wait, with or without timeout
+    all      = runnable | parked | blocked | waiting
+  };
+
+ private:
+  static const int BatchSize = 1000;
+
+  uint _state_filter;
+  bool _grouped;
+  int  _max_depth;
+
+ public:
+  VirtualThreadDumper(uint state_filter, bool grouped, int max_depth) :
+    _state_filter(state_filter), _grouped(grouped), _max_depth(max_depth) {}
+
+  // Parses a comma separated list of state categories ("runnable", "parked",
+  // "blocked", "waiting" or "all"). Returns false on an unknown category.
+  static bool parse_state_filter(const char* str, uint* filter);
+
+  void dump(outputStream* out);
+};
+
+#endif // SHARE_SERVICES_VIRTUALTHREADDUMPER_HPP
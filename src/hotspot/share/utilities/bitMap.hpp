@@ -152,6 +152,19 @@ class BitMap {
     return _map[word] ^ flip;
   }
 
+  // The number of words the searches test at a time when skipping over words
+  // without interesting bits.
+  static const idx_t find_block_words = 4;
+
+  // The bitwise or of the find_block_words flipped words starting at word, so
+  // zero if none of them has an interesting bit. The loads are independent,
+  // which lets the compiler use wide loads and keeps the search loop short.
+  bm_word_t flipped_block_or(idx_t word, bm_word_t flip) const {
+    STATIC_ASSERT(find_block_words == 4);
+    return flipped_word(word, flip) | flipped_word(word + 1, flip) |
+           flipped_word(word + 2, flip) | flipped_word(word + 3, flip);
+  }
+
   // Set a word to a specified value or to all ones; clear a word.
   void set_word  (idx_t word, bm_word_t val) { _map[word] = val; }
   void set_word  (idx_t word)            { set_word(word, ~(bm_word_t)0); }
@@ -215,7 +215,14 @@ inline BitMap::idx_t BitMap::find_first_bit_impl(idx_t beg, idx_t end) const {
       idx_t word_limit = aligned_right
         ? to_words_align_down(end) // Minuscule savings when aligned.
         : to_words_align_up(end);
-      while (++word_index < word_limit) {
+      ++word_index;
+      // Sparse maps are mostly words without interesting bits; skip over
+      // them a block at a time before looking for the word itself.
+      while ((word_limit - word_index) >= find_block_words &&
+             flipped_block_or(word_index, flip) == 0) {
+        word_index += find_block_words;
+      }
+      for (; word_index < word_limit; ++word_index) {
         cword = flipped_word(word_index, flip);
         if (cword != 0) {
           // Update for found non-zero word, and join common tail to compute
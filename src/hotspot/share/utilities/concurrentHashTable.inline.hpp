@@ -1237,6 +1237,7 @@ inline TableStatistics ConcurrentHashTable<CONFIG, MT>::
 {
   constexpr size_t batch_size = 128;
   NumberSeq summary;
+  TableBucketSizes bucket_sizes;
   size_t literal_bytes = 0;
   InternalTable* table = get_table();
   size_t num_batches = table->_size / batch_size;
@@ -1258,13 +1259,14 @@ inline TableStatistics ConcurrentHashTable<CONFIG, MT>::
         current_node = current_node->next();
       }
       summary.add((double)count);
+      bucket_sizes.add(count);
     }
   }
 
   if (_stats_rate == nullptr) {
-    return TableStatistics(summary, literal_bytes, sizeof(Bucket), sizeof(Node));
+    return TableStatistics(summary, literal_bytes, sizeof(Bucket), sizeof(Node), &bucket_sizes);
   } else {
-    return TableStatistics(*_stats_rate, summary, literal_bytes, sizeof(Bucket), sizeof(Node));
+    return TableStatistics(*_stats_rate, summary, literal_bytes, sizeof(Bucket), sizeof(Node), &bucket_sizes);
   }
 }
 
@@ -38,6 +38,11 @@ class MemRegion;
  * It holds one bit per ObjAlignmentInBytes-aligned address. Its underlying backing memory is
  * allocated on-demand only, in fragments covering 64M heap ranges. Fragments are never deleted
  * during the lifetime of the ObjectBitSet. The underlying memory is allocated from C-Heap.
+ *
+ * After initialize_parallel(), several threads may mark objects within the covered range
+ * concurrently using par_mark_obj(). Fragments are then found through a flat lock-free
+ * table indexed by 64M granule. The serial accessors must not be used while parallel
+ * marking is in progress, but may be used before and after it.
  */
 template<MemTag MT>
 class ObjectBitSet : public CHeapObj<MT> {
@@ -56,12 +61,19 @@ class ObjectBitSet : public CHeapObj<MT> {
                                       hash_segment> BitMapFragmentTable;
 
   CHeapBitMap* get_fragment_bits(uintptr_t addr);
+  CHeapBitMap* par_get_fragment_bits(uintptr_t addr);
+  CHeapBitMap* volatile* par_fragment_slot(uintptr_t granule) const;
+  void par_add_fragment(BitMapFragment* fragment);
 
   BitMapFragmentTable _bitmap_fragments;
   BitMapFragment* _fragment_list;
   CHeapBitMap* _last_fragment_bits;
   uintptr_t _last_fragment_granule;
 
+  CHeapBitMap* volatile* _par_fragments;
+  uintptr_t _par_first_granule;
+  size_t _par_granule_count;
+
  public:
   ObjectBitSet();
   ~ObjectBitSet();
@@ -79,6 +91,16 @@ class ObjectBitSet : public CHeapObj<MT> {
   bool is_marked(oop obj) {
     return is_marked(cast_from_oop<uintptr_t>(obj));
   }
+
+  // Enables parallel marking of objects within covered.
+  void initialize_parallel(MemRegion covered);
+
+  // Returns true if the mark was set by this call, false if the object was already marked.
+  bool par_mark_obj(uintptr_t addr);
+
+  bool par_mark_obj(oop obj) {
+    return par_mark_obj(cast_from_oop<uintptr_t>(obj));
+  }
 };
 
 template<MemTag MT>
@@ -93,6 +115,10 @@ class ObjectBitSet<MT>::BitMapFragment : public CHeapObj<MT> {
     return _next;
   }
 
+  void set_next(BitMapFragment* next) {
+    _next = next;
+  }
+
   CHeapBitMap* bits() {
     return &_bits;
   }
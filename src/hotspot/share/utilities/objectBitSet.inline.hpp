@@ -28,6 +28,7 @@
 #include "utilities/objectBitSet.hpp"
 
 #include "memory/memRegion.hpp"
+#include "runtime/atomic.hpp"
 #include "utilities/bitMap.inline.hpp"
 
 template<MemTag MT>
@@ -41,7 +42,10 @@ ObjectBitSet<MT>::ObjectBitSet() :
         _bitmap_fragments(32, 8*K),
         _fragment_list(nullptr),
         _last_fragment_bits(nullptr),
-        _last_fragment_granule(UINTPTR_MAX) {
+        _last_fragment_granule(UINTPTR_MAX),
+        _par_fragments(nullptr),
+        _par_first_granule(0),
+        _par_granule_count(0) {
 }
 
 template<MemTag MT>
@@ -52,6 +56,9 @@ ObjectBitSet<MT>::~ObjectBitSet() {
     delete current;
     current = next;
   }
+  if (_par_fragments != nullptr) {
+    FREE_C_HEAP_ARRAY(CHeapBitMap*, _par_fragments);
+  }
   // destructors for ResourceHashtable base deletes nodes, and
   // ResizeableResourceHashtableStorage deletes the table.
 }
@@ -73,9 +80,18 @@ inline CHeapBitMap* ObjectBitSet<MT>::get_fragment_bits(uintptr_t addr) {
   if (found != nullptr) {
     bits = *found;
   } else {
-    BitMapFragment* fragment = new BitMapFragment(granule, _fragment_list);
-    bits = fragment->bits();
-    _fragment_list = fragment;
+    CHeapBitMap* volatile* const slot = par_fragment_slot(granule);
+    if (slot != nullptr && *slot != nullptr) {
+      // Created by parallel marking, not yet known to the table.
+      bits = *slot;
+    } else {
+      BitMapFragment* fragment = new BitMapFragment(granule, _fragment_list);
+      bits = fragment->bits();
+      _fragment_list = fragment;
+      if (slot != nullptr) {
+        *slot = bits;
+      }
+    }
     _bitmap_fragments.put(granule, bits);
     _bitmap_fragments.maybe_grow();
   }
@@ -86,6 +102,76 @@ inline CHeapBitMap* ObjectBitSet<MT>::get_fragment_bits(uintptr_t addr) {
   return bits;
 }
 
+template<MemTag MT>
+void ObjectBitSet<MT>::initialize_parallel(MemRegion covered) {
+  assert(_par_fragments == nullptr, "already initialized");
+  assert(!covered.is_empty(), "invariant");
+  _par_first_granule = (uintptr_t)covered.start() >> _bitmap_granularity_shift;
+  const uintptr_t last_granule = ((uintptr_t)covered.end() - 1) >> _bitmap_granularity_shift;
+  _par_granule_count = last_granule - _par_first_granule + 1;
+  CHeapBitMap** const fragments = NEW_C_HEAP_ARRAY(CHeapBitMap*, _par_granule_count, MT);
+  for (size_t i = 0; i < _par_granule_count; i++) {
+    fragments[i] = nullptr;
+  }
+  _par_fragments = fragments;
+}
+
+template<MemTag MT>
+inline CHeapBitMap* volatile* ObjectBitSet<MT>::par_fragment_slot(uintptr_t granule) const {
+  if (_par_fragments == nullptr ||
+      granule < _par_first_granule ||
+      granule - _par_first_granule >= _par_granule_count) {
+    return nullptr;
+  }
+  return &_par_fragments[granule - _par_first_granule];
+}
+
+template<MemTag MT>
+void ObjectBitSet<MT>::par_add_fragment(BitMapFragment* fragment) {
+  BitMapFragment* head = Atomic::load(&_fragment_list);
+  while (true) {
+    fragment->set_next(head);
+    BitMapFragment* const prev = Atomic::cmpxchg(&_fragment_list, head, fragment);
+    if (prev == head) {
+      return;
+    }
+    head = prev;
+  }
+}
+
+template<MemTag MT>
+inline CHeapBitMap* ObjectBitSet<MT>::par_get_fragment_bits(uintptr_t addr) {
+  const uintptr_t granule = addr >> _bitmap_granularity_shift;
+  CHeapBitMap* volatile* const slot = par_fragment_slot(granule);
+  assert(slot != nullptr, "address " PTR_FORMAT " not covered by parallel marking", addr);
+  CHeapBitMap* bits = Atomic::load_acquire(slot);
+  if (bits != nullptr) {
+    return bits;
+  }
+  // The table is only read during parallel marking, never updated.
+  CHeapBitMap** found = _bitmap_fragments.get(granule);
+  if (found != nullptr) {
+    Atomic::release_store(slot, *found);
+    return *found;
+  }
+  BitMapFragment* const fragment = new BitMapFragment(granule, nullptr);
+  CHeapBitMap* const winner = Atomic::cmpxchg(slot, (CHeapBitMap*)nullptr, fragment->bits());
+  if (winner != nullptr) {
+    // Another thread installed a fragment for this granule first.
+    delete fragment;
+    return winner;
+  }
+  par_add_fragment(fragment);
+  return fragment->bits();
+}
+
+template<MemTag MT>
+inline bool ObjectBitSet<MT>::par_mark_obj(uintptr_t addr) {
+  CHeapBitMap* bits = par_get_fragment_bits(addr);
+  const BitMap::idx_t bit = addr_to_bit(addr);
+  return bits->par_set_bit(bit);
+}
+
 template<MemTag MT>
 inline void ObjectBitSet<MT>::mark_obj(uintptr_t addr) {
   CHeapBitMap* bits = get_fragment_bits(addr);
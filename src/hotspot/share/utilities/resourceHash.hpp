@@ -317,6 +317,7 @@ class ResourceHashtableBase : public STORAGE {
   template<typename Function>
   TableStatistics statistics_calculate(Function size_function) const {
     NumberSeq summary;
+    TableBucketSizes bucket_sizes;
     size_t literal_bytes = 0;
     Node* const* bucket = table();
     const unsigned sz = table_size();
@@ -329,9 +330,10 @@ class ResourceHashtableBase : public STORAGE {
         node = node->_next;
       }
       summary.add((double)count);
+      bucket_sizes.add(count);
       ++bucket;
     }
-    return TableStatistics(summary, literal_bytes, sizeof(Node*), sizeof(Node));
+    return TableStatistics(summary, literal_bytes, sizeof(Node*), sizeof(Node), &bucket_sizes);
   }
 
   // This method calculates the "shallow" size. If you want the recursive size, use statistics_calculate.
@@ -81,6 +81,12 @@ float TableRateStatistics::get_remove_rate() {
   return (float)(_removed_items_stamp - _removed_items_stamp_prev) / (float)_seconds_stamp;
 }
 
+TableBucketSizes::TableBucketSizes() : _probes(0) {
+  for (size_t i = 0; i <= MaxCounted; i++) {
+    _counts[i] = 0;
+  }
+}
+
 TableStatistics::TableStatistics() :
   _literal_bytes(0),
   _number_of_buckets(0), _number_of_entries(0),
@@ -91,7 +97,8 @@ TableStatistics::TableStatistics() :
   _add_rate(0), _remove_rate(0) {
 }
 
-TableStatistics::TableStatistics(NumberSeq summary, size_t literal_bytes, size_t bucket_bytes, size_t node_bytes) :
+TableStatistics::TableStatistics(NumberSeq summary, size_t literal_bytes, size_t bucket_bytes, size_t node_bytes,
+                                 const TableBucketSizes* bucket_sizes) :
   _literal_bytes(literal_bytes),
   _number_of_buckets(0), _number_of_entries(0),
   _maximum_bucket_size(0), _average_bucket_size(0),
@@ -114,12 +121,17 @@ TableStatistics::TableStatistics(NumberSeq summary, size_t literal_bytes, size_t
 
   _bucket_size = (_number_of_buckets <= 0) ? 0 : (_bucket_bytes / _number_of_buckets);
   _entry_size = (_number_of_entries <= 0) ? 0 : (_entry_bytes / _number_of_entries);
+
+  if (bucket_sizes != nullptr) {
+    _bucket_sizes = *bucket_sizes;
+  }
 }
 
 TableStatistics::TableStatistics(TableRateStatistics& rate_stats,
                                   NumberSeq summary, size_t literal_bytes,
-                                  size_t bucket_bytes, size_t node_bytes) :
-  TableStatistics(summary, literal_bytes, bucket_bytes, node_bytes) {
+                                  size_t bucket_bytes, size_t node_bytes,
+                                  const TableBucketSizes* bucket_sizes) :
+  TableStatistics(summary, literal_bytes, bucket_bytes, node_bytes, bucket_sizes) {
 #if INCLUDE_JFR
   if (Jfr::is_recording()) {
     rate_stats.stamp();
@@ -150,5 +162,15 @@ void TableStatistics::print(outputStream* st, const char *table_name) {
   st->print_cr("Variance of bucket size : %9.3f", _variance_of_bucket_size);
   st->print_cr("Std. dev. of bucket size: %9.3f", _stddev_of_bucket_size);
   st->print_cr("Maximum bucket size     : %9" PRIuPTR, _maximum_bucket_size);
+  if (_bucket_sizes._probes != 0) {
+    st->print_cr("Average probe length    : %9.3f", (double)_bucket_sizes._probes / (double)_number_of_entries);
+    st->print_cr("Bucket size histogram   :");
+    for (size_t i = 0; i <= TableBucketSizes::MaxCounted; i++) {
+      size_t count = _bucket_sizes._counts[i];
+      st->print_cr("  %2" PRIuPTR "%s entries          : %9" PRIuPTR " buckets (%5.1f%%)",
+                   i, i == TableBucketSizes::MaxCounted ? "+" : " ", count,
+                   percent_of(count, _number_of_buckets));
+    }
+  }
 }
 
@@ -58,6 +58,25 @@ class TableRateStatistics : public CHeapObj<mtStatistics> {
   float get_remove_rate();
 };
 
+// Distribution of the bucket sizes of a table, which are the lengths of the
+// chains lookups have to probe.
+class TableBucketSizes {
+public:
+  // Buckets with at least this many entries are counted together.
+  static const size_t MaxCounted = 8;
+
+  size_t _counts[MaxCounted + 1];
+  // Number of nodes probed when looking up every entry of the table once.
+  size_t _probes;
+
+  TableBucketSizes();
+
+  void add(size_t bucket_size) {
+    _counts[MIN2(bucket_size, MaxCounted)]++;
+    _probes += bucket_size * (bucket_size + 1) / 2;
+  }
+};
+
 class TableStatistics : CHeapObj<mtStatistics> {
 
 public:
@@ -81,9 +100,13 @@ class TableStatistics : CHeapObj<mtStatistics> {
   float _add_rate;
   float _remove_rate;
 
+  TableBucketSizes _bucket_sizes;
+
   TableStatistics();
-  TableStatistics(NumberSeq summary, size_t literal_bytes, size_t bucket_bytes, size_t node_bytes);
-  TableStatistics(TableRateStatistics& rate_stats, NumberSeq summary, size_t literal_bytes, size_t bucket_bytes, size_t node_bytes);
+  TableStatistics(NumberSeq summary, size_t literal_bytes, size_t bucket_bytes, size_t node_bytes,
+                  const TableBucketSizes* bucket_sizes = nullptr);
+  TableStatistics(TableRateStatistics& rate_stats, NumberSeq summary, size_t literal_bytes, size_t bucket_bytes, size_t node_bytes,
+                  const TableBucketSizes* bucket_sizes = nullptr);
   ~TableStatistics();
 
   void print(outputStream* st, const char *table_name);
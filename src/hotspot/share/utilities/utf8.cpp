@@ -98,6 +98,27 @@ char* UTF8::next_character(const char* str, jint* value) {
   return next_ch;
 }
 
+// The ASCII runs that make up most class file strings are scanned 8 bytes at
+// a time. A word is "plain ASCII" when all its bytes are in [1, 127]: for such
+// bytes neither v nor v - 1 has the high bit set, while a zero byte turns
+// into 0xFF (no borrow can come from the plain bytes below it).
+static const uint64_t HIGH_BITS = UCONST64(0x8080808080808080);
+static const uint64_t LOW_BITS  = UCONST64(0x0101010101010101);
+
+static inline uint64_t load_word(const unsigned char* p) {
+  uint64_t w;
+  memcpy(&w, p, sizeof(w));
+  return w;
+}
+
+static inline bool is_ascii_word(uint64_t w) {
+  return (w & HIGH_BITS) == 0;
+}
+
+static inline bool is_plain_ascii_word(uint64_t w) {
+  return (((w - LOW_BITS) | w) & HIGH_BITS) == 0;
+}
+
 // The number of unicode characters in a utf8 sequence can be easily
 // determined by noting that bytes of the form 10xxxxxx are part of
 // a 2 or 3-byte multi-byte sequence, all others are either characters
@@ -113,6 +134,14 @@ int UTF8::unicode_length(const char* str, size_t len, bool& is_latin1, bool& has
   is_latin1 = true;
   unsigned char prev = 0;
   for (size_t i = 0; i < len; i++) {
+    // An ASCII byte as prev never makes the next byte non-latin1.
+    while (i + sizeof(uint64_t) <= len && is_ascii_word(load_word((const unsigned char*)str + i))) {
+      i += sizeof(uint64_t);
+      prev = 0;
+    }
+    if (i == len) {
+      break;
+    }
     unsigned char c = str[i];
     if ((c & 0xC0) == 0x80) {
       // Multibyte, check if valid latin1 character.
@@ -338,24 +367,14 @@ jint UTF8::get_supplementary_character(const unsigned char* str) {
 
 bool UTF8::is_legal_utf8(const unsigned char* buffer, size_t length,
                          bool version_leq_47) {
-  size_t i = 0;
-  size_t count = length >> 2;
-  for (size_t k = 0; k < count; k++) {
-    unsigned char b0 = buffer[i];
-    unsigned char b1 = buffer[i+1];
-    unsigned char b2 = buffer[i+2];
-    unsigned char b3 = buffer[i+3];
-    // For an unsigned char v,
-    // (v | v - 1) is < 128 (highest bit 0) for 0 < v < 128;
-    // (v | v - 1) is >= 128 (highest bit 1) for v == 0 or v >= 128.
-    unsigned char res = b0 | (b0 - 1) |
-                        b1 | (b1 - 1) |
-                        b2 | (b2 - 1) |
-                        b3 | (b3 - 1);
-    if (res >= 128) break;
-    i += 4;
-  }
-  for(; i < length; i++) {
+  for (size_t i = 0; i < length; i++) {
+    // Skip runs of plain ASCII, also after each multi-byte character.
+    while (i + sizeof(uint64_t) <= length && is_plain_ascii_word(load_word(&buffer[i]))) {
+      i += sizeof(uint64_t);
+    }
+    if (i == length) {
+      break;
+    }
     unsigned short c;
     // no embedded zeros
     if (buffer[i] == 0) return false;
@@ -52,6 +52,7 @@
 #include "runtime/osThread.hpp"
 #include "runtime/safefetch.hpp"
 #include "runtime/safepointMechanism.hpp"
+#include "runtime/sizeClassMalloc.hpp"
 #include "runtime/stackFrameStream.inline.hpp"
 #include "runtime/stackOverflow.hpp"
 #include "runtime/threads.hpp"
@@ -1321,6 +1322,10 @@ void VMError::report(outputStream* st, bool _verbose) {
     NativeHeapTrimmer::print_state(st);
     st->cr();
 
+  STEP_IF("printing size class malloc state", _verbose)
+    SizeClassMalloc::print_state(st);
+    st->cr();
+
   STEP_IF("printing system", _verbose)
     st->print_cr("---------------  S Y S T E M  ---------------");
     st->cr();
@@ -1496,6 +1501,10 @@ void VMError::print_vm_info(outputStream* st) {
   NativeHeapTrimmer::print_state(st);
   st->cr();
 
+  // STEP("printing size class malloc state")
+  SizeClassMalloc::print_state(st);
+  st->cr();
+
 
   // STEP("printing system")
   st->print_cr("---------------  S Y S T E M  ---------------");
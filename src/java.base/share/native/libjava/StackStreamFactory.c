@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2015, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -86,3 +86,26 @@ JNIEXPORT void JNICALL Java_java_lang_StackStreamFactory_00024AbstractStackWalke
 {
     JVM_SetStackWalkContinuation(env, stackstream, anchor, frames, cont);
 }
+
+/*
+ * Class:     java_lang_StackStreamFactory
+ * Method:    fillCallerLocations
+ * Signature: (IILjdk/internal/vm/ContinuationScope;[Ljava/lang/Class;[J)I
+ */
+JNIEXPORT jint JNICALL Java_java_lang_StackStreamFactory_fillCallerLocations
+  (JNIEnv *env, jclass dummy, jint mode, jint skipFrames, jobject contScope,
+   jobjectArray classes, jlongArray locations)
+{
+    return JVM_FillCallerLocations(env, mode, skipFrames, contScope, classes, locations);
+}
+
+/*
+ * Class:     java_lang_StackStreamFactory
+ * Method:    initCallerFrameInfo
+ * Signature: (Ljava/lang/StackFrameInfo;Ljava/lang/Class;J)V
+ */
+JNIEXPORT void JNICALL Java_java_lang_StackStreamFactory_initCallerFrameInfo
+  (JNIEnv *env, jclass dummy, jobject frameInfo, jclass holder, jlong location)
+{
+    JVM_InitCallerFrameInfo(env, frameInfo, holder, location);
+}
@@ -52,3 +52,10 @@ Java_java_lang_VirtualThread_virtualThreadPinnedEvent(JNIEnv *env, jclass ignore
 {
     JVM_VirtualThreadPinnedEvent(reasonCode, reasonString);
 }
+
+JNIEXPORT jint JNICALL
+Java_java_lang_VirtualThread_carrierThreadStates(JNIEnv *env, jclass ignored,
+                                                 jobjectArray carriers, jlongArray states)
+{
+    return JVM_GetCarrierThreadStates(env, ignored, carriers, states);
+}
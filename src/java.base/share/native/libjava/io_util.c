@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1994, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1994, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -57,6 +57,13 @@ readSingle(JNIEnv *env, jobject this, jfieldID fid) {
  */
 #define BUF_SIZE 8192
 
+/*
+ * Transfers larger than BUF_SIZE go directly to or from the array when the
+ * collector can pin it without holding off GC for the duration of the I/O,
+ * which saves allocating and copying a native buffer. Otherwise a buffer
+ * is malloc'd as before.
+ */
+
 /*
  * Returns true if the array slice defined by the given offset and length
  * is out of bounds.
@@ -77,6 +84,7 @@ readBytes(JNIEnv *env, jobject this, jbyteArray bytes,
     jint nread;
     char stackBuf[BUF_SIZE];
     char *buf = NULL;
+    jbyte *pinned = NULL;
     FD fd;
 
     if (IS_NULL(bytes)) {
@@ -92,10 +100,15 @@ readBytes(JNIEnv *env, jobject this, jbyteArray bytes,
     if (len == 0) {
         return 0;
     } else if (len > BUF_SIZE) {
-        buf = malloc(len);
-        if (buf == NULL) {
-            JNU_ThrowOutOfMemoryError(env, NULL);
-            return 0;
+        pinned = (jbyte *)JVM_PinArray(env, bytes);
+        if (pinned != NULL) {
+            buf = (char *)(pinned + off);
+        } else {
+            buf = malloc(len);
+            if (buf == NULL) {
+                JNU_ThrowOutOfMemoryError(env, NULL);
+                return 0;
+            }
         }
     } else {
         buf = stackBuf;
@@ -108,7 +121,9 @@ readBytes(JNIEnv *env, jobject this, jbyteArray bytes,
     } else {
         nread = IO_Read(fd, buf, len);
         if (nread > 0) {
-            (*env)->SetByteArrayRegion(env, bytes, off, nread, (jbyte *)buf);
+            if (pinned == NULL) {
+                (*env)->SetByteArrayRegion(env, bytes, off, nread, (jbyte *)buf);
+            }
         } else if (nread == -1) {
             JNU_ThrowIOExceptionWithLastError(env, "Read error");
         } else { /* EOF */
@@ -116,7 +131,9 @@ readBytes(JNIEnv *env, jobject this, jbyteArray bytes,
         }
     }
 
-    if (buf != stackBuf) {
+    if (pinned != NULL) {
+        JVM_UnpinArray(env, bytes);
+    } else if (buf != stackBuf) {
         free(buf);
     }
     return nread;
@@ -149,6 +166,7 @@ writeBytes(JNIEnv *env, jobject this, jbyteArray bytes,
     jint n;
     char stackBuf[BUF_SIZE];
     char *buf = NULL;
+    jbyte *pinned = NULL;
     FD fd;
 
     if (IS_NULL(bytes)) {
@@ -164,16 +182,23 @@ writeBytes(JNIEnv *env, jobject this, jbyteArray bytes,
     if (len == 0) {
         return;
     } else if (len > BUF_SIZE) {
-        buf = malloc(len);
-        if (buf == NULL) {
-            JNU_ThrowOutOfMemoryError(env, NULL);
-            return;
+        pinned = (jbyte *)JVM_PinArray(env, bytes);
+        if (pinned != NULL) {
+            buf = (char *)(pinned + off);
+        } else {
+            buf = malloc(len);
+            if (buf == NULL) {
+                JNU_ThrowOutOfMemoryError(env, NULL);
+                return;
+            }
         }
     } else {
         buf = stackBuf;
     }
 
-    (*env)->GetByteArrayRegion(env, bytes, off, len, (jbyte *)buf);
+    if (pinned == NULL) {
+        (*env)->GetByteArrayRegion(env, bytes, off, len, (jbyte *)buf);
+    }
 
     if (!(*env)->ExceptionOccurred(env)) {
         off = 0;
@@ -196,7 +221,9 @@ writeBytes(JNIEnv *env, jobject this, jbyteArray bytes,
             len -= n;
         }
     }
-    if (buf != stackBuf) {
+    if (pinned != NULL) {
+        JVM_UnpinArray(env, bytes);
+    } else if (buf != stackBuf) {
         free(buf);
     }
 }
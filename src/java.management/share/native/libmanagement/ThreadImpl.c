@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2003, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2003, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -79,6 +79,15 @@ Java_sun_management_ThreadImpl_getThreadTotalCpuTime1
                                              JNI_TRUE /* user+sys */);
 }
 
+JNIEXPORT void JNICALL
+Java_sun_management_ThreadImpl_getThreadStatistics0
+  (JNIEnv *env, jclass cls, jlongArray ids, jintArray states, jlongArray cpuTimes,
+   jlongArray blockedCounts, jlongArray waitedCounts)
+{
+    jmm_interface->GetThreadStatistics(env, ids, states, cpuTimes,
+                                       blockedCounts, waitedCounts);
+}
+
 JNIEXPORT jlong JNICALL
 Java_sun_management_ThreadImpl_getThreadUserCpuTime0
   (JNIEnv *env, jclass cls, jlong tid)
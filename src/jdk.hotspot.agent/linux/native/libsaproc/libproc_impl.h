@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2003, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2003, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -90,6 +90,8 @@ typedef struct ps_prochandle_ops {
 
 struct core_data {
    int                core_fd;   // file descriptor of core file
+   const char*        core_map;  // read-only mapping of the core file, or NULL
+   size_t             core_map_size; // size of core_map
    int                exec_fd;   // file descriptor of exec file
    int                interp_fd; // file descriptor of interpreter (ld-linux.so.2)
    // part of the class sharing workaround
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2003, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2003, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,6 +30,8 @@
 #include <stddef.h>
 #include <elf.h>
 #include <link.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "libproc_impl.h"
 #include "ps_core_common.h"
 #include "proc_service.h"
@@ -106,8 +108,11 @@ static bool sort_map_array(struct ps_prochandle* ph) {
 #endif
 
 static bool core_read_data(struct ps_prochandle* ph, uintptr_t addr, char *buf, size_t size) {
+   static int page_size = 0;
    ssize_t resid = size;
-   int page_size=sysconf(_SC_PAGE_SIZE);
+   if (page_size == 0) {
+      page_size = sysconf(_SC_PAGE_SIZE);
+   }
    while (resid != 0) {
       map_info *mp = core_lookup(ph, addr);
       uintptr_t mapoff;
@@ -124,7 +129,12 @@ static bool core_read_data(struct ps_prochandle* ph, uintptr_t addr, char *buf,
       len = MIN(resid, mp->memsz - mapoff);
       off = mp->offset + mapoff;
 
-      if ((len = pread(fd, buf, len, off)) <= 0) {
+      // SA mostly reads a few bytes at a time, so serve reads of the
+      // core file itself from its mapping instead of one pread each.
+      if (fd == ph->core->core_fd && ph->core->core_map != NULL &&
+          off >= 0 && (size_t)off + len <= ph->core->core_map_size) {
+         memcpy(buf, ph->core->core_map + off, len);
+      } else if ((len = pread(fd, buf, len, off)) <= 0) {
          break;
       }
 
@@ -155,6 +165,15 @@ static bool core_read_data(struct ps_prochandle* ph, uintptr_t addr, char *buf,
    }
 }
 
+// unmap the core file before the common clean-up closes it
+static void core_release_mapped(struct ps_prochandle* ph) {
+   if (ph->core != NULL && ph->core->core_map != NULL) {
+      munmap((void*)ph->core->core_map, ph->core->core_map_size);
+      ph->core->core_map = NULL;
+   }
+   core_release(ph);
+}
+
 // null implementation for write
 static bool core_write_data(struct ps_prochandle* ph,
                              uintptr_t addr, const char *buf , size_t size) {
@@ -176,7 +195,7 @@ static bool core_get_lwp_regs(struct ps_prochandle* ph, lwpid_t lwp_id,
 }
 
 static ps_prochandle_ops core_ops = {
-   .release=  core_release,
+   .release=  core_release_mapped,
    .p_pread=  core_read_data,
    .p_pwrite= core_write_data,
    .get_lwp_regs= core_get_lwp_regs
@@ -760,6 +779,21 @@ Pgrab_core(const char* exec_file, const char* core_file) {
     goto err;
   }
 
+  // map the core file for reading the debuggee memory saved in it; if that
+  // fails, core_read_data() falls back to pread().
+  {
+    struct stat st;
+    if (fstat(ph->core->core_fd, &st) == 0 && st.st_size > 0) {
+      void* addr = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, ph->core->core_fd, 0);
+      if (addr != MAP_FAILED) {
+        ph->core->core_map = (const char*)addr;
+        ph->core->core_map_size = (size_t)st.st_size;
+      } else {
+        print_debug("can't map core file, using pread\n");
+      }
+    }
+  }
+
   if ((ph->core->exec_fd = open(exec_file, O_RDONLY)) < 0) {
     print_debug("can't open executable file\n");
     goto err;
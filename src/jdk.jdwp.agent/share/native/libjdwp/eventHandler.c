@@ -866,6 +866,25 @@ cbThreadEnd(jvmtiEnv *jvmti_env, JNIEnv *env, jthread thread)
     LOG_MISC(("END cbThreadEnd"));
 }
 
+/*
+ * Vthread start and end events are only needed when the debugger asked
+ * for thread start/end events, wants all vthreads remembered, or already
+ * has (or may need) a ThreadNode for the vthread. Skipping the rest avoids
+ * creating and destroying a ThreadNode for every vthread in applications
+ * that run very large numbers of them.
+ */
+static jboolean
+vthreadEventNeeded(EventIndex ei, jthread vthread)
+{
+    if (gdata->includeVThreads || gdata->rememberVThreadsWhenDisconnected) {
+        return JNI_TRUE;
+    }
+    if (getHandlerChain(ei)->first != NULL) {
+        return JNI_TRUE;
+    }
+    return threadControl_isTrackedVThread(vthread);
+}
+
 /* Event callback for JVMTI_EVENT_VIRTUAL_THREAD_START */
 static void JNICALL
 cbVThreadStart(jvmtiEnv *jvmti_env, JNIEnv *env, jthread vthread)
@@ -876,11 +895,13 @@ cbVThreadStart(jvmtiEnv *jvmti_env, JNIEnv *env, jthread vthread)
     JDI_ASSERT(gdata->vthreadsSupported);
 
     BEGIN_CALLBACK() {
-        (void)memset(&info,0,sizeof(info));
-        /* Convert to THREAD_START event. */
-        info.ei         = EI_THREAD_START;
-        info.thread     = vthread;
-        event_callback(env, &info);
+        if (vthreadEventNeeded(EI_THREAD_START, vthread)) {
+            (void)memset(&info,0,sizeof(info));
+            /* Convert to THREAD_START event. */
+            info.ei         = EI_THREAD_START;
+            info.thread     = vthread;
+            event_callback(env, &info);
+        }
     } END_CALLBACK();
 
     LOG_MISC(("END cbVThreadStart"));
@@ -897,11 +918,13 @@ cbVThreadEnd(jvmtiEnv *jvmti_env, JNIEnv *env, jthread vthread)
     JDI_ASSERT(gdata->vthreadsSupported);
 
     BEGIN_CALLBACK() {
-        (void)memset(&info,0,sizeof(info));
-        /* Convert to THREAD_END event. */
-        info.ei         = EI_THREAD_END;
-        info.thread     = vthread;
-        event_callback(env, &info);
+        if (vthreadEventNeeded(EI_THREAD_END, vthread)) {
+            (void)memset(&info,0,sizeof(info));
+            /* Convert to THREAD_END event. */
+            info.ei         = EI_THREAD_END;
+            info.thread     = vthread;
+            event_callback(env, &info);
+        }
     } END_CALLBACK();
 
     LOG_MISC(("END cbVThreadEnd"));
@@ -1699,6 +1699,23 @@ threadControl_removeDebugThread(jthread thread)
     return error;
 }
 
+/*
+ * Returns JNI_TRUE if a VIRTUAL_THREAD_START or VIRTUAL_THREAD_END for
+ * the given vthread has to be handled. Vthreads the debugger has never
+ * seen do not need a ThreadNode unless a suspendAll is in effect, since
+ * insertThread() creates one lazily on the first event that needs it.
+ */
+jboolean
+threadControl_isTrackedVThread(jthread vthread)
+{
+    jboolean rc;
+
+    debugMonitorEnter(threadLock);
+    rc = (suspendAllCount > 0 || findThread(NULL, vthread) != NULL);
+    debugMonitorExit(threadLock);
+    return rc;
+}
+
 jboolean
 threadControl_isDebugThread(jthread thread)
 {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1998, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1998, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -55,6 +55,7 @@ StepRequest *threadControl_getStepRequest(jthread);
 InvokeRequest *threadControl_getInvokeRequest(jthread);
 
 jboolean threadControl_isDebugThread(jthread thread);
+jboolean threadControl_isTrackedVThread(jthread vthread);
 jvmtiError threadControl_addDebugThread(jthread thread);
 
 jvmtiError threadControl_applicationThreadStatus(jthread thread, jdwpThreadStatus *pstatus, jint *suspendStatus);
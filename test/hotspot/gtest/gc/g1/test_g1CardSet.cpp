@@ -378,6 +378,34 @@ void G1CardSetTest::cardset_basic_test() {
     card_set.iterate_cards(count_cards);
     ASSERT_TRUE(count_cards._num_cards == config.max_cards_in_region());
 
+    card_set.clear();
+    ASSERT_TRUE(card_set.occupied() == 0);
+  }
+  { // Test coarsening Howl containers to full on request
+    G1CardSet card_set(&config, &mm);
+
+    // One more card than fits into an array of cards makes region 99 use a Howl container.
+    for (uint i = 0; i <= config.max_cards_in_array(); i++) {
+      G1AddCardResult res = card_set.add_card(99, i);
+      ASSERT_TRUE(res == Added);
+    }
+    G1AddCardResult res = card_set.add_card(50, 1);
+    ASSERT_TRUE(res == Added);
+    ASSERT_TRUE(config.max_cards_in_array() + 2 == card_set.occupied());
+
+    ASSERT_TRUE(card_set.coarsen_howl_containers_to_full() == 1);
+    ASSERT_TRUE(CardsPerRegion + 1 == card_set.occupied());
+
+    res = card_set.add_card(99, CardsPerRegion - 1);
+    ASSERT_TRUE(res == Found);
+    ASSERT_TRUE(card_set.contains_card(50, 1));
+    ASSERT_FALSE(card_set.contains_card(50, 2));
+
+    // Nothing left to coarsen.
+    ASSERT_TRUE(card_set.coarsen_howl_containers_to_full() == 0);
+
+    check_iteration(&card_set, card_set.occupied());
+
     card_set.clear();
     ASSERT_TRUE(card_set.occupied() == 0);
   }
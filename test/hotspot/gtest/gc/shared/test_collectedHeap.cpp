@@ -23,7 +23,11 @@
 
 #include "precompiled.hpp"
 #include "gc/shared/collectedHeap.hpp"
+#include "memory/oopFactory.hpp"
 #include "memory/universe.hpp"
+#include "oops/typeArrayOop.hpp"
+#include "runtime/handles.inline.hpp"
+#include "runtime/interfaceSupport.inline.hpp"
 #include "unittest.hpp"
 
 TEST_VM(CollectedHeap, is_in) {
@@ -39,3 +43,22 @@ TEST_VM(CollectedHeap, is_in) {
   ASSERT_FALSE(heap->is_in((void*)outside_heap)) << "outside_heap: " << outside_heap
           << " is unexpectedly in the heap";
 }
+
+TEST_VM(CollectedHeap, pin_object_detached) {
+  JavaThread* THREAD = JavaThread::current();
+  ThreadInVMfromNative invm(THREAD);
+  CollectedHeap* heap = Universe::heap();
+
+  typeArrayHandle array(THREAD, oopFactory::new_byteArray(128, THREAD));
+  ASSERT_FALSE(HAS_PENDING_EXCEPTION);
+
+  if (!heap->pin_object_detached(array())) {
+    return; // Collector only supports thread-bound pinning.
+  }
+  // Nested pins must balance, and may overlap with thread-bound ones.
+  ASSERT_TRUE(heap->pin_object_detached(array()));
+  heap->pin_object(THREAD, array());
+  heap->unpin_object_detached(array());
+  heap->unpin_object(THREAD, array());
+  heap->unpin_object_detached(array());
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/workerCountController.hpp"
+#include "unittest.hpp"
+
+// These tests assume UseGCWorkerCountFeedback is off, so the processor quota
+// does not limit the results, and the default GCWorkerEfficiencyTarget of 80.
+
+TEST(WorkerCountControllerTest, no_samples) {
+  WorkerCountController controller("test", 8);
+  ASSERT_EQ(6u, controller.workers(6));
+  ASSERT_EQ(8u, controller.workers(20));
+  ASSERT_EQ(1u, controller.workers(0));
+}
+
+TEST(WorkerCountControllerTest, shrinks_when_workers_wait) {
+  WorkerCountController controller("test", 8);
+  // Half of the worker time is spent waiting: 4 busy workers, which
+  // need 5 workers at 80% efficiency.
+  controller.record(8, 1.0, 4.0);
+  ASSERT_EQ(5u, controller.workers(8));
+}
+
+TEST(WorkerCountControllerTest, grows_when_workers_are_busy) {
+  WorkerCountController controller("test", 8);
+  controller.record(4, 1.0, 4.0);
+  ASSERT_EQ(5u, controller.workers(4));
+
+  controller.record(8, 1.0, 8.0);
+  ASSERT_EQ(8u, controller.workers(8)); // limited by the maximum
+}
+
+TEST(WorkerCountControllerTest, ignores_empty_runs) {
+  WorkerCountController controller("test", 8);
+  controller.record(8, 0.0, 0.0);
+  ASSERT_EQ(3u, controller.workers(3));
+}
@@ -87,6 +87,14 @@ LOG_LEVEL_LIST
     lm.flush();
   }
 
+  // With asyncmode=block, every message makes it, even into a buffer too small for all of them.
+  void test_asynclog_block_messages() {
+    AsyncLogWriter::BufferUpdater saver(1024);
+    for (int i = 0; i < 500; ++i) {
+      log_debug(logging)("blocking line %d", i);
+    }
+  }
+
   // stdout/stderr support
   bool write_to_file(const std::string& output) {
     FILE* f = os::fopen(TestLogFileName, "w");
@@ -253,6 +261,29 @@ TEST_VM_F(AsyncLogTest, droppingMessage) {
   EXPECT_TRUE(file_contains_substring(TestLogFileName, "messages dropped due to async logging"));
 }
 
+TEST_VM_F(AsyncLogTest, blockingMessage) {
+  if (AsyncLogWriter::instance() == nullptr) {
+    return;
+  }
+
+  set_log_config(TestLogFileName, "logging=debug", "", "asyncmode=block");
+  test_asynclog_block_messages();
+  AsyncLogWriter::flush();
+  EXPECT_TRUE(file_contains_substring(TestLogFileName, "blocking line 0"));
+  EXPECT_TRUE(file_contains_substring(TestLogFileName, "blocking line 499"));
+  EXPECT_FALSE(file_contains_substring(TestLogFileName, "messages dropped due to async logging"));
+}
+
+TEST_VM_F(AsyncLogTest, samplingMessage) {
+  if (AsyncLogWriter::instance() == nullptr) {
+    return;
+  }
+
+  set_log_config(TestLogFileName, "logging=debug", "", "asyncmode=sample");
+  test_asynclog_drop_messages();
+  EXPECT_TRUE(file_contains_substring(TestLogFileName, "messages dropped due to async logging"));
+}
+
 TEST_VM_F(AsyncLogTest, stdoutOutput) {
   testing::internal::CaptureStdout();
 
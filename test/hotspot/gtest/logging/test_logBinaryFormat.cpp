@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+#include "precompiled.hpp"
+#include "jvm.h"
+#include "logging/log.hpp"
+#include "logging/logAsyncWriter.hpp"
+#include "logging/logBinaryFormat.hpp"
+#include "logTestFixture.hpp"
+#include "logTestUtils.inline.hpp"
+#include "memory/resourceArea.hpp"
+#include "unittest.hpp"
+#include "utilities/ostream.hpp"
+
+class LogBinaryFormatTest : public LogTestFixture {
+ protected:
+  void render(stringStream* out) {
+    AsyncLogWriter::flush();
+    stringStream err;
+    EXPECT_TRUE(LogBinaryReader::render(TestLogFileName, out, &err)) << err.base();
+  }
+};
+
+static LogBinaryFormat::ArgKind kind_of(const char* spec) {
+  LogBinaryFormat::Conversion conv;
+  LogBinaryFormat::parse_conversion(spec, &conv);
+  EXPECT_EQ(spec + strlen(spec), conv._end) << spec;
+  return conv._kind;
+}
+
+TEST(LogBinaryFormat, parse_conversion) {
+  EXPECT_EQ(LogBinaryFormat::NoArg, kind_of("%%"));
+  EXPECT_EQ(LogBinaryFormat::IntArg, kind_of("%d"));
+  EXPECT_EQ(LogBinaryFormat::IntArg, kind_of("%-08lld"));
+  EXPECT_EQ(LogBinaryFormat::IntArg, kind_of("%*zu"));
+  EXPECT_EQ(LogBinaryFormat::IntArg, kind_of("%#016lx"));
+  EXPECT_EQ(LogBinaryFormat::IntArg, kind_of("%c"));
+  EXPECT_EQ(LogBinaryFormat::DoubleArg, kind_of("%.3f"));
+  EXPECT_EQ(LogBinaryFormat::DoubleArg, kind_of("%10.*lg"));
+  EXPECT_EQ(LogBinaryFormat::StringArg, kind_of("%-20s"));
+  EXPECT_EQ(LogBinaryFormat::PointerArg, kind_of("%p"));
+  EXPECT_EQ(LogBinaryFormat::UnsupportedArg, kind_of("%n"));
+  EXPECT_EQ(LogBinaryFormat::UnsupportedArg, kind_of("%ls"));
+  EXPECT_EQ(LogBinaryFormat::UnsupportedArg, kind_of("%Lf"));
+}
+
+TEST_VM_F(LogBinaryFormatTest, roundtrip) {
+  set_log_config(TestLogFileName, "logging=info", "level,tags", "format=binary");
+  const char* s = "a string";
+  const char* null_string = nullptr;
+  for (int i = 0; i < 3; i++) {
+    log_info(logging)("int %d size " SIZE_FORMAT " hex " PTR_FORMAT " %s", -i, (size_t)i, (uintptr_t)0xcafe, s);
+  }
+  log_info(logging)("%5.1f%% |%-*s| %c %s", 12.34, 6, "ab", 'x', null_string);
+  log_info(logging)("jlong " JLONG_FORMAT " julong " JULONG_FORMAT, min_jlong, max_julong);
+  log_info(logging)("plain text");
+
+  ResourceMark rm;
+  stringStream out;
+  render(&out);
+  const char* expected =
+    "[info][logging] int 0 size 0 hex 0x000000000000cafe a string\n"
+    "[info][logging] int -1 size 1 hex 0x000000000000cafe a string\n"
+    "[info][logging] int -2 size 2 hex 0x000000000000cafe a string\n"
+    "[info][logging]  12.3% |ab    | x (null)\n"
+    "[info][logging] jlong -9223372036854775808 julong 18446744073709551615\n"
+    "[info][logging] plain text\n";
+  EXPECT_STREQ(expected, out.base());
+}
+
+// Format strings are identified by address, check that a buffer reused for
+// another format string gets a new definition.
+PRAGMA_DIAG_PUSH
+PRAGMA_FORMAT_NONLITERAL_IGNORED
+TEST_VM_F(LogBinaryFormatTest, reused_format_buffer) {
+  set_log_config(TestLogFileName, "logging=info", "level", "format=binary");
+  char fmt[32];
+  strcpy(fmt, "first %d");
+  log_info(logging)(fmt, 1);
+  strcpy(fmt, "second %s");
+  log_info(logging)(fmt, "two");
+
+  ResourceMark rm;
+  stringStream out;
+  render(&out);
+  EXPECT_STREQ("[info] first 1\n[info] second two\n", out.base());
+}
+PRAGMA_DIAG_POP
+
+TEST_VM_F(LogBinaryFormatTest, not_binary) {
+  set_log_config(TestLogFileName, "logging=info");
+  log_info(logging)("a text message");
+
+  AsyncLogWriter::flush();
+  ResourceMark rm;
+  stringStream out;
+  stringStream err;
+  EXPECT_FALSE(LogBinaryReader::render(TestLogFileName, &out, &err));
+  EXPECT_TRUE(strstr(err.base(), "is not a binary log file") != nullptr) << err.base();
+}
@@ -25,6 +25,8 @@
 
 #include "precompiled.hpp"
 #include "memory/arena.hpp"
+#include "runtime/flags/flagSetting.hpp"
+#include "runtime/globals_extension.hpp"
 #include "runtime/os.hpp"
 #include "utilities/align.hpp"
 #include "utilities/globalDefinitions.hpp"
@@ -382,3 +384,41 @@ TEST_VM(Arena, different_chunk_sizes) {
     Arena ar7(mtTest, Arena::Tag::tag_other, random_arena_chunk_size());
   }
 }
+
+TEST_VM(Arena, different_chunk_sizes_with_thread_cache) {
+  AutoSaveRestore<uint> FLAG_GUARD(ArenaThreadChunkCacheSize);
+  FLAG_SET_CMDLINE(ArenaThreadChunkCacheSize, 4);
+  for (int i = 0; i < 1000; i ++) {
+    Arena ar0(mtTest, Arena::Tag::tag_other, random_arena_chunk_size());
+    Arena ar1(mtTest, Arena::Tag::tag_other, random_arena_chunk_size());
+    Arena ar2(mtTest, Arena::Tag::tag_other, random_arena_chunk_size());
+    Arena ar3(mtTest, Arena::Tag::tag_other, random_arena_chunk_size());
+    void* p = ar0.Amalloc(Chunk::size * 2);
+    ASSERT_AMALLOC(ar0, p);
+  }
+  Arena::flush_thread_chunk_cache();
+}
+
+TEST_VM(Arena, grow_large_chunks) {
+  AutoSaveRestore<bool> FLAG_GUARD(ArenaGrowLargeChunks);
+  FLAG_SET_CMDLINE(ArenaGrowLargeChunks, true);
+  Arena ar(mtTest);
+  // The first grows are by default sized chunks
+  while (ar.size_in_bytes() < 8 * Chunk::size) {
+    const size_t before = ar.size_in_bytes();
+    void* p = ar.Amalloc(Chunk::size);
+    ASSERT_AMALLOC(ar, p);
+    ASSERT_LE(ar.size_in_bytes() - before, (size_t)Chunk::size);
+  }
+  // Then the arena grows by large chunks
+  const size_t before = ar.size_in_bytes();
+  void* p = ar.Amalloc(Chunk::size);
+  ASSERT_AMALLOC(ar, p);
+  ASSERT_EQ(ar.size_in_bytes() - before, (size_t)Chunk::large_size);
+  // which are filled before growing again
+  for (int i = 0; i < 6; i++) {
+    p = ar.Amalloc(Chunk::size);
+    ASSERT_AMALLOC(ar, p);
+  }
+  ASSERT_EQ(ar.size_in_bytes() - before, (size_t)Chunk::large_size);
+}
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/handshake.hpp"
+#include "runtime/interfaceSupport.inline.hpp"
+#include "runtime/javaThread.hpp"
+#include "runtime/os.hpp"
+#include "runtime/semaphore.inline.hpp"
+#include "runtime/threadSMR.inline.hpp"
+#include "threadHelper.inline.hpp"
+#include "unittest.hpp"
+
+// Runs until told to stop, blocked most of the time so that the requester
+// can execute handshakes on its behalf.
+class HandshakeTestThread : public JavaTestThread {
+  Semaphore*     _started;
+  volatile bool* _stop;
+
+public:
+  HandshakeTestThread(Semaphore* post, Semaphore* started, volatile bool* stop) :
+    JavaTestThread(post), _started(started), _stop(stop) {}
+
+  virtual void main_run() {
+    _started->signal();
+    while (!Atomic::load_acquire(_stop)) {
+      ThreadBlockInVM tbivm(this);
+      os::naked_short_sleep(1);
+    }
+  }
+};
+
+// Counts how many times the closure ran for each of the targets.
+class CountingHandshakeClosure : public HandshakeClosure {
+  JavaThread* const* _targets;
+  int                _count;
+  volatile int*      _executed;
+
+public:
+  CountingHandshakeClosure(JavaThread* const* targets, int count, volatile int* executed) :
+    HandshakeClosure("CountingHandshake"), _targets(targets), _count(count), _executed(executed) {}
+
+  void do_thread(Thread* thread) {
+    for (int i = 0; i < _count; i++) {
+      if (_targets[i] == thread) {
+        Atomic::inc(&_executed[i]);
+      }
+    }
+  }
+};
+
+static void wait_until_exited(JavaThread* thread) {
+  while (true) {
+    ThreadsListHandle tlh;
+    if (!tlh.includes(thread)) {
+      return;
+    }
+    ThreadBlockInVM tbivm(JavaThread::current());
+    os::naked_short_sleep(1);
+  }
+}
+
+TEST_VM(Handshake, execute_thread_set) {
+  const int running = 4;
+  // The running threads, a thread that has exited and a thread that
+  // was started after the ThreadsListHandle was taken.
+  const int count = running + 2;
+  const int exited = running;
+  const int late = running + 1;
+
+  JavaThread* current = JavaThread::current();
+  ThreadInVMfromNative tivfn(current);
+
+  Semaphore post;
+  Semaphore started;
+  volatile bool stop = false;
+  JavaThread* targets[count];
+  volatile int executed[count] = {};
+
+  Semaphore done_started;
+  volatile bool done_stop = true;
+  HandshakeTestThread* done = new HandshakeTestThread(&post, &done_started, &done_stop);
+  done->doit();
+  post.wait_with_safepoint_check(current);
+  targets[exited] = done;
+  wait_until_exited(done);
+
+  for (int i = 0; i < running; i++) {
+    HandshakeTestThread* t = new HandshakeTestThread(&post, &started, &stop);
+    t->doit();
+    targets[i] = t;
+  }
+  for (int i = 0; i < running; i++) {
+    started.wait_with_safepoint_check(current);
+  }
+
+  {
+    ThreadsListHandle tlh;
+    HandshakeTestThread* t = new HandshakeTestThread(&post, &started, &stop);
+    t->doit();
+    targets[late] = t;
+    started.wait_with_safepoint_check(current);
+
+    CountingHandshakeClosure cl(targets, count, executed);
+    Handshake::execute(&cl, &tlh, targets, count);
+  }
+
+  for (int i = 0; i < running; i++) {
+    EXPECT_EQ(1, executed[i]) << "running target " << i;
+  }
+  EXPECT_EQ(0, executed[exited]) << "exited target";
+  EXPECT_EQ(0, executed[late]) << "target not in the list";
+
+  Atomic::release_store(&stop, true);
+  for (int i = 0; i < running + 1; i++) {
+    post.wait_with_safepoint_check(current);
+  }
+}
+
+TEST_VM(Handshake, execute_thread_set_none_alive) {
+  JavaThread* current = JavaThread::current();
+  ThreadInVMfromNative tivfn(current);
+
+  Semaphore post;
+  Semaphore started;
+  volatile bool stop = true;
+  HandshakeTestThread* done = new HandshakeTestThread(&post, &started, &stop);
+  done->doit();
+  post.wait_with_safepoint_check(current);
+  wait_until_exited(done);
+
+  JavaThread* targets[] = { done };
+  volatile int executed[1] = {};
+  ThreadsListHandle tlh;
+  CountingHandshakeClosure cl(targets, 1, executed);
+  // Returns without waiting when none of the targets is alive
+  Handshake::execute(&cl, &tlh, targets, 1);
+  EXPECT_EQ(0, executed[0]);
+}
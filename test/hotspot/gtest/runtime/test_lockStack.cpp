@@ -425,3 +425,34 @@ TEST_VM_F(LockStackTest, remove) {
 
   EXPECT_TRUE(ls.is_empty());
 }
+
+TEST_VM_F(LockStackTest, is_full) {
+  if (LockingMode != LM_LIGHTWEIGHT) {
+    return;
+  }
+
+  JavaThread* THREAD = JavaThread::current();
+  // the thread should be in vm to use locks
+  ThreadInVMfromNative ThreadInVMfromNative(THREAD);
+
+  LockStack& ls = THREAD->lock_stack();
+
+  EXPECT_TRUE(ls.is_empty());
+  EXPECT_LE(LockStack::capacity(), LockStack::CAPACITY);
+  EXPECT_EQ(LockStack::end_offset() - LockStack::start_offset(), (uint32_t)(LockStack::capacity() * oopSize));
+
+  oop obj = Universe::int_mirror();
+
+  for (int i = 0; i < LockStack::capacity(); i++) {
+    EXPECT_FALSE(ls.is_full());
+    push_raw(ls, obj);
+  }
+  EXPECT_TRUE(ls.is_full());
+
+  // Clear stack
+  for (int i = 0; i < LockStack::capacity(); i++) {
+    pop_raw(ls);
+  }
+
+  EXPECT_TRUE(ls.is_empty());
+}
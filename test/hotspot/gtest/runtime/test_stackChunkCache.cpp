@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "runtime/stackChunkCache.inline.hpp"
+#include "unittest.hpp"
+
+TEST(StackChunkCache, presize_first_request) {
+  StackChunkCache cache;
+  EXPECT_EQ(300, cache.presize(300));
+}
+
+TEST(StackChunkCache, presize_grows_immediately) {
+  StackChunkCache cache;
+  EXPECT_EQ(300, cache.presize(300));
+  EXPECT_EQ(1000, cache.presize(1000));
+  EXPECT_EQ(2000, cache.presize(2000));
+}
+
+TEST(StackChunkCache, presize_decays) {
+  StackChunkCache cache;
+  EXPECT_EQ(1000, cache.presize(1000));
+  // The hint loses an eighth of itself per request, but never goes below the request
+  EXPECT_EQ(875, cache.presize(300));
+  EXPECT_EQ(766, cache.presize(300));
+  for (int i = 0; i < 100; i++) {
+    cache.presize(300);
+  }
+  EXPECT_EQ(300, cache.presize(300));
+}
+
+TEST(StackChunkCache, presize_ignores_uncacheable_sizes) {
+  StackChunkCache cache;
+  const int max_cacheable = (1 << (StackChunkCache::MinSizeClassLog + StackChunkCache::NumSizeClasses)) - 1;
+  EXPECT_EQ(1000, cache.presize(1000));
+  // A request too large for the cache is returned as is and not recorded
+  EXPECT_EQ(max_cacheable + 1, cache.presize(max_cacheable + 1));
+  EXPECT_EQ(875, cache.presize(300));
+  EXPECT_EQ(max_cacheable, cache.presize(max_cacheable));
+}
@@ -23,6 +23,7 @@
 
 #include "precompiled.hpp"
 #include "memory/allocation.hpp"
+#include "memory/memRegion.hpp"
 #include "utilities/objectBitSet.inline.hpp"
 #include "unittest.hpp"
 
@@ -64,3 +65,15 @@ TEST_VM(ObjectBitSet, mark_multi) {
   ASSERT_TRUE(obs.is_marked(&obj1));
   ASSERT_TRUE(obs.is_marked(&obj2));
 }
+
+TEST_VM(ObjectBitSet, par_mark) {
+  ObjectBitSet<mtTracing> obs;
+  oopDesc objs[2];
+  obs.mark_obj(&objs[0]);
+  obs.initialize_parallel(MemRegion((HeapWord*)&objs[0], (HeapWord*)&objs[2]));
+  ASSERT_FALSE(obs.par_mark_obj(&objs[0]));
+  ASSERT_TRUE(obs.par_mark_obj(&objs[1]));
+  ASSERT_FALSE(obs.par_mark_obj(&objs[1]));
+  ASSERT_TRUE(obs.is_marked(&objs[0]));
+  ASSERT_TRUE(obs.is_marked(&objs[1]));
+}
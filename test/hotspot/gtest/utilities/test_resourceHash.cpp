@@ -467,10 +467,14 @@ TEST_VM_F(ResourceHashtablePrintTest, print_test) {
   ts.print(&st, "TestTable");
   // Verify output in string
   const char* strings[] = {
-      "Number of buckets", "Number of entries", "300", "Number of literals", "Average bucket size", "Maximum bucket size" };
+      "Number of buckets", "Number of entries", "300", "Number of literals", "Average bucket size", "Maximum bucket size",
+      "Average probe length", "Bucket size histogram" };
   for (const auto& str : strings) {
     ASSERT_THAT(st.base(), testing::HasSubstr(str));
   }
+  // The 300 consecutive keys are spread evenly over the 30 buckets.
+  ASSERT_EQ(ts._bucket_sizes._counts[TableBucketSizes::MaxCounted], 30u);
+  ASSERT_EQ(ts._bucket_sizes._probes, 30u * (10 * 11 / 2));
   // Cleanup: need to delete pointers in entries
   TableDeleter deleter;
   _test_table.unlink(&deleter);
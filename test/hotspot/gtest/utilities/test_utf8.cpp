@@ -205,3 +205,36 @@ TEST_VM(utf8, truncation) {
 
 
 }
+
+TEST_VM(utf8, is_legal_utf8_word_scan) {
+
+  // The ASCII runs are scanned a word at a time, so check that a zero or
+  // an illegal byte is found at every position of a longer buffer.
+
+  unsigned char buf[40];
+  for (size_t len = 0; len <= sizeof(buf); len++) {
+    ::memset(buf, 'a', sizeof(buf));
+    EXPECT_TRUE(UTF8::is_legal_utf8(buf, len, false));
+    for (size_t i = 0; i < len; i++) {
+      buf[i] = 0;
+      EXPECT_FALSE(UTF8::is_legal_utf8(buf, len, false)) << "zero at " << i;
+      buf[i] = 0x80;
+      EXPECT_FALSE(UTF8::is_legal_utf8(buf, len, false)) << "0x80 at " << i;
+      buf[i] = 'a';
+    }
+  }
+
+  // A 2-byte encoding, N with tilde, at every position
+  for (size_t i = 0; i + 1 < sizeof(buf); i++) {
+    ::memset(buf, 'a', sizeof(buf));
+    buf[i] = 0xC3;
+    buf[i + 1] = 0x91;
+    EXPECT_TRUE(UTF8::is_legal_utf8(buf, sizeof(buf), false)) << "at " << i;
+    bool is_latin1;
+    bool has_multibyte;
+    EXPECT_EQ(UTF8::unicode_length((const char*)buf, sizeof(buf), is_latin1, has_multibyte),
+              (int)sizeof(buf) - 1) << "at " << i;
+    EXPECT_TRUE(is_latin1);
+    EXPECT_TRUE(has_multibyte);
+  }
+}
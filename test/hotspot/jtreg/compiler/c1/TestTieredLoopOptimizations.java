@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check results of C1 range check elimination and loop invariant code motion
+ *          in profiled tiers, including deoptimization on failed assumptions.
+ * @requires vm.compiler1.enabled
+ * @run main/othervm -Xbatch -XX:+UnlockExperimentalVMOptions -XX:+C1TieredLoopOptimizations
+ *                   -XX:TieredStopAtLevel=3 compiler.c1.TestTieredLoopOptimizations
+ * @run main/othervm -Xbatch -XX:+UnlockExperimentalVMOptions -XX:+C1TieredLoopOptimizations
+ *                   -XX:TieredStopAtLevel=2 compiler.c1.TestTieredLoopOptimizations
+ */
+
+package compiler.c1;
+
+public class TestTieredLoopOptimizations {
+
+    static class Holder {
+        int[] values;
+        int scale;
+    }
+
+    // holder.values, holder.scale and the array length are loop invariant.
+    static long sum(Holder holder, int from, int to) {
+        long sum = 0;
+        for (int i = from; i < to; i++) {
+            sum += holder.values[i] * holder.scale;
+        }
+        return sum;
+    }
+
+    public static void main(String[] args) {
+        Holder holder = new Holder();
+        holder.values = new int[1000];
+        holder.scale = 3;
+        for (int i = 0; i < holder.values.length; i++) {
+            holder.values[i] = i;
+        }
+        long expected = 3L * 999 * 1000 / 2;
+
+        for (int iter = 0; iter < 20_000; iter++) {
+            long s = sum(holder, 0, holder.values.length);
+            if (s != expected) {
+                throw new RuntimeException("Wrong sum: " + s + " != " + expected);
+            }
+        }
+
+        // The hoisted range check fails, so the code deoptimizes and the
+        // interpreter throws.
+        try {
+            sum(holder, 0, holder.values.length + 1);
+            throw new RuntimeException("Expected AIOOBE");
+        } catch (ArrayIndexOutOfBoundsException e) {
+            // expected
+        }
+        try {
+            sum(new Holder(), 0, 10);
+            throw new RuntimeException("Expected NPE");
+        } catch (NullPointerException e) {
+            // expected
+        }
+        for (int iter = 0; iter < 20_000; iter++) {
+            long s = sum(holder, 0, holder.values.length);
+            if (s != expected) {
+                throw new RuntimeException("Wrong sum after deoptimization: " + s + " != " + expected);
+            }
+        }
+    }
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check that objects escaping only on rarely taken branches are correctly
+ *          reallocated when RareBranchProbability turns these branches into traps.
+ * @requires vm.compiler2.enabled
+ * @run main/othervm -Xbatch -XX:+UnlockExperimentalVMOptions -XX:RareBranchProbability=0.01
+ *                   -XX:CompileCommand=compileonly,compiler.escapeAnalysis.TestRareBranchEscape::parse
+ *                   compiler.escapeAnalysis.TestRareBranchEscape
+ */
+
+package compiler.escapeAnalysis;
+
+public class TestRareBranchEscape {
+
+    static final class Token {
+        final int value;
+        final int pos;
+
+        Token(int value, int pos) {
+            this.value = value;
+            this.pos = pos;
+        }
+    }
+
+    static Token lastError;
+
+    static int parse(int x) {
+        Token t = new Token(x * 3, x);
+        if ((x & 1023) == 1023) {
+            // Rare error path: the token escapes.
+            lastError = t;
+            return -1;
+        }
+        return t.value + t.pos;
+    }
+
+    public static void main(String[] args) {
+        for (int iter = 0; iter < 200_000; iter++) {
+            int r = parse(iter);
+            if ((iter & 1023) == 1023) {
+                if (r != -1 || lastError == null || lastError.pos != iter || lastError.value != iter * 3) {
+                    throw new RuntimeException("Wrong error token at " + iter);
+                }
+            } else if (r != iter * 4) {
+                throw new RuntimeException("Wrong result at " + iter + ": " + r);
+            }
+        }
+    }
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check that the two major receivers of a polymorphic call site are inlined
+ *          with TypeProfileTwoMajorReceiversPercent.
+ * @requires vm.compiler2.enabled & vm.flavor == "server" & vm.opt.TypeProfileWidth == null
+ * @library /test/lib
+ * @run driver compiler.inlining.TestTwoMajorReceivers
+ */
+
+package compiler.inlining;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestTwoMajorReceivers {
+
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer output = ProcessTools.executeTestJava(
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:TypeProfileTwoMajorReceiversPercent=90",
+            "-XX:-TieredCompilation",
+            "-XX:CompileCommand=compileonly,compiler.inlining.TestTwoMajorReceivers$Launcher::test",
+            "-XX:CompileCommand=quiet",
+            "-XX:+PrintInlining",
+            "-Xbatch",
+            Launcher.class.getName());
+        output.shouldHaveExitValue(0);
+        output.shouldMatch("TestTwoMajorReceivers\\$B::get .*inline \\(hot\\)");
+        output.shouldMatch("TestTwoMajorReceivers\\$C::get .*inline \\(hot\\)");
+        output.shouldNotMatch("TestTwoMajorReceivers\\$D::get .*inline \\(hot\\)");
+    }
+
+    static abstract class A {
+        abstract int get();
+    }
+
+    static class B extends A {
+        int get() { return 1; }
+    }
+
+    static class C extends A {
+        int get() { return 2; }
+    }
+
+    static class D extends A {
+        int get() { return 3; }
+    }
+
+    static class Launcher {
+        static int test(A a) {
+            return a.get();
+        }
+
+        public static void main(String[] args) {
+            A[] receivers = new A[100];
+            for (int i = 0; i < receivers.length; i++) {
+                // 60% B, 35% C, 5% D
+                receivers[i] = i < 60 ? new B() : (i < 95 ? new C() : new D());
+            }
+            int sum = 0;
+            for (int i = 0; i < 100_000; i++) {
+                sum += test(receivers[i % receivers.length]);
+            }
+            System.out.println(sum);
+        }
+    }
+}
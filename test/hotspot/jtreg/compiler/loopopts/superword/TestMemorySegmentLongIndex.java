@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check results of loops over MemorySegments with long indices, which SuperWord
+ *          may vectorize in the int inner loop of the long counted loop nest.
+ * @run main/othervm -Xbatch -XX:CompileCommand=compileonly,compiler.loopopts.superword.TestMemorySegmentLongIndex::test*
+ *                   compiler.loopopts.superword.TestMemorySegmentLongIndex
+ * @run main/othervm -Xbatch -XX:-UseSuperWord
+ *                   compiler.loopopts.superword.TestMemorySegmentLongIndex
+ */
+
+package compiler.loopopts.superword;
+
+import java.lang.foreign.Arena;
+import java.lang.foreign.MemorySegment;
+import java.lang.foreign.ValueLayout;
+
+public class TestMemorySegmentLongIndex {
+
+    static final int SIZE = 10_000;
+
+    static void testCopyAdd(MemorySegment a, MemorySegment b, long n) {
+        for (long i = 0; i < n; i++) {
+            long v = a.getAtIndex(ValueLayout.JAVA_INT, i);
+            b.setAtIndex(ValueLayout.JAVA_INT, i, (int)(v + 42));
+        }
+    }
+
+    static long testSum(MemorySegment a, long n) {
+        long sum = 0;
+        for (long i = 0; i < n; i++) {
+            sum += a.getAtIndex(ValueLayout.JAVA_LONG, i);
+        }
+        return sum;
+    }
+
+    public static void main(String[] args) {
+        try (Arena arena = Arena.ofConfined()) {
+            MemorySegment ints = arena.allocate(SIZE * 4L);
+            MemorySegment out = arena.allocate(SIZE * 4L);
+            MemorySegment longs = arena.allocate(SIZE * 8L);
+            long expectedSum = 0;
+            for (int i = 0; i < SIZE; i++) {
+                ints.setAtIndex(ValueLayout.JAVA_INT, i, i * 3);
+                longs.setAtIndex(ValueLayout.JAVA_LONG, i, i * 7L);
+                expectedSum += i * 7L;
+            }
+
+            for (int iter = 0; iter < 20_000; iter++) {
+                long n = SIZE - (iter & 7);
+                testCopyAdd(ints, out, n);
+                for (int i = 0; i < n; i++) {
+                    int r = out.getAtIndex(ValueLayout.JAVA_INT, i);
+                    if (r != i * 3 + 42) {
+                        throw new RuntimeException("Wrong value at " + i + ": " + r);
+                    }
+                }
+                long sum = testSum(longs, n);
+                long expected = expectedSum;
+                for (long i = n; i < SIZE; i++) {
+                    expected -= i * 7L;
+                }
+                if (sum != expected) {
+                    throw new RuntimeException("Wrong sum: " + sum + " != " + expected);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check that DumpHotMethodsFile writes CompileCommands that can be read back.
+ * @requires vm.compiler2.enabled & vm.flavor == "server"
+ * @library /test/lib
+ * @run driver compiler.oracle.TestDumpHotMethods
+ */
+
+package compiler.oracle;
+
+import java.io.File;
+import java.nio.file.Files;
+import java.util.List;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestDumpHotMethods {
+
+    public static void main(String[] args) throws Exception {
+        File file = new File("hot_methods.txt");
+
+        OutputAnalyzer output = ProcessTools.executeTestJava(
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:DumpHotMethodsFile=" + file.getPath(),
+            "-XX:DumpHotMethodsThresholdScaling=0.5",
+            "-Xbatch",
+            "-Xlog:jit+compilation=info",
+            Hot.class.getName());
+        output.shouldHaveExitValue(0);
+        output.shouldContain("hot methods to " + file.getPath());
+
+        List<String> lines = Files.readAllLines(file.toPath());
+        String expected = "CompileThresholdScaling,compiler/oracle/TestDumpHotMethods$Hot.compute(I)I,0.5";
+        boolean found = lines.stream().anyMatch(l -> l.startsWith(expected));
+        if (!found) {
+            throw new RuntimeException("Missing \"" + expected + "\" in " + lines);
+        }
+
+        // The file must be accepted as a CompileCommandFile.
+        output = ProcessTools.executeTestJava(
+            "-XX:CompileCommandFile=" + file.getPath(),
+            "-XX:CompileCommand=quiet",
+            Hot.class.getName());
+        output.shouldHaveExitValue(0);
+        output.shouldNotContain("CompileCommand: An error occurred");
+    }
+
+    static class Hot {
+        static int compute(int x) {
+            int r = 0;
+            for (int i = 0; i < x; i++) {
+                r += i ^ x;
+            }
+            return r;
+        }
+
+        public static void main(String[] args) {
+            int sum = 0;
+            for (int i = 0; i < 100_000; i++) {
+                sum += compute(i & 0xff);
+            }
+            System.out.println(sum);
+        }
+    }
+}
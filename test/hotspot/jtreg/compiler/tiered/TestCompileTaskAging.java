@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Sanity test of compile queue aging with many concurrently hot methods.
+ * @requires vm.compMode != "Xint" & vm.opt.TieredStopAtLevel == null
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:TieredCompileTaskAgingMillis=1
+ *                   -XX:CICompilerCount=2 compiler.tiered.TestCompileTaskAging
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:TieredCompileTaskAgingMillis=1000
+ *                   -XX:CICompilerCount=2 -XX:-BackgroundCompilation compiler.tiered.TestCompileTaskAging
+ */
+
+package compiler.tiered;
+
+public class TestCompileTaskAging {
+
+    static int a(int x) { return x * 31 + 7; }
+    static int b(int x) { return (x ^ 0x5bd1e995) >>> 3; }
+    static int c(int x) { return Integer.rotateLeft(x, 5) - x; }
+    static int d(int x) { return x % 17 == 0 ? a(x) : b(x); }
+    static int e(int x) { return c(x) + d(x); }
+
+    static long loop(int n) {
+        long sum = 0;
+        for (int i = 0; i < n; i++) {
+            sum += e(i) ^ a(i);
+        }
+        return sum;
+    }
+
+    public static void main(String[] args) {
+        // Methods getting hot at the same time compete for the compile queue.
+        long sum = 0;
+        for (int round = 0; round < 20_000; round++) {
+            sum += loop(100);
+        }
+        System.out.println(sum);
+    }
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check that compilations report their CPU time, and that throttling the
+ *          compiler threads with CompilerCPUPercent still compiles hot methods.
+ * @requires vm.hasJFR & vm.compMode != "Xint"
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:CompilerCPUPercent=10
+ *                   compiler.tiered.TestCompilerCPUPercent
+ */
+
+package compiler.tiered;
+
+import java.nio.file.Path;
+import java.util.List;
+
+import jdk.jfr.Recording;
+import jdk.jfr.consumer.RecordedEvent;
+import jdk.jfr.consumer.RecordingFile;
+
+public class TestCompilerCPUPercent {
+
+    static int hot(int x) {
+        return (x * 31 + 7) ^ (x >>> 3);
+    }
+
+    public static void main(String[] args) throws Exception {
+        try (Recording recording = new Recording()) {
+            recording.enable("jdk.Compilation").withThreshold(java.time.Duration.ZERO);
+            recording.start();
+            long sum = 0;
+            for (int i = 0; i < 1_000_000; i++) {
+                sum += hot(i);
+            }
+            System.out.println(sum);
+            recording.stop();
+
+            Path file = Path.of("compilations.jfr");
+            recording.dump(file);
+            List<RecordedEvent> events = RecordingFile.readAllEvents(file);
+            if (events.isEmpty()) {
+                throw new RuntimeException("No compilation events");
+            }
+            for (RecordedEvent e : events) {
+                if (e.getDuration("cpuTime").isNegative()) {
+                    throw new RuntimeException("Negative CPU time: " + e);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Run virtual threads that are repeatedly thawed into interpreted and
+ *          profiled frames with Tier0ThawWeight.
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:Tier0ThawWeight=1024
+ *                   compiler.tiered.TestThawWeight
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:Tier0ThawWeight=1024
+ *                   -XX:TieredStopAtLevel=3 compiler.tiered.TestThawWeight
+ */
+
+package compiler.tiered;
+
+import java.util.ArrayList;
+import java.util.List;
+
+public class TestThawWeight {
+
+    static final int THREADS = 50;
+    static final int ITERATIONS = 2_000;
+
+    // Yields in the middle of a loop, so the frame of this method is frozen
+    // and thawed on every iteration.
+    static long work(int seed) {
+        long sum = 0;
+        for (int i = 0; i < ITERATIONS; i++) {
+            sum += (long)seed * i;
+            Thread.yield();
+        }
+        return sum;
+    }
+
+    public static void main(String[] args) throws Exception {
+        List<Thread> threads = new ArrayList<>();
+        long[] results = new long[THREADS];
+        for (int t = 0; t < THREADS; t++) {
+            final int seed = t;
+            threads.add(Thread.ofVirtual().start(() -> results[seed] = work(seed)));
+        }
+        for (Thread t : threads) {
+            t.join();
+        }
+        long expected = (long)ITERATIONS * (ITERATIONS - 1) / 2;
+        for (int t = 0; t < THREADS; t++) {
+            if (results[t] != t * expected) {
+                throw new RuntimeException("Thread " + t + ": " + results[t] + " != " + t * expected);
+            }
+        }
+    }
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check that methods above Tier4MaxBytecodeSize are only compiled at tier 1.
+ * @requires vm.compiler1.enabled & vm.compiler2.enabled & vm.flavor == "server"
+ * @requires vm.opt.TieredStopAtLevel == null & vm.opt.CompilationMode == null
+ * @library /test/lib
+ * @run driver compiler.tiered.TestTier4MaxBytecodeSize
+ */
+
+package compiler.tiered;
+
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestTier4MaxBytecodeSize {
+
+    static final Pattern BIG = Pattern.compile("(\\d)\\s+compiler\\.tiered\\.TestTier4MaxBytecodeSize\\$Hot::big ");
+    static final Pattern SMALL = Pattern.compile("(\\d)\\s+compiler\\.tiered\\.TestTier4MaxBytecodeSize\\$Hot::small ");
+
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer output = ProcessTools.executeTestJava(
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:Tier4MaxBytecodeSize=40",
+            "-XX:-UseOnStackReplacement",
+            "-XX:-BackgroundCompilation",
+            "-XX:+PrintCompilation",
+            Hot.class.getName());
+        output.shouldHaveExitValue(0);
+
+        String bigLevels = levels(BIG, output.getStdout());
+        if (!bigLevels.equals("1")) {
+            throw new RuntimeException("Expected big() to be compiled at tier 1 only, got levels: " + bigLevels);
+        }
+        String smallLevels = levels(SMALL, output.getStdout());
+        if (!smallLevels.contains("4")) {
+            throw new RuntimeException("Expected small() to be compiled at tier 4, got levels: " + smallLevels);
+        }
+    }
+
+    static String levels(Pattern pattern, String out) {
+        StringBuilder sb = new StringBuilder();
+        Matcher m = pattern.matcher(out);
+        while (m.find()) {
+            if (sb.indexOf(m.group(1)) < 0) {
+                sb.append(m.group(1));
+            }
+        }
+        return sb.toString();
+    }
+
+    static class Hot {
+        // More than 40 bytes of bytecode.
+        static int big(int x) {
+            int r = x;
+            r = r * 31 + 7;
+            r = (r ^ 0x5bd1e995) >>> 3;
+            r = Integer.rotateLeft(r, 5) - x;
+            r = r % 17 == 0 ? r + 11 : r - 13;
+            r += (x & 0xff) * (x >>> 24);
+            r ^= r >>> 16;
+            return r;
+        }
+
+        static int small(int x) {
+            return x * 31 + 7;
+        }
+
+        public static void main(String[] args) {
+            int sum = 0;
+            for (int i = 0; i < 200_000; i++) {
+                sum += big(i) + small(i);
+            }
+            System.out.println(sum);
+        }
+    }
+}
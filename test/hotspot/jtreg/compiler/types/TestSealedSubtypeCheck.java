@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check instanceof and checkcast results on sealed hierarchies with
+ *          OptimizeSealedSubtypeChecks, including a non-sealed subclass that is
+ *          extended at run time.
+ * @requires vm.compiler2.enabled
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:+UnlockExperimentalVMOptions
+ *                   -XX:+OptimizeSealedSubtypeChecks compiler.types.TestSealedSubtypeCheck
+ */
+
+package compiler.types;
+
+public class TestSealedSubtypeCheck {
+
+    interface Tagged {}
+
+    sealed interface Expr permits Const, Add, Node {}
+    record Const(int value) implements Expr {}
+    record Add(Expr left, Expr right) implements Expr {}
+    static non-sealed class Node implements Expr {}
+
+    static abstract sealed class Shape permits Circle, Square {}
+    static final class Circle extends Shape {}
+    static final class Square extends Shape {}
+
+    static class Other {}
+    static class TaggedNode extends Node implements Tagged {}
+
+    static int eval(Expr e) {
+        if (e instanceof Const c) {
+            return c.value();
+        } else if (e instanceof Add a) {
+            return eval(a.left()) + eval(a.right());
+        }
+        return 0;
+    }
+
+    // Never true: no class in the hierarchy of Expr extends Other.
+    static boolean isOther(Expr e) {
+        return ((Object)e) instanceof Other;
+    }
+
+    // May be true through the non-sealed Node.
+    static boolean isTagged(Expr e) {
+        return e instanceof Tagged;
+    }
+
+    static boolean isCharSequence(Expr e) {
+        return ((Object)e) instanceof CharSequence;
+    }
+
+    // Never true: Circle and Square are final and implement no interface.
+    static boolean isRunnable(Shape s) {
+        return ((Object)s) instanceof Runnable;
+    }
+
+    static boolean isOther(Shape s) {
+        return ((Object)s) instanceof Other;
+    }
+
+    public static void main(String[] args) {
+        Expr tree = new Add(new Const(1), new Add(new Const(2), new Node()));
+        for (int i = 0; i < 20_000; i++) {
+            check(eval(tree) == 3, "eval");
+            check(!isOther(tree), "isOther");
+            check(!isTagged(tree), "isTagged");
+            check(!isCharSequence(tree), "isCharSequence");
+            Shape s = (i & 1) == 0 ? new Circle() : new Square();
+            check(!isRunnable(s), "isRunnable");
+            check(!isOther(s), "isOther(Shape)");
+        }
+        Expr tagged = new TaggedNode();
+        for (int i = 0; i < 20_000; i++) {
+            check(isTagged(tagged), "isTagged(TaggedNode)");
+            check(!isOther(tagged), "isOther(TaggedNode)");
+            check(eval(new Add(tree, tagged)) == 3, "eval(TaggedNode)");
+        }
+    }
+
+    static void check(boolean b, String what) {
+        if (!b) {
+            throw new RuntimeException(what + " failed");
+        }
+    }
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check that deoptimization storms are detected and end again.
+ * @requires vm.compiler2.enabled & vm.flavor == "server"
+ * @library /test/lib
+ * @run driver compiler.uncommontrap.TestDeoptimizationStorm
+ */
+
+package compiler.uncommontrap;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestDeoptimizationStorm {
+
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer output = ProcessTools.executeTestJava(
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:DeoptimizationStormThreshold=1",
+            "-Xlog:deoptimization=info",
+            "-XX:-BackgroundCompilation",
+            Trapper.class.getName());
+        output.shouldHaveExitValue(0);
+        output.shouldContain("Deoptimization storm started");
+        output.shouldContain("Deoptimization storm ended");
+    }
+
+    static class Trapper {
+        static int test(boolean flag) {
+            if (flag) {
+                return 1;
+            }
+            return 0;
+        }
+
+        public static void main(String[] args) throws Exception {
+            int sum = 0;
+            for (int i = 0; i < 100_000; i++) {
+                sum += test(false);
+            }
+            // Hits the uncommon trap of the never taken branch.
+            sum += test(true);
+
+            // Keep the method hot so that its recompilation is requested
+            // while the storm lasts and after it ended.
+            long end = System.currentTimeMillis() + 3_000;
+            while (System.currentTimeMillis() < end) {
+                for (int i = 0; i < 10_000; i++) {
+                    sum += test((i & 1) == 0);
+                }
+                Thread.sleep(10);
+            }
+            System.out.println(sum);
+        }
+    }
+}
@@ -42,6 +42,17 @@
  * @run main/native/othervm -Xmx256m gc.cslocker.TestCSLocker
  */
 
+/*
+ * @test TestCSLockerPinOldObjects
+ * @summary Same as TestCSLocker, with counted pinning of old objects in
+ * @summary Parallel GC; young arrays must still lock out collections.
+ * @requires vm.gc.Parallel
+ * @library /
+ * @run main/native/othervm -Xmx256m -XX:+UseParallelGC
+ *      -XX:+UnlockExperimentalVMOptions -XX:+ParallelPinOldObjects
+ *      gc.cslocker.TestCSLocker
+ */
+
 public class TestCSLocker extends Thread
 {
     static int timeoutMillis = 5000;
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test TestDirtyCardFilter
+ * @summary Check that remembered sets stay complete when duplicate cards are
+ *          removed from full update buffers.
+ * @requires vm.gc.G1
+ * @run main/othervm -XX:+UseG1GC -Xmx128m -XX:G1HeapRegionSize=1m
+ *      -XX:+UnlockExperimentalVMOptions -XX:G1DirtyCardFilterSize=512
+ *      -XX:+UnlockDiagnosticVMOptions -XX:+VerifyBeforeGC -XX:+VerifyAfterGC
+ *      gc.g1.TestDirtyCardFilter
+ * @run main/othervm -XX:+UseG1GC -Xmx128m -XX:G1HeapRegionSize=1m
+ *      -XX:+UnlockExperimentalVMOptions -XX:G1DirtyCardFilterSize=1 -XX:G1UpdateBufferSize=16
+ *      -XX:+UnlockDiagnosticVMOptions -XX:+VerifyBeforeGC -XX:+VerifyAfterGC
+ *      gc.g1.TestDirtyCardFilter
+ */
+
+public class TestDirtyCardFilter {
+
+    static final int SLOTS = 64 * 1024;
+
+    public static void main(String[] args) {
+        Object[] holder = new Object[SLOTS];
+        System.gc(); // move the holder into the old generation
+
+        for (int round = 0; round < 20; round++) {
+            // Repeatedly store young objects into a few old cards, so that
+            // the same cards are enqueued many times.
+            for (int i = 0; i < 200_000; i++) {
+                int slot = (i * 31) % 256 + (i % 4) * (SLOTS / 4);
+                holder[slot] = new long[] { i };
+            }
+            // Also spread stores over the whole array.
+            for (int i = 0; i < SLOTS; i++) {
+                holder[i] = new int[1];
+            }
+            if (round % 5 == 4) {
+                System.gc();
+            }
+        }
+
+        for (int i = 0; i < SLOTS; i++) {
+            if (!(holder[i] instanceof int[])) {
+                throw new RuntimeException("Lost element " + i);
+            }
+        }
+    }
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+package gc.g1;
+
+/*
+ * @test TestHumongousCompactionOnFragmentation
+ * @summary Test that a regular full GC moves humongous objects when they
+ *          fragment the heap and G1HumongousCompactionFragmentationPercent is set.
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @run driver gc.g1.TestHumongousCompactionOnFragmentation
+ */
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestHumongousCompactionOnFragmentation {
+
+    private static OutputAnalyzer run(String percent) throws Exception {
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava("-XX:+UseG1GC",
+                                                                    "-XX:+UnlockExperimentalVMOptions",
+                                                                    "-XX:G1HumongousCompactionFragmentationPercent=" + percent,
+                                                                    "-Xmx32m",
+                                                                    "-Xms32m",
+                                                                    "-XX:G1HeapRegionSize=1m",
+                                                                    "-Xlog:gc+phases=debug",
+                                                                    GCTest.class.getName());
+        output.shouldHaveExitValue(0);
+        return output;
+    }
+
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer output = run("10");
+        output.shouldContain("Humongous fragmentation:");
+        output.shouldContain("Phase 2: Prepare humongous compaction");
+
+        // Disabled by default, regular full GCs do not move humongous objects.
+        output = run("0");
+        output.shouldNotContain("Humongous fragmentation:");
+        output.shouldNotContain("Phase 2: Prepare humongous compaction");
+    }
+
+    static class GCTest {
+        static Object[] humongous = new Object[12];
+
+        public static void main(String[] args) {
+            // Interleave humongous objects and drop every other one, so the
+            // survivors are spread over the heap.
+            for (int i = 0; i < humongous.length; i++) {
+                humongous[i] = new byte[768 * 1024];
+            }
+            for (int i = 0; i < humongous.length; i += 2) {
+                humongous[i] = null;
+            }
+            System.gc();
+            System.out.println("Done");
+        }
+    }
+}
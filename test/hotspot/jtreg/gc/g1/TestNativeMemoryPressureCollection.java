@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/**
+ * @test TestNativeMemoryPressureCollection
+ * @requires vm.gc.G1
+ * @summary Verify that growing direct buffer memory starts a concurrent cycle
+ * @library /test/lib /
+ * @modules java.base/jdk.internal.misc
+ * @run driver gc.g1.TestNativeMemoryPressureCollection
+ */
+
+import java.nio.ByteBuffer;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestNativeMemoryPressureCollection {
+
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava("-XX:+UseG1GC",
+                                                                    "-XX:+UnlockExperimentalVMOptions",
+                                                                    "-XX:NativeMemoryTracking=summary",
+                                                                    "-XX:NativeMemoryPressureGCThreshold=16M",
+                                                                    "-Xlog:gc",
+                                                                    "-Xmx64M",
+                                                                    GCTest.class.getName());
+
+        output.shouldContain("Pause Young (Concurrent Start) (Native Memory Pressure)");
+        output.shouldHaveExitValue(0);
+
+        // Without native memory tracking there is no signal.
+        output = ProcessTools.executeLimitedTestJava("-XX:+UseG1GC",
+                                                     "-XX:+UnlockExperimentalVMOptions",
+                                                     "-XX:NativeMemoryPressureGCThreshold=16M",
+                                                     "-Xlog:gc",
+                                                     "-Xmx64M",
+                                                     GCTest.class.getName());
+
+        output.shouldNotContain("(Native Memory Pressure)");
+        output.shouldHaveExitValue(0);
+    }
+
+    static class GCTest {
+        // Keep the buffers reachable so they are not freed before the check.
+        static ByteBuffer[] buffers = new ByteBuffer[64];
+
+        public static void main(String [] args) throws Exception {
+            for (int i = 0; i < buffers.length; i++) {
+                buffers[i] = ByteBuffer.allocateDirect(1024 * 1024);
+            }
+            // The service thread checks for native memory pressure once a second.
+            Thread.sleep(3000);
+            System.out.println("Done");
+        }
+    }
+}
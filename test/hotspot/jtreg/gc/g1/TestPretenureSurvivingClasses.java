@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test TestPretenureSurvivingClasses
+ * @summary Check that G1 pretenures objects of classes that always survive young collections.
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @build jdk.test.whitebox.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller jdk.test.whitebox.WhiteBox
+ * @run driver gc.g1.TestPretenureSurvivingClasses
+ */
+
+import jdk.test.whitebox.WhiteBox;
+
+import java.util.ArrayList;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestPretenureSurvivingClasses {
+
+    private static OutputAnalyzer runTest(String percent) throws Exception {
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava(
+            "-Xbootclasspath/a:.",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+WhiteBoxAPI",
+            "-XX:+UseG1GC",
+            "-Xms128M",
+            "-Xmx128M",
+            "-XX:G1PretenureSurvivalPercent=" + percent,
+            "-XX:+VerifyAfterGC",
+            "-Xlog:gc+age=debug",
+            GCTest.class.getName());
+
+        output.shouldHaveExitValue(0);
+        System.out.println(output.getStdout());
+        return output;
+    }
+
+    public static void main(String[] args) throws Exception {
+        String survivor = "pretenuring objects of " + GCTest.Survivor.class.getName();
+        String garbage = "pretenuring objects of " + GCTest.Garbage.class.getName();
+
+        OutputAnalyzer output = runTest("90");
+        output.shouldContain("Start " + survivor);
+        output.shouldNotContain(garbage);
+
+        output = runTest("0");
+        output.shouldNotContain(survivor);
+    }
+
+    static class GCTest {
+        private static final WhiteBox WB = WhiteBox.getWhiteBox();
+
+        static class Survivor {
+            long value;
+            Survivor(long value) { this.value = value; }
+        }
+
+        static class Garbage {
+            long value;
+            Garbage(long value) { this.value = value; }
+        }
+
+        public static ArrayList<Survivor> holder = new ArrayList<>();
+        public static Object sink;
+
+        public static void main(String [] args) {
+            for (int round = 0; round < 10; round++) {
+                ArrayList<Garbage> garbage = new ArrayList<>();
+                for (int i = 0; i < 10000; i++) {
+                    holder.add(new Survivor(i));
+                    garbage.add(new Garbage(i));
+                }
+                // Keep the garbage alive across one young collection only.
+                sink = garbage;
+                WB.youngGC();
+            }
+            long sum = 0;
+            for (Survivor s : holder) {
+                sum += s.value;
+            }
+            System.out.println(sum);
+        }
+    }
+}
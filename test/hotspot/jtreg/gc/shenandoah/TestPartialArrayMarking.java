@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+/* @test id=passive
+ * @summary Test that large object arrays are marked completely with ShenandoahMarkPartialArrays
+ * @requires vm.gc.Shenandoah
+ *
+ * @run main/othervm -XX:+UnlockDiagnosticVMOptions -XX:+UnlockExperimentalVMOptions -Xmx512m
+ *      -XX:+UseShenandoahGC -XX:ShenandoahGCMode=passive
+ *      -XX:+ShenandoahMarkPartialArrays -XX:+ShenandoahVerify
+ *      TestPartialArrayMarking
+ */
+
+/* @test id=aggressive
+ * @summary Test that large object arrays are marked completely with ShenandoahMarkPartialArrays
+ * @requires vm.gc.Shenandoah
+ *
+ * @run main/othervm -XX:+UnlockDiagnosticVMOptions -XX:+UnlockExperimentalVMOptions -Xmx512m
+ *      -XX:+UseShenandoahGC -XX:ShenandoahGCHeuristics=aggressive
+ *      -XX:+ShenandoahMarkPartialArrays -XX:ParallelGCThreads=4
+ *      TestPartialArrayMarking
+ */
+
+public class TestPartialArrayMarking {
+
+    static final int LENGTH = 4 * 1024 * 1024 + 17; // not a multiple of the chunk size
+    static final int ROUNDS = 10;
+
+    public static void main(String[] args) throws Exception {
+        Integer[] array = new Integer[LENGTH];
+        for (int i = 0; i < LENGTH; i++) {
+            array[i] = Integer.valueOf(i);
+        }
+
+        for (int r = 0; r < ROUNDS; r++) {
+            // Churn through garbage so that the array elements get evacuated.
+            for (int i = 0; i < 1000; i++) {
+                Object[] garbage = new Object[1024];
+            }
+            System.gc();
+
+            for (int i = 0; i < LENGTH; i++) {
+                if (array[i].intValue() != i) {
+                    throw new IllegalStateException("Element " + i + " is " + array[i]);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2021 SAP SE. All rights reserved.
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test verifies that the segments of a heap dump that are not
+ *          merged with -XX:-HeapDumpMergeSegments concatenate to a valid dump
+ * @library /test/lib
+ * @run driver/timeout=240 TestUnmergedHeapDumpOnOutOfMemoryError run 0
+ */
+
+/*
+ * @test
+ * @summary Same as above, with gzip compressed segments
+ * @library /test/lib
+ * @requires vm.flagless
+ * @run driver/timeout=240 TestUnmergedHeapDumpOnOutOfMemoryError run 1
+ */
+
+import jdk.test.lib.Asserts;
+import jdk.test.lib.hprof.HprofParser;
+import jdk.test.lib.process.ProcessTools;
+import jdk.test.lib.process.OutputAnalyzer;
+
+import java.io.File;
+import java.io.FileOutputStream;
+import java.nio.file.Files;
+
+public class TestUnmergedHeapDumpOnOutOfMemoryError {
+
+    static volatile Object[] oa;
+
+    public static void main(String[] args) throws Exception {
+        if (args.length == 2) {
+            test(Integer.parseInt(args[1]));
+            return;
+        }
+
+        try {
+            oa = new Object[Integer.MAX_VALUE];
+            throw new Error("OOME not triggered");
+        } catch (OutOfMemoryError err) {
+            // Ignore
+        }
+    }
+
+    static void test(int level) throws Exception {
+        ProcessBuilder pb = ProcessTools.createLimitedTestJavaProcessBuilder(
+            "-XX:+HeapDumpOnOutOfMemoryError",
+            "-XX:-HeapDumpMergeSegments",
+            "-XX:HeapDumpGzipLevel=" + level,
+            "-Xlog:heapdump",
+            "-Xmx128M",
+            TestUnmergedHeapDumpOnOutOfMemoryError.class.getName());
+
+        Process proc = pb.start();
+        String heapdumpFilename = "java_pid" + proc.pid() + ".hprof" + (level > 0 ? ".gz" : "");
+        OutputAnalyzer output = new OutputAnalyzer(proc);
+        output.stdoutShouldNotBeEmpty();
+        output.shouldContain("Dumping heap to " + heapdumpFilename);
+        output.shouldContain("Heap dump segments not merged");
+
+        File dump = new File(heapdumpFilename);
+        Asserts.assertTrue(dump.exists() && dump.isFile(),
+                "Could not find dump file " + dump.getAbsolutePath());
+
+        File merged = new File("merged_" + heapdumpFilename);
+        try (FileOutputStream out = new FileOutputStream(merged)) {
+            Files.copy(dump.toPath(), out);
+            int segments = 0;
+            for (File segment = new File(heapdumpFilename + ".p0"); segment.exists();
+                 segment = new File(heapdumpFilename + ".p" + ++segments)) {
+                Files.copy(segment.toPath(), out);
+            }
+            Asserts.assertGreaterThan(segments, 1, "Expected heap and end of dump segments");
+        }
+
+        HprofParser.parse(merged);
+        System.out.println("PASSED");
+    }
+
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Hidden classes get their metaspace from the micro arena freelists.
+ * @library /test/lib
+ * @run driver runtime.Metaspace.TestMicroArenas
+ */
+
+package runtime.Metaspace;
+
+import java.io.InputStream;
+import java.lang.invoke.MethodHandles;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestMicroArenas {
+
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer output = ProcessTools.executeTestJava(
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:+MetaspaceMicroArenas",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+PrintMetaspaceStatisticsAtExit",
+            "-cp", System.getProperty("test.class.path"),
+            App.class.getName());
+        output.shouldHaveExitValue(0);
+        output.shouldContain("of micro arenas:");
+        output.shouldContain("fragmented, in free chunks < granule:");
+    }
+
+    static class Hidden {}
+
+    static class App {
+        public static void main(String[] args) throws Exception {
+            byte[] bytes;
+            try (InputStream in = Hidden.class.getResourceAsStream("TestMicroArenas$Hidden.class")) {
+                bytes = in.readAllBytes();
+            }
+            MethodHandles.Lookup lookup = MethodHandles.lookup();
+            for (int i = 0; i < 1000; i++) {
+                lookup.defineHiddenClass(bytes, false);
+            }
+            System.gc();
+        }
+    }
+}
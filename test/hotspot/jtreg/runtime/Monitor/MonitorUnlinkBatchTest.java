@@ -60,6 +60,11 @@
  * @run driver MonitorUnlinkBatchTest lazy
  */
 
+/*
+ * @test id=partitioned
+ * @library /test/lib
+ * @run driver MonitorUnlinkBatchTest partitioned
+ */
 
 public class MonitorUnlinkBatchTest {
 
@@ -152,6 +157,25 @@ public static void main(String[] args) throws Exception {
                 );
                 break;
 
+            case "partitioned":
+                // Deflation of partitioned in-use lists, also with cycles ending
+                // in the middle of the partitions.
+                test("",
+                     "-XX:+UnlockExperimentalVMOptions",
+                     "-XX:MonitorInUseListPartitions=8"
+                );
+                test("",
+                     "-XX:+UnlockExperimentalVMOptions",
+                     "-XX:MonitorInUseListPartitions=64",
+                     "-XX:MonitorDeflationMax=1024",
+                     "-XX:MonitorUnlinkBatch=1"
+                );
+                test("outside the allowed range",
+                     "-XX:+UnlockExperimentalVMOptions",
+                     "-XX:MonitorInUseListPartitions=0"
+                );
+                break;
+
             default:
                 throw new IllegalArgumentException("Unknown test: " + test);
         }
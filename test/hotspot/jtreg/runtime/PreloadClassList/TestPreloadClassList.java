@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check that classes of a PreloadClassList are preloaded and reported.
+ * @library /test/lib
+ * @run driver runtime.PreloadClassList.TestPreloadClassList
+ */
+
+package runtime.PreloadClassList;
+
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.List;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestPreloadClassList {
+
+    public static void main(String[] args) throws Exception {
+        Path list = Path.of("preload.classlist");
+        Files.write(list, List.of(
+            "# NOTE: a comment",
+            "java/lang/Object id: 0",
+            binaryName(App.class),
+            binaryName(Used.class) + " id: 2",
+            binaryName(Unused.class),
+            "does/not/Exist",
+            "@lambda-proxy java/lang/Object run ()V"));
+
+        OutputAnalyzer output = ProcessTools.executeTestJava(
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:PreloadClassList=" + list,
+            "-XX:PreloadClassListThreads=2",
+            "-Xlog:class+preload=info",
+            "-cp", System.getProperty("test.class.path"),
+            App.class.getName());
+        output.shouldHaveExitValue(0);
+        output.shouldContain("Preloading 5 classes from " + list);
+        output.shouldMatch("Preloaded \\d of 5 classes");
+        output.shouldContain("preloaded classes used by the application");
+    }
+
+    static String binaryName(Class<?> c) {
+        return c.getName().replace('.', '/');
+    }
+
+    static class Used {
+        static int value = 42;
+    }
+
+    static class Unused {}
+
+    static class App {
+        public static void main(String[] args) throws Exception {
+            // Give the preloader time to get through the list.
+            Thread.sleep(1000);
+            System.out.println(Used.value);
+        }
+    }
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check that iload pairs rewritten at link time execute correctly,
+ *          including branches into the middle of a fused pair.
+ * @run main/othervm -Xint -XX:+UnlockExperimentalVMOptions -XX:+RewriteFrequentPairsAtLink
+ *                   TestRewriteFrequentPairsAtLink
+ */
+
+public class TestRewriteFrequentPairsAtLink {
+
+    static int pair(int a, int b) {
+        return a - b;           // iload_0, iload_1: not rewritten
+    }
+
+    static int run(int a, int b, int c, int d) {
+        int x = a;
+        int y = b;
+        int z = c;
+        int w = d;
+        return (x - y) * (z - w);   // iload runs of length 2
+    }
+
+    static int triple(int a, int b, int c, int d, int e) {
+        int x = a;
+        int y = b;
+        int z = c;
+        int w = 0;
+        for (int i = 0; i < e; i++) {
+            w += x * (y - z);       // iload run of length 3
+        }
+        return w;
+    }
+
+    static int chars(char[] cs, int a, int b, int c, int d) {
+        int sum = 0;
+        for (int i = a; i < b; i++) {
+            int j = i;
+            sum += cs[j];           // iload, caload
+        }
+        return sum + c - d;
+    }
+
+    static int branchy(int a, int b, int c, int d, boolean f) {
+        int x = a;
+        int y = b;
+        int z = c;
+        int v = f ? x : y;          // branch target in the middle of a run
+        return v - z + d;
+    }
+
+    public static void main(String[] args) {
+        char[] cs = "interpreter".toCharArray();
+        int expectedChars = 0;
+        for (char ch : cs) {
+            expectedChars += ch;
+        }
+        for (int i = 0; i < 1000; i++) {
+            check(pair(7, 3), 4);
+            check(run(9, 4, 8, 2), 30);
+            check(triple(2, 7, 4, 0, 5), 30);
+            check(chars(cs, 0, cs.length, 5, 2), expectedChars + 3);
+            check(branchy(1, 2, 3, 4, true), 2);
+            check(branchy(1, 2, 3, 4, false), 3);
+        }
+    }
+
+    static void check(int actual, int expected) {
+        if (actual != expected) {
+            throw new RuntimeException("expected " + expected + " but got " + actual);
+        }
+    }
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check that the threads slowest to reach a safepoint are logged.
+ * @library /test/lib
+ * @run driver runtime.Safepoint.TestSafepointSlowThreads
+ */
+
+package runtime.Safepoint;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestSafepointSlowThreads {
+
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer output = ProcessTools.executeTestJava(
+            "-Xlog:safepoint=debug",
+            Spinner.class.getName());
+        output.shouldHaveExitValue(0);
+        output.shouldMatch("Slow thread spinner-\\d reached safepoint after \\d+ ns");
+    }
+
+    static class Spinner {
+        static volatile boolean done;
+        static volatile long sink;
+
+        public static void main(String[] args) throws Exception {
+            Thread[] spinners = new Thread[4];
+            for (int i = 0; i < spinners.length; i++) {
+                spinners[i] = new Thread(() -> {
+                    long sum = 0;
+                    while (!done) {
+                        sum++;
+                    }
+                    sink = sum;
+                }, "spinner-" + i);
+                spinners[i].start();
+            }
+            // The spinning threads are running when the safepoints start.
+            for (int i = 0; i < 20; i++) {
+                Thread.sleep(10);
+                System.gc();
+            }
+            done = true;
+            for (Thread t : spinners) {
+                t.join();
+            }
+        }
+    }
+}
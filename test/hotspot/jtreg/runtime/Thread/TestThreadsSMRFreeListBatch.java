@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Churn threads while the retired ThreadsLists are reclaimed in batches.
+ * @library /test/lib
+ * @run driver TestThreadsSMRFreeListBatch
+ */
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestThreadsSMRFreeListBatch {
+
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer output = ProcessTools.executeTestJava(
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:ThreadsSMRFreeListBatch=16",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+EnableThreadSMRStatistics",
+            "-Xlog:thread+smr=info",
+            "-cp", System.getProperty("test.class.path"),
+            App.class.getName());
+        output.shouldHaveExitValue(0);
+        output.shouldContain("_to_delete_list_cnt=");
+    }
+
+    static class App {
+        public static void main(String[] args) throws Exception {
+            // Start and exit threads while others take ThreadsListHandles
+            // by querying thread state.
+            for (int round = 0; round < 100; round++) {
+                Thread[] threads = new Thread[16];
+                for (int i = 0; i < threads.length; i++) {
+                    threads[i] = new Thread(() -> Thread.getAllStackTraces());
+                    threads[i].start();
+                }
+                for (Thread t : threads) {
+                    t.join();
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary The archived heap region is mapped, not copied, with Shenandoah.
+ * @requires vm.cds.write.archived.java.heap
+ * @requires vm.gc.Shenandoah & vm.gc.G1
+ * @library /test/lib
+ * @run driver MapArchivedHeapShenandoah
+ */
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class MapArchivedHeapShenandoah {
+
+    public static void main(String[] args) throws Exception {
+        String archive = "MapArchivedHeapShenandoah.jsa";
+
+        OutputAnalyzer dump = ProcessTools.executeTestJava(
+            "-XX:+UseG1GC",
+            "-XX:SharedArchiveFile=" + archive,
+            "-Xshare:dump",
+            "-Xlog:cds");
+        dump.shouldHaveExitValue(0);
+
+        OutputAnalyzer run = ProcessTools.executeTestJava(
+            "-XX:+UseShenandoahGC",
+            "-XX:SharedArchiveFile=" + archive,
+            "-Xshare:auto",
+            "-Xlog:cds",
+            "-version");
+        run.shouldHaveExitValue(0);
+        if (run.getOutput().contains("Unable to use shared archive")) {
+            // The archive could not be mapped at all, e.g. because of ASLR.
+            return;
+        }
+        run.shouldContain("Heap data mapped at");
+        run.shouldNotContain("Cannot use CDS heap data");
+    }
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Resolved invokevirtual entries of classes from the dynamic archive are archived.
+ * @requires vm.cds
+ * @library /test/lib
+ * @run driver DynamicArchiveResolvedMethods
+ */
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class DynamicArchiveResolvedMethods {
+
+    public static void main(String[] args) throws Exception {
+        String archive = "DynamicArchiveResolvedMethods.jsa";
+        String cp = System.getProperty("test.class.path");
+
+        OutputAnalyzer dump = ProcessTools.executeTestJava(
+            "-XX:ArchiveClassesAtExit=" + archive,
+            "-Xlog:cds+resolve=trace",
+            "-cp", cp,
+            App.class.getName());
+        dump.shouldHaveExitValue(0);
+        dump.shouldMatch("archived method CP entry.*DynamicArchiveResolvedMethods\\$App DynamicArchiveResolvedMethods\\$Sub.zzz:\\(\\)I => DynamicArchiveResolvedMethods\\$Sub");
+
+        OutputAnalyzer run = ProcessTools.executeTestJava(
+            "-XX:SharedArchiveFile=" + archive,
+            "-cp", cp,
+            App.class.getName());
+        run.shouldHaveExitValue(0);
+        run.shouldContain("sum = 6");
+    }
+
+    static class Base {
+        int zzz() { return 1; }
+        int aaa() { return 2; }
+    }
+
+    static class Sub extends Base {
+        // Method sorting at dynamic dump time puts these in a different order
+        // than the class file does, which changes the vtable layout.
+        int zzz() { return 3; }
+        int mmm() { return 4; }
+    }
+
+    static class App {
+        public static void main(String[] args) {
+            int sum = 0;
+            for (int i = 0; i < 2; i++) {
+                Sub s = new Sub();
+                sum += s.zzz();
+            }
+            System.out.println("sum = " + sum);
+        }
+    }
+}
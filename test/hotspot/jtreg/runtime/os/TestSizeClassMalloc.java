@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Run with the size-class malloc, with and without NMT.
+ * @library /test/lib
+ * @requires vm.flagless
+ * @run driver runtime.os.TestSizeClassMalloc
+ */
+
+package runtime.os;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestSizeClassMalloc {
+
+    public static void main(String[] args) throws Exception {
+        for (String nmt : new String[] { "off", "summary", "detail" }) {
+            OutputAnalyzer output = ProcessTools.executeLimitedTestJava(
+                "-XX:+UnlockExperimentalVMOptions",
+                "-XX:+UseSizeClassMalloc",
+                "-XX:NativeMemoryTracking=" + nmt,
+                "-Xlog:malloc=info",
+                "-Xcomp",
+                "-cp", System.getProperty("test.class.path"),
+                App.class.getName());
+            output.shouldHaveExitValue(0);
+            output.shouldContain("Size-class malloc: reserved");
+        }
+    }
+
+    static class App {
+        public static void main(String[] args) throws Exception {
+            // Churn compiler and GC internal allocations from several threads
+            Thread[] threads = new Thread[4];
+            for (int i = 0; i < threads.length; i++) {
+                threads[i] = new Thread(() -> {
+                    StringBuilder sb = new StringBuilder();
+                    for (int j = 0; j < 10_000; j++) {
+                        sb.append(j);
+                        if (sb.length() > 1000) {
+                            sb.setLength(0);
+                        }
+                    }
+                });
+                threads[i].start();
+            }
+            for (Thread t : threads) {
+                t.join();
+            }
+            System.gc();
+        }
+    }
+}
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+import jdk.test.lib.dcmd.CommandExecutor;
+import jdk.test.lib.dcmd.JMXExecutor;
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.locks.LockSupport;
+
+import org.testng.annotations.AfterClass;
+import org.testng.annotations.BeforeClass;
+import org.testng.annotations.Test;
+
+/*
+ * @test
+ * @summary Test of diagnostic command Thread.vthread_dump
+ * @requires vm.continuations
+ * @library /test/lib
+ * @run testng VThreadDumpTest
+ */
+public class VThreadDumpTest {
+    private static final int THREAD_COUNT = 10;
+
+    private final List<Thread> threads = new ArrayList<>();
+    private volatile boolean done;
+
+    @BeforeClass
+    public void startThreads() throws Exception {
+        CountDownLatch started = new CountDownLatch(THREAD_COUNT);
+        for (int i = 0; i < THREAD_COUNT; i++) {
+            threads.add(Thread.ofVirtual().name("dumped-" + i).start(() -> {
+                started.countDown();
+                while (!done) {
+                    LockSupport.park();
+                }
+            }));
+        }
+        started.await();
+        // wait for all of them to park
+        for (Thread t : threads) {
+            while (t.getState() != Thread.State.WAITING) {
+                Thread.sleep(10);
+            }
+        }
+    }
+
+    @AfterClass
+    public void stopThreads() throws Exception {
+        done = true;
+        for (Thread t : threads) {
+            LockSupport.unpark(t);
+            t.join();
+        }
+    }
+
+    public void run(CommandExecutor executor) throws Exception {
+        OutputAnalyzer output = executor.execute("Thread.vthread_dump -state=parked");
+        output.shouldContain("\"virtualThreadDump\"");
+        output.shouldContain("\"threads\"");
+        output.shouldContain("\"name\": \"dumped-0\"");
+        output.shouldContain("\"name\": \"dumped-" + (THREAD_COUNT - 1) + "\"");
+        output.shouldContain("\"state\": \"PARKED\"");
+        output.shouldContain("java.util.concurrent.locks.LockSupport.park");
+
+        // all the parked threads have the same stack
+        output = executor.execute("Thread.vthread_dump -grouped -state=parked");
+        output.shouldContain("\"stackGroups\"");
+        output.shouldMatch("\"count\": \"([1-9][0-9]+)\"");
+        output.shouldNotContain("\"name\": \"dumped-0\"");
+
+        output = executor.execute("Thread.vthread_dump -state=blocked,waiting");
+        output.shouldNotContain("\"name\": \"dumped-0\"");
+
+        Path file = Files.createTempFile(Path.of("."), "vthreads", ".json");
+        output = executor.execute("Thread.vthread_dump " + file);
+        output.shouldContain("already exists");
+        output = executor.execute("Thread.vthread_dump -overwrite -state=parked " + file);
+        output.shouldContain("Created " + file);
+        String json = Files.readString(file);
+        if (!json.contains("\"name\": \"dumped-0\"") || !json.trim().endsWith("}")) {
+            throw new RuntimeException("Unexpected dump file contents: " + json);
+        }
+    }
+
+    @Test
+    public void jmx() throws Exception {
+        run(new JMXExecutor());
+    }
+
+    @Test
+    public void cli() throws Exception {
+        run(new PidJcmdExecutor());
+    }
+}
@@ -38,5 +38,9 @@
  * @run main/othervm/native
  *      -agentlib:ConcreteKlassFilter=-waittime=5
  *      nsk.jvmti.IterateThroughHeap.concrete_klass_filter.ConcreteKlassFilter
+ * @run main/othervm/native
+ *      -XX:+UnlockExperimentalVMOptions -XX:+JvmtiParallelHeapIteration
+ *      -agentlib:ConcreteKlassFilter=-waittime=5
+ *      nsk.jvmti.IterateThroughHeap.concrete_klass_filter.ConcreteKlassFilter
  */
 
@@ -66,5 +66,9 @@
  * @run main/othervm/native
  *      -agentlib:HeapFilter=-waittime=5,filter=JVMTI_HEAP_FILTER_TAGGED
  *      nsk.jvmti.IterateThroughHeap.filter_tagged.HeapFilter
+ * @run main/othervm/native
+ *      -XX:+UnlockExperimentalVMOptions -XX:+JvmtiParallelHeapIteration
+ *      -agentlib:HeapFilter=-waittime=5,filter=JVMTI_HEAP_FILTER_TAGGED
+ *      nsk.jvmti.IterateThroughHeap.filter_tagged.HeapFilter
  */
 
@@ -120,6 +120,15 @@
  * @run junit/othervm -Xcomp -XX:-TieredCompilation -XX:LockingMode=2 --enable-native-access=ALL-UNNAMED MonitorEnterExit
  */
 
+/*
+ * @test id=VThreadAdaptiveSpin
+ * @requires os.arch=="amd64" | os.arch=="x86_64" | os.arch=="aarch64" | os.arch=="riscv64"
+ * @modules java.base/java.lang:+open jdk.management
+ * @library /test/lib
+ * @build LockingMode
+ * @run junit/othervm -XX:+UnlockExperimentalVMOptions -XX:+VThreadAdaptiveSpin --enable-native-access=ALL-UNNAMED MonitorEnterExit
+ */
+
 import java.time.Duration;
 import java.util.ArrayList;
 import java.util.List;
@@ -30,6 +30,15 @@
  * @run main ParkWithFixedThreadPool
  */
 
+/*
+ * @test id=tlab-size-hints
+ * @summary Test virtual thread park with a fixed thread pool and TLAB size hints
+ * @requires vm.continuations
+ * @modules java.base/java.lang:+open
+ * @library /test/lib
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+VirtualThreadTLABSizeHints ParkWithFixedThreadPool
+ */
+
 import java.util.concurrent.*;
 import java.util.concurrent.atomic.*;
 import java.util.concurrent.locks.LockSupport;
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test the jdk.VirtualThreadCPUTime event with -XX:+VirtualThreadCPUTime
+ * @requires vm.continuations & vm.hasJFR
+ * @modules jdk.jfr
+ * @library /test/lib
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+VirtualThreadCPUTime VirtualThreadCPUTime
+ */
+
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.Comparator;
+import java.util.List;
+
+import jdk.jfr.Recording;
+import jdk.jfr.consumer.RecordedEvent;
+import jdk.jfr.consumer.RecordingFile;
+import jdk.test.lib.Asserts;
+
+public class VirtualThreadCPUTime {
+    private static final int MOUNTS = 5;
+    private static volatile long sink;
+
+    public static void main(String[] args) throws Exception {
+        try (Recording recording = new Recording()) {
+            recording.enable("jdk.VirtualThreadCPUTime");
+            recording.start();
+
+            Thread vthread = Thread.ofVirtual().start(() -> {
+                for (int i = 0; i < MOUNTS; i++) {
+                    spin(20_000_000L);
+                    try {
+                        Thread.sleep(10); // unmounts
+                    } catch (InterruptedException e) {
+                        throw new RuntimeException(e);
+                    }
+                }
+            });
+            vthread.join();
+
+            recording.stop();
+            Path path = Files.createTempFile("cputime", ".jfr");
+            recording.dump(path);
+            List<RecordedEvent> events = RecordingFile.readAllEvents(path).stream()
+                .filter(e -> e.getThread() != null && e.getThread().getJavaThreadId() == vthread.threadId())
+                .sorted(Comparator.comparing(RecordedEvent::getStartTime))
+                .toList();
+            System.out.println(events);
+
+            Asserts.assertGreaterThanOrEqual(events.size(), MOUNTS, "one event per unmount expected");
+            long previousTotal = 0;
+            for (RecordedEvent e : events) {
+                long cpuTime = e.getLong("cpuTime");
+                long totalCpuTime = e.getLong("totalCpuTime");
+                Asserts.assertGreaterThanOrEqual(cpuTime, 0L);
+                Asserts.assertEquals(previousTotal + cpuTime, totalCpuTime, "totals must add up");
+                previousTotal = totalCpuTime;
+            }
+            Asserts.assertGreaterThan(previousTotal, 0L);
+        }
+    }
+
+    // Busy for about the given wall clock time
+    private static void spin(long nanos) {
+        long end = System.nanoTime() + nanos;
+        long x = 0;
+        while (System.nanoTime() < end) {
+            x++;
+        }
+        sink = x;
+    }
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check CRC32 computed by libzip, which folds long inputs with
+ *          carry-less multiplication where available, against a table
+ *          driven reference for unaligned offsets and many lengths
+ * @key randomness
+ * @library /test/lib
+ * @build jdk.test.lib.RandomFactory
+ * @run main/othervm -XX:+IgnoreUnrecognizedVMOptions -XX:-UseCRC32Intrinsics NativeCRC32Test
+ * @run main/othervm NativeCRC32Test
+ */
+
+import java.nio.ByteBuffer;
+import java.util.Random;
+import java.util.zip.CRC32;
+
+import jdk.test.lib.RandomFactory;
+
+public class NativeCRC32Test {
+    private static final int[] TABLE = new int[256];
+
+    static {
+        for (int n = 0; n < 256; n++) {
+            int c = n;
+            for (int k = 0; k < 8; k++) {
+                c = (c & 1) != 0 ? 0xEDB88320 ^ (c >>> 1) : c >>> 1;
+            }
+            TABLE[n] = c;
+        }
+    }
+
+    private static long reference(long crc, byte[] b, int off, int len) {
+        int c = ~(int)crc;
+        for (int i = off; i < off + len; i++) {
+            c = TABLE[(c ^ b[i]) & 0xFF] ^ (c >>> 8);
+        }
+        return ~c & 0xFFFFFFFFL;
+    }
+
+    private static void check(String what, int off, int len, long expected, long actual) {
+        if (expected != actual) {
+            throw new RuntimeException(what + " off=" + off + " len=" + len + ": expected 0x" +
+                                       Long.toHexString(expected) + ", got 0x" + Long.toHexString(actual));
+        }
+    }
+
+    private static void checkArray(byte[] data, int off, int len) {
+        long expected = reference(0, data, off, len);
+        CRC32 crc = new CRC32();
+        crc.update(data, off, len);
+        check("array", off, len, expected, crc.getValue());
+
+        // Continue from a non-zero crc, split at an unaligned point
+        int split = len / 3;
+        crc.reset();
+        crc.update(data, off, split);
+        crc.update(data, off + split, len - split);
+        check("split array", off, len, expected, crc.getValue());
+    }
+
+    private static void checkDirect(ByteBuffer direct, byte[] data, int off, int len) {
+        long expected = reference(0, data, off, len);
+        CRC32 crc = new CRC32();
+        crc.update(direct.slice(off, len));
+        check("direct buffer", off, len, expected, crc.getValue());
+    }
+
+    public static void main(String[] args) {
+        Random rnd = RandomFactory.getRandom();
+        byte[] data = new byte[1 << 20];
+        rnd.nextBytes(data);
+        ByteBuffer direct = ByteBuffer.allocateDirect(data.length);
+        direct.put(data).clear();
+
+        // Around the length where the folding kicks in, for every alignment
+        for (int off = 0; off < 32; off++) {
+            for (int len = 0; len <= 300; len++) {
+                checkArray(data, off, len);
+                checkDirect(direct, data, off, len);
+            }
+        }
+        // Long inputs, ending at any position modulo the 64 byte folding width
+        for (int i = 0; i < 200; i++) {
+            int off = rnd.nextInt(64);
+            int len = rnd.nextInt(data.length - off);
+            checkArray(data, off, len);
+            checkDirect(direct, data, off, len);
+        }
+        checkArray(data, 0, data.length);
+        checkDirect(direct, data, 0, data.length);
+    }
+}
@@ -1,5 +1,5 @@
 /*
-* Copyright (c) 2018, 2023, Oracle and/or its affiliates. All rights reserved.
+* Copyright (c) 2018, 2024, Oracle and/or its affiliates. All rights reserved.
 * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
 *
 * This code is free software; you can redistribute it and/or modify it
@@ -38,6 +38,49 @@
 * @run testng/othervm -XX:+UnlockDiagnosticVMOptions -XX:+ShowHiddenFrames -Xcomp -XX:-TieredCompilation -XX:CompileOnly=jdk.internal.vm.Continuation::*,Basic::* -XX:CompileCommand=exclude,Basic.manyArgsDriver Basic
 * @run testng/othervm -XX:+UnlockDiagnosticVMOptions -XX:+ShowHiddenFrames -Xcomp -XX:-TieredCompilation -XX:CompileOnly=jdk.internal.vm.Continuation::*,Basic::* -XX:CompileCommand=exclude,jdk/internal/vm/Continuation.enter Basic
 * @run testng/othervm -XX:+UnlockDiagnosticVMOptions -XX:+ShowHiddenFrames -Xcomp -XX:-TieredCompilation -XX:CompileOnly=jdk.internal.vm.Continuation::*,Basic::* -XX:CompileCommand=inline,jdk/internal/vm/Continuation.run Basic
+* @run testng/othervm -XX:+UnlockDiagnosticVMOptions -XX:+UnlockExperimentalVMOptions -XX:+ShowHiddenFrames -Xcomp -XX:-TieredCompilation -XX:CompileOnly=jdk.internal.vm.Continuation::*,Basic::* -XX:ContinuationFullThawThreshold=0 -XX:ContinuationLazyThawBatchFrames=3 Basic
+* @run testng/othervm -XX:+UnlockDiagnosticVMOptions -XX:+UnlockExperimentalVMOptions -XX:+ShowHiddenFrames -Xcomp -XX:-TieredCompilation -XX:CompileOnly=jdk.internal.vm.Continuation::*,Basic::* -XX:+UseStackChunkCache Basic
+* @run testng/othervm -XX:+UnlockDiagnosticVMOptions -XX:+UnlockExperimentalVMOptions -XX:+ShowHiddenFrames -Xcomp -XX:-TieredCompilation -XX:CompileOnly=jdk.internal.vm.Continuation::*,Basic::* -XX:+PresizeStackChunks -XX:-UseStackChunkCache Basic
+* @run testng/othervm -XX:+UnlockDiagnosticVMOptions -XX:+UnlockExperimentalVMOptions -XX:+ShowHiddenFrames -Xcomp -XX:-TieredCompilation -XX:CompileOnly=jdk.internal.vm.Continuation::*,Basic::* -XX:+PresizeStackChunks -XX:+UseStackChunkCache Basic
+* @run testng/othervm -XX:+UnlockDiagnosticVMOptions -XX:+UnlockExperimentalVMOptions -XX:+ShowHiddenFrames -Xcomp -XX:-TieredCompilation -XX:CompileOnly=jdk.internal.vm.Continuation::*,Basic::* -XX:+ContinuationAdaptiveThaw Basic
+*/
+
+/**
+* @test id=g1-no-bitmap
+* @summary Stack chunks walked by frames instead of a bitmap under G1
+* @requires vm.continuations
+* @requires vm.gc.G1
+* @modules java.base/jdk.internal.vm
+* @library /test/lib
+* @build java.base/java.lang.StackWalkerHelper
+*
+* @run testng/othervm -XX:+UnlockDiagnosticVMOptions -XX:+UnlockExperimentalVMOptions -XX:+ShowHiddenFrames -Xcomp -XX:-TieredCompilation -XX:CompileOnly=jdk.internal.vm.Continuation::*,Basic::* -XX:+UseG1GC -XX:StackChunkBitmapMinWords=1000000 Basic
+*/
+
+/**
+* @test id=parallel-no-bitmap
+* @summary Stack chunks walked by frames instead of a bitmap under Parallel GC
+* @requires vm.continuations
+* @requires vm.gc.Parallel
+* @modules java.base/jdk.internal.vm
+* @library /test/lib
+* @build java.base/java.lang.StackWalkerHelper
+*
+* @run testng/othervm -XX:+UnlockDiagnosticVMOptions -XX:+UnlockExperimentalVMOptions -XX:+ShowHiddenFrames -Xcomp -XX:-TieredCompilation -XX:CompileOnly=jdk.internal.vm.Continuation::*,Basic::* -XX:+UseParallelGC -XX:StackChunkBitmapMinWords=1000000 Basic
+*/
+
+/**
+* @test id=g1-trim
+* @summary Trimming of stack chunks when G1 evacuates them in a young collection
+* @requires vm.continuations
+* @requires vm.gc.G1
+* @modules java.base/jdk.internal.vm
+* @library /test/lib
+* @build java.base/java.lang.StackWalkerHelper
+* @build jdk.test.whitebox.WhiteBox
+* @run driver jdk.test.lib.helpers.ClassFileInstaller jdk.test.whitebox.WhiteBox
+*
+* @run testng/othervm -XX:+UnlockDiagnosticVMOptions -XX:+UnlockExperimentalVMOptions -XX:+ShowHiddenFrames -XX:+WhiteBoxAPI -Xbootclasspath/a:. -Xcomp -XX:-TieredCompilation -XX:CompileOnly=jdk.internal.vm.Continuation::*,Basic::* -XX:+UseG1GC -XX:+TrimStackChunks -XX:TrimStackChunksMinWords=2 -DBasic.youngGC=true Basic
 */
 
 /**
@@ -57,6 +100,7 @@
 import jdk.internal.vm.ContinuationScope;
 
 import jdk.test.lib.Platform;
+import jdk.test.whitebox.WhiteBox;
 
 import java.util.ArrayList;
 import java.util.Arrays;
@@ -74,6 +118,17 @@
 public class Basic {
     static final ContinuationScope FOO = new ContinuationScope() {};
 
+    // Young collections evacuate the stack chunks instead of marking them in place
+    static final boolean YOUNG_GC = Boolean.getBoolean("Basic.youngGC");
+
+    static void gc() {
+        if (YOUNG_GC) {
+            WhiteBox.getWhiteBox().youngGC();
+        } else {
+            System.gc();
+        }
+    }
+
     @Test
     public void test1() {
         // Basic freeze and thaw
@@ -91,7 +146,7 @@ public void test1() {
         int i = 0;
         while (!cont.isDone()) {
             cont.run();
-            System.gc();
+            gc();
 
             assertEquals(cont.isPreempted(), false);
 
@@ -227,7 +282,7 @@ public void testManyArgs() {
         int i = 0;
         while (!cont.isDone()) {
             cont.run();
-            System.gc();
+            gc();
         }
         assertEquals(res.get(), 247);
     }
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package org.openjdk.bench.java.lang;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OperationsPerInvocation;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+import org.openjdk.jmh.infra.Blackhole;
+
+import java.util.concurrent.ThreadFactory;
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Measures contended monitor enter/exit, where a virtual thread that cannot
+ * acquire the monitor unmounts instead of blocking its carrier, and the
+ * handoff of a monitor between two threads taking turns with Object.wait and
+ * Object.notify.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@Warmup(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@Measurement(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@State(Scope.Thread)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@Fork(3)
+public class VirtualThreadMonitors {
+
+    static final int ROUNDS = 10_000;
+
+    @Param({"virtual", "platform"})
+    public String kind;
+
+    @State(Scope.Thread)
+    public static class Contention {
+        @Param({"2", "8", "32"})
+        public int threads;
+
+        @Param({"0", "100"})
+        public int work;
+    }
+
+    ThreadFactory factory;
+
+    final Object lock = new Object();
+
+    int counter;
+
+    int turn;
+
+    @Setup
+    public void setup() {
+        factory = kind.equals("virtual") ? Thread.ofVirtual().factory() : Thread.ofPlatform().factory();
+    }
+
+    private void runAll(Runnable task, int count) throws InterruptedException {
+        Thread[] ts = new Thread[count];
+        for (int i = 0; i < count; i++) {
+            ts[i] = factory.newThread(task);
+        }
+        for (Thread t : ts) {
+            t.start();
+        }
+        for (Thread t : ts) {
+            t.join();
+        }
+    }
+
+    @Benchmark
+    @OperationsPerInvocation(ROUNDS)
+    public int contendedEnter(Contention contention) throws InterruptedException {
+        counter = 0;
+        int perThread = ROUNDS / contention.threads;
+        int work = contention.work;
+        runAll(() -> {
+            for (int i = 0; i < perThread; i++) {
+                synchronized (lock) {
+                    counter++;
+                    Blackhole.consumeCPU(work);
+                }
+            }
+        }, contention.threads);
+        return counter;
+    }
+
+    private void handoff(int me) {
+        synchronized (lock) {
+            for (int i = 0; i < ROUNDS; i++) {
+                try {
+                    while (turn != me) {
+                        lock.wait();
+                    }
+                } catch (InterruptedException e) {
+                    throw new RuntimeException(e);
+                }
+                turn = 1 - me;
+                lock.notify();
+            }
+        }
+    }
+
+    @Benchmark
+    @OperationsPerInvocation(ROUNDS)
+    public void waitNotify() throws InterruptedException {
+        turn = 0;
+        Thread t0 = factory.newThread(() -> handoff(0));
+        Thread t1 = factory.newThread(() -> handoff(1));
+        t0.start();
+        t1.start();
+        t0.join();
+        t1.join();
+    }
+}
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package org.openjdk.bench.java.lang;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OperationsPerInvocation;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.ThreadFactory;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.locks.LockSupport;
+
+/**
+ * Measures park/unpark handoffs between two threads taking turns, with an
+ * untimed park, and with a timed park that is always unparked before its
+ * timeout so that every round arms and cancels a scheduler timer. Also measures
+ * a short timed park that runs to expiry.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@Warmup(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@Measurement(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@State(Scope.Thread)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@Fork(3)
+public class VirtualThreadParking {
+
+    static final int ROUNDS = 10_000;
+
+    @Param({"virtual", "platform"})
+    public String kind;
+
+    ThreadFactory factory;
+
+    volatile int turn;
+
+    @Setup
+    public void setup() {
+        factory = kind.equals("virtual") ? Thread.ofVirtual().factory() : Thread.ofPlatform().factory();
+    }
+
+    private void pingPong(boolean timed) throws InterruptedException {
+        turn = 0;
+        Thread[] players = new Thread[2];
+        for (int i = 0; i < 2; i++) {
+            int me = i;
+            players[i] = factory.newThread(() -> play(me, players[1 - me], timed));
+        }
+        players[0].start();
+        players[1].start();
+        players[0].join();
+        players[1].join();
+    }
+
+    private void play(int me, Thread other, boolean timed) {
+        for (int i = 0; i < ROUNDS; i++) {
+            while (turn != me) {
+                if (timed) {
+                    LockSupport.parkNanos(TimeUnit.SECONDS.toNanos(10));
+                } else {
+                    LockSupport.park();
+                }
+            }
+            turn = 1 - me;
+            LockSupport.unpark(other);
+        }
+    }
+
+    @Benchmark
+    @OperationsPerInvocation(ROUNDS)
+    public void parkUnpark() throws InterruptedException {
+        pingPong(false);
+    }
+
+    @Benchmark
+    @OperationsPerInvocation(ROUNDS)
+    public void timedParkUnpark() throws InterruptedException {
+        pingPong(true);
+    }
+
+    @Fork(value = 3, jvmArgsAppend = {"-Djdk.virtualThreadScheduler.parallelism=1"})
+    @Benchmark
+    @OperationsPerInvocation(ROUNDS)
+    public void parkUnparkOneCarrier() throws InterruptedException {
+        pingPong(false);
+    }
+
+    @Benchmark
+    @OperationsPerInvocation(ROUNDS / 10)
+    public void timedParkExpire() throws InterruptedException {
+        Thread t = factory.newThread(() -> {
+            for (int i = 0; i < ROUNDS / 10; i++) {
+                LockSupport.parkNanos(1_000);
+            }
+        });
+        t.start();
+        t.join();
+    }
+}
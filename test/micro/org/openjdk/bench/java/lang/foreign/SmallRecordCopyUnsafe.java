@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.java.lang.foreign;
+
+import java.lang.foreign.Arena;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+import sun.misc.Unsafe;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Copies and fills of small records whose size is a compile-time constant,
+ * as done by off-heap serializers. Run again with
+ * -XX:UnsafeCopyMemoryInlineLimit=0 to compare with the stub call.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@Warmup(iterations = 5, time = 500, timeUnit = TimeUnit.MILLISECONDS)
+@Measurement(iterations = 10, time = 500, timeUnit = TimeUnit.MILLISECONDS)
+@State(org.openjdk.jmh.annotations.Scope.Thread)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@Fork(value = 3, jvmArgsAppend = {"--enable-native-access=ALL-UNNAMED",
+                                  "-XX:+UnlockExperimentalVMOptions",
+                                  "-XX:UnsafeCopyMemoryInlineLimit=64"})
+public class SmallRecordCopyUnsafe {
+
+    static final Unsafe UNSAFE = Utils.unsafe;
+
+    long src;
+    long dst;
+    byte[] heap;
+
+    @Setup
+    public void setup() {
+        src = Arena.global().allocate(64).address();
+        dst = Arena.global().allocate(64).address();
+        heap = new byte[64];
+    }
+
+    @Benchmark
+    public void copy8() {
+        UNSAFE.copyMemory(src, dst, 8);
+    }
+
+    @Benchmark
+    public void copy13() {
+        UNSAFE.copyMemory(src, dst, 13);
+    }
+
+    @Benchmark
+    public void copy32() {
+        UNSAFE.copyMemory(src, dst, 32);
+    }
+
+    @Benchmark
+    public void copy64() {
+        UNSAFE.copyMemory(src, dst, 64);
+    }
+
+    @Benchmark
+    public void copyToHeap32() {
+        UNSAFE.copyMemory(null, src, heap, Unsafe.ARRAY_BYTE_BASE_OFFSET, 32);
+    }
+
+    @Benchmark
+    public void fill32() {
+        UNSAFE.setMemory(dst, 32, (byte) 0);
+    }
+}
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package org.openjdk.bench.java.net;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OperationsPerInvocation;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.TearDown;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.io.IOException;
+import java.io.InputStream;
+import java.io.OutputStream;
+import java.io.UncheckedIOException;
+import java.net.InetAddress;
+import java.net.InetSocketAddress;
+import java.net.ServerSocket;
+import java.net.Socket;
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Measures a request/response round trip over a loopback connection between
+ * two virtual threads. Each read finds no data available and parks the reader
+ * until the poller sees the socket become readable.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@Warmup(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@Measurement(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@State(Scope.Thread)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@Fork(3)
+public class VirtualThreadSocketIO {
+
+    static final int ROUNDS = 1_000;
+
+    @Param({"16", "8192"})
+    public int size;
+
+    ServerSocket listener;
+    Socket client;
+    Socket server;
+    Thread echo;
+    byte[] message;
+
+    @Setup
+    public void setup() throws IOException {
+        InetAddress lb = InetAddress.getLoopbackAddress();
+        listener = new ServerSocket(0, 1, lb);
+        client = new Socket();
+        client.connect(new InetSocketAddress(lb, listener.getLocalPort()));
+        client.setTcpNoDelay(true);
+        server = listener.accept();
+        server.setTcpNoDelay(true);
+        message = new byte[size];
+        echo = Thread.ofVirtual().start(this::echo);
+    }
+
+    @TearDown
+    public void teardown() throws Exception {
+        client.close();
+        echo.join();
+        server.close();
+        listener.close();
+    }
+
+    private static void readFully(InputStream in, byte[] b) throws IOException {
+        int n = 0;
+        while (n < b.length) {
+            int r = in.read(b, n, b.length - n);
+            if (r < 0) {
+                throw new IOException("unexpected EOF");
+            }
+            n += r;
+        }
+    }
+
+    private void echo() {
+        byte[] buf = new byte[size];
+        try (InputStream in = server.getInputStream(); OutputStream out = server.getOutputStream()) {
+            while (true) {
+                int n = 0;
+                while (n < buf.length) {
+                    int r = in.read(buf, n, buf.length - n);
+                    if (r < 0) {
+                        return;
+                    }
+                    n += r;
+                }
+                out.write(buf);
+            }
+        } catch (IOException e) {
+            // the client closed the connection
+        }
+    }
+
+    @Benchmark
+    @OperationsPerInvocation(ROUNDS)
+    public void readWrite() throws InterruptedException {
+        Thread t = Thread.ofVirtual().start(() -> {
+            try {
+                InputStream in = client.getInputStream();
+                OutputStream out = client.getOutputStream();
+                for (int i = 0; i < ROUNDS; i++) {
+                    out.write(message);
+                    readFully(in, message);
+                }
+            } catch (IOException e) {
+                throw new UncheckedIOException(e);
+            }
+        });
+        t.join();
+    }
+}
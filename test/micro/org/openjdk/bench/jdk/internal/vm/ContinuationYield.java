@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package org.openjdk.bench.jdk.internal.vm;
+
+import jdk.internal.vm.Continuation;
+import jdk.internal.vm.ContinuationScope;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.CompilerControl;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Measures a yield/continue round trip of a continuation that yields at a
+ * given stack depth, i.e. one freeze and one thaw of {@code depth} compiled
+ * or interpreted frames, each with {@code frameSize} words of live locals.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@Warmup(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@Measurement(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@State(Scope.Thread)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@Fork(value = 3, jvmArgsAppend = {"--add-exports", "java.base/jdk.internal.vm=ALL-UNNAMED"})
+public class ContinuationYield {
+
+    static final ContinuationScope SCOPE = new ContinuationScope("ContinuationYield");
+
+    @Param({"1", "5", "10", "20", "50", "100"})
+    public int depth;
+
+    @Param({"1", "8"})
+    public int frameSize;
+
+    @Param({"compiled", "interpreted"})
+    public String frames;
+
+    Continuation cont;
+
+    @Setup
+    public void setup() {
+        cont = new Continuation(SCOPE, this::body);
+        cont.run(); // run to the first yield
+    }
+
+    private void body() {
+        boolean interpreted = frames.equals("interpreted");
+        while (true) {
+            if (interpreted) {
+                if (frameSize == 1) {
+                    recurseSmallInterpreted(depth);
+                } else {
+                    recurseLargeInterpreted(depth);
+                }
+            } else {
+                if (frameSize == 1) {
+                    recurseSmall(depth);
+                } else {
+                    recurseLarge(depth);
+                }
+            }
+        }
+    }
+
+    @CompilerControl(CompilerControl.Mode.DONT_INLINE)
+    private static long recurseSmall(int depth) {
+        if (depth > 1) {
+            return recurseSmall(depth - 1) + 1;
+        }
+        Continuation.yield(SCOPE);
+        return 0;
+    }
+
+    @CompilerControl(CompilerControl.Mode.DONT_INLINE)
+    private static long recurseLarge(int depth) {
+        // keep values live across the call so they are spilled into the frame
+        long a = depth, b = a * 3, c = b * 5, d = c * 7, e = d * 11, f = e * 13, g = f * 17;
+        long r;
+        if (depth > 1) {
+            r = recurseLarge(depth - 1);
+        } else {
+            Continuation.yield(SCOPE);
+            r = 0;
+        }
+        return r + a + b + c + d + e + f + g;
+    }
+
+    @CompilerControl(CompilerControl.Mode.EXCLUDE)
+    private static long recurseSmallInterpreted(int depth) {
+        if (depth > 1) {
+            return recurseSmallInterpreted(depth - 1) + 1;
+        }
+        Continuation.yield(SCOPE);
+        return 0;
+    }
+
+    @CompilerControl(CompilerControl.Mode.EXCLUDE)
+    private static long recurseLargeInterpreted(int depth) {
+        long a = depth, b = a * 3, c = b * 5, d = c * 7, e = d * 11, f = e * 13, g = f * 17;
+        long r;
+        if (depth > 1) {
+            r = recurseLargeInterpreted(depth - 1);
+        } else {
+            Continuation.yield(SCOPE);
+            r = 0;
+        }
+        return r + a + b + c + d + e + f + g;
+    }
+
+    @Benchmark
+    public void yieldAndContinue() {
+        cont.run();
+    }
+
+    @Fork(value = 3, jvmArgsAppend = {"--add-exports", "java.base/jdk.internal.vm=ALL-UNNAMED",
+                                      "-XX:+UnlockExperimentalVMOptions", "-XX:ContinuationCopyStubThreshold=64"})
+    @Benchmark
+    public void yieldAndContinueCopyStub() {
+        cont.run();
+    }
+
+    @Fork(value = 3, jvmArgsAppend = {"--add-exports", "java.base/jdk.internal.vm=ALL-UNNAMED",
+                                      "-XX:+UnlockExperimentalVMOptions", "-XX:ContinuationCopyStubThreshold=64",
+                                      "-XX:+ContinuationCopyPrefetchDestination"})
+    @Benchmark
+    public void yieldAndContinueCopyStubPrefetch() {
+        cont.run();
+    }
+}